@@ -36,6 +36,7 @@
 #include "cpl_vsi.h"
 #include "cpl_worker_thread_pool.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
 constexpr double TO_RADIANS = M_PI / 180.0;
 
@@ -3274,6 +3275,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
         nThreads = atoi(pszThreads);
     if (nThreads > 128)
         nThreads = 128;
+    nThreads = std::min(nThreads, GDALGetMaxNumThreads());
     if (nThreads > 1)
     {
         psContext->poWorkerThreadPool = new CPLWorkerThreadPool();
@@ -33,6 +33,7 @@
 #include "../frmts/vrt/vrtdataset.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 // #include "gdalsse_priv.h"
 
 // Limit types to practical use cases.
@@ -458,19 +459,11 @@ GDALPansharpenOperation::Initialize(const GDALPansharpenOptions *psOptionsIn)
     // Setup thread pool.
     int nThreads = psOptions->nThreads;
     if (nThreads == -1)
-        nThreads = CPLGetNumCPUs();
+        nThreads = GDALGetNumThreads("ALL_CPUS");
     else if (nThreads == 0)
-    {
-        const char *pszNumThreads =
-            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
-        if (pszNumThreads)
-        {
-            if (EQUAL(pszNumThreads, "ALL_CPUS"))
-                nThreads = CPLGetNumCPUs();
-            else
-                nThreads = std::max(0, std::min(128, atoi(pszNumThreads)));
-        }
-    }
+        nThreads = GDALGetNumThreads(nullptr, nullptr, "1", 128);
+    else
+        nThreads = std::min(nThreads, GDALGetMaxNumThreads());
     if (nThreads > 1)
     {
         CPLDebug("PANSHARPEN", "Using %d threads", nThreads);
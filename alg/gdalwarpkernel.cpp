@@ -309,20 +309,10 @@ void *GWKThreadsCreate(char **papszWarpOptions,
                        GDALTransformerFunc /* pfnTransformer */,
                        void *pTransformerArg)
 {
-    const char *pszWarpThreads =
-        CSLFetchNameValue(papszWarpOptions, "NUM_THREADS");
-    if (pszWarpThreads == nullptr)
-        pszWarpThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
-
-    int nThreads = 0;
-    if (EQUAL(pszWarpThreads, "ALL_CPUS"))
-        nThreads = CPLGetNumCPUs();
-    else
-        nThreads = atoi(pszWarpThreads);
+    int nThreads =
+        GDALGetNumThreads(papszWarpOptions, "NUM_THREADS", "1", 128);
     if (nThreads <= 1)
         nThreads = 0;
-    if (nThreads > 128)
-        nThreads = 128;
 
     GWKThreadData *psThreadData = new GWKThreadData();
     auto poThreadPool =
@@ -38,6 +38,7 @@
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_alg_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 
@@ -1201,6 +1202,14 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
                                             int nDstXSize, int nDstYSize)
 
 {
+    // Overlapping I/O and computation requires a second thread.
+    if (GDALGetMaxNumThreads() < 2)
+    {
+        CPLDebug("GDAL", "ChunkAndWarpMulti() limited to a single thread, "
+                         "due to GDAL_MAX_NUM_THREADS");
+        return ChunkAndWarpImage(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
+    }
+
     hIOMutex = CPLCreateMutex();
     hWarpMutex = CPLCreateMutex();
 
@@ -1865,51 +1865,101 @@ bool GDALAbstractPipelineAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     }
 
     // Because of multiprocessing in gdal raster tile, make sure that all
-    // steps before it are serialized in a .gdal.json file
+    // steps before it are serialized in a .gdal.json file.
+    // This is also done for the raster write step, so that it can evaluate
+    // several windows of its input concurrently, provided that all steps
+    // before it support it. Contrary to tile, it silently falls back to
+    // serial execution otherwise.
+    const bool bLastStepIsWrite =
+        !m_steps.empty() && m_steps.back()->GetName() == "write";
+    const auto CanEvaluatePrecedingStepsInParallel = [this]()
+    {
+        for (size_t i = 0; i + 1 < m_steps.size(); ++i)
+        {
+            if (!m_steps[i]->SupportsParallelEvaluation())
+                return false;
+        }
+        return !m_steps[m_steps.size() - 2]->CanHandleNextStep(
+            m_steps.back().get());
+    };
     if (m_steps.size() >= 2 && m_steps.back()->SupportsInputMultiThreading() &&
         m_steps.back()
                 ->GetArg(GDAL_ARG_NAME_NUM_THREADS_INT_HIDDEN)
                 ->Get<int>() > 1 &&
-        !(m_steps.size() == 2 && m_steps[0]->GetName() == "read"))
+        !(m_steps.size() == 2 && m_steps[0]->GetName() == "read") &&
+        (!bLastStepIsWrite || CanEvaluatePrecedingStepsInParallel()))
     {
         bool ret = false;
         auto poSrcDS = m_inputDataset.size() == 1
                            ? m_inputDataset[0].GetDatasetRef()
                            : nullptr;
+        bool bMaterializedInput = true;
         if (poSrcDS)
         {
             auto poSrcDriver = poSrcDS->GetDriver();
             if (!poSrcDriver || EQUAL(poSrcDriver->GetDescription(), "MEM"))
             {
-                ReportError(
-                    CE_Failure, CPLE_AppDefined,
-                    "Cannot execute this pipeline in parallel mode due to "
-                    "input dataset being a non-materialized dataset. "
-                    "Materialize it first, or add '-j 1' to the last step "
-                    "'tile'");
-                return false;
+                if (!bLastStepIsWrite)
+                {
+                    ReportError(
+                        CE_Failure, CPLE_AppDefined,
+                        "Cannot execute this pipeline in parallel mode due to "
+                        "input dataset being a non-materialized dataset. "
+                        "Materialize it first, or add '-j 1' to the last step "
+                        "'tile'");
+                    return false;
+                }
+                bMaterializedInput = false;
             }
         }
-        std::string outString;
-        if (SaveGDALGFile(std::string(), outString))
+        if (bMaterializedInput)
         {
-            const char *const apszAllowedDrivers[] = {"GDALG", nullptr};
-            auto poCurDS = GDALDataset::Open(
-                outString.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
-                apszAllowedDrivers);
+            const auto OpenAsGDALG = [this]() -> GDALDataset *
+            {
+                std::string outString;
+                if (!SaveGDALGFile(std::string(), outString))
+                    return nullptr;
+                const char *const apszAllowedDrivers[] = {"GDALG", nullptr};
+                return GDALDataset::Open(outString.c_str(),
+                                         GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
+                                         apszAllowedDrivers);
+            };
+
+            GDALDataset *poCurDS = nullptr;
+            if (bLastStepIsWrite)
+            {
+                // Errors are only emitted if the parallel mode can be used,
+                // since the serial mode would emit them again.
+                CPLErrorAccumulator oErrorAccumulator;
+                {
+                    auto oContext = oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oContext);
+                    poCurDS = OpenAsGDALG();
+                }
+                if (poCurDS)
+                    oErrorAccumulator.ReplayErrors();
+            }
+            else
+            {
+                poCurDS = OpenAsGDALG();
+            }
             if (poCurDS)
             {
-                auto &tileAlg = m_steps.back();
-                tileAlg->m_inputDataset.clear();
-                tileAlg->m_inputDataset.resize(1);
-                tileAlg->m_inputDataset[0].Set(poCurDS);
-                tileAlg->m_inputDataset[0].SetDatasetOpenedByAlgorithm();
+                auto &lastAlg = m_steps.back();
+                lastAlg->m_inputDataset.clear();
+                lastAlg->m_inputDataset.resize(1);
+                lastAlg->m_inputDataset[0].Set(poCurDS);
+                lastAlg->m_inputDataset[0].SetDatasetOpenedByAlgorithm();
                 poCurDS->Release();
-                ret = tileAlg->RunStep(ctxt);
-                tileAlg->m_inputDataset[0].Close();
+                ret = lastAlg->RunStep(ctxt);
+                lastAlg->m_inputDataset[0].Close();
+                return ret;
             }
+            if (!bLastStepIsWrite)
+                return false;
+            CPLDebug("GDAL", "Cannot serialize pipeline as GDALG: "
+                             "running it serially");
         }
-        return ret;
     }
 
     int countPipelinesWithProgress = 0;
@@ -299,6 +299,14 @@ class GDALPipelineStepAlgorithm /* non final */ : public GDALAlgorithm
         return false;
     }
 
+    //! Whether the output of this step can be evaluated concurrently by
+    //! several threads, each one on its own instance of the pipeline, when
+    //! the pipeline is serialized as a GDALG dataset.
+    virtual bool SupportsParallelEvaluation() const
+    {
+        return false;
+    }
+
     virtual bool CanHandleNextStep(GDALPipelineStepAlgorithm *) const
     {
         return false;
@@ -33,6 +33,11 @@ class GDALRasterAspectAlgorithm /* non final */
 
     explicit GDALRasterAspectAlgorithm(bool standaloneStep = false);
 
+    bool SupportsParallelEvaluation() const override
+    {
+        return true;
+    }
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
@@ -35,6 +35,11 @@ class GDALRasterCalcAlgorithm : public GDALRasterPipelineStepAlgorithm
         return true;
     }
 
+    bool SupportsParallelEvaluation() const override
+    {
+        return true;
+    }
+
   private:
     bool RunImpl(GDALProgressFunc pfnProgress, void *pProgressData) override;
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
@@ -34,6 +34,11 @@ class GDALRasterClipAlgorithm /* non final */
 
     explicit GDALRasterClipAlgorithm(bool standaloneStep = false);
 
+    bool SupportsParallelEvaluation() const override
+    {
+        return true;
+    }
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
@@ -36,6 +36,11 @@ class GDALRasterHillshadeAlgorithm /* non final */
 
     bool CanHandleNextStep(GDALPipelineStepAlgorithm *) const override;
 
+    bool SupportsParallelEvaluation() const override
+    {
+        return true;
+    }
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
@@ -36,6 +36,11 @@ class GDALRasterReadAlgorithm final : public GDALRasterPipelineStepAlgorithm
         return true;
     }
 
+    bool SupportsParallelEvaluation() const override
+    {
+        return true;
+    }
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 };
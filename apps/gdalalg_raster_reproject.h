@@ -41,6 +41,11 @@ class GDALRasterReprojectAlgorithm /* non final */
 
     bool CanHandleNextStep(GDALPipelineStepAlgorithm *) const override;
 
+    bool SupportsParallelEvaluation() const override
+    {
+        return true;
+    }
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
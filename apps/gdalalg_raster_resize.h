@@ -32,6 +32,11 @@ class GDALRasterResizeAlgorithm /* non final */
 
     explicit GDALRasterResizeAlgorithm(bool standaloneStep = false);
 
+    bool SupportsParallelEvaluation() const override
+    {
+        return true;
+    }
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
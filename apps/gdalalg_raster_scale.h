@@ -34,6 +34,11 @@ class GDALRasterScaleAlgorithm /* non final */
 
     explicit GDALRasterScaleAlgorithm(bool standaloneStep = false);
 
+    bool SupportsParallelEvaluation() const override
+    {
+        return true;
+    }
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
@@ -32,6 +32,11 @@ class GDALRasterSelectAlgorithm /* non final */
 
     explicit GDALRasterSelectAlgorithm(bool standaloneStep = false);
 
+    bool SupportsParallelEvaluation() const override
+    {
+        return true;
+    }
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
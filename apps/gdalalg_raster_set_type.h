@@ -33,6 +33,11 @@ class GDALRasterSetTypeAlgorithm /* non final */
 
     explicit GDALRasterSetTypeAlgorithm(bool standaloneStep = false);
 
+    bool SupportsParallelEvaluation() const override
+    {
+        return true;
+    }
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
@@ -33,6 +33,11 @@ class GDALRasterSlopeAlgorithm /* non final */
 
     explicit GDALRasterSlopeAlgorithm(bool standaloneStep = false);
 
+    bool SupportsParallelEvaluation() const override
+    {
+        return true;
+    }
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
@@ -33,6 +33,11 @@ class GDALRasterUnscaleAlgorithm /* non final */
 
     explicit GDALRasterUnscaleAlgorithm(bool standaloneStep = false);
 
+    bool SupportsParallelEvaluation() const override
+    {
+        return true;
+    }
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
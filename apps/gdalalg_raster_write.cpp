@@ -12,12 +12,293 @@
 
 #include "gdalalg_raster_write.h"
 
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "gdal_utils.h"
 #include "gdal_priv.h"
+#include "gdal_proxy.h"
+#include "gdal_thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
 
 //! @cond Doxygen_Suppress
 
+#ifndef _
+#define _(x) (x)
+#endif
+
+namespace
+{
+
+/************************************************************************/
+/*                 GDALRasterWriteParallelReadDataset                   */
+/************************************************************************/
+
+// Dataset forwarding everything to a thread-safe dataset, except that
+// reading a window that spans several chunks is split into concurrent
+// RasterIO() requests, run on the global thread pool. Each thread evaluates
+// the pipeline on its own instance of it (cloned by the thread-safe dataset),
+// and the chunks are directly written into the buffer of the caller, so the
+// amount of memory in flight is the one of the requests issued by the writer.
+class GDALRasterWriteParallelReadDataset final : public GDALProxyDataset
+{
+  public:
+    GDALRasterWriteParallelReadDataset(
+        std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> poTSDS,
+        int nThreads);
+
+    bool ParallelRasterIO(int nXOff, int nYOff, int nXSize, int nYSize,
+                          void *pData, int nBufXSize, int nBufYSize,
+                          GDALDataType eBufType, int nBandCount,
+                          const int *panBandMap, GSpacing nPixelSpace,
+                          GSpacing nLineSpace, GSpacing nBandSpace,
+                          const GDALRasterIOExtraArg *psExtraArg,
+                          CPLErr &eErr);
+
+  protected:
+    GDALDataset *RefUnderlyingDataset() const override
+    {
+        return m_poTSDS.get();
+    }
+
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount,
+                     BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                     GSpacing nLineSpace, GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
+  private:
+    std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> m_poTSDS;
+    CPLWorkerThreadPool *m_poThreadPool = nullptr;
+    int m_nChunkXSize = 0;
+    int m_nChunkYSize = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALRasterWriteParallelReadDataset)
+};
+
+/************************************************************************/
+/*                  GDALRasterWriteParallelReadBand                     */
+/************************************************************************/
+
+class GDALRasterWriteParallelReadBand final : public GDALProxyRasterBand
+{
+  public:
+    GDALRasterWriteParallelReadBand(GDALRasterWriteParallelReadDataset *poDSIn,
+                                    int nBandIn,
+                                    GDALRasterBand *poUnderlyingBand)
+        : m_poUnderlyingBand(poUnderlyingBand)
+    {
+        poDS = poDSIn;
+        nBand = nBandIn;
+        nRasterXSize = poUnderlyingBand->GetXSize();
+        nRasterYSize = poUnderlyingBand->GetYSize();
+        eDataType = poUnderlyingBand->GetRasterDataType();
+        poUnderlyingBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    }
+
+  protected:
+    GDALRasterBand *RefUnderlyingRasterBand(bool /*bForceOpen*/) const override
+    {
+        return m_poUnderlyingBand;
+    }
+
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override
+    {
+        CPLErr eErr = CE_None;
+        if (eRWFlag == GF_Read &&
+            cpl::down_cast<GDALRasterWriteParallelReadDataset *>(poDS)
+                ->ParallelRasterIO(nXOff, nYOff, nXSize, nYSize, pData,
+                                   nBufXSize, nBufYSize, eBufType, 1, &nBand,
+                                   nPixelSpace, nLineSpace, 0, psExtraArg,
+                                   eErr))
+        {
+            return eErr;
+        }
+        return GDALProxyRasterBand::IRasterIO(
+            eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+            nBufYSize, eBufType, nPixelSpace, nLineSpace, psExtraArg);
+    }
+
+  private:
+    GDALRasterBand *const m_poUnderlyingBand;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALRasterWriteParallelReadBand)
+};
+
+/************************************************************************/
+/*                 GDALRasterWriteParallelReadDataset()                 */
+/************************************************************************/
+
+GDALRasterWriteParallelReadDataset::GDALRasterWriteParallelReadDataset(
+    std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> poTSDS,
+    int nThreads)
+    : m_poTSDS(std::move(poTSDS)),
+      m_poThreadPool(GDALGetGlobalThreadPool(nThreads))
+{
+    nRasterXSize = m_poTSDS->GetRasterXSize();
+    nRasterYSize = m_poTSDS->GetRasterYSize();
+    SetDescription(m_poTSDS->GetDescription());
+    for (int i = 0; i < m_poTSDS->GetRasterCount(); ++i)
+    {
+        SetBand(i + 1, std::make_unique<GDALRasterWriteParallelReadBand>(
+                           this, i + 1, m_poTSDS->GetRasterBand(i + 1)));
+    }
+
+    // Use chunks that are a multiple of the natural block size, and at least
+    // 256x256, to keep the per-job overhead low.
+    constexpr int MIN_CHUNK_SIZE = 256;
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    m_poTSDS->GetRasterBand(1)->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    nBlockXSize = std::max(1, nBlockXSize);
+    nBlockYSize = std::max(1, nBlockYSize);
+    m_nChunkXSize =
+        nBlockXSize * std::max(1, DIV_ROUND_UP(MIN_CHUNK_SIZE, nBlockXSize));
+    m_nChunkYSize =
+        nBlockYSize * std::max(1, DIV_ROUND_UP(MIN_CHUNK_SIZE, nBlockYSize));
+}
+
+/************************************************************************/
+/*                              IRasterIO()                             */
+/************************************************************************/
+
+CPLErr GDALRasterWriteParallelReadDataset::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    int nBandCount, BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    CPLErr eErr = CE_None;
+    if (eRWFlag == GF_Read &&
+        ParallelRasterIO(nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                         nBufYSize, eBufType, nBandCount, panBandMap,
+                         nPixelSpace, nLineSpace, nBandSpace, psExtraArg,
+                         eErr))
+    {
+        return eErr;
+    }
+    return GDALProxyDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+}
+
+/************************************************************************/
+/*                          ParallelRasterIO()                          */
+/************************************************************************/
+
+/** Split a read request into chunks processed concurrently.
+ *
+ * The progress callback of psExtraArg is called from the calling thread, as
+ * chunks complete.
+ *
+ * @return false if the request is not eligible (resampling involved,
+ * floating-point window, or a single chunk), in which case the caller must
+ * process it serially.
+ */
+bool GDALRasterWriteParallelReadDataset::ParallelRasterIO(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData, int nBufXSize,
+    int nBufYSize, GDALDataType eBufType, int nBandCount,
+    const int *panBandMap, GSpacing nPixelSpace, GSpacing nLineSpace,
+    GSpacing nBandSpace, const GDALRasterIOExtraArg *psExtraArg, CPLErr &eErr)
+{
+    if (!m_poThreadPool || nXSize != nBufXSize || nYSize != nBufYSize ||
+        (psExtraArg && psExtraArg->bFloatingPointWindowValidity))
+    {
+        return false;
+    }
+    const int nChunksX = DIV_ROUND_UP(nXSize, m_nChunkXSize);
+    const int nChunksY = DIV_ROUND_UP(nYSize, m_nChunkYSize);
+    if (static_cast<int64_t>(nChunksX) * nChunksY <= 1)
+        return false;
+
+    // Jobs do not report progress, which is done by the calling thread
+    GDALRasterIOExtraArg sJobExtraArg;
+    INIT_RASTERIO_EXTRA_ARG(sJobExtraArg);
+    if (psExtraArg)
+        sJobExtraArg.eResampleAlg = psExtraArg->eResampleAlg;
+
+    auto poQueue = m_poThreadPool->CreateJobQueue();
+    std::atomic<bool> bSuccess{true};
+    std::atomic<int> nChunksDone{0};
+    CPLErrorAccumulator oErrorAccumulator;
+    GByte *const pabyData = static_cast<GByte *>(pData);
+    for (int iY = 0; iY < nChunksY; ++iY)
+    {
+        const int nChunkYOff = iY * m_nChunkYSize;
+        const int nChunkYSize = std::min(m_nChunkYSize, nYSize - nChunkYOff);
+        for (int iX = 0; iX < nChunksX; ++iX)
+        {
+            const int nChunkXOff = iX * m_nChunkXSize;
+            const int nChunkXSize =
+                std::min(m_nChunkXSize, nXSize - nChunkXOff);
+            GByte *pabyChunkData = pabyData + nChunkYOff * nLineSpace +
+                                   nChunkXOff * nPixelSpace;
+            poQueue->SubmitJob(
+                [this, &bSuccess, &nChunksDone, &oErrorAccumulator,
+                 sJobExtraArg, pabyChunkData, nXOff, nYOff, nChunkXOff,
+                 nChunkYOff, nChunkXSize, nChunkYSize, eBufType, nBandCount,
+                 panBandMap, nPixelSpace, nLineSpace, nBandSpace]() mutable
+                {
+                    if (!bSuccess)
+                        return;
+                    auto oContext = oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oContext);
+                    if (m_poTSDS->RasterIO(
+                            GF_Read, nXOff + nChunkXOff, nYOff + nChunkYOff,
+                            nChunkXSize, nChunkYSize, pabyChunkData,
+                            nChunkXSize, nChunkYSize, eBufType, nBandCount,
+                            panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+                            &sJobExtraArg) != CE_None)
+                    {
+                        bSuccess = false;
+                    }
+                    ++nChunksDone;
+                });
+        }
+    }
+
+    // WaitEvent() also runs pending jobs when called from a worker thread
+    const int nChunks = nChunksX * nChunksY;
+    bool bInterrupted = false;
+    const auto pfnProgress = psExtraArg ? psExtraArg->pfnProgress : nullptr;
+    while (poQueue->WaitEvent())
+    {
+        if (pfnProgress && !bInterrupted && bSuccess &&
+            !pfnProgress(static_cast<double>(nChunksDone) / nChunks, "",
+                         psExtraArg->pProgressData))
+        {
+            bInterrupted = true;
+            bSuccess = false;
+        }
+    }
+    poQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    if (bInterrupted)
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+    }
+    else if (bSuccess && pfnProgress &&
+             !pfnProgress(1.0, "", psExtraArg->pProgressData))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        bSuccess = false;
+    }
+
+    eErr = bSuccess ? CE_None : CE_Failure;
+    return true;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*          GDALRasterWriteAlgorithm::GDALRasterWriteAlgorithm()        */
 /************************************************************************/
@@ -27,6 +308,26 @@ GDALRasterWriteAlgorithm::GDALRasterWriteAlgorithm()
                                       /* standaloneStep =*/false)
 {
     AddRasterOutputArgs(/* hiddenForCLI = */ false);
+    m_numThreadsStr = std::to_string(GDALGetNumThreads(nullptr, nullptr, "1"));
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr,
+                     _("Number of jobs (or ALL_CPUS) used to evaluate the "
+                       "previous steps of the pipeline"));
+}
+
+/************************************************************************/
+/*        GDALRasterWriteAlgorithm::SupportsInputMultiThreading()       */
+/************************************************************************/
+
+bool GDALRasterWriteAlgorithm::SupportsInputMultiThreading() const
+{
+    // A VRT output must reference the datasets of the pipeline, not a
+    // serialized version of it, and streamed output does not read anything.
+    if (EQUAL(m_format.c_str(), "stream") || EQUAL(m_format.c_str(), "VRT"))
+        return false;
+    return !(m_format.empty() &&
+             EQUAL(CPLGetExtensionSafe(m_outputDataset.GetName().c_str())
+                       .c_str(),
+                   "vrt"));
 }
 
 /************************************************************************/
@@ -78,6 +379,26 @@ bool GDALRasterWriteAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     const std::string osLastErrorMsg = CPLGetLastErrorMsg();
     const auto nLastErrorCounter = CPLGetErrorCounter();
 
+    // When the previous steps of the pipeline have been serialized as a
+    // GDALG dataset, which can be cloned, evaluate them with several threads.
+    std::unique_ptr<GDALDataset> poParallelReadDS;
+    if (m_numThreads > 1 && poSrcDS->GetRasterCount() > 0 &&
+        poSrcDS->GetDriver() &&
+        EQUAL(poSrcDS->GetDriver()->GetDescription(), "GDALG"))
+    {
+        std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> poTSDS(
+            GDALGetThreadSafeDataset(poSrcDS, GDAL_OF_RASTER));
+        if (poTSDS)
+        {
+            CPLDebug("GDAL", "Evaluating input of write step with %d threads",
+                     m_numThreads);
+            poParallelReadDS =
+                std::make_unique<GDALRasterWriteParallelReadDataset>(
+                    std::move(poTSDS), m_numThreads);
+            poSrcDS = poParallelReadDS.get();
+        }
+    }
+
     GDALDatasetH hSrcDS = GDALDataset::ToHandle(poSrcDS);
     auto poRetDS = GDALDataset::FromHandle(GDALTranslate(
         m_outputDataset.GetName().c_str(), hSrcDS, psOptions, nullptr));
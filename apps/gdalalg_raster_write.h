@@ -46,9 +46,16 @@ class GDALRasterWriteAlgorithm final : public GDALRasterPipelineStepAlgorithm
         return false;
     }
 
+    bool SupportsInputMultiThreading() const override;
+
   private:
     friend class GDALRasterPipelineStepAlgorithm;
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
+
+    int m_numThreads = 0;
+
+    // Work variables
+    std::string m_numThreadsStr{};
 };
 
 //! @endcond
@@ -73,6 +73,8 @@ class GDALVectorClipAlgorithmLayer final : public GDALVectorPipelineOutputLayer
                                  std::unique_ptr<OGRGeometry> poClipGeom)
         : GDALVectorPipelineOutputLayer(oSrcLayer),
           m_poClipGeom(std::move(poClipGeom)),
+          m_poPreparedClipGeom(OGRCreatePreparedGeometry(
+              OGRGeometry::ToHandle(m_poClipGeom.get()))),
           m_eSrcLayerGeomType(oSrcLayer.GetGeomType()),
           m_eFlattenSrcLayerGeomType(wkbFlatten(m_eSrcLayerGeomType)),
           m_bSrcLayerGeomTypeIsCollection(OGR_GT_IsSubClassOf(
@@ -105,6 +107,17 @@ class GDALVectorClipAlgorithmLayer final : public GDALVectorPipelineOutputLayer
         if (poGeom == nullptr)
             return;
 
+        // Geometries fully inside the clipping geometry are left untouched,
+        // which avoids computing their intersection.
+        if (m_poPreparedClipGeom &&
+            OGRPreparedGeometryContains(m_poPreparedClipGeom.get(),
+                                        OGRGeometry::ToHandle(poGeom)))
+        {
+            poSrcFeature->SetFDefnUnsafe(m_poFeatureDefn);
+            apoOutFeatures.push_back(std::move(poSrcFeature));
+            return;
+        }
+
         poIntersection.reset(poGeom->Intersection(m_poClipGeom.get()));
         if (!poIntersection)
             return;
@@ -171,6 +184,7 @@ class GDALVectorClipAlgorithmLayer final : public GDALVectorPipelineOutputLayer
 
   private:
     std::unique_ptr<OGRGeometry> const m_poClipGeom{};
+    OGRPreparedGeometryUniquePtr const m_poPreparedClipGeom{};
     const OGRwkbGeometryType m_eSrcLayerGeomType;
     const OGRwkbGeometryType m_eFlattenSrcLayerGeomType;
     const bool m_bSrcLayerGeomTypeIsCollection;
@@ -17,6 +17,7 @@
 #include "gdalalg_vsi_copy.h"
 #include "gdalalg_vsi_delete.h"
 #include "gdalalg_vsi_list.h"
+#include "gdalalg_vsi_metrics.h"
 #include "gdalalg_vsi_move.h"
 #include "gdalalg_vsi_sync.h"
 #include "gdalalg_vsi_sozip.h"
@@ -31,6 +32,7 @@ GDALVSIAlgorithm::GDALVSIAlgorithm()
     RegisterSubAlgorithm<GDALVSICopyAlgorithm>();
     RegisterSubAlgorithm<GDALVSIDeleteAlgorithm>();
     RegisterSubAlgorithm<GDALVSIListAlgorithm>();
+    RegisterSubAlgorithm<GDALVSIMetricsAlgorithm>();
     RegisterSubAlgorithm<GDALVSIMoveAlgorithm>();
     RegisterSubAlgorithm<GDALVSISyncAlgorithm>();
     RegisterSubAlgorithm<GDALVSISOZIPAlgorithm>();
@@ -13,6 +13,7 @@
 #include "gdalalg_vsi_copy.h"
 
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_error.h"
@@ -149,6 +150,10 @@ bool GDALVSICopyAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
             }
         }
 
+        // Files of ZIP archives are extracted concurrently
+        if (m_recursive && STARTS_WITH_CI(m_source.c_str(), "/vsizip/"))
+            return ExtractZip(pfnProgress, pProgressData);
+
         uint64_t curAmount = 0;
         return CopyRecursive(m_source, m_destination, 0, m_recursive ? -1 : 0,
                              curAmount, 0, pfnProgress, pProgressData);
@@ -178,6 +183,49 @@ bool GDALVSICopyAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
     }
 }
 
+/************************************************************************/
+/*                 GDALVSICopyAlgorithm::ExtractZip()                   */
+/************************************************************************/
+
+bool GDALVSICopyAlgorithm::ExtractZip(GDALProgressFunc pfnProgress,
+                                      void *pProgressData) const
+{
+    CPLStringList aosOptions;
+    if (m_skip)
+        aosOptions.SetNameValue("SKIP_ERRORS", "YES");
+
+    // Capture errors of VSIZipExtractAll() so that they are reported, and
+    // skipped with --skip-errors, the same way as by CopyRecursive()
+    CPLErrorAccumulator oErrorAccumulator;
+    int nRet;
+    {
+        [[maybe_unused]] auto oContext =
+            oErrorAccumulator.InstallForCurrentScope();
+        nRet = VSIZipExtractAll(m_source.c_str(), m_destination.c_str(),
+                                aosOptions.List(), pfnProgress, pProgressData);
+    }
+
+    bool bInterrupted = false;
+    for (const auto &oError : oErrorAccumulator.GetErrors())
+    {
+        if (oError.no == CPLE_UserInterrupt)
+        {
+            bInterrupted = true;
+            ReportError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+        else if (oError.type == CE_Failure || oError.type == CE_Warning)
+        {
+            ReportError(m_skip ? CE_Warning : oError.type, oError.no, "%s",
+                        oError.msg.c_str());
+        }
+        else
+        {
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+    }
+    return nRet == 0 || (m_skip && !bInterrupted);
+}
+
 /************************************************************************/
 /*                 GDALVSICopyAlgorithm::CopySingle()                   */
 /************************************************************************/
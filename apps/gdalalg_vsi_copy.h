@@ -52,6 +52,8 @@ class GDALVSICopyAlgorithm final : public GDALAlgorithm
                        int depth, int maxdepth, uint64_t &curAmount,
                        uint64_t totalAmount, GDALProgressFunc pfnProgress,
                        void *pProgressData) const;
+
+    bool ExtractZip(GDALProgressFunc pfnProgress, void *pProgressData) const;
 };
 
 //! @endcond
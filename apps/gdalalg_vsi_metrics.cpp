@@ -0,0 +1,104 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  gdal "vsi metrics" subcommand
+ * Author:   NextGIS <info at nextgis dot com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, NextGIS <info at nextgis dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdalalg_vsi_metrics.h"
+
+#include "cpl_conv.h"
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+#ifndef _
+#define _(x) (x)
+#endif
+
+/************************************************************************/
+/*           GDALVSIMetricsAlgorithm::GDALVSIMetricsAlgorithm()         */
+/************************************************************************/
+
+GDALVSIMetricsAlgorithm::GDALVSIMetricsAlgorithm()
+    : GDALAlgorithm(NAME, DESCRIPTION, HELP_URL)
+{
+    {
+        auto &arg =
+            AddArg("read", 0,
+                   _("File to read entirely before reporting metrics"),
+                   &m_filename)
+                .SetMinCharCount(1);
+        SetAutoCompleteFunctionForFilename(arg, 0);
+    }
+    AddArg("reset", 0, _("Reset metrics after reporting them"), &m_reset);
+    AddOutputStringArg(&m_output);
+}
+
+/************************************************************************/
+/*                   GDALVSIMetricsAlgorithm::RunImpl()                 */
+/************************************************************************/
+
+bool GDALVSIMetricsAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
+                                      void *pProgressData)
+{
+    if (!m_filename.empty())
+    {
+        VSIStatBufL sStat;
+        const bool bHasSize = VSIStatL(m_filename.c_str(), &sStat) == 0 &&
+                              !VSI_ISDIR(sStat.st_mode) && sStat.st_size > 0;
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(m_filename.c_str(), "rb"));
+        if (!fp)
+        {
+            ReportError(CE_Failure, CPLE_FileIO, "Cannot open %s",
+                        m_filename.c_str());
+            return false;
+        }
+        std::vector<GByte> abyBuffer(10 * 1024 * 1024);
+        vsi_l_offset nTotalRead = 0;
+        while (true)
+        {
+            const size_t nRead =
+                fp->Read(abyBuffer.data(), 1, abyBuffer.size());
+            nTotalRead += nRead;
+            if (bHasSize && pfnProgress &&
+                !pfnProgress(static_cast<double>(nTotalRead) /
+                                 static_cast<double>(sStat.st_size),
+                             "", pProgressData))
+            {
+                ReportError(CE_Failure, CPLE_UserInterrupt,
+                            "Interrupted by user");
+                return false;
+            }
+            if (nRead < abyBuffer.size())
+                break;
+        }
+        if (fp->Error())
+        {
+            ReportError(CE_Failure, CPLE_FileIO, "Error while reading %s",
+                        m_filename.c_str());
+            return false;
+        }
+    }
+
+    char *pszJSON = VSIIOMetricsGetAsSerializedJSON(nullptr);
+    m_output = pszJSON ? pszJSON : "";
+    if (!m_output.empty() && m_output.back() != '\n')
+        m_output += '\n';
+    CPLFree(pszJSON);
+
+    if (m_reset)
+        VSIIOMetricsReset();
+
+    return true;
+}
+
+//! @endcond
@@ -0,0 +1,45 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  gdal "vsi metrics" subcommand
+ * Author:   NextGIS <info at nextgis dot com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, NextGIS <info at nextgis dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef GDALALG_VSI_METRICS_INCLUDED
+#define GDALALG_VSI_METRICS_INCLUDED
+
+#include "gdalalgorithm.h"
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                        GDALVSIMetricsAlgorithm                       */
+/************************************************************************/
+
+class GDALVSIMetricsAlgorithm final : public GDALAlgorithm
+{
+  public:
+    static constexpr const char *NAME = "metrics";
+    static constexpr const char *DESCRIPTION =
+        "Report I/O metrics of GDAL Virtual System Interface (VSI) file "
+        "systems.";
+    static constexpr const char *HELP_URL = "/programs/gdal_vsi_metrics.html";
+
+    GDALVSIMetricsAlgorithm();
+
+  private:
+    std::string m_filename{};
+    bool m_reset = false;
+    std::string m_output{};
+
+    bool RunImpl(GDALProgressFunc, void *) override;
+};
+
+//! @endcond
+
+#endif
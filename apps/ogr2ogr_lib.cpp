@@ -6589,7 +6589,8 @@ bool LayerTranslator::Translate(
         else if (psOptions->nFIDToFetch != OGRNullFID)
             poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
         else
-            poFeature.reset(poSrcLayer->GetNextFeature());
+            poFeature.reset(
+                poSrcLayer->GetNextFeatureReusing(poFeature.release()));
 
         if (poFeature == nullptr)
         {
@@ -42,12 +42,14 @@
 #include "cpl_worker_thread_pool.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_threadsafe_queue.hpp"
+#include "gdal_thread_pool.h"
 
 #include <atomic>
 #include <cmath>
 #include <limits>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #if !defined(_WIN32)
 #include <unistd.h>
@@ -4276,6 +4278,61 @@ TEST_F(test_cpl, VSISupportsRandomWrite)
 #endif
 }
 
+// Test VSIFReadMultiRangeL() on a local file
+TEST_F(test_cpl, VSIFReadMultiRangeL_local_file)
+{
+    const std::string osTmpFile = CPLGenerateTempFilenameSafe(nullptr);
+    constexpr size_t FILE_SIZE = 10 * 1024 * 1024 + 1;
+    std::vector<GByte> abyContent(FILE_SIZE);
+    for (size_t i = 0; i < FILE_SIZE; ++i)
+        abyContent[i] = static_cast<GByte>((i * 37) % 251);
+    {
+        VSILFILE *fp = VSIFOpenL(osTmpFile.c_str(), "wb");
+        if (!fp)
+            GTEST_SKIP() << "Cannot create temporary file";
+        ASSERT_EQ(VSIFWriteL(abyContent.data(), 1, FILE_SIZE, fp), FILE_SIZE);
+        VSIFCloseL(fp);
+    }
+
+    VSILFILE *fp = VSIFOpenL(osTmpFile.c_str(), "rb");
+    ASSERT_NE(fp, nullptr);
+
+    // Mix of small ranges, and of a range larger than the piece size
+    const vsi_l_offset anOffsets[] = {1, 1000, 65536, 300000, 1000000};
+    const size_t anSizes[] = {10, 50000, 100000, 1, FILE_SIZE - 1000000};
+    std::vector<std::vector<GByte>> aabyData;
+    std::vector<void *> apData;
+    for (size_t nSize : anSizes)
+    {
+        aabyData.emplace_back(nSize);
+        apData.push_back(aabyData.back().data());
+    }
+
+    ASSERT_EQ(VSIFReadMultiRangeL(static_cast<int>(apData.size()),
+                                  apData.data(), anOffsets, anSizes, fp),
+              0);
+    for (size_t i = 0; i < aabyData.size(); ++i)
+    {
+        EXPECT_TRUE(memcmp(aabyData[i].data(), abyContent.data() + anOffsets[i],
+                           anSizes[i]) == 0);
+    }
+
+    // Reading past end of file must fail
+    {
+        const vsi_l_offset nOffset = FILE_SIZE - 10;
+        const size_t nSize = 20;
+        GByte abyBuffer[20];
+        void *pData = abyBuffer;
+        EXPECT_NE(VSIFReadMultiRangeL(1, &pData, &nOffset, &nSize, fp), 0);
+    }
+
+    // File position is left unchanged
+    EXPECT_EQ(VSIFTellL(fp), 0);
+
+    VSIFCloseL(fp);
+    VSIUnlink(osTmpFile.c_str());
+}
+
 // Test ignore-env-vars = yes of configuration file
 TEST_F(test_cpl, config_file_ignore_env_vars)
 {
@@ -4462,6 +4519,51 @@ TEST_F(test_cpl, CPLWorkerThreadPool_recursion)
     ASSERT_EQ(ctxt.nCounter, 3 * 3);
 }
 
+// Test waiting for nested job queues from worker threads
+TEST_F(test_cpl, CPLJobQueue_nested_wait_from_worker)
+{
+    CPLWorkerThreadPool oThreadPool;
+    oThreadPool.Setup(4, nullptr, nullptr, /* waitAllStarted = */ true);
+
+    constexpr int N_OUTER_JOBS = 8;
+    constexpr int N_INNER_JOBS = 16;
+    std::atomic<int> nCounter{0};
+    std::atomic<int> nEvents{0};
+
+    {
+        auto poOuterQueue = oThreadPool.CreateJobQueue();
+        for (int i = 0; i < N_OUTER_JOBS; ++i)
+        {
+            poOuterQueue->SubmitJob(
+                [&oThreadPool, &nCounter, &nEvents, i]()
+                {
+                    auto poInnerQueue = oThreadPool.CreateJobQueue();
+                    for (int j = 0; j < N_INNER_JOBS; ++j)
+                    {
+                        poInnerQueue->SubmitJob(
+                            [&nCounter]()
+                            {
+                                CPLSleep(0.001);
+                                ++nCounter;
+                            });
+                    }
+                    if ((i % 2) == 0)
+                    {
+                        poInnerQueue->WaitCompletion();
+                    }
+                    else
+                    {
+                        while (poInnerQueue->WaitEvent())
+                            ++nEvents;
+                    }
+                });
+        }
+        poOuterQueue->WaitCompletion();
+    }
+    EXPECT_EQ(nCounter, N_OUTER_JOBS * N_INNER_JOBS);
+    EXPECT_LE(nEvents, N_OUTER_JOBS / 2 * N_INNER_JOBS);
+}
+
 // Test /vsimem/ PRead() implementation
 TEST_F(test_cpl, vsimem_pread)
 {
@@ -4519,6 +4621,93 @@ TEST_F(test_cpl, file_system_pread)
     VSIUnlink("temp_test_64.bin");
 }
 
+// Test GetMappedRegion() on /vsimem/, local files and /vsisubfile/
+TEST_F(test_cpl, VSIFGetMappedRegionL)
+{
+    for (const std::string &osFilename :
+         {std::string(VSIMemGenerateHiddenFilename("mapped.bin")),
+          std::string("temp_test_mapped.bin")})
+    {
+        VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+        if (fp == nullptr)
+            continue;
+        ASSERT_EQ(VSIFWriteL("abcdefgh", 1, 8, fp), 8U);
+        // Not available in write mode
+        EXPECT_EQ(VSIFGetMappedRegionL(fp, 0, 1), nullptr);
+        VSIFCloseL(fp);
+
+        fp = VSIFOpenL(osFilename.c_str(), "rb");
+        ASSERT_NE(fp, nullptr);
+        const char *pszMapped =
+            static_cast<const char *>(VSIFGetMappedRegionL(fp, 2, 4));
+        if (pszMapped)
+        {
+            EXPECT_EQ(std::string(pszMapped, 4), "cdef");
+            EXPECT_EQ(VSIFTellL(fp), 0U);
+            EXPECT_NE(VSIFGetMappedRegionL(fp, 0, 8), nullptr);
+            EXPECT_EQ(VSIFGetMappedRegionL(fp, 0, 9), nullptr);
+            EXPECT_EQ(VSIFGetMappedRegionL(fp, 9, 0), nullptr);
+        }
+        else
+        {
+            // Only POSIX local files are guaranteed to be mapped
+            EXPECT_TRUE(!STARTS_WITH(osFilename.c_str(), "/vsimem/"));
+        }
+        VSIFCloseL(fp);
+
+        const std::string osSubfile =
+            "/vsisubfile/1_4," + osFilename;  // "bcde"
+        fp = VSIFOpenL(osSubfile.c_str(), "rb");
+        ASSERT_NE(fp, nullptr);
+        pszMapped = static_cast<const char *>(VSIFGetMappedRegionL(fp, 1, 3));
+        if (pszMapped)
+        {
+            EXPECT_EQ(std::string(pszMapped, 3), "cde");
+            EXPECT_EQ(VSIFGetMappedRegionL(fp, 1, 4), nullptr);
+        }
+        VSIFCloseL(fp);
+
+        VSIUnlink(osFilename.c_str());
+    }
+}
+
+// Test that GetMappedRegion() on /vsimem/ does not let writers invalidate
+// the returned pointer
+TEST_F(test_cpl, VSIFGetMappedRegionL_vsimem_writers)
+{
+    const std::string osFilename(VSIMemGenerateHiddenFilename("mapped.bin"));
+    VSILFILE *fpWriter = VSIFOpenL(osFilename.c_str(), "wb");
+    ASSERT_NE(fpWriter, nullptr);
+    ASSERT_EQ(VSIFWriteL("abcdefgh", 1, 8, fpWriter), 8U);
+
+    // Not available while the file is opened in update mode by any handle
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    ASSERT_NE(fp, nullptr);
+    EXPECT_EQ(VSIFGetMappedRegionL(fp, 0, 8), nullptr);
+    VSIFCloseL(fpWriter);
+    const char *pszMapped =
+        static_cast<const char *>(VSIFGetMappedRegionL(fp, 0, 8));
+    ASSERT_NE(pszMapped, nullptr);
+
+    // The buffer cannot be reallocated while it is mapped
+    fpWriter = VSIFOpenL(osFilename.c_str(), "rb+");
+    ASSERT_NE(fpWriter, nullptr);
+    std::vector<char> abyLarge(1024 * 1024, 'x');
+    VSIFSeekL(fpWriter, 0, SEEK_END);
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    EXPECT_EQ(VSIFWriteL(abyLarge.data(), 1, abyLarge.size(), fpWriter), 0U);
+    CPLPopErrorHandler();
+    EXPECT_EQ(std::string(pszMapped, 8), "abcdefgh");
+    VSIFCloseL(fp);
+
+    // But it can once the mapping handle is closed
+    EXPECT_EQ(VSIFWriteL(abyLarge.data(), 1, abyLarge.size(), fpWriter),
+              abyLarge.size());
+    VSIFCloseL(fpWriter);
+
+    VSIUnlink(osFilename.c_str());
+}
+
 // Test CPLMask implementation
 TEST_F(test_cpl, CPLMask)
 {
@@ -5665,4 +5854,70 @@ TEST_F(test_cpl, CPLHasUnbalancedPathTraversal)
     EXPECT_TRUE(CPLHasUnbalancedPathTraversal("a\\..\\..\\"));
 }
 
+// Test that reading an indexed gzip file, with read-ahead, from jobs running
+// in the global thread pool does not deadlock when there are more such jobs
+// than workers, and read-ahead jobs are queued behind them.
+TEST_F(test_cpl, VSIGZip_read_ahead_from_global_thread_pool_jobs)
+{
+    std::string osData;
+    for (int i = 0; i < 400000; ++i)
+        osData += std::to_string(i) + ',';
+
+    const std::string osFilename(VSIMemGenerateHiddenFilename("test.gz"));
+    {
+        CPLConfigOptionSetter oWriteIndexSetter("CPL_VSIL_GZIP_WRITE_INDEX",
+                                                "YES", false);
+        CPLConfigOptionSetter oChunkSizeSetter("CPL_VSIL_DEFLATE_CHUNK_SIZE",
+                                               "64K", false);
+        CPLConfigOptionSetter oNumThreadsSetter("GDAL_NUM_THREADS", "2",
+                                                false);
+        VSILFILE *fp = VSIFOpenL(("/vsigzip/" + osFilename).c_str(), "wb");
+        ASSERT_NE(fp, nullptr);
+        EXPECT_EQ(VSIFWriteL(osData.data(), 1, osData.size(), fp),
+                  osData.size());
+        EXPECT_EQ(VSIFCloseL(fp), 0);
+    }
+    VSIStatBufL sStat;
+    ASSERT_EQ(VSIStatL((osFilename + ".gzidx").c_str(), &sStat), 0);
+
+    auto poPool = GDALGetGlobalThreadPool(2);
+    ASSERT_NE(poPool, nullptr);
+    const int nJobs = 4 * poPool->GetThreadCount();
+    auto poQueue = poPool->CreateJobQueue();
+    std::atomic<int> nSuccess{0};
+    for (int i = 0; i < nJobs; ++i)
+    {
+        poQueue->SubmitJob(
+            [&osFilename, &osData, &nSuccess]()
+            {
+                // Config options are thread-local: set them in the job
+                CPLConfigOptionSetter oNumThreadsSetter("GDAL_NUM_THREADS",
+                                                        "2", false);
+                CPLConfigOptionSetter oInflightSetter(
+                    "CPL_VSIL_GZIP_MAX_INFLIGHT_BLOCKS", "3", false);
+
+                VSILFILE *fp =
+                    VSIFOpenL(("/vsigzip/" + osFilename).c_str(), "rb");
+                if (!fp)
+                    return;
+                std::string osRead;
+                std::vector<char> abyBuffer(12345);
+                size_t nRead;
+                while ((nRead = VSIFReadL(abyBuffer.data(), 1,
+                                          abyBuffer.size(), fp)) > 0)
+                {
+                    osRead.append(abyBuffer.data(), nRead);
+                }
+                VSIFCloseL(fp);
+                if (osRead == osData)
+                    ++nSuccess;
+            });
+    }
+    poQueue->WaitCompletion();
+    EXPECT_EQ(nSuccess, nJobs);
+
+    VSIUnlink((osFilename + ".gzidx").c_str());
+    VSIUnlink(osFilename.c_str());
+}
+
 }  // namespace
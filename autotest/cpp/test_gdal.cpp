@@ -15,6 +15,7 @@
 #include "gdal_alg.h"
 #include "gdal_priv.h"
 #include "gdal_utils.h"
+#include "gdal_thread_pool.h"
 #include "gdal_priv_templates.hpp"
 #include "gdal.h"
 #include "tilematrixset.hpp"
@@ -778,6 +779,39 @@ TEST_F(test_gdal, GDALSwapWords_unaligned_buffers)
     GDALSwapWords(abyBuffer, 4, 2, 9);
 }
 
+// Test GDALSwapWords() on packed buffers of various sizes and alignments
+TEST_F(test_gdal, GDALSwapWords_packed_buffers)
+{
+    for (int nWordSize : {2, 4, 8})
+    {
+        for (int nOffset = 0; nOffset < 8; ++nOffset)
+        {
+            for (int nWordCount = 0; nWordCount < 20; ++nWordCount)
+            {
+                std::vector<GByte> abyBuffer(8 + 8 * 20);
+                for (size_t i = 0; i < abyBuffer.size(); ++i)
+                    abyBuffer[i] = static_cast<GByte>(i);
+                GDALSwapWords(abyBuffer.data() + nOffset, nWordSize,
+                              nWordCount, nWordSize);
+                for (size_t i = 0; i < abyBuffer.size(); ++i)
+                {
+                    size_t nExpected = i;
+                    if (i >= static_cast<size_t>(nOffset) &&
+                        i < static_cast<size_t>(nOffset) +
+                                nWordSize * nWordCount)
+                    {
+                        const size_t iInWord = (i - nOffset) % nWordSize;
+                        nExpected = i - iInWord + (nWordSize - 1 - iInWord);
+                    }
+                    ASSERT_EQ(abyBuffer[i], nExpected)
+                        << "nWordSize=" << nWordSize << " nOffset=" << nOffset
+                        << " nWordCount=" << nWordCount << " i=" << i;
+                }
+            }
+        }
+    }
+}
+
 // Test ARE_REAL_EQUAL()
 TEST_F(test_gdal, ARE_REAL_EQUAL)
 {
@@ -6389,4 +6423,27 @@ TEST_F(test_gdal, GDALGeoTransform)
     }
 }
 
+// Test GDALGetNumThreads()
+TEST_F(test_gdal, GDALGetNumThreads)
+{
+    EXPECT_EQ(GDALGetNumThreads(nullptr), 1);
+    EXPECT_EQ(GDALGetNumThreads("0"), 1);
+    EXPECT_EQ(GDALGetNumThreads("3"), 3);
+    EXPECT_EQ(GDALGetNumThreads("3", 2), 2);
+    EXPECT_EQ(GDALGetNumThreads("ALL_CPUS"), CPLGetNumCPUs());
+
+    {
+        CPLConfigOptionSetter oSetter("GDAL_NUM_THREADS", "5", false);
+        EXPECT_EQ(GDALGetNumThreads(nullptr, "NUM_THREADS", "1"), 5);
+        const char *const apszOptions[] = {"NUM_THREADS=4", nullptr};
+        EXPECT_EQ(GDALGetNumThreads(apszOptions, "NUM_THREADS", "1"), 4);
+        EXPECT_EQ(GDALGetNumThreads(apszOptions, nullptr, "1"), 5);
+
+        CPLConfigOptionSetter oSetterMax("GDAL_MAX_NUM_THREADS", "2", false);
+        EXPECT_EQ(GDALGetNumThreads(apszOptions, "NUM_THREADS", "1"), 2);
+        EXPECT_EQ(GDALGetNumThreads("ALL_CPUS"),
+                  std::min(2, CPLGetNumCPUs()));
+    }
+}
+
 }  // namespace
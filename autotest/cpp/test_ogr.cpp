@@ -23,6 +23,7 @@
 #include <cmath>
 #include <fstream>
 #include <limits>
+#include <map>
 
 #ifdef HAVE_SQLITE3
 #include <sqlite3.h>
@@ -1454,6 +1455,96 @@ TEST_F(test_ogr, OGRToOGCGeomType)
                  "Point ZM");
 }
 
+// Test OGRLayer::GetNextFeatureReusing()
+TEST_F(test_ogr, GetNextFeatureReusing)
+{
+    if (!GDALGetDriverByName("ESRI Shapefile") ||
+        !GDALGetDriverByName("FlatGeobuf"))
+    {
+        GTEST_SKIP() << "ESRI Shapefile or FlatGeobuf driver missing";
+    }
+
+    std::string file(data_ + SEP + "poly.shp");
+    GDALDatasetUniquePtr poSrcDS(
+        GDALDataset::Open(file.c_str(), GDAL_OF_VECTOR));
+    ASSERT_TRUE(poSrcDS != nullptr);
+
+    const char *pszFGB = "/vsimem/test_ogr_GetNextFeatureReusing.fgb";
+    {
+        auto poDrv = GetGDALDriverManager()->GetDriverByName("FlatGeobuf");
+        GDALDatasetUniquePtr poDstDS(
+            poDrv->Create(pszFGB, 0, 0, 0, GDT_Unknown, nullptr));
+        ASSERT_TRUE(poDstDS != nullptr);
+        ASSERT_TRUE(poDstDS->CopyLayer(poSrcDS->GetLayer(0), "poly") !=
+                    nullptr);
+    }
+    GDALDatasetUniquePtr poFGBDS(GDALDataset::Open(pszFGB, GDAL_OF_VECTOR));
+    ASSERT_TRUE(poFGBDS != nullptr);
+    std::vector<GDALDataset *> apoDS{poSrcDS.get(), poFGBDS.get()};
+
+    // GeoPackage has its own implementation
+    const char *pszGPKG = "/vsimem/test_ogr_GetNextFeatureReusing.gpkg";
+    GDALDatasetUniquePtr poGPKGDS;
+    if (auto poDrv = GetGDALDriverManager()->GetDriverByName("GPKG"))
+    {
+        poGPKGDS.reset(poDrv->Create(pszGPKG, 0, 0, 0, GDT_Unknown, nullptr));
+        ASSERT_TRUE(poGPKGDS != nullptr);
+        ASSERT_TRUE(poGPKGDS->CopyLayer(poSrcDS->GetLayer(0), "poly") !=
+                    nullptr);
+        apoDS.push_back(poGPKGDS.get());
+    }
+
+    for (auto *poDS : apoDS)
+    {
+        auto poLayer = poDS->GetLayer(0);
+        std::map<GIntBig, std::unique_ptr<OGRFeature>> apoExpected;
+        for (auto &&poFeature : *poLayer)
+        {
+            const auto nFID = poFeature->GetFID();
+            apoExpected[nFID].reset(poFeature.release());
+        }
+        ASSERT_EQ(apoExpected.size(), 10U);
+
+        // Reuse with all features, then with a filter that skips some
+        for (const char *pszFilter : {"", "EAS_ID > 170"})
+        {
+            poLayer->SetAttributeFilter(pszFilter[0] ? pszFilter : nullptr);
+            poLayer->ResetReading();
+            OGRFeature *poFeature = nullptr;
+            size_t nCount = 0;
+            while ((poFeature = poLayer->GetNextFeatureReusing(poFeature)) !=
+                   nullptr)
+            {
+                const auto oIter = apoExpected.find(poFeature->GetFID());
+                ASSERT_TRUE(oIter != apoExpected.end());
+                EXPECT_TRUE(poFeature->Equal(oIter->second.get()));
+                ++nCount;
+            }
+            EXPECT_EQ(nCount, pszFilter[0] ? 4U : 10U);
+        }
+        poLayer->SetAttributeFilter(nullptr);
+
+        // A feature of another definition is not refilled, but deleted
+        {
+            poLayer->ResetReading();
+            OGRFeatureDefn *poOtherDefn = new OGRFeatureDefn("other");
+            poOtherDefn->Reference();
+            auto poFeature = poLayer->GetNextFeatureReusing(
+                new OGRFeature(poOtherDefn));
+            poOtherDefn->Release();
+            ASSERT_TRUE(poFeature != nullptr);
+            EXPECT_EQ(poFeature->GetDefnRef(), poLayer->GetLayerDefn());
+            EXPECT_TRUE(
+                poFeature->Equal(apoExpected.begin()->second.get()));
+            delete poFeature;
+        }
+    }
+    poFGBDS.reset();
+    VSIUnlink(pszFGB);
+    poGPKGDS.reset();
+    VSIUnlink(pszGPKG);
+}
+
 // Test layer, dataset-feature and layer-feature iterators
 TEST_F(test_ogr, DatasetFeature_and_LayerFeature_iterators)
 {
@@ -4734,4 +4825,68 @@ TEST_F(test_ogr, OGRPolygon_two_vertex_constructor)
     CPLFree(outWKT);
 }
 
+// Test OGRPreparedGeometryIntersectsBatch() and
+// OGRPreparedGeometryContainsBatch()
+TEST_F(test_ogr, OGRPreparedGeometry_batch)
+{
+    if (!OGRHasPreparedGeometrySupport())
+    {
+        GTEST_SKIP() << "GEOS missing";
+    }
+
+    OGRPolygon oPoly(0, 0, 10, 10);
+    OGRPreparedGeometryUniquePtr poPrepared(
+        OGRCreatePreparedGeometry(OGRGeometry::ToHandle(&oPoly)));
+    ASSERT_NE(poPrepared, nullptr);
+
+    std::vector<std::unique_ptr<OGRGeometry>> apoGeoms;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const double dfX = (i % 40) - 15;
+        const double dfY = (i / 40) - 7;
+        if ((i % 3) == 0)
+            apoGeoms.push_back(std::make_unique<OGRPoint>(dfX, dfY));
+        else
+            apoGeoms.push_back(std::make_unique<OGRPolygon>(
+                dfX, dfY, dfX + 1 + (i % 5), dfY + 1 + (i % 7)));
+    }
+    apoGeoms.push_back(std::make_unique<OGRPoint>());
+    std::vector<OGRGeometryH> ahGeoms;
+    for (const auto &poGeom : apoGeoms)
+        ahGeoms.push_back(OGRGeometry::ToHandle(poGeom.get()));
+    const int nGeomCount = static_cast<int>(ahGeoms.size());
+
+    for (const char *pszNumThreads : {"1", "4"})
+    {
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("NUM_THREADS", pszNumThreads);
+        std::vector<int> abIntersects(nGeomCount, -1);
+        std::vector<int> abContains(nGeomCount, -1);
+        EXPECT_TRUE(OGRPreparedGeometryIntersectsBatch(
+            poPrepared.get(), nGeomCount, ahGeoms.data(), abIntersects.data(),
+            aosOptions.List()));
+        EXPECT_TRUE(OGRPreparedGeometryContainsBatch(
+            poPrepared.get(), nGeomCount, ahGeoms.data(), abContains.data(),
+            aosOptions.List()));
+        for (int i = 0; i < nGeomCount; ++i)
+        {
+            EXPECT_EQ(abIntersects[i], OGRPreparedGeometryIntersects(
+                                           poPrepared.get(), ahGeoms[i]))
+                << i;
+            EXPECT_EQ(abContains[i], OGRPreparedGeometryContains(
+                                         poPrepared.get(), ahGeoms[i]))
+                << i;
+            EXPECT_EQ(abContains[i] != FALSE,
+                      oPoly.Contains(apoGeoms[i].get()))
+                << i;
+        }
+    }
+
+    EXPECT_TRUE(OGRPreparedGeometryIntersectsBatch(poPrepared.get(), 0,
+                                                   nullptr, nullptr, nullptr));
+    int bRes = FALSE;
+    EXPECT_FALSE(OGRPreparedGeometryContainsBatch(nullptr, 1, ahGeoms.data(),
+                                                  &bRes, nullptr));
+}
+
 }  // namespace
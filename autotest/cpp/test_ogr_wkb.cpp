@@ -12,11 +12,13 @@
 
 #include "gdal_unit_test.h"
 
+#include "ogr_feature.h"
 #include "ogr_geometry.h"
 #include "ogr_wkb.h"
 
 #include "gtest_include.h"
 
+#include <array>
 #include <limits>
 
 namespace
@@ -858,4 +860,227 @@ TEST_F(test_ogr_wkb, OGRWKBTransformFixture_ct_failure)
     }
 }
 
+TEST_F(test_ogr_wkb, OGRWKBGeometryView)
+{
+    const char *const apszWKT[] = {
+        "POINT EMPTY",
+        "POINT (1 2)",
+        "POINT ZM (1 2 3 4)",
+        "LINESTRING EMPTY",
+        "LINESTRING (0 0,10 0,10 10)",
+        "LINESTRING Z (0 0 1,10 10 2,0 10 3,0 0 4)",
+        "CIRCULARSTRING (0 0,1 1,2 0)",
+        "POLYGON EMPTY",
+        "POLYGON ((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))",
+        "POLYGON M ((0 0 1,0 10 2,10 10 3,10 0 4,0 0 5))",
+        "TRIANGLE ((0 0,0 10,10 0,0 0))",
+        "MULTIPOINT ((1 2),(3 4))",
+        "MULTILINESTRING ((0 0,1 1),EMPTY,(5 5,6 5))",
+        "MULTIPOLYGON (((0 0,0 10,10 10,10 0,0 0)),((20 20,20 30,30 30,30 "
+        "20,20 20),(22 22,28 22,28 28,22 28,22 22)))",
+        "GEOMETRYCOLLECTION (POINT (1 2),LINESTRING (0 0,3 4),"
+        "GEOMETRYCOLLECTION (POLYGON ((0 0,0 1,1 1,1 0,0 0))))",
+        "GEOMETRYCOLLECTION (POINT EMPTY,LINESTRING EMPTY)",
+        "COMPOUNDCURVE (CIRCULARSTRING (0 0,1 1,2 0),(2 0,0 0))",
+        "CURVEPOLYGON (COMPOUNDCURVE (CIRCULARSTRING (0 0,1 1,2 0),(2 0,0 0)))",
+        "MULTICURVE ((0 0,1 1),CIRCULARSTRING (0 0,1 1,2 0))",
+        "MULTISURFACE (((0 0,0 1,1 1,0 0)),CURVEPOLYGON ((0 0,0 2,2 2,0 0)))",
+        "POLYHEDRALSURFACE Z (((0 0 0,0 1 0,1 1 0,0 0 0)))",
+        "TIN (((0 0,0 1,1 0,0 0)),((0 0,1 0,1 -1,0 0)))",
+    };
+    std::vector<OGREnvelope> asEnvelopes;
+    for (const auto &adfRect : std::vector<std::array<double, 4>>{
+             {-1, -1, 0.5, 0.5},
+             {3, 3, 4, 4},
+             {4, 4, 6, 6},
+             {9, -1, 11, 1},
+             {-5, 5, 15, 6},
+             {24, 24, 26, 26},
+             {100, 100, 101, 101}})
+    {
+        OGREnvelope sEnvelope;
+        sEnvelope.MinX = adfRect[0];
+        sEnvelope.MinY = adfRect[1];
+        sEnvelope.MaxX = adfRect[2];
+        sEnvelope.MaxY = adfRect[3];
+        asEnvelopes.push_back(sEnvelope);
+    }
+
+    for (const char *pszWKT : apszWKT)
+    {
+        SCOPED_TRACE(pszWKT);
+        auto [poGeom, eErr] = OGRGeometryFactory::createFromWkt(pszWKT);
+        ASSERT_EQ(eErr, OGRERR_NONE);
+        for (const auto eByteOrder : {wkbNDR, wkbXDR})
+        {
+            std::vector<GByte> abyWkb(poGeom->WkbSize() + 1, 0xff);
+            poGeom->exportToWkb(eByteOrder, abyWkb.data(), wkbVariantIso);
+
+            // Trailing bytes are ignored
+            OGRWKBGeometryView oView;
+            ASSERT_TRUE(oView.Init(abyWkb.data(), abyWkb.size()));
+            EXPECT_EQ(oView.GetSize(), abyWkb.size() - 1);
+            EXPECT_EQ(oView.GetGeometryType(), poGeom->getGeometryType());
+            EXPECT_EQ(oView.IsEmpty(), CPL_TO_BOOL(poGeom->IsEmpty()));
+
+            const auto eFlatType = wkbFlatten(poGeom->getGeometryType());
+            if (eFlatType == wkbPolyhedralSurface || eFlatType == wkbTIN)
+            {
+                // Sum of the areas and perimeters of the faces
+                EXPECT_NEAR(oView.GetArea(),
+                            eFlatType == wkbTIN ? 1.0 : 0.5, 1e-10);
+                EXPECT_NEAR(oView.GetLength(),
+                            (2 + sqrt(2.0)) * (eFlatType == wkbTIN ? 2 : 1),
+                            1e-10);
+            }
+            else if (OGR_GT_IsSurface(eFlatType) ||
+                     OGR_GT_IsCurve(eFlatType) ||
+                     OGR_GT_IsSubClassOf(eFlatType, wkbGeometryCollection))
+            {
+                double dfLength = 0;
+                double dfArea = 0;
+                if (OGR_GT_IsSurface(eFlatType))
+                {
+                    dfLength = poGeom->toSurface()->get_Length();
+                    dfArea = poGeom->toSurface()->get_Area();
+                }
+                else if (OGR_GT_IsCurve(eFlatType))
+                {
+                    dfLength = poGeom->toCurve()->get_Length();
+                    dfArea = poGeom->toCurve()->get_Area();
+                }
+                else
+                {
+                    dfLength = poGeom->toGeometryCollection()->get_Length();
+                    dfArea = poGeom->toGeometryCollection()->get_Area();
+                }
+                EXPECT_NEAR(oView.GetLength(), dfLength, 1e-10);
+                EXPECT_NEAR(oView.GetArea(), dfArea, 1e-10);
+            }
+
+            if (!poGeom->IsEmpty())
+            {
+                OGREnvelope sEnvelope;
+                OGREnvelope sExpected;
+                poGeom->getEnvelope(&sExpected);
+                EXPECT_TRUE(oView.GetEnvelope(sEnvelope));
+                if (!poGeom->hasCurveGeometry())
+                    EXPECT_EQ(sEnvelope, sExpected);
+            }
+
+            for (const auto &sEnvelope : asEnvelopes)
+            {
+                bool bIntersects = false;
+                if (oView.IntersectsEnvelope(sEnvelope, bIntersects))
+                {
+                    // Geometries with arcs are only decided by their
+                    // linear parts
+                    if (poGeom->hasCurveGeometry() && !poGeom->IsEmpty())
+                        EXPECT_TRUE(bIntersects);
+                    if (OGRGeometryFactory::haveGEOS())
+                    {
+                        OGRPolygon oRect(sEnvelope);
+                        EXPECT_EQ(bIntersects,
+                                  CPL_TO_BOOL(poGeom->Intersects(&oRect)))
+                            << sEnvelope.MinX << " " << sEnvelope.MinY;
+                    }
+                }
+                else
+                {
+                    EXPECT_TRUE(poGeom->hasCurveGeometry());
+                }
+            }
+
+            auto poGeomFromView = oView.ToGeometry();
+            ASSERT_TRUE(poGeomFromView != nullptr);
+            EXPECT_TRUE(poGeomFromView->Equals(poGeom.get()));
+
+            // Truncated buffers are rejected
+            for (size_t i = 0; i + 1 < abyWkb.size(); ++i)
+            {
+                EXPECT_FALSE(oView.Init(abyWkb.data(), i)) << i;
+            }
+        }
+    }
+}
+
+TEST_F(test_ogr_wkb, OGRWKBGeometryView_accessors)
+{
+    auto [poGeom, eErr] = OGRGeometryFactory::createFromWkt(
+        "GEOMETRYCOLLECTION (POINT Z (1 2 3),"
+        "POLYGON ((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2)),"
+        "MULTILINESTRING M ((0 0 5,1 1 6)))");
+    ASSERT_EQ(eErr, OGRERR_NONE);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(wkbXDR, abyWkb.data(), wkbVariantIso);
+
+    OGRWKBGeometryView oView;
+    ASSERT_TRUE(oView.Init(abyWkb.data(), abyWkb.size()));
+    EXPECT_EQ(oView.GetGeometryCount(), 3U);
+    EXPECT_EQ(oView.GetRingCount(), 0U);
+    OGRWKBPointSequenceView oPoints;
+    EXPECT_FALSE(oView.GetPoints(oPoints));
+
+    std::vector<OGRWKBGeometryView> aoParts;
+    for (const auto &oPart : oView)
+        aoParts.push_back(oPart);
+    ASSERT_EQ(aoParts.size(), 3U);
+
+    // Sub-geometries have the dimension of the collection
+    EXPECT_EQ(aoParts[0].GetGeometryType(), wkbPointZM);
+    ASSERT_TRUE(aoParts[0].GetPoints(oPoints));
+    ASSERT_EQ(oPoints.GetPointCount(), 1U);
+    EXPECT_EQ(oPoints.GetX(0), 1);
+    EXPECT_EQ(oPoints.GetY(0), 2);
+    EXPECT_EQ(oPoints.GetZ(0), 3);
+    EXPECT_EQ(oPoints.GetM(0), 0);
+    EXPECT_EQ(aoParts[1].GetGeometryType(), wkbPolygonZM);
+
+    EXPECT_EQ(aoParts[1].GetRingCount(), 2U);
+    ASSERT_TRUE(aoParts[1].GetRing(1, oPoints));
+    ASSERT_EQ(oPoints.GetPointCount(), 5U);
+    EXPECT_EQ(oPoints.GetX(1), 8);
+    EXPECT_EQ(oPoints.GetY(1), 2);
+    EXPECT_FALSE(aoParts[1].GetRing(2, oPoints));
+    EXPECT_TRUE(aoParts[1].ContainsPoint(1, 1));
+    EXPECT_FALSE(aoParts[1].ContainsPoint(5, 5));
+    EXPECT_FALSE(aoParts[1].ContainsPoint(11, 5));
+    EXPECT_TRUE(oView.ContainsPoint(1, 1));
+
+    EXPECT_EQ(aoParts[2].GetGeometryCount(), 1U);
+    ASSERT_TRUE((*aoParts[2].begin()).GetPoints(oPoints));
+    ASSERT_EQ(oPoints.GetPointCount(), 2U);
+    EXPECT_EQ(oPoints.GetZ(1), 0);
+    EXPECT_EQ(oPoints.GetM(1), 6);
+
+    OGRFeatureDefn *poDefn = new OGRFeatureDefn();
+    poDefn->Reference();
+    {
+        OGRFeature oFeature(poDefn);
+        EXPECT_EQ(oFeature.SetGeomField(0, aoParts[1]), OGRERR_NONE);
+        ASSERT_TRUE(oFeature.GetGeometryRef() != nullptr);
+        EXPECT_EQ(oFeature.GetGeometryRef()->getGeometryType(),
+                  wkbPolygonZM);
+
+        // A geometry of the same type is refilled in place
+        const OGRGeometry *poGeom = oFeature.GetGeometryRef();
+        EXPECT_EQ(oFeature.SetGeomField(0, aoParts[1]), OGRERR_NONE);
+        EXPECT_EQ(oFeature.GetGeometryRef(), poGeom);
+        EXPECT_TRUE(poGeom->Equals(aoParts[1].ToGeometry().get()));
+
+        // But not a geometry of another type
+        EXPECT_EQ(oFeature.SetGeomField(0, aoParts[2]), OGRERR_NONE);
+        ASSERT_TRUE(oFeature.GetGeometryRef() != nullptr);
+        EXPECT_EQ(oFeature.GetGeometryRef()->getGeometryType(),
+                  aoParts[2].GetGeometryType());
+        EXPECT_TRUE(oFeature.GetGeometryRef()->Equals(
+            aoParts[2].ToGeometry().get()));
+
+        EXPECT_EQ(oFeature.SetGeomField(1, aoParts[1]), OGRERR_FAILURE);
+        EXPECT_EQ(oFeature.SetGeomField(0, OGRWKBGeometryView()),
+                  OGRERR_CORRUPT_DATA);
+    }
+    poDefn->Release();
+}
+
 }  // namespace
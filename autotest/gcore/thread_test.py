@@ -435,6 +435,34 @@ def test_thread_safe_many_datasets():
     assert res[0]
 
 
+@pytest.mark.parametrize("max_handles", ["1", "5"])
+def test_thread_safe_many_datasets_max_handles(max_handles):
+
+    tab_ds = [
+        gdal.OpenEx(
+            "data/byte.tif" if (i % 3) < 2 else "data/utmsmall.tif",
+            gdal.OF_RASTER | gdal.OF_THREAD_SAFE,
+        )
+        for i in range(20)
+    ]
+
+    res = [True]
+
+    def check():
+        for _ in range(3):
+            for i, ds in enumerate(tab_ds):
+                if ds.GetRasterBand(1).Checksum() != (4672 if (i % 3) < 2 else 50054):
+                    res[0] = False
+
+    with gdal.config_option("GDAL_THREAD_SAFE_DATASET_MAX_HANDLES", max_handles):
+        threads = [threading.Thread(target=check) for i in range(4)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+    assert res[0]
+
+
 def test_thread_safe_BeginAsyncReader():
 
     with gdal.OpenEx("data/byte.tif", gdal.OF_RASTER | gdal.OF_THREAD_SAFE) as ds:
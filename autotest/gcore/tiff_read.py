@@ -1204,6 +1204,91 @@ def test_tiff_read_vsicurl_multirange():
         gdal.VSICurlClearCache()
 
 
+###############################################################################
+# Test GDAL_HTTP_MERGE_RANGES_MAX_GAP with ReadMultiRange() on /vsicurl/
+
+
+@pytest.mark.require_curl()
+@pytest.mark.parametrize("max_gap", ["0", "1000000"])
+def test_tiff_read_vsicurl_multirange_merge_gap(max_gap):
+
+    webserver_process = None
+    webserver_port = 0
+
+    (webserver_process, webserver_port) = webserver.launch(
+        handler=webserver.DispatcherHttpHandler
+    )
+    if webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    class RangeRecordingHandler(webserver.BaseMockedHttpHandler):
+        def __init__(self):
+            self.ranges = []
+
+        def final_check(self):
+            pass
+
+        def process(self, method, request):
+            filesize = os.stat("../gdrivers/data/utm.tif").st_size
+            request.protocol_version = "HTTP/1.1"
+            if method == "HEAD":
+                request.send_response(200)
+                request.send_header("Content-Length", filesize)
+                request.end_headers()
+                return
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = int(rng.split("-")[1])
+            self.ranges.append((start, end))
+            request.send_response(206)
+            request.send_header("Content-type", "application/octet-stream")
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, filesize)
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.send_header("Connection", "close")
+            request.end_headers()
+            with open("../gdrivers/data/utm.tif", "rb") as f:
+                f.seek(start, 0)
+                request.wfile.write(f.read(end - start + 1))
+
+    try:
+        handler = RangeRecordingHandler()
+        with webserver.install_http_handler(handler):
+            with gdaltest.config_options(
+                {
+                    "GTIFF_DIRECT_IO": "YES",
+                    "CPL_VSIL_CURL_ALLOWED_EXTENSIONS": ".tif",
+                    "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+                    "GDAL_HTTP_MERGE_RANGES_MAX_GAP": max_gap,
+                }
+            ):
+                ds = gdal.Open("/vsicurl/http://127.0.0.1:%d/utm.tif" % webserver_port)
+                assert ds is not None, "could not open dataset"
+                nb_requests_after_open = len(handler.ranges)
+
+                # Read 4 lines far apart from each other
+                subsampled_data = ds.ReadRaster(0, 0, 512, 512, 128, 4)
+                ds = None
+
+        ds = gdal.Open("../gdrivers/data/utm.tif")
+        assert subsampled_data == ds.ReadRaster(0, 0, 512, 512, 128, 4)
+        ds = None
+
+        nb_requests = len(handler.ranges) - nb_requests_after_open
+        if max_gap == "0":
+            assert nb_requests >= 3
+        else:
+            assert nb_requests == 1
+
+    finally:
+        webserver.server_stop(webserver_process, webserver_port)
+
+        gdal.VSICurlClearCache()
+
+
 ###############################################################################
 # Test reading a TIFF made of a single-strip that is more than 2GB (#5403)
 
@@ -9818,6 +9818,35 @@ def test_tiff_write_jpegxl_uint16_single_band():
     ut.testCreateCopy()
 
 
+###############################################################################
+# Test that JXL compression of a single tile can use several threads
+
+
+@pytest.mark.require_creation_option("GTiff", "JXL")
+def test_tiff_write_jpegxl_single_block_num_threads(tmp_vsimem):
+
+    filename = tmp_vsimem / "test_tiff_write_jpegxl_single_block_num_threads.tif"
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    gdal.Translate(
+        filename,
+        src_ds,
+        options="-co COMPRESS=JXL -co TILED=YES -co BLOCKXSIZE=64 -co BLOCKYSIZE=64 -co NUM_THREADS=4",
+    )
+
+    with gdal.Open(filename) as ds:
+        assert ds.GetMetadataItem("JXL_NUM_THREADS", "_DEBUG_") == "1"
+        assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+            src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+        ]
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        with gdal.Open(filename) as ds:
+            assert ds.GetMetadataItem("JXL_NUM_THREADS", "_DEBUG_") == "4"
+            assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+                src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+            ]
+
+
 ###############################################################################
 # Test JXL_DISTANCE option without specifying JXL_LOSSLESS=NO
 
@@ -1122,6 +1122,50 @@ def test_vsiaz_write_blockblob_default_chunk_size():
         gdal.VSIFCloseL(f)
 
 
+###############################################################################
+# Test uploading blocks in the background with VSIAZ_MAX_INFLIGHT_PARTS
+
+
+def test_vsiaz_write_blockblob_max_inflight_parts():
+
+    if gdaltest.webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    path = "/azure/blob/myaccount/test_create/file.bin"
+    handler = webserver.NonSequentialMockedHttpHandler()
+    for block in range(1, 4):
+        handler.add(
+            "PUT",
+            path + "?blockid=%012d&comp=block" % block,
+            201,
+            expected_headers={
+                "Content-Length": str(1024 * 1024 if block < 3 else 1024)
+            },
+        )
+    handler.add(
+        "PUT",
+        path + "?comp=blocklist",
+        201,
+        expected_body=b'<?xml version="1.0" encoding="utf-8"?>\n<BlockList>\n<Latest>000000000001</Latest>\n<Latest>000000000002</Latest>\n<Latest>000000000003</Latest>\n</BlockList>\n',
+    )
+
+    with gdaltest.config_option("VSIAZ_MAX_INFLIGHT_PARTS", "3"):
+        f = gdal.VSIFOpenExL(
+            "/vsiaz/test_create/file.bin",
+            "wb",
+            False,
+            ["BLOB_TYPE=BLOCK", "CHUNK_SIZE=1"],
+        )
+    assert f is not None
+
+    with webserver.install_http_handler(handler):
+        for i in range(2 * 1024 + 1):
+            assert gdal.VSIFWriteL(b"x" * 1024, 1, 1024, f) == 1024
+        assert gdal.VSIFCloseL(f) == 0
+
+
 ###############################################################################
 # Test writing a block blob single PUT
 
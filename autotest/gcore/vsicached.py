@@ -117,3 +117,44 @@ def test_vsicached_readdir_error():
 
     with gdal.quiet_errors():
         assert gdal.ReadDir("/vsicached?") is None
+
+
+def test_vsicached_shared(tmp_path):
+
+    filename = str(tmp_path / "test.bin")
+    with open(filename, "wb") as f:
+        f.write(b"a" * 100000)
+    st = os.stat(filename)
+
+    cached_filename = "/vsicached?chunk_size=4096&file=" + filename.replace("\\", "/")
+    with gdal.config_option("VSI_CACHE_SHARED", "YES"):
+        f = gdal.VSIFOpenL(cached_filename, "rb")
+        assert f
+        try:
+            assert gdal.VSIFReadL(1, 100000, f) == b"a" * 100000
+        finally:
+            gdal.VSIFCloseL(f)
+
+        # Rewrite the file without changing its size nor modification time:
+        # a new handle should get blocks from the shared cache
+        with open(filename, "wb") as f:
+            f.write(b"b" * 100000)
+        os.utime(filename, ns=(st.st_atime_ns, st.st_mtime_ns))
+
+        f = gdal.VSIFOpenL(cached_filename, "rb")
+        assert f
+        try:
+            assert gdal.VSIFReadL(1, 100000, f) == b"a" * 100000
+        finally:
+            gdal.VSIFCloseL(f)
+
+        # A different size must invalidate the cached blocks
+        with open(filename, "wb") as f:
+            f.write(b"c" * 100001)
+
+        f = gdal.VSIFOpenL(cached_filename, "rb")
+        assert f
+        try:
+            assert gdal.VSIFReadL(1, 100001, f) == b"c" * 100001
+        finally:
+            gdal.VSIFCloseL(f)
@@ -11,6 +11,8 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
+import os
 import sys
 import time
 
@@ -863,6 +865,58 @@ def test_vsicurl_test_retry(server):
 ###############################################################################
 
 
+def test_vsicurl_io_metrics(server):
+
+    gdal.VSICurlClearCache()
+    gdal.IOMetricsReset()
+
+    handler = webserver.SequentialHandler()
+    handler.add("GET", "/test_io_metrics/", 404)
+    handler.add("HEAD", "/test_io_metrics/test.txt", 200, {"Content-Length": "3"})
+    handler.add("GET", "/test_io_metrics/test.txt", 502)
+    handler.add("GET", "/test_io_metrics/test.txt", 200, {}, "foo")
+    with webserver.install_http_handler(handler):
+        f = gdal.VSIFOpenL(
+            "/vsicurl?max_retry=1&retry_delay=0.01&url=http://localhost:%d/test_io_metrics/test.txt"
+            % server.port,
+            "rb",
+        )
+        assert f is not None
+        try:
+            with gdal.quiet_errors():
+                assert gdal.VSIFReadL(1, 3, f) == b"foo"
+            # Served from the region cache
+            gdal.VSIFSeekL(f, 0, 0)
+            assert gdal.VSIFReadL(1, 3, f) == b"foo"
+        finally:
+            gdal.VSIFCloseL(f)
+
+    j = json.loads(gdal.IOMetricsGetAsSerializedJSON())
+    assert j["enabled"]
+    fs = j["filesystems"]["vsicurl"]
+    assert fs["retries"] == 1
+    assert fs["in_flight"] == 0
+    host = fs["hosts"]["localhost:%d" % server.port]
+    # HEAD, GET with 502 and successful GET
+    assert host["requests"] >= 3
+    assert host["errors"] >= 1
+    assert host["downloaded_bytes"] >= 3
+    assert host["total_time_ms"]["count"] == host["requests"]
+    assert sum(host["total_time_ms"]["buckets"].values()) == host["requests"]
+    assert j["caches"]["vsicurl_region_cache"]["hits"] == 1
+    assert j["caches"]["vsicurl_region_cache"]["misses"] == 1
+
+    gdal.IOMetricsReset()
+    j = json.loads(gdal.IOMetricsGetAsSerializedJSON())
+    assert j["filesystems"]["vsicurl"]["retries"] == 0
+    assert j["filesystems"]["vsicurl"]["hosts"]["localhost:%d" % server.port][
+        "requests"
+    ] == 0
+
+
+###############################################################################
+
+
 def test_vsicurl_retry_codes_ALL(server):
 
     gdal.VSICurlClearCache()
@@ -1815,3 +1869,90 @@ def test_vsicurl_test_redirect_301_to_url_ending_slash_and_then_403(server):
             gdal.VSIStatL("/vsicurl/http://localhost:%d/test_redirect" % server.port)
             is None
         )
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_DISK_CACHE_DIR
+
+
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    cache_dir = str(tmp_path / "cache")
+    filename = "/vsicurl/http://localhost:%d/test_disk_cache.bin" % server.port
+
+    def read():
+        f = gdal.VSIFOpenL(filename, "rb")
+        assert f is not None
+        data = gdal.VSIFReadL(1, 3, f)
+        gdal.VSIFCloseL(f)
+        return data
+
+    with gdal.config_option("CPL_VSIL_CURL_DISK_CACHE_DIR", cache_dir):
+
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"etag1"'},
+        )
+        handler.add("GET", "/test_disk_cache.bin", 200, {}, b"foo")
+        with webserver.install_http_handler(handler):
+            assert read() == b"foo"
+
+        assert gdal.ReadDirRecursive(cache_dir)
+
+        # The cache is only accessible by its owner
+        if sys.platform != "win32":
+            for x in gdal.ReadDirRecursive(cache_dir):
+                mode = os.stat(os.path.join(cache_dir, x)).st_mode
+                assert mode & 0o077 == 0, x
+
+        # Content is read from the disk cache after the in-memory cache has
+        # been cleared
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"etag1"'},
+        )
+        with webserver.install_http_handler(handler):
+            assert read() == b"foo"
+
+        # Remote file has changed
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"etag2"'},
+        )
+        handler.add("GET", "/test_disk_cache.bin", 200, {}, b"bar")
+        with webserver.install_http_handler(handler):
+            assert read() == b"bar"
+
+        # Cache size limit exceeded: least recently used content is removed
+        gdal.VSICurlClearCache()
+        with gdal.config_option("CPL_VSIL_CURL_DISK_CACHE_SIZE", "1"):
+            handler = webserver.SequentialHandler()
+            handler.add(
+                "HEAD",
+                "/test_disk_cache.bin",
+                200,
+                {"Content-Length": "3", "ETag": '"etag3"'},
+            )
+            handler.add("GET", "/test_disk_cache.bin", 200, {}, b"baz")
+            with webserver.install_http_handler(handler):
+                assert read() == b"baz"
+            assert not [
+                x
+                for x in gdal.ReadDirRecursive(cache_dir)
+                if not x.endswith("/")
+            ]
+
+    gdal.VSICurlClearCache()
@@ -919,6 +919,118 @@ def test_vsigzip_multi_thread():
         pytest.fail()
 
 
+###############################################################################
+# Test CPL_VSIL_GZIP_INDEX
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_vsigzip_index(tmp_vsimem, num_threads):
+
+    import gzip
+
+    # Two gzip members, to test reading across member boundaries
+    data = b"".join(b"%d," % (i * i) for i in range(300000))
+    half = len(data) // 2
+    gz_filename = str(tmp_vsimem / "test.gz")
+    gdal.FileFromMemBuffer(
+        gz_filename, gzip.compress(data[0:half]) + gzip.compress(data[half:])
+    )
+    other_gz_filename = str(tmp_vsimem / "other.gz")
+    gdal.FileFromMemBuffer(other_gz_filename, gzip.compress(b"foo"))
+
+    def read(filename, offset, size):
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f
+        try:
+            gdal.VSIFSeekL(f, offset, 0)
+            return gdal.VSIFReadL(1, size, f)
+        finally:
+            gdal.VSIFCloseL(f)
+
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_GZIP_INDEX": "YES",
+            "CPL_VSIL_GZIP_INDEX_SPAN": "65536",
+            "GDAL_NUM_THREADS": num_threads,
+        }
+    ):
+        # First sequential pass builds the index
+        assert read(gz_filename, 0, len(data) + 1) == data
+        assert gdal.VSIStatL(gz_filename + ".gzidx") is not None
+
+        # Evict the cached handle, so that the index is loaded from the
+        # sidecar file
+        assert read(other_gz_filename, 0, 3) == b"foo"
+
+        for offset, size in [
+            (len(data) - 10, 10),
+            (half - 100000, 200000),
+            (1000, 500000),
+            (0, len(data) + 1),
+            (12345, 1),
+        ]:
+            assert read(gz_filename, offset, size) == data[offset : offset + size]
+
+
+###############################################################################
+# Test CPL_VSIL_GZIP_WRITE_INDEX and read-ahead using the written index
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_vsigzip_write_index(tmp_vsimem, num_threads):
+
+    import gzip
+
+    data = b"".join(b"%d," % (i * i % 1000003) for i in range(400000))
+    gz_filename = str(tmp_vsimem / "test.gz")
+
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_GZIP_WRITE_INDEX": "YES",
+            "CPL_VSIL_DEFLATE_CHUNK_SIZE": "64K",
+            "GDAL_NUM_THREADS": num_threads,
+        }
+    ):
+        f = gdal.VSIFOpenL("/vsigzip/" + gz_filename, "wb")
+        assert f
+        for i in range(0, len(data), 10000):
+            chunk = data[i : i + 10000]
+            assert gdal.VSIFWriteL(chunk, 1, len(chunk), f) == len(chunk)
+        assert gdal.VSIFCloseL(f) == 0
+
+    assert gdal.VSIStatL(gz_filename + ".gzidx") is not None
+
+    # The output is a regular gzip file
+    f = gdal.VSIFOpenL(gz_filename, "rb")
+    compressed = gdal.VSIFReadL(1, 10 * len(data), f)
+    gdal.VSIFCloseL(f)
+    assert gzip.decompress(compressed) == data
+
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": num_threads, "CPL_VSIL_GZIP_MAX_INFLIGHT_BLOCKS": "3"}
+    ):
+        f = gdal.VSIFOpenL("/vsigzip/" + gz_filename, "rb")
+        assert f
+        try:
+            # Sequential reads, interleaved with seeks
+            got = b""
+            while True:
+                chunk = gdal.VSIFReadL(1, 12345, f)
+                got += chunk
+                if len(chunk) < 12345:
+                    break
+            assert got == data
+
+            for offset in (len(data) - 10, 1000, 500000, 70000):
+                gdal.VSIFSeekL(f, offset, 0)
+                assert gdal.VSIFReadL(1, 200000, f) == data[offset : offset + 200000]
+
+            gdal.VSIFSeekL(f, 0, 2)
+            assert gdal.VSIFTellL(f) == len(data)
+        finally:
+            gdal.VSIFCloseL(f)
+
+
 ###############################################################################
 # Test vsisync()
 
@@ -3172,6 +3172,81 @@ def test_vsis3_write_multipart_retry(aws_test_config, webserver_port):
                 gdal.VSIFCloseL(f)
 
 
+###############################################################################
+# Test uploading parts in the background with MAX_INFLIGHT_PARTS
+
+
+@pytest.mark.parametrize("fail", [False, True])
+def test_vsis3_write_multipart_max_inflight_parts(
+    aws_test_config, webserver_port, fail
+):
+
+    gdal.VSICurlClearCache()
+
+    filename = "/vsis3/s3_fake_bucket4/inflight.bin"
+    path = "/s3_fake_bucket4/inflight.bin"
+
+    handler = webserver.NonSequentialMockedHttpHandler()
+    response = """<?xml version="1.0" encoding="UTF-8"?>
+    <InitiateMultipartUploadResult>
+    <UploadId>my_id</UploadId>
+    </InitiateMultipartUploadResult>"""
+    handler.add("POST", path + "?uploads", 200, {}, response)
+    for part in range(1, 5):
+        if fail and part == 2:
+            handler.add("PUT", path + f"?partNumber={part}&uploadId=my_id", 403)
+        else:
+            handler.add(
+                "PUT",
+                path + f"?partNumber={part}&uploadId=my_id",
+                200,
+                {"ETag": f'"etag{part}"', "Content-Length": "0"},
+                b"",
+                expected_headers={"Content-Length": "1000" if part < 4 else "500"},
+            )
+    if fail:
+        handler.add("DELETE", path + "?uploadId=my_id", 204)
+    else:
+        handler.add(
+            "POST",
+            path + "?uploadId=my_id",
+            200,
+            {},
+            b"",
+            expected_body=b"""<CompleteMultipartUpload>
+<Part>
+<PartNumber>1</PartNumber><ETag>"etag1"</ETag></Part>
+<Part>
+<PartNumber>2</PartNumber><ETag>"etag2"</ETag></Part>
+<Part>
+<PartNumber>3</PartNumber><ETag>"etag3"</ETag></Part>
+<Part>
+<PartNumber>4</PartNumber><ETag>"etag4"</ETag></Part>
+</CompleteMultipartUpload>
+""",
+        )
+
+    with webserver.install_http_handler(handler):
+        with gdaltest.config_option("VSIS3_CHUNK_SIZE_BYTES", "1000"):
+            f = gdal.VSIFOpenExL(filename, "wb", False, ["MAX_INFLIGHT_PARTS=3"])
+        assert f is not None
+        if fail:
+            with gdal.quiet_errors():
+                # The failure may only be noticed when closing
+                for i in range(35):
+                    if gdal.VSIFWriteL(b"x" * 100, 1, 100, f) != 100:
+                        break
+                assert gdal.VSIFCloseL(f) != 0
+            # PUT requests for parts that were not submitted are not issued
+            handler.req_resp_map = {}
+        else:
+            for i in range(35):
+                assert gdal.VSIFWriteL(b"x" * 100, 1, 100, f) == 100
+            gdal.ErrorReset()
+            assert gdal.VSIFCloseL(f) == 0
+            assert gdal.GetLastErrorMsg() == ""
+
+
 ###############################################################################
 # Test abort pending multipart uploads
 
@@ -977,6 +977,50 @@ def test_vsizip_sozip_of_file_bigger_than_4GB():
         gdal.VSIFCloseL(f)
 
 
+###############################################################################
+# Test reading a SOZip-enabled file with chunks decompressed in parallel
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_vsizip_sozip_multi_thread_read(tmp_vsimem, num_threads):
+
+    data = b"".join(b"%08d" % i for i in range(100000))
+    gdal.FileFromMemBuffer(tmp_vsimem / "src.bin", data)
+
+    zipfilename = tmp_vsimem / "test.zip"
+    dstfilename = f"/vsizip/{zipfilename}/test.bin"
+    options = ["SOZIP_ENABLED=YES", "SOZIP_CHUNK_SIZE=1024"]
+    assert gdal.CopyFile(tmp_vsimem / "src.bin", dstfilename, options=options) == 0
+    assert gdal.GetFileMetadata(dstfilename, "ZIP")["SOZIP_VALID"] == "YES"
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        with gdal.VSIFile(dstfilename, "rb") as f:
+            assert f.read() == data
+            for offset, size in [(0, 1), (1000, 5000), (12345, 300000), (799990, 20)]:
+                f.seek(offset)
+                assert f.read(size) == data[offset : offset + size]
+
+
+###############################################################################
+# Test that the cache of information on files in archives is invalidated
+# when the archive is modified
+
+
+def test_vsizip_file_info_cache_invalidation(tmp_vsimem):
+
+    zipfilename = tmp_vsimem / "test.zip"
+    with gdal.VSIFile(f"/vsizip/{zipfilename}/a", "wb") as f:
+        f.write(b"foo")
+    with gdal.VSIFile(f"/vsizip/{zipfilename}/a", "rb") as f:
+        assert f.read() == b"foo"
+
+    gdal.Unlink(zipfilename)
+    with gdal.VSIFile(f"/vsizip/{zipfilename}/a", "wb") as f:
+        f.write(b"barbaz")
+    with gdal.VSIFile(f"/vsizip/{zipfilename}/a", "rb") as f:
+        assert f.read() == b"barbaz"
+
+
 ###############################################################################
 # Test bugfix for https://github.com/OSGeo/gdal/issues/12572
 
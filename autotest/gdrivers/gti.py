@@ -2902,6 +2902,80 @@ def test_gti_read_multi_threaded_disabled_since_overlapping_sources(tmp_vsimem):
     )
 
 
+###############################################################################
+# Test concurrent opening of overlapping sources, rendered in priority order
+
+
+@pytest.mark.parametrize("use_threads", [True, False])
+def test_gti_read_overlapping_sources_concurrent_opening(tmp_vsimem, use_threads):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/small_world.tif", width=512, format="MEM"
+    )
+    tiles_ds = []
+    for i in range(3):
+        tile_filename = str(tmp_vsimem / ("%d.tif" % i))
+        # Each tile overlaps the next one by 32 pixels, and odd tiles have
+        # a constant value, so that the priority order matters.
+        gdal.Translate(
+            tile_filename,
+            src_ds,
+            srcWin=[i * 160, 0, 192, 256],
+            scaleParams=[[0, 255, i, i]] if i % 2 else None,
+        )
+        tiles_ds.append(gdal.Open(tile_filename))
+
+    index_filename = str(tmp_vsimem / "index.gti.gpkg")
+    index_ds, _ = create_basic_tileindex(index_filename, tiles_ds)
+    del index_ds
+
+    vrt_ds = gdal.Open(index_filename)
+    with gdal.config_options({} if use_threads else {"GTI_NUM_THREADS": "0"}):
+        got = vrt_ds.ReadRaster(0, 0, 512, 256)
+    assert vrt_ds.GetMetadataItem(
+        "CONCURRENT_SOURCE_OPENING_LAST_USED", "__DEBUG__"
+    ) == ("1" if gdal.GetNumCPUs() >= 2 and use_threads else "0")
+
+    # Compare with a serial rendering through a VRT mosaic, where last
+    # sources have priority.
+    vrt_mosaic = gdal.BuildVRT("", [t.GetDescription() for t in tiles_ds])
+    assert got == vrt_mosaic.ReadRaster(0, 0, 512, 256)
+
+
+###############################################################################
+# Test concurrent opening of sources when a tile is referenced several times
+
+
+def test_gti_read_overlapping_sources_concurrent_opening_duplicated_tile(
+    tmp_vsimem,
+):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/small_world.tif", width=512, format="MEM"
+    )
+    tiles_ds = []
+    for i in range(2):
+        tile_filename = str(tmp_vsimem / ("%d.tif" % i))
+        gdal.Translate(
+            tile_filename,
+            src_ds,
+            srcWin=[i * 160, 0, 192, 256],
+            scaleParams=[[0, 255, i, i]] if i % 2 else None,
+        )
+        tiles_ds.append(gdal.Open(tile_filename))
+    tiles_ds = [tiles_ds[0], tiles_ds[1], tiles_ds[0]]
+
+    index_filename = str(tmp_vsimem / "index.gti.gpkg")
+    index_ds, _ = create_basic_tileindex(index_filename, tiles_ds)
+    del index_ds
+
+    vrt_ds = gdal.Open(index_filename)
+    got = vrt_ds.ReadRaster(0, 0, 352, 256)
+
+    vrt_mosaic = gdal.BuildVRT("", [t.GetDescription() for t in tiles_ds])
+    assert got == vrt_mosaic.ReadRaster(0, 0, 352, 256)
+
+
 ###############################################################################
 # Test multi-threaded reading
 
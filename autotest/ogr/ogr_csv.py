@@ -3630,6 +3630,114 @@ def test_ogr_csv_creation_illegal_layer_name(tmp_vsimem):
         ds.CreateLayer("illegal/with/slash")
 
 
+###############################################################################
+# Test attribute indexes created with CREATE INDEX
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_csv_sidecar_attribute_index(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.csv")
+    content = "id,val,name\n" + "".join(
+        f"{i},{(i * 7) % 31},{'AbC'[i % 3]}{i % 5}\n" for i in range(500)
+    )
+    gdal.FileFromMemBuffer(filename, content)
+    gdal.FileFromMemBuffer(filename[0:-3] + "csvt", "Integer,Integer,String")
+
+    filters = [
+        "val = 3",
+        "val >= 28",
+        "val BETWEEN 10 AND 12.5",
+        "name = 'a1'",
+        "name IN ('B2', 'c3')",
+        "name < 'b'",
+        "val < 2 AND name > 'b'",
+    ]
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        expected = {}
+        for attr_filter in filters:
+            lyr.SetAttributeFilter(attr_filter)
+            expected[attr_filter] = [f["id"] for f in lyr]
+
+        ds.ExecuteSQL("CREATE INDEX ON test USING val")
+        ds.ExecuteSQL("CREATE INDEX ON test USING name")
+        assert gdal.VSIStatL(filename + ".test.val.ogridx") is not None
+        assert gdal.VSIStatL(filename + ".test.name.ogridx") is not None
+
+        for attr_filter in filters:
+            lyr.SetAttributeFilter(attr_filter)
+            assert [f["id"] for f in lyr] == expected[attr_filter], attr_filter
+
+    # The index is ignored once the file has been modified
+    gdal.FileFromMemBuffer(filename, content + "500,3,A0\n")
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        lyr.SetAttributeFilter("val = 3")
+        assert [f["id"] for f in lyr] == expected["val = 3"] + [500]
+
+
+###############################################################################
+# Test sidecar spatial index created with CREATE SPATIAL INDEX
+
+
+def test_ogr_csv_sidecar_spatial_index(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.csv")
+    content = "id,val,WKT\n" + "".join(
+        f'{i},{i % 7},"LINESTRING ({(i * 37) % 100} {(i * 53) % 100},'
+        f'{(i * 37) % 100 + i % 5} {(i * 53) % 100 + i % 3})"\n'
+        for i in range(1000)
+    )
+    content += "1000,0,\n"
+    gdal.FileFromMemBuffer(filename, content)
+    gdal.FileFromMemBuffer(filename[0:-3] + "csvt", "Integer,Integer,WKT")
+
+    rects = [
+        (10, 10, 20, 20),
+        (-5, -5, 0, 0),
+        (50.5, 0, 50.5, 100),
+        (200, 200, 300, 300),
+    ]
+
+    def get_ids(lyr, rect, attr_filter=None):
+        lyr.SetSpatialFilterRect(*rect)
+        lyr.SetAttributeFilter(attr_filter)
+        return [f["id"] for f in lyr]
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        expected = [get_ids(lyr, rect) for rect in rects]
+        expected_with_attr = get_ids(lyr, rects[0], "val = 3")
+        assert expected[0]
+        assert expected_with_attr
+
+        lyr.SetSpatialFilterRect(*rects[1])
+        ds.ExecuteSQL("CREATE SPATIAL INDEX ON test")
+        assert gdal.VSIStatL(filename + ".test.geometry.ogrsidx") is not None
+        # The spatial filter is restored after the index has been built
+        assert lyr.GetSpatialFilter() is not None
+
+        for rect, ids in zip(rects, expected):
+            assert get_ids(lyr, rect) == ids, rect
+        assert get_ids(lyr, rects[0], "val = 3") == expected_with_attr
+
+        ds.ExecuteSQL("CREATE INDEX ON test USING val")
+        assert get_ids(lyr, rects[0], "val = 3") == expected_with_attr
+
+        with pytest.raises(Exception, match="Syntax error"):
+            ds.ExecuteSQL("CREATE SPATIAL INDEX ON test USING")
+        with pytest.raises(Exception, match="geometry field not found"):
+            ds.ExecuteSQL("CREATE SPATIAL INDEX ON test USING foo")
+
+    # The index is ignored once the file has been modified
+    gdal.FileFromMemBuffer(filename, content + '1001,0,"POINT (15 15)"\n')
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert get_ids(lyr, rects[0]) == expected[0] + [1001]
+
+
 ###############################################################################
 
 
@@ -1150,6 +1150,138 @@ def test_ogr_flatgeobuf_arrow_stream_numpy(layer_creation_options):
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
 
 
+###############################################################################
+# Test that attribute filters evaluated by the compiled evaluator, on features
+# and on Arrow batches, give the same result as the generic evaluator
+
+
+@pytest.mark.parametrize(
+    "where",
+    [
+        "int32 > 3",
+        "int32 >= 3 AND int32 < 7",
+        "3 < int32",
+        "int64 BETWEEN -2 AND 2",
+        "float64 = 1.5 OR int32 = 1.0",
+        "float64 IN (0, 1.5, -2)",
+        "int32 IN (1, 2, 5) OR str IN ('abc', 'DEF')",
+        "str = 'ABC'",
+        "str <> 'abc'",
+        "str > 'b' AND NOT flag",
+        "str BETWEEN 'a' AND 'c'",
+        "str IS NULL OR int16 IS NOT NULL",
+        "NOT (int32 > 3 OR float64 < 0)",
+        "int32 = int16",
+        "FID > 5 AND FID IN (1, 6, 7, 12)",
+        "datetime IS NULL",
+        "datetime > '2022/01/01'",
+    ],
+)
+def test_ogr_flatgeobuf_arrow_stream_compiled_filter(tmp_vsimem, where):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    field = ogr.FieldDefn("flag", ogr.OFTInteger)
+    field.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(field)
+    field = ogr.FieldDefn("int16", ogr.OFTInteger)
+    field.SetSubType(ogr.OFSTInt16)
+    lyr.CreateField(field)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("float64", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("datetime", ogr.OFTDateTime))
+    strs = ["abc", "ABC", "def", "", "b", "c"]
+    for i in range(50):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 7 != 0:
+            f["str"] = strs[i % len(strs)]
+        if i % 5 != 0:
+            f["flag"] = i % 2
+            f["int16"] = i % 4
+        if i % 6 != 0:
+            f["int32"] = i % 9
+            f["int64"] = i % 5 - 2
+            f["float64"] = (i % 6) * 0.5 - 1
+        if i % 3 != 0:
+            f["datetime"] = "2022/01/01 00:00:%02d" % i
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt("POINT(%d 0)" % i))
+        lyr.CreateFeature(f)
+    # NaN must not match any value of an IN list
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["float64"] = float("nan")
+    f.SetGeometryDirectly(ogr.CreateGeometryFromWkt("POINT(50 0)"))
+    lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+
+    def get_fids(compiled_filter):
+        with gdal.config_option("OGR_SQL_COMPILED_FILTER", compiled_filter):
+            lyr.SetAttributeFilter(where)
+        fids_features = [f.GetFID() for f in lyr]
+        fids_arrow = []
+        for options in ([], ["MAX_FEATURES_IN_BATCH=7"]):
+            stream = lyr.GetArrowStreamAsNumPy(options)
+            fids = []
+            for batch in stream:
+                fids += [int(fid) for fid in batch["OGC_FID"]]
+            fids_arrow.append(fids)
+        lyr.SetAttributeFilter(None)
+        assert fids_arrow[0] == fids_features
+        assert fids_arrow[1] == fids_features
+        return fids_features
+
+    expected = get_fids("NO")
+    assert expected
+    assert get_fids("YES") == expected
+
+
+###############################################################################
+# Test that the post-filtering of Arrow batches gives the same result whatever
+# the number of threads it uses
+
+
+def test_ogr_flatgeobuf_arrow_stream_post_filter_multithreaded(tmp_vsimem):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    for i in range(40000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int32"] = i % 11
+        f.SetGeometryDirectly(
+            ogr.CreateGeometryFromWkt("POINT(%d %d)" % (i % 200, i // 200))
+        )
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    lyr.SetSpatialFilter(
+        ogr.CreateGeometryFromWkt("POLYGON((0 0,0 150,190 190,100 0,0 0))")
+    )
+    lyr.SetAttributeFilter("int32 IN (1, 3, 4)")
+    fids_features = [f.GetFID() for f in lyr]
+    assert fids_features
+
+    for num_threads in ("1", "4"):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            stream = lyr.GetArrowStreamAsNumPy()
+            fids = []
+            for batch in stream:
+                fids += [int(fid) for fid in batch["OGC_FID"]]
+        assert fids == fids_features
+
+
 ###############################################################################
 # Test reading an empty file with GetArrowStream()
 
@@ -1650,3 +1782,113 @@ def test_ogr_flatgeobuf_write_empty_file_no_spatial_index(tmp_vsimem):
         assert lyr.GetFeatureCount() == 0
         assert lyr.GetExtent(can_return_null=True) is None
         assert lyr.GetSpatialRef().GetAuthorityCode(None) == "32631"
+
+
+###############################################################################
+# Test attribute indexes created with CREATE INDEX
+
+
+def test_ogr_flatgeobuf_sidecar_attribute_index(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.fgb")
+
+    def create_file(n):
+        with ogr.GetDriverByName("FlatGeobuf").CreateDataSource(filename) as ds:
+            lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+            lyr.CreateField(ogr.FieldDefn("ival", ogr.OFTInteger))
+            lyr.CreateField(ogr.FieldDefn("rval", ogr.OFTReal))
+            lyr.CreateField(ogr.FieldDefn("sval", ogr.OFTString))
+            for i in range(n):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                if i % 17 != 0:
+                    f["ival"] = (i * 7) % 101
+                    f["rval"] = ((i * 13) % 57) / 4.0
+                    f["sval"] = ("A", "b", "C", "d")[i % 4] + str(i % 10)
+                f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({i % 50} {i // 50})"))
+                lyr.CreateFeature(f)
+
+    create_file(2000)
+
+    filters = [
+        "ival = 5",
+        "ival IN (1, 2, 100)",
+        "ival > 90",
+        "ival <= 3",
+        "ival < 10.5",
+        "ival BETWEEN 20 AND 25",
+        "rval >= 13.5",
+        "rval > 2 AND rval < 3",
+        "sval = 'a3'",
+        "sval > 'C'",
+        "sval BETWEEN 'b' AND 'c5'",
+        "ival = 5 OR sval = 'D1'",
+        "ival > 1000",
+    ]
+    spatial_filter = ogr.CreateGeometryFromWkt("POLYGON((0 0,0 20,20 20,20 0,0 0))")
+
+    def get_fids(lyr, attr_filter, use_spatial_filter):
+        lyr.SetSpatialFilter(spatial_filter if use_spatial_filter else None)
+        lyr.SetAttributeFilter(attr_filter)
+        return [f.GetFID() for f in lyr]
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        expected = {
+            (attr_filter, use_spatial_filter): get_fids(
+                lyr, attr_filter, use_spatial_filter
+            )
+            for attr_filter in filters
+            for use_spatial_filter in (False, True)
+        }
+
+        for field in ("ival", "rval", "sval"):
+            ds.ExecuteSQL(f"CREATE INDEX ON test USING {field}")
+            assert gdal.VSIStatL(f"{filename}.test.{field}.ogridx") is not None
+
+        lyr.SetAttributeFilter(None)
+        assert lyr.GetFeatureCount() == 2000
+
+        for (attr_filter, use_spatial_filter), fids in expected.items():
+            assert (
+                get_fids(lyr, attr_filter, use_spatial_filter) == fids
+            ), attr_filter
+
+    # Rewriting the file makes the index out of date, hence ignored
+    create_file(1000)
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        lyr.SetAttributeFilter("ival = 5")
+        assert lyr.GetFeatureCount() == 10
+
+        ds.ExecuteSQL("DROP INDEX ON test USING ival")
+        assert gdal.VSIStatL(f"{filename}.test.ival.ogridx") is None
+
+
+###############################################################################
+# Test reading features in place from the mapped file
+
+
+@pytest.mark.parametrize("use_local_file", [False, True])
+def test_ogr_flatgeobuf_use_mmap(tmp_vsimem, tmp_path, use_local_file):
+
+    filename = str((tmp_path if use_local_file else tmp_vsimem) / "test_use_mmap.fgb")
+    with ogr.GetDriverByName("FlatGeobuf").CreateDataSource(filename) as ds:
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbLineString)
+        lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+        for i in range(100):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["str"] = "x" * i
+            f.SetGeometry(ogr.CreateGeometryFromWkt(f"LINESTRING ({i} 0,0 {i})"))
+            lyr.CreateFeature(f)
+
+    def read(open_options):
+        with gdal.OpenEx(filename, open_options=open_options) as ds:
+            lyr = ds.GetLayer(0)
+            return [(f["str"], f.GetGeometryRef().ExportToWkt()) for f in lyr]
+
+    expected = read([])
+    assert len(expected) == 100
+    assert read(["USE_MMAP=YES"]) == expected
+    with gdal.config_option("CPL_VSIL_USE_MMAP", "NO"):
+        assert read(["USE_MMAP=YES"]) == expected
@@ -27,6 +27,7 @@
 ###############################################################################
 
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -546,3 +547,116 @@ def test_ogr_join_on_special_field():
         assert f["a"] == "a2"
         assert f["b"] is None
         assert sql_lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test that the hash join strategy returns the same results as the attribute
+# filter one
+
+
+@pytest.mark.parametrize("max_memory", [None, "1000"])
+def test_ogr_join_hash_join(max_memory):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("first")
+    lyr.CreateField(ogr.FieldDefn("int_key", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("real_key", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    for i in range(100):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 10 != 9:
+            f["int_key"] = i % 40
+            f["real_key"] = (i % 40) + 0.5
+            f["str_key"] = ("KEY%d" if i % 2 else "key%d") % (i % 40)
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("second")
+    lyr.CreateField(ogr.FieldDefn("int_key", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("real_key", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for i in range(60):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i != 7:
+            # Keys are duplicated from 30: only the first match is used
+            f["int_key"] = i % 30
+            f["real_key"] = (i % 30) + 0.5
+            f["str_key"] = "key%d" % (i % 30)
+        f["val"] = "val%d" % i
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d 0)" % i))
+        lyr.CreateFeature(f)
+
+    def get_results(sql, hash_join):
+        options = {"OGR_SQL_HASH_JOIN": hash_join}
+        if max_memory:
+            options["OGR_SQL_MAX_MEMORY"] = max_memory
+        ret = []
+        with gdal.config_options(options):
+            with ds.ExecuteSQL(sql) as sql_lyr:
+                for f in sql_lyr:
+                    ret.append(
+                        (
+                            f.GetFID(),
+                            f["val"],
+                            (
+                                f.GetGeometryRef().ExportToWkt()
+                                if f.GetGeometryRef()
+                                else None
+                            ),
+                        )
+                    )
+        return ret
+
+    for key in ("int_key", "real_key", "str_key"):
+        for sql in (
+            f"SELECT first.*, second.val FROM first LEFT JOIN second ON first.{key} = second.{key}",
+            f"SELECT first.*, second.* FROM first LEFT JOIN second ON second.{key} = first.{key} ORDER BY first.{key}",
+        ):
+            expected = get_results(sql, "NO")
+            assert expected == get_results(sql, "YES")
+            assert len([x for x in expected if x[1] is not None]) > 0
+
+    # Mix of integer and real keys
+    sql = "SELECT first.*, second.val FROM first LEFT JOIN second ON first.int_key = second.real_key"
+    assert get_results(sql, "NO") == get_results(sql, "YES")
+
+
+###############################################################################
+# Test that the hash join strategy is not used for a secondary table of a
+# driver that evaluates attribute filters natively
+
+
+@pytest.mark.require_driver("GPKG")
+def test_ogr_join_hash_join_native_sql_driver(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test_ogr_join_hash_join_native_sql_driver.gpkg")
+    with ogr.GetDriverByName("GPKG").CreateDataSource(filename) as ds:
+        for name, count in (("first", 10), ("second", 100)):
+            lyr = ds.CreateLayer(name, geom_type=ogr.wkbNone)
+            lyr.CreateField(ogr.FieldDefn("key", ogr.OFTInteger))
+            lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+            for i in range(count):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                f["key"] = i
+                f["val"] = "%s%d" % (name, i)
+                lyr.CreateFeature(f)
+        ds.ExecuteSQL("CREATE INDEX idx_second_key ON second(key)")
+
+    debug_msgs = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    with ogr.Open(filename) as ds:
+        with gdal.config_option("CPL_DEBUG", "ON"):
+            with gdaltest.error_handler(handler):
+                gdal.SetCurrentErrorHandlerCatchDebug(True)
+                with ds.ExecuteSQL(
+                    "SELECT first.key, second.val FROM first "
+                    "LEFT JOIN second ON first.key = second.key",
+                    dialect="OGRSQL",
+                ) as sql_lyr:
+                    vals = [f["val"] for f in sql_lyr]
+    assert vals == ["second%d" % i for i in range(10)]
+    assert not any("Hash join" in msg for msg in debug_msgs)
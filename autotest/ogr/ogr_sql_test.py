@@ -1436,6 +1436,80 @@ def test_ogr_sql_48():
             assert sql_lyr.GetFeature(i)["int_field"] == lyr.GetFeature(i)["int_field"]
 
 
+###############################################################################
+# Test ORDER BY and DISTINCT with spilling to temporary files, and with the
+# parallel sort
+
+
+@pytest.mark.parametrize("max_memory", ["1000", None])
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_sql_order_by_distinct_spill(num_threads, max_memory):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("real_field", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    values = []
+    for i in range(3000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        int_val = None if (i % 97) == 0 else (i * 7919) % 113 - 50
+        real_val = ((i * 104729) % 1000) / 10.0 - 50
+        str_val = "val%d" % ((i * 31) % 500)
+        f["int_field"] = int_val
+        f["real_field"] = real_val
+        f["str_field"] = str_val
+        lyr.CreateFeature(f)
+        values.append((f.GetFID(), int_val, real_val, str_val))
+
+    with gdal.config_options(
+        {
+            "OGR_SQL_MAX_MEMORY": max_memory,
+            "GDAL_NUM_THREADS": num_threads,
+            # Sort slices of at least 100 entries in parallel
+            "OGR_SQL_SORT_MIN_ENTRIES_PER_THREAD": "100",
+        }
+    ):
+        with ds.ExecuteSQL(
+            "SELECT * FROM test ORDER BY int_field DESC, str_field, real_field DESC"
+        ) as sql_lyr:
+            got = [f.GetFID() for f in sql_lyr]
+        # Stable sort, from the least significant key
+        expected = sorted(values, key=lambda x: -x[2])
+        expected = sorted(expected, key=lambda x: x[3])
+        expected = sorted(
+            expected, key=lambda x: (x[1] is not None, x[1] or 0), reverse=True
+        )
+        assert got == [x[0] for x in expected]
+
+        with ds.ExecuteSQL("SELECT DISTINCT int_field FROM test") as sql_lyr:
+            got = [f["int_field"] for f in sql_lyr]
+        assert got == list(dict.fromkeys(x[1] for x in values))
+
+        with ds.ExecuteSQL(
+            "SELECT DISTINCT int_field FROM test ORDER BY int_field DESC"
+        ) as sql_lyr:
+            assert sql_lyr.GetFeatureCount() == 114
+            got = [f["int_field"] for f in sql_lyr]
+        assert got == sorted(
+            set(x[1] for x in values if x[1] is not None), reverse=True
+        ) + [None]
+
+        with ds.ExecuteSQL(
+            "SELECT DISTINCT str_field FROM test ORDER BY str_field"
+        ) as sql_lyr:
+            got = [f["str_field"] for f in sql_lyr]
+        assert got == sorted(set(x[3] for x in values))
+
+        with ds.ExecuteSQL(
+            "SELECT COUNT(DISTINCT str_field), COUNT(DISTINCT int_field), COUNT(*) FROM test"
+        ) as sql_lyr:
+            f = sql_lyr.GetNextFeature()
+            assert f.GetField(0) == 500
+            assert f.GetField(1) == 113
+            assert f.GetField(2) == 3000
+
+
 ###############################################################################
 # Test arithmetic expressions
 
@@ -2234,3 +2308,75 @@ def test_ogr_sql_union_layer_feature_count_add_overflow():
             "select * from test union all select * from test2", dialect="OGRSQL"
         ) as sql_lyr:
             assert sql_lyr.GetFeatureCount() == 0
+
+
+###############################################################################
+# Test that attribute filters evaluated by the compiled program give the same
+# result as the generic expression evaluator
+
+
+@pytest.mark.parametrize(
+    "where",
+    [
+        "i = 1",
+        "NOT i = 1",
+        "NOT (i = 1 OR s = 'b')",
+        "i = 1 OR s = 'b'",
+        "NOT i = 1 OR s IS NULL",
+        "NOT (i > 1 AND r < 0)",
+        "i IN (0, 2, 5)",
+        "NOT i IN (0, 2, 5)",
+        "i64 IN (-1, 3)",
+        "r IN (0, 0.5, 1.5)",
+        "NOT r IN (0, 0.5, 1.5)",
+        "s IN ('a', 'c', '')",
+        "NOT s IN ('a', 'c')",
+        "i BETWEEN 1 AND 3",
+        "NOT i BETWEEN 1 AND 3",
+        "r BETWEEN -0.5 AND 1",
+        "s BETWEEN 'a' AND 'b'",
+        "r = r",
+        "r <> r",
+        "NOT r < 1",
+        "i = i64",
+        "i64 < r",
+        "r >= r2",
+        "NOT r <> r2",
+        "s = s2",
+        "s < s2",
+        "fid = i",
+        " OR ".join("(i = %d" % j for j in range(40)) + ")" * 40,
+    ],
+)
+def test_ogr_sql_compiled_filter(where):
+
+    mem_ds = ogr.GetDriverByName("MEM").CreateDataSource("my_ds")
+    mem_lyr = mem_ds.CreateLayer("my_layer")
+    mem_lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    mem_lyr.CreateField(ogr.FieldDefn("i64", ogr.OFTInteger64))
+    mem_lyr.CreateField(ogr.FieldDefn("r", ogr.OFTReal))
+    mem_lyr.CreateField(ogr.FieldDefn("r2", ogr.OFTReal))
+    mem_lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    mem_lyr.CreateField(ogr.FieldDefn("s2", ogr.OFTString))
+    strs = ["a", "b", "c", "", "ab"]
+    for i in range(60):
+        f = ogr.Feature(mem_lyr.GetLayerDefn())
+        if i % 7 != 0:
+            f["i"] = i % 6
+            f["i64"] = i % 5 - 2
+        if i % 5 != 0:
+            f["r"] = float("nan") if i % 9 == 0 else (i % 6) * 0.5 - 1
+            f["r2"] = (i % 4) * 0.5 - 1
+        if i % 6 != 0:
+            f["s"] = strs[i % len(strs)]
+            f["s2"] = strs[i % 3]
+        mem_lyr.CreateFeature(f)
+
+    def get_fids(compiled_filter):
+        with gdal.config_option("OGR_SQL_COMPILED_FILTER", compiled_filter):
+            mem_lyr.SetAttributeFilter(where)
+        fids = [f.GetFID() for f in mem_lyr]
+        mem_lyr.SetAttributeFilter(None)
+        return fids
+
+    assert get_fids("YES") == get_fids("NO")
@@ -745,3 +745,112 @@ def test_gdalalg_raster_pipeline_info_executable():
         f"{gdal_path} raster pipeline read ../gcore/data/byte.tif ! info"
     )
     assert out.startswith("Driver: GTiff/GeoTIFF")
+
+
+
+@pytest.mark.parametrize("num_threads", ["1", "2", "ALL_CPUS"])
+def test_gdalalg_raster_pipeline_write_num_threads(tmp_vsimem, num_threads):
+
+    if not gdaltest.gdal_has_vrt_expression_dialect("muparser"):
+        pytest.skip("muparser not available")
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    gdal.Translate(
+        src_filename,
+        "../gcore/data/byte.tif",
+        width=1000,
+        height=1000,
+        creationOptions={"TILED": "YES"},
+    )
+
+    with gdal.Run(
+        "raster",
+        "pipeline",
+        output_format="MEM",
+        output="",
+        pipeline=f"read {src_filename} ! calc --calc 255-X ! resize --size 500,500 ! write -j 1",
+    ) as alg:
+        expected_checksum = alg.Output().GetRasterBand(1).Checksum()
+
+    out_filename = str(tmp_vsimem / "out.tif")
+    gdal.Run(
+        "raster",
+        "pipeline",
+        pipeline=f"read {src_filename} ! calc --calc 255-X ! resize --size 500,500 ! write {out_filename} -j {num_threads}",
+    )
+
+    with gdal.Open(out_filename) as ds:
+        assert ds.RasterXSize == 500
+        assert ds.GetRasterBand(1).Checksum() == expected_checksum
+
+
+@pytest.mark.parametrize("gdal_num_threads", [None, "2"])
+def test_gdalalg_raster_pipeline_write_num_threads_default(
+    tmp_vsimem, gdal_num_threads
+):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    gdal.Translate(
+        src_filename,
+        "../gcore/data/byte.tif",
+        width=1000,
+        height=1000,
+        creationOptions={"TILED": "YES"},
+    )
+
+    debug_msgs = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    tab_pct = [0]
+
+    def my_progress(pct, msg, user_data):
+        assert pct >= tab_pct[0]
+        tab_pct[0] = pct
+        return True
+
+    out_filename = str(tmp_vsimem / "out.tif")
+    with gdaltest.config_options(
+        {"CPL_DEBUG": "ON", "GDAL_NUM_THREADS": gdal_num_threads}
+    ):
+        with gdaltest.error_handler(handler):
+            gdal.SetCurrentErrorHandlerCatchDebug(True)
+            gdal.Run(
+                "raster",
+                "pipeline",
+                pipeline=f"read {src_filename} ! resize --size 500,500 ! write {out_filename}",
+                progress=my_progress,
+            )
+
+    assert tab_pct[0] == 1
+    parallel = any("Evaluating input of write step" in msg for msg in debug_msgs)
+    assert parallel == (gdal_num_threads is not None and gdal.GetNumCPUs() > 1)
+
+    with gdal.Open(out_filename) as ds:
+        assert ds.RasterXSize == 500
+
+
+def test_gdalalg_raster_pipeline_write_num_threads_interrupted(tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    gdal.Translate(
+        src_filename,
+        "../gcore/data/byte.tif",
+        width=1000,
+        height=1000,
+        creationOptions={"TILED": "YES"},
+    )
+
+    def my_progress(pct, msg, user_data):
+        return pct == 0
+
+    out_filename = str(tmp_vsimem / "out.tif")
+    with pytest.raises(Exception, match="User terminated"):
+        gdal.Run(
+            "raster",
+            "pipeline",
+            pipeline=f"read {src_filename} ! resize --size 500,500 ! write {out_filename} -j 2",
+            progress=my_progress,
+        )
@@ -425,6 +425,62 @@ def test_gdalalg_vector_clip_geom_not_rectangle():
     assert out_lyr.GetNextFeature() is None
 
 
+def test_gdalalg_vector_clip_geom_fully_inside():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    src_lyr = src_ds.CreateLayer("test")
+    src_lyr.CreateField(ogr.FieldDefn("foo"))
+
+    # Geometries fully inside the clipping geometry are kept unmodified
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["foo"] = "inside"
+    f.SetGeometry(
+        ogr.CreateGeometryFromWkt(
+            "POLYGON Z ((0.1 0.1 1,0.5 0.1 2,0.5 0.5 3,0.1 0.5 4,0.1 0.1 1))"
+        )
+    )
+    src_lyr.CreateFeature(f)
+
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["foo"] = "partial"
+    f.SetGeometry(
+        ogr.CreateGeometryFromWkt("POLYGON ((0.5 0.5,0.5 2,2 2,2 0.5,0.5 0.5))")
+    )
+    src_lyr.CreateFeature(f)
+
+    clip = get_clip_alg()
+    clip["input"] = src_ds
+
+    assert clip.ParseCommandLineArguments(
+        [
+            "--geometry",
+            "POLYGON ((0 0,0 1,1 1,1 0,0 0))",
+            "--of",
+            "MEM",
+            "--output",
+            "memory_ds",
+        ]
+    )
+    assert clip.Run()
+
+    out_ds = clip["output"].GetDataset()
+    out_lyr = out_ds.GetLayer(0)
+    out_f = out_lyr.GetNextFeature()
+    assert out_f["foo"] == "inside"
+    assert (
+        out_f.GetGeometryRef().ExportToIsoWkt()
+        == "POLYGON Z ((0.1 0.1 1,0.5 0.1 2,0.5 0.5 3,0.1 0.5 4,0.1 0.1 1))"
+    )
+
+    out_f = out_lyr.GetNextFeature()
+    assert out_f["foo"] == "partial"
+    ogrtest.check_feature_geometry(
+        out_f, "POLYGON ((0.5 0.5,0.5 1,1 1,1 0.5,0.5 0.5))"
+    )
+
+    assert out_lyr.GetNextFeature() is None
+
+
 def test_gdalalg_vector_clip_intersection_incompatible_geometry_type():
 
     src_ds = gdal.GetDriverByName("MEM").Create("", 0, 0, 0, gdal.GDT_Unknown)
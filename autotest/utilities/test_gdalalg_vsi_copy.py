@@ -182,6 +182,57 @@ def test_gdalalg_vsi_copy_source_ends_slash_star(tmp_vsimem):
     assert set(res) == set(["a", "subdir/"])
 
 
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gdalalg_vsi_copy_recursive_zip(tmp_vsimem, num_threads):
+
+    zipfilename = tmp_vsimem / "src.zip"
+    big = b"".join(b"%08d" % i for i in range(100000))
+    gdal.FileFromMemBuffer(tmp_vsimem / "big.bin", big)
+    assert (
+        gdal.CopyFile(
+            tmp_vsimem / "big.bin",
+            f"/vsizip/{zipfilename}/subdir/big.bin",
+            options=["SOZIP_ENABLED=YES", "SOZIP_CHUNK_SIZE=1024"],
+        )
+        == 0
+    )
+    for i in range(10):
+        gdal.FileFromMemBuffer(tmp_vsimem / "small.bin", b"%d" % i)
+        assert (
+            gdal.CopyFile(tmp_vsimem / "small.bin", f"/vsizip/{zipfilename}/{i}.txt")
+            == 0
+        )
+
+    last_pct = [0]
+
+    def my_progress(pct, msg, user_data):
+        last_pct[0] = pct
+        return True
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        alg = get_alg()
+        alg["source"] = f"/vsizip/{zipfilename}"
+        alg["destination"] = tmp_vsimem / "dst"
+        alg["recursive"] = True
+        assert alg.Run(my_progress)
+    assert last_pct[0] == 1.0
+    assert set(gdal.ReadDirRecursive(tmp_vsimem / "dst")) == set(
+        gdal.ReadDirRecursive(f"/vsizip/{zipfilename}")
+    )
+    with gdal.VSIFile(tmp_vsimem / "dst" / "subdir" / "big.bin", "rb") as f:
+        assert f.read() == big
+    for i in range(10):
+        with gdal.VSIFile(tmp_vsimem / "dst" / f"{i}.txt", "rb") as f:
+            assert f.read() == b"%d" % i
+
+    alg = get_alg()
+    alg["source"] = f"/vsizip/{zipfilename}/subdir"
+    alg["destination"] = tmp_vsimem / "dst2"
+    alg["recursive"] = True
+    assert alg.Run()
+    assert gdal.ReadDirRecursive(tmp_vsimem / "dst2") == ["big.bin"]
+
+
 def test_gdalalg_vsi_copy_recursive_destination_cannot_be_created(tmp_vsimem):
 
     gdal.Mkdir(tmp_vsimem / "src", 0o755)
@@ -211,3 +262,25 @@ def test_gdalalg_vsi_copy_recursive_destination_cannot_be_created_skip(tmp_vsime
     alg["skip-errors"] = True
     with gdal.quiet_errors():
         assert alg.Run()
+
+
+def test_gdalalg_vsi_copy_recursive_zip_destination_cannot_be_created(tmp_vsimem):
+
+    zipfilename = tmp_vsimem / "src.zip"
+    gdal.FileFromMemBuffer(tmp_vsimem / "small.bin", "foo")
+    assert gdal.CopyFile(tmp_vsimem / "small.bin", f"/vsizip/{zipfilename}/a") == 0
+
+    alg = get_alg()
+    alg["source"] = f"/vsizip/{zipfilename}"
+    alg["destination"] = "/i_do/not/exist"
+    alg["recursive"] = True
+    with pytest.raises(Exception, match="Cannot create directory /i_do/not/exist"):
+        alg.Run()
+
+    alg = get_alg()
+    alg["source"] = f"/vsizip/{zipfilename}"
+    alg["destination"] = "/i_do/not/exist"
+    alg["recursive"] = True
+    alg["skip-errors"] = True
+    with gdal.quiet_errors():
+        assert alg.Run()
@@ -0,0 +1,50 @@
+#!/usr/bin/env pytest
+# -*- coding: utf-8 -*-
+###############################################################################
+# Project:  GDAL/OGR Test Suite
+# Purpose:  'gdal vsi metrics' testing
+# Author:   NextGIS <info at nextgis dot com>
+#
+###############################################################################
+# Copyright (c) 2026, NextGIS <info at nextgis dot com>
+#
+# SPDX-License-Identifier: MIT
+###############################################################################
+
+import json
+
+import pytest
+
+from osgeo import gdal
+
+
+def get_alg():
+    return gdal.GetGlobalAlgorithmRegistry()["vsi"]["metrics"]
+
+
+def test_gdalalg_vsi_metrics(tmp_path):
+
+    # /vsimem/ files are not wrapped by VSI_CACHE, hence use a local file
+    filename = tmp_path / "test"
+    with open(filename, "wb") as f:
+        f.write(b"test")
+
+    with gdal.config_option("VSI_CACHE", "YES"):
+        alg = get_alg()
+        alg["read"] = filename
+        alg["reset"] = True
+        assert alg.Run()
+    j = json.loads(alg["output-string"])
+    assert j["enabled"]
+    assert j["caches"]["vsi_cache"]["misses"] >= 1
+
+    j = json.loads(gdal.IOMetricsGetAsSerializedJSON())
+    assert j["caches"]["vsi_cache"]["misses"] == 0
+
+
+def test_gdalalg_vsi_metrics_read_error():
+
+    alg = get_alg()
+    alg["read"] = "/i_do/not/exist"
+    with pytest.raises(Exception, match="Cannot open"):
+        alg.Run()
@@ -258,6 +258,7 @@ else ()
   check_type_size("off_t" SIZEOF_OFF_T)
 
   check_function_exists(pread64 HAVE_PREAD64)
+  check_function_exists(posix_fadvise HAVE_POSIX_FADVISE)
 
   check_function_exists(ftruncate64 HAVE_FTRUNCATE64)
   if (HAVE_FTRUNCATE64)
@@ -1044,6 +1044,13 @@ man_pages = [
         [author_evenr],
         1,
     ),
+    (
+        "programs/gdal_vsi_metrics",
+        "gdal-vsi-metrics",
+        "Report I/O metrics of GDAL Virtual System Interface (VSI) file systems",
+        [author_evenr],
+        1,
+    ),
     (
         "programs/gdal_vsi_move",
         "gdal-vsi-move",
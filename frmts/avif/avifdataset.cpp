@@ -11,6 +11,7 @@
 
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 #include "cpl_minixml.h"
 #include "cpl_multiproc.h"
 #include "cpl_vsi_virtual.h"
@@ -489,6 +490,8 @@ bool GDALAVIFDataset::Init(GDALOpenInfo *poOpenInfo)
     if (!m_decoder)
         return false;
 
+    m_decoder->maxThreads = GDALGetNumThreads(nullptr, nullptr, "ALL_CPUS");
+
     std::string osFilename(poOpenInfo->pszFilename);
     VSIVirtualHandleUniquePtr fp(poOpenInfo->fpL);
     poOpenInfo->fpL = nullptr;
@@ -930,13 +933,8 @@ GDALDataset *GDALAVIFDataset::CreateCopy(const char *pszFilename,
             avifCodecChoiceFromName(CPLString(pszCodec).tolower().c_str());
     }
 
-    const char *pszThreads = CSLFetchNameValueDef(
-        papszOptions, "NUM_THREADS",
-        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"));
-    if (pszThreads && !EQUAL(pszThreads, "ALL_CPUS"))
-        encoder->maxThreads = atoi(pszThreads);
-    else
-        encoder->maxThreads = CPLGetNumCPUs();
+    encoder->maxThreads =
+        GDALGetNumThreads(papszOptions, "NUM_THREADS", "ALL_CPUS");
 
 #if AVIF_VERSION_MAJOR >= 1
     encoder->quality = nQuality;
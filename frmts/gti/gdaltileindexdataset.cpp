@@ -347,6 +347,9 @@ class GDALTileIndexDataset final : public GDALPamDataset
     //! Whereas the multi-threading rendering code path must be used. Updated by CollectSources().
     bool m_bLastMustUseMultiThreading = false;
 
+    //! Whether overlapping sources have been opened concurrently. Updated by CollectSources().
+    bool m_bLastOpenedSourcesConcurrently = false;
+
     //! Whether the GTI file is a STAC collection
     bool m_bSTACCollection = false;
 
@@ -362,6 +365,28 @@ class GDALTileIndexDataset final : public GDALPamDataset
     //! Sort sources according to m_nSortFieldIndex.
     void SortSourceDesc();
 
+    //! Result of the opening of a source by OpenSourcesConcurrently()
+    struct OpenedSource
+    {
+        SourceDesc oSourceDesc{};
+        bool bOK = false;
+        CPLErrorAccumulator oErrorAccumulator{};
+    };
+
+    //! Open concurrently the sources m_aoSourceDesc[iStart:iEnd[.
+    //! Used by CollectSources() when sources are overlapping.
+    void OpenSourcesConcurrently(
+        size_t iStart, size_t iEnd,
+        std::vector<std::unique_ptr<OpenedSource>> &apoOpenedSources);
+
+    //! Read concurrently the windows of the sources that RenderSource() will
+    //! request, so that they are in the block cache of each source when
+    //! rendering them serially in priority order.
+    void PrefetchSources(double dfXOff, double dfYOff, double dfXSize,
+                         double dfYSize, int nBufXSize, int nBufYSize,
+                         int nBandCount, BANDMAP_TYPE panBandMap,
+                         GDALRasterIOExtraArg *psExtraArg);
+
     //! Whether the output buffer needs to be nodata initialized, or if
     //! sources are fully covering it.
     bool NeedInitBuffer(int nBandCount, const int *panBandMap) const;
@@ -2438,6 +2463,10 @@ const char *GDALTileIndexDataset::GetMetadataItem(const char *pszName,
         {
             return m_bLastMustUseMultiThreading ? "1" : "0";
         }
+        else if (EQUAL(pszName, "CONCURRENT_SOURCE_OPENING_LAST_USED"))
+        {
+            return m_bLastOpenedSourcesConcurrently ? "1" : "0";
+        }
     }
     return GDALPamDataset::GetMetadataItem(pszName, pszDomain);
 }
@@ -3571,26 +3600,35 @@ bool GDALTileIndexDataset::GetSourceDesc(const std::string &osTileName,
 
             if (bExportSRS)
             {
-                if (m_osWKT.empty())
+                std::string osWKT;
                 {
-                    char *pszWKT = nullptr;
-                    const char *const apszWKTOptions[] = {"FORMAT=WKT2_2019",
-                                                          nullptr};
-                    m_oSRS.exportToWkt(&pszWKT, apszWKTOptions);
-                    if (pszWKT)
-                        m_osWKT = pszWKT;
-                    CPLFree(pszWKT);
-
+                    // m_osWKT is lazily initialized, possibly from several
+                    // threads when sources are opened concurrently.
+                    std::unique_lock<std::mutex> oLock;
+                    if (pMutex)
+                        oLock = std::unique_lock<std::mutex>(*pMutex);
                     if (m_osWKT.empty())
                     {
-                        CPLError(CE_Failure, CPLE_AppDefined,
-                                 "Cannot export VRT SRS to WKT2");
-                        return false;
+                        char *pszWKT = nullptr;
+                        const char *const apszWKTOptions[] = {
+                            "FORMAT=WKT2_2019", nullptr};
+                        m_oSRS.exportToWkt(&pszWKT, apszWKTOptions);
+                        if (pszWKT)
+                            m_osWKT = pszWKT;
+                        CPLFree(pszWKT);
                     }
+                    osWKT = m_osWKT;
+                }
+
+                if (osWKT.empty())
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Cannot export VRT SRS to WKT2");
+                    return false;
                 }
 
                 aosOptions.AddString("-t_srs");
-                aosOptions.AddString(m_osWKT.c_str());
+                aosOptions.AddString(osWKT.c_str());
             }
 
             // First pass to get the extent of the tile in the
@@ -3787,6 +3825,7 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
     m_dfLastMaxXFilter = dfMaxX;
     m_dfLastMaxYFilter = dfMaxY;
     m_bLastMustUseMultiThreading = false;
+    m_bLastOpenedSourcesConcurrently = false;
 
     OGRLayer *poSQLLayer = nullptr;
     if (!m_osSpatialSQL.empty())
@@ -3837,6 +3876,17 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
     if (poSQLLayer)
         ReleaseResultSet(poSQLLayer);
 
+    // Opening sources is typically dominated by I/O latency (e.g. on
+    // network storage), which is independent of the size of the request.
+    // Hence we do not apply MINIMUM_PIXEL_COUNT_FOR_THREADED_IO to it.
+    size_t nOpenBatchSize = 1;
+    if (bMultiThreadAllowed && m_aoSourceDesc.size() > 1)
+    {
+        if (m_nNumThreads < 0)
+            m_nNumThreads = GetNumThreads();
+        nOpenBatchSize = static_cast<size_t>(std::max(1, m_nNumThreads));
+    }
+
     constexpr int MINIMUM_PIXEL_COUNT_FOR_THREADED_IO = 1000 * 1000;
     if (bMultiThreadAllowed && m_aoSourceDesc.size() > 1 &&
         dfXSize * dfYSize > MINIMUM_PIXEL_COUNT_FOR_THREADED_IO)
@@ -3933,6 +3983,11 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
 
     // Try to find the last (most priority) fully opaque source covering
     // the whole AOI. We only need to start rendering from it.
+    // When multi-threading is allowed, sources are opened concurrently by
+    // batches of nOpenBatchSize, starting from the most priority ones, so
+    // that we do not open many more sources than the serial code path.
+    std::vector<std::unique_ptr<OpenedSource>> apoOpenedSources;
+    size_t iBatchStart = m_aoSourceDesc.size();
     size_t i = m_aoSourceDesc.size();
     while (i > 0)
     {
@@ -3944,8 +3999,27 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
             pszTileName, GetDescription(), m_bSTACCollection));
 
         SourceDesc oSourceDesc;
-        if (!GetSourceDesc(osTileName, oSourceDesc, nullptr))
+        if (nOpenBatchSize > 1)
+        {
+            if (i < iBatchStart)
+            {
+                iBatchStart = i + 1 > nOpenBatchSize ? i + 1 - nOpenBatchSize
+                                                     : 0;
+                OpenSourcesConcurrently(iBatchStart, i + 1, apoOpenedSources);
+                m_bLastOpenedSourcesConcurrently = true;
+            }
+            auto &poOpenedSource = apoOpenedSources[i - iBatchStart];
+            // Replay errors and warnings only for sources we actually use,
+            // in the same order as the serial code path would emit them.
+            poOpenedSource->oErrorAccumulator.ReplayErrors();
+            if (!poOpenedSource->bOK)
+                return false;
+            oSourceDesc = std::move(poOpenedSource->oSourceDesc);
+        }
+        else if (!GetSourceDesc(osTileName, oSourceDesc, nullptr))
+        {
             return false;
+        }
 
         // Check consistency of bounding box in tile index vs actual
         // extent of the tile.
@@ -4047,6 +4121,219 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
     return true;
 }
 
+/************************************************************************/
+/*                      OpenSourcesConcurrently()                       */
+/************************************************************************/
+
+void GDALTileIndexDataset::OpenSourcesConcurrently(
+    size_t iStart, size_t iEnd,
+    std::vector<std::unique_ptr<OpenedSource>> &apoOpenedSources)
+{
+    CPLAssert(iStart < iEnd && iEnd <= m_aoSourceDesc.size());
+    apoOpenedSources.clear();
+    std::vector<std::string> aosTileNames;
+    for (size_t i = iStart; i < iEnd; ++i)
+    {
+        apoOpenedSources.push_back(std::make_unique<OpenedSource>());
+        aosTileNames.push_back(GetAbsoluteFileName(
+            m_aoSourceDesc[i].poFeature->GetFieldAsString(
+                m_nLocationFieldIndex),
+            GetDescription(), m_bSTACCollection));
+    }
+
+    // A tile may be referenced by several features. Only open concurrently
+    // its first occurrence: the other ones are opened afterwards, from the
+    // cache of shared sources.
+    std::vector<size_t> anUniqueIdx;
+    std::vector<size_t> anDuplicateIdx;
+    {
+        std::set<std::string> oSetTileNames;
+        for (size_t i = 0; i < aosTileNames.size(); ++i)
+        {
+            if (oSetTileNames.insert(aosTileNames[i]).second)
+                anUniqueIdx.push_back(i);
+            else
+                anDuplicateIdx.push_back(i);
+        }
+    }
+
+    const auto OpenSource = [this, &apoOpenedSources,
+                             &aosTileNames](size_t i, std::mutex *pMutex)
+    {
+        auto &poOpenedSource = apoOpenedSources[i];
+        auto oAccumulator =
+            poOpenedSource->oErrorAccumulator.InstallForCurrentScope();
+        CPL_IGNORE_RET_VAL(oAccumulator);
+        poOpenedSource->bOK = GetSourceDesc(
+            aosTileNames[i], poOpenedSource->oSourceDesc, pMutex);
+    };
+
+    CPLWorkerThreadPool *psThreadPool =
+        anUniqueIdx.size() > 1
+            ? GDALGetGlobalThreadPool(static_cast<int>(anUniqueIdx.size()))
+            : nullptr;
+    if (!psThreadPool)
+    {
+        // Only one distinct source, or no thread pool. Serial opening.
+        for (size_t i = 0; i < aosTileNames.size(); ++i)
+            OpenSource(i, nullptr);
+        return;
+    }
+
+    CPLDebugOnly("GTI", "Opening %d sources concurrently",
+                 static_cast<int>(anUniqueIdx.size()));
+
+    auto oQueue = psThreadPool->CreateJobQueue();
+    for (const size_t i : anUniqueIdx)
+    {
+        auto pMutex = &m_oQueueWorkingStates.oMutex;
+        const auto Func = [&OpenSource, i, pMutex]() { OpenSource(i, pMutex); };
+        if (!oQueue->SubmitJob(Func))
+        {
+            // Run it in the current thread
+            Func();
+        }
+    }
+    oQueue->WaitCompletion();
+
+    for (const size_t i : anDuplicateIdx)
+        OpenSource(i, nullptr);
+}
+
+/************************************************************************/
+/*                          PrefetchSources()                           */
+/************************************************************************/
+
+void GDALTileIndexDataset::PrefetchSources(
+    double dfXOff, double dfYOff, double dfXSize, double dfYSize,
+    int nBufXSize, int nBufYSize, int nBandCount, BANDMAP_TYPE panBandMap,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    if (m_aoSourceDesc.size() <= 1)
+        return;
+    if (m_nNumThreads < 0)
+        m_nNumThreads = GetNumThreads();
+    if (m_nNumThreads <= 1)
+        return;
+
+    const GDALRIOResampleAlg eResampleAlg =
+        psExtraArg->eResampleAlg != GRIORA_NearestNeighbour
+            ? psExtraArg->eResampleAlg
+            : m_eResampling;
+
+    struct PrefetchRequest
+    {
+        GDALDataset *poDS = nullptr;
+        int nReqXOff = 0;
+        int nReqYOff = 0;
+        int nReqXSize = 0;
+        int nReqYSize = 0;
+        int nOutXSize = 0;
+        int nOutYSize = 0;
+        GDALDataType eDT = GDT_Unknown;
+        std::vector<int> anBands{};
+    };
+
+    std::vector<PrefetchRequest> aoRequests;
+    std::set<GDALDataset *> oSetDS;
+    GIntBig nTotalBytes = 0;
+    for (const auto &oSourceDesc : m_aoSourceDesc)
+    {
+        GDALDataset *poTileDS = oSourceDesc.poDS.get();
+        // The same dataset may be listed several times in the tile index,
+        // and it must not be accessed concurrently.
+        if (!poTileDS || !oSetDS.insert(poTileDS).second)
+            continue;
+
+        PrefetchRequest oReq;
+        oReq.poDS = poTileDS;
+        for (int i = 0; i < nBandCount; ++i)
+        {
+            if (panBandMap[i] >= 1 &&
+                panBandMap[i] <= poTileDS->GetRasterCount())
+                oReq.anBands.push_back(panBandMap[i]);
+        }
+        if (oReq.anBands.empty())
+            continue;
+
+        auto poTileBand = poTileDS->GetRasterBand(oReq.anBands[0]);
+        oReq.eDT = poTileBand->GetRasterDataType();
+
+        double dfReqXOff = 0.0;
+        double dfReqYOff = 0.0;
+        double dfReqXSize = 0.0;
+        double dfReqYSize = 0.0;
+        int nOutXOff = 0;
+        int nOutYOff = 0;
+        bool bError = false;
+        oSourceDesc.poSource->SetRasterBand(poTileBand, false);
+        if (!oSourceDesc.poSource->GetSrcDstWindow(
+                dfXOff, dfYOff, dfXSize, dfYSize, nBufXSize, nBufYSize,
+                eResampleAlg, &dfReqXOff, &dfReqYOff, &dfReqXSize, &dfReqYSize,
+                &oReq.nReqXOff, &oReq.nReqYOff, &oReq.nReqXSize,
+                &oReq.nReqYSize, &nOutXOff, &nOutYOff, &oReq.nOutXSize,
+                &oReq.nOutYSize, bError))
+        {
+            continue;
+        }
+
+        nTotalBytes += static_cast<GIntBig>(oReq.nOutXSize) * oReq.nOutYSize *
+                       static_cast<int>(oReq.anBands.size()) *
+                       GDALGetDataTypeSizeBytes(oReq.eDT);
+        aoRequests.push_back(std::move(oReq));
+    }
+
+    // Prefetching is only useful if the blocks of all sources can remain
+    // in the block cache until they are rendered.
+    if (aoRequests.size() <= 1 || nTotalBytes > GDALGetCacheMax64() / 2)
+        return;
+
+    CPLWorkerThreadPool *psThreadPool = GDALGetGlobalThreadPool(
+        std::min(static_cast<int>(aoRequests.size()), m_nNumThreads));
+    if (!psThreadPool)
+        return;
+
+    CPLDebugOnly("GTI", "Prefetching %d sources concurrently",
+                 static_cast<int>(aoRequests.size()));
+
+    auto oQueue = psThreadPool->CreateJobQueue();
+    for (const auto &oReq : aoRequests)
+    {
+        const auto pReq = &oReq;
+        oQueue->SubmitJob(
+            [pReq, eResampleAlg]()
+            {
+                const size_t nDTSize = GDALGetDataTypeSizeBytes(pReq->eDT);
+                std::vector<GByte> abyBuffer;
+                try
+                {
+                    abyBuffer.resize(static_cast<size_t>(pReq->nOutXSize) *
+                                     pReq->nOutYSize * pReq->anBands.size() *
+                                     nDTSize);
+                }
+                catch (const std::exception &)
+                {
+                    return;
+                }
+
+                GDALRasterIOExtraArg sExtraArg;
+                INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+                sExtraArg.eResampleAlg = eResampleAlg;
+
+                // Errors will be emitted again, in the main thread, when
+                // rendering the source.
+                CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+                CPL_IGNORE_RET_VAL(pReq->poDS->RasterIO(
+                    GF_Read, pReq->nReqXOff, pReq->nReqYOff, pReq->nReqXSize,
+                    pReq->nReqYSize, abyBuffer.data(), pReq->nOutXSize,
+                    pReq->nOutYSize, pReq->eDT,
+                    static_cast<int>(pReq->anBands.size()),
+                    pReq->anBands.data(), 0, 0, 0, &sExtraArg));
+            });
+    }
+    oQueue->WaitCompletion();
+}
+
 /************************************************************************/
 /*                          SortSourceDesc()                            */
 /************************************************************************/
@@ -4871,6 +5158,11 @@ CPLErr GDALTileIndexDataset::IRasterIO(
         }
         else
         {
+            // Overlapping sources must be rendered in priority order, but
+            // their pixels can be fetched concurrently beforehand.
+            PrefetchSources(dfXOff, dfYOff, dfXSize, dfYSize, nBufXSize,
+                            nBufYSize, nBandCount, panBandMap, psExtraArg);
+
             // Now render from bottom of the stack to top.
             for (auto &oSourceDesc : m_aoSourceDesc)
             {
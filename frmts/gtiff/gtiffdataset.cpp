@@ -943,6 +943,14 @@ void GTiffDataset::RestoreVolatileParameters(TIFF *hTIFF)
         GTiffSetDeflateSubCodec(hTIFF);
     }
 
+#ifdef HAVE_JXL
+    if (m_nJXLNumThreads > 1 && (m_nCompression == COMPRESSION_JXL ||
+                                 m_nCompression == COMPRESSION_JXL_DNG_1_7))
+    {
+        TIFFSetField(hTIFF, TIFFTAG_JXL_NUM_THREADS, m_nJXLNumThreads);
+    }
+#endif
+
     /* -------------------------------------------------------------------- */
     /*      Propagate any quality settings.                                 */
     /* -------------------------------------------------------------------- */
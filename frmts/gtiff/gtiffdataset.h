@@ -171,6 +171,7 @@ class GTiffDataset final : public GDALPamDataset
     float m_fJXLDistance = 1.0f;
     float m_fJXLAlphaDistance = -1.0f;  // -1 = same as non-alpha channel
     uint32_t m_nJXLEffort = 5;
+    int m_nJXLNumThreads = 1;  // threads used by libjxl for a single block
 #endif
     double m_dfNoDataValue = DEFAULT_NODATA_VALUE;
     int64_t m_nNoDataValueInt64 = GDAL_PAM_DEFAULT_NODATA_VALUE_INT64;
@@ -6509,6 +6509,10 @@ const char *GTiffDataset::GetMetadataItem(const char *pszName,
         {
             return CPLSPrintf("%u", m_nJXLEffort);
         }
+        else if (EQUAL(pszName, "JXL_NUM_THREADS"))
+        {
+            return CPLSPrintf("%d", m_nJXLNumThreads);
+        }
 #endif
         return nullptr;
     }
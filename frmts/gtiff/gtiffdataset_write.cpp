@@ -902,8 +902,18 @@ bool GTiffDataset::WriteEncodedStrip(uint32_t strip, GByte *pabyData,
 void GTiffDataset::InitCompressionThreads(bool bUpdateMode,
                                           CSLConstList papszOptions)
 {
-    // Raster == tile, then no need for threads
-    if (m_nBlockXSize == nRasterXSize && m_nBlockYSize == nRasterYSize)
+    const bool bSingleBlock =
+        m_nBlockXSize == nRasterXSize && m_nBlockYSize == nRasterYSize;
+#ifdef HAVE_JXL
+    const bool bIsJXL = m_nCompression == COMPRESSION_JXL ||
+                        m_nCompression == COMPRESSION_JXL_DNG_1_7;
+#else
+    constexpr bool bIsJXL = false;
+#endif
+
+    // Raster == tile, then no need for threads (except for codecs that
+    // can use several threads to process a single tile)
+    if (bSingleBlock && !bIsJXL)
         return;
 
     const char *pszValue = CSLFetchNameValue(papszOptions, "NUM_THREADS");
@@ -915,6 +925,33 @@ void GTiffDataset::InitCompressionThreads(bool bUpdateMode,
             EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
         if (nThreads > 1024)
             nThreads = 1024;  // to please Coverity
+#ifdef HAVE_JXL
+        // The JPEG-XL codec uses its own threads, outside of the global
+        // thread pool.
+        nThreads = std::min(nThreads, GDALGetMaxNumThreads());
+        if (bIsJXL && nThreads > 1)
+        {
+            // Give the JPEG-XL codec the threads that are not already used
+            // to process several tiles/strips in parallel, so as not to
+            // oversubscribe the CPUs.
+            const int nBlocks = m_nPlanarConfig == PLANARCONFIG_SEPARATE
+                                    ? m_nBlocksPerBand * nBands
+                                    : m_nBlocksPerBand;
+            m_nJXLNumThreads =
+                std::max(1, nThreads / std::max(1, std::min(nBlocks, nThreads)));
+            if (m_nJXLNumThreads > 1)
+            {
+                CPLDebug("GTiff",
+                         "Using up to %d threads for JPEG-XL compression/"
+                         "decompression of a single block",
+                         m_nJXLNumThreads);
+                TIFFSetField(m_hTIFF, TIFFTAG_JXL_NUM_THREADS,
+                             m_nJXLNumThreads);
+            }
+        }
+#endif
+        if (bSingleBlock)
+            return;
         if (nThreads > 1)
         {
             if ((bUpdateMode && m_nCompression != COMPRESSION_NONE) ||
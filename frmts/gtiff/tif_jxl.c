@@ -27,6 +27,9 @@
 
 #include <jxl/decode.h>
 #include <jxl/encode.h>
+#ifdef HAVE_JXL_THREADS
+#include <jxl/resizable_parallel_runner.h>
+#endif
 
 #include <stdint.h>
 
@@ -46,6 +49,7 @@ typedef struct
     int effort;           /* 3 to 9. default: 7 */
     float distance;       /* 0 to 15. default: 1.0 */
     float alpha_distance; /* 0 to 15. default: -1.0 (same as distance) */
+    uint32_t num_threads; /* threads used within a strip/tile. default: 1 */
 
     uint32_t segment_width;
     uint32_t segment_height;
@@ -57,6 +61,10 @@ typedef struct
 
     JxlDecoder *decoder;
 
+#ifdef HAVE_JXL_THREADS
+    void *runner; /* JxlResizableParallelRunner, when num_threads > 1 */
+#endif
+
     TIFFVGetMethod vgetparent; /* super-class method */
     TIFFVSetMethod vsetparent; /* super-class method */
 } JXLState;
@@ -68,6 +76,37 @@ typedef struct
 static int JXLEncode(TIFF *tif, uint8_t *bp, tmsize_t cc, uint16_t s);
 static int JXLDecode(TIFF *tif, uint8_t *op, tmsize_t occ, uint16_t s);
 
+#ifdef HAVE_JXL_THREADS
+/*
+ * Return the parallel runner to use for a segment, or NULL if the segment
+ * must be processed by the calling thread only.
+ */
+static void *JXLGetParallelRunner(TIFF *tif, JXLState *sp)
+{
+    static const char module[] = "JXLGetParallelRunner";
+    if (sp->num_threads <= 1)
+        return NULL;
+    if (sp->runner == NULL)
+    {
+        sp->runner = JxlResizableParallelRunnerCreate(NULL);
+        if (sp->runner == NULL)
+        {
+            TIFFWarningExtR(tif, module,
+                            "JxlResizableParallelRunnerCreate() failed");
+            return NULL;
+        }
+    }
+    {
+        uint32_t nThreads = (uint32_t)JxlResizableParallelRunnerSuggestThreads(
+            sp->segment_width, sp->segment_height);
+        if (nThreads > sp->num_threads)
+            nThreads = sp->num_threads;
+        JxlResizableParallelRunnerSetThreads(sp->runner, nThreads);
+    }
+    return sp->runner;
+}
+#endif
+
 static int GetJXLDataType(TIFF *tif)
 {
     TIFFDirectory *td = &tif->tif_dir;
@@ -258,6 +297,18 @@ static int JXLPreDecode(TIFF *tif, uint16_t s)
     }
 
     JxlDecoderStatus status;
+#ifdef HAVE_JXL_THREADS
+    {
+        void *runner = JXLGetParallelRunner(tif, sp);
+        if (runner != NULL &&
+            JxlDecoderSetParallelRunner(sp->decoder, JxlResizableParallelRunner,
+                                        runner) != JXL_DEC_SUCCESS)
+        {
+            TIFFErrorExtR(tif, module, "JxlDecoderSetParallelRunner() failed");
+            return 0;
+        }
+    }
+#endif
     status = JxlDecoderSubscribeEvents(sp->decoder,
                                        JXL_DEC_BASIC_INFO | JXL_DEC_FULL_IMAGE);
     if (status != JXL_DEC_SUCCESS)
@@ -790,6 +841,20 @@ static int JXLPostEncode(TIFF *tif)
     }
     JxlEncoderUseContainer(enc, JXL_FALSE);
 
+#ifdef HAVE_JXL_THREADS
+    {
+        void *runner = JXLGetParallelRunner(tif, sp);
+        if (runner != NULL &&
+            JxlEncoderSetParallelRunner(enc, JxlResizableParallelRunner,
+                                        runner) != JXL_ENC_SUCCESS)
+        {
+            TIFFErrorExtR(tif, module, "JxlEncoderSetParallelRunner() failed");
+            JxlEncoderDestroy(enc);
+            return 0;
+        }
+    }
+#endif
+
 #ifdef HAVE_JxlEncoderFrameSettingsCreate
     JxlEncoderFrameSettings *opts = JxlEncoderFrameSettingsCreate(enc, NULL);
 #else
@@ -1169,6 +1234,11 @@ static void JXLCleanup(TIFF *tif)
     if (sp->decoder)
         JxlDecoderDestroy(sp->decoder);
 
+#ifdef HAVE_JXL_THREADS
+    if (sp->runner)
+        JxlResizableParallelRunnerDestroy(sp->runner);
+#endif
+
     _TIFFfreeExt(tif, sp);
     tif->tif_data = NULL;
 
@@ -1184,6 +1254,8 @@ static const TIFFField JXLFields[] = {
      FALSE, FALSE, "Distance", NULL},
     {TIFFTAG_JXL_ALPHA_DISTANCE, 0, 0, TIFF_ANY, 0, TIFF_SETGET_FLOAT,
      FIELD_PSEUDO, FALSE, FALSE, "AlphaDistance", NULL},
+    {TIFFTAG_JXL_NUM_THREADS, 0, 0, TIFF_ANY, 0, TIFF_SETGET_UINT32,
+     FIELD_PSEUDO, FALSE, FALSE, "NumThreads", NULL},
 };
 
 static int JXLVSetField(TIFF *tif, uint32_t tag, va_list ap)
@@ -1252,6 +1324,19 @@ static int JXLVSetField(TIFF *tif, uint32_t tag, va_list ap)
             return 1;
         }
 
+        case TIFFTAG_JXL_NUM_THREADS:
+        {
+            uint32_t num_threads = va_arg(ap, uint32_t);
+            if (num_threads < 1 || num_threads > 1024)
+            {
+                TIFFErrorExtR(tif, module, "Invalid value for NumThreads: %u",
+                              num_threads);
+                return 0;
+            }
+            sp->num_threads = num_threads;
+            return 1;
+        }
+
         default:
         {
             return (*sp->vsetparent)(tif, tag, ap);
@@ -1278,6 +1363,9 @@ static int JXLVGetField(TIFF *tif, uint32_t tag, va_list ap)
         case TIFFTAG_JXL_ALPHA_DISTANCE:
             *va_arg(ap, float *) = sp->alpha_distance;
             break;
+        case TIFFTAG_JXL_NUM_THREADS:
+            *va_arg(ap, uint32_t *) = sp->num_threads;
+            break;
         default:
             return (*sp->vgetparent)(tif, tag, ap);
     }
@@ -1342,6 +1430,7 @@ int TIFFInitJXL(TIFF *tif, int scheme)
     sp->effort = 5;
     sp->distance = 1.0;
     sp->alpha_distance = -1.0;
+    sp->num_threads = 1;
 
     return 1;
 bad:
@@ -55,6 +55,12 @@
              max butteraugli distance, lower = higher quality. Range: 0 .. 15.*/
 #endif
 
+#ifndef TIFFTAG_JXL_NUM_THREADS
+#define TIFFTAG_JXL_NUM_THREADS                                                \
+    65539 /* Maximum number of threads used by libjxl to compress or           \
+             decompress a single strip/tile. Default is 1 */
+#endif
+
 #if defined(__cplusplus)
 extern "C"
 {
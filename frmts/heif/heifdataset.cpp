@@ -11,6 +11,7 @@
 
 #include "heifdataset.h"
 #include "gdal_frmts.h"
+#include "gdal_thread_pool.h"
 
 #include "cpl_vsi_virtual.h"
 
@@ -236,6 +237,11 @@ GDALHEIFDataset::RequestRangeCbk(uint64_t start_pos, uint64_t end_pos,
 
 bool GDALHEIFDataset::Init(GDALOpenInfo *poOpenInfo)
 {
+#if LIBHEIF_NUMERIC_VERSION >= BUILD_LIBHEIF_VERSION(1, 13, 0)
+    heif_context_set_max_decoding_threads(
+        m_hCtxt, GDALGetNumThreads(nullptr, nullptr, "ALL_CPUS"));
+#endif
+
     CPLString osFilename(poOpenInfo->pszFilename);
 #ifdef HAS_CUSTOM_FILE_READER
     VSILFILE *fpL;
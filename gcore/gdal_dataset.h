@@ -873,6 +873,7 @@ class CPL_DLL GDALDataset : public GDALMajorObject
 
     //! @cond Doxygen_Suppress
     OGRErr ProcessSQLCreateIndex(const char *);
+    OGRErr ProcessSQLCreateSpatialIndex(const char *);
     OGRErr ProcessSQLDropIndex(const char *);
     OGRErr ProcessSQLDropTable(const char *);
     OGRErr ProcessSQLAlterTableAddColumn(const char *);
@@ -12,6 +12,11 @@
 
 #include "gdal_thread_pool.h"
 
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <limits>
 #include <mutex>
 
 // For unclear reasons, attempts at making this a std::unique_ptr<>, even
@@ -26,8 +31,97 @@ static std::mutex &GetMutexThreadPool()
     return gMutexThreadPool;
 }
 
+/************************************************************************/
+/*                        GDALGetMaxNumThreads()                        */
+/************************************************************************/
+
+/** Return the process-wide maximum number of worker threads, as set by the
+ * GDAL_MAX_NUM_THREADS configuration option, that all multi-threaded code
+ * paths should share.
+ *
+ * @return a strictly positive number (INT_MAX if there is no limit)
+ */
+int GDALGetMaxNumThreads()
+{
+    const char *pszValue = CPLGetConfigOption("GDAL_MAX_NUM_THREADS", nullptr);
+    if (pszValue == nullptr)
+        return std::numeric_limits<int>::max();
+    if (EQUAL(pszValue, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    return std::max(1, atoi(pszValue));
+}
+
+/************************************************************************/
+/*                         GDALGetNumThreads()                          */
+/************************************************************************/
+
+/** Return the number of threads corresponding to a value of a NUM_THREADS
+ * option, that is either ALL_CPUS or an integer.
+ *
+ * The result is clamped to nMaxVal (if strictly positive) and to
+ * GDALGetMaxNumThreads().
+ *
+ * @param pszValue ALL_CPUS, an integer, or nullptr (which means 1)
+ * @param nMaxVal upper bound, or -1 for no other bound than
+ *                GDALGetMaxNumThreads()
+ * @return a strictly positive number
+ */
+int GDALGetNumThreads(const char *pszValue, int nMaxVal)
+{
+    int nThreads = 1;
+    if (pszValue != nullptr)
+    {
+        nThreads =
+            EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+    }
+    if (nMaxVal > 0)
+        nThreads = std::min(nThreads, nMaxVal);
+    return std::max(1, std::min(nThreads, GDALGetMaxNumThreads()));
+}
+
+/** Return the number of threads set by the pszItem option of papszOptions,
+ * or by the GDAL_NUM_THREADS configuration option, or by pszDefault if none
+ * of them is set.
+ *
+ * The result is clamped to nMaxVal (if strictly positive) and to
+ * GDALGetMaxNumThreads().
+ *
+ * @param papszOptions list of options, or nullptr
+ * @param pszItem name of the option (typically NUM_THREADS), or nullptr
+ * @param pszDefault default value, ALL_CPUS or an integer
+ * @param nMaxVal upper bound, or -1 for no other bound than
+ *                GDALGetMaxNumThreads()
+ * @return a strictly positive number
+ */
+int GDALGetNumThreads(CSLConstList papszOptions, const char *pszItem,
+                      const char *pszDefault, int nMaxVal)
+{
+    const char *pszValue =
+        pszItem ? CSLFetchNameValue(papszOptions, pszItem) : nullptr;
+    if (pszValue == nullptr)
+        pszValue = CPLGetConfigOption("GDAL_NUM_THREADS", pszDefault);
+    return GDALGetNumThreads(pszValue, nMaxVal);
+}
+
+/************************************************************************/
+/*                      GDALGetGlobalThreadPool()                       */
+/************************************************************************/
+
+/** Return the global thread pool, making sure it has at least nThreads
+ * worker threads, within the limit of GDALGetMaxNumThreads().
+ */
 CPLWorkerThreadPool *GDALGetGlobalThreadPool(int nThreads)
 {
+    const int nMaxNumThreads = GDALGetMaxNumThreads();
+    if (nThreads > nMaxNumThreads)
+    {
+        CPLDebugOnce("GDAL",
+                     "Limiting global thread pool to %d threads, "
+                     "due to GDAL_MAX_NUM_THREADS",
+                     nMaxNumThreads);
+        nThreads = nMaxNumThreads;
+    }
+
     std::lock_guard oGuard(GetMutexThreadPool());
     if (gpoCompressThreadPool == nullptr)
     {
@@ -17,6 +17,13 @@
 
 CPLWorkerThreadPool CPL_DLL *GDALGetGlobalThreadPool(int nThreads);
 
+int CPL_DLL GDALGetMaxNumThreads();
+
+int CPL_DLL GDALGetNumThreads(const char *pszValue, int nMaxVal = -1);
+
+int CPL_DLL GDALGetNumThreads(CSLConstList papszOptions, const char *pszItem,
+                              const char *pszDefault, int nMaxVal = -1);
+
 void GDALDestroyGlobalThreadPool();
 
 #endif  // GDAL_THREAD_POOL_H
@@ -6494,6 +6494,74 @@ OGRErr GDALDataset::ProcessSQLCreateIndex(const char *pszSQLCommand)
     return eErr;
 }
 
+/************************************************************************/
+/*                     ProcessSQLCreateSpatialIndex()                   */
+/*                                                                      */
+/*      The correct syntax for creating a spatial index in our          */
+/*      dialect of SQL is:                                              */
+/*                                                                      */
+/*        CREATE SPATIAL INDEX ON <layername> [USING <geomfieldname>]   */
+/*                                                                      */
+/*      It is only supported by layers that use sidecar indexes.        */
+/************************************************************************/
+
+OGRErr GDALDataset::ProcessSQLCreateSpatialIndex(const char *pszSQLCommand)
+
+{
+    const CPLStringList aosTokens(CSLTokenizeString(pszSQLCommand));
+
+    /* -------------------------------------------------------------------- */
+    /*      Do some general syntax checking.                                */
+    /* -------------------------------------------------------------------- */
+    if ((aosTokens.size() != 5 && aosTokens.size() != 7) ||
+        !EQUAL(aosTokens[0], "CREATE") || !EQUAL(aosTokens[1], "SPATIAL") ||
+        !EQUAL(aosTokens[2], "INDEX") || !EQUAL(aosTokens[3], "ON") ||
+        (aosTokens.size() == 7 && !EQUAL(aosTokens[5], "USING")))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Syntax error in CREATE SPATIAL INDEX command.\n"
+                 "Was '%s'\n"
+                 "Should be of form 'CREATE SPATIAL INDEX ON <table> "
+                 "[USING <geometry field>]'",
+                 pszSQLCommand);
+        return OGRERR_FAILURE;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Find the named layer and geometry field.                        */
+    /* -------------------------------------------------------------------- */
+    OGRLayer *poLayer = GetLayerByName(aosTokens[4]);
+    if (poLayer == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "CREATE SPATIAL INDEX ON failed, no such layer as `%s'.",
+                 aosTokens[4]);
+        return OGRERR_FAILURE;
+    }
+
+    int iGeomField = 0;
+    if (aosTokens.size() == 7)
+    {
+        iGeomField =
+            poLayer->GetLayerDefn()->GetGeomFieldIndex(aosTokens[6]);
+        if (iGeomField < 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "`%s' failed, geometry field not found.",
+                     pszSQLCommand);
+            return OGRERR_FAILURE;
+        }
+    }
+    else if (poLayer->GetLayerDefn()->GetGeomFieldCount() == 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "`%s' failed, layer has no geometry field.", pszSQLCommand);
+        return OGRERR_FAILURE;
+    }
+
+    return poLayer->BuildSidecarSpatialIndex(iGeomField);
+}
+
 /************************************************************************/
 /*                        ProcessSQLDropIndex()                         */
 /*                                                                      */
@@ -7203,6 +7271,15 @@ GDALDataset::ExecuteSQL(const char *pszStatement, OGRGeometry *poSpatialFilter,
         return nullptr;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Handle CREATE SPATIAL INDEX statements specially.               */
+    /* -------------------------------------------------------------------- */
+    if (STARTS_WITH_CI(pszStatement, "CREATE SPATIAL INDEX"))
+    {
+        ProcessSQLCreateSpatialIndex(pszStatement);
+        return nullptr;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Handle DROP INDEX statements specially.                         */
     /* -------------------------------------------------------------------- */
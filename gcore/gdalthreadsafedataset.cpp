@@ -18,6 +18,8 @@
 #include "gdal_rat.h"
 #include "gdal_priv.h"
 
+#include <atomic>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -39,6 +41,13 @@ bool GDALThreadLocalDatasetCacheIsInDestruction();
  *   them in a thread-safe way.
  * - GDALThreadLocalDatasetCache which is an internal class, which holds the
  *   thread-local datasets.
+ *
+ * The total number of thread-local datasets, among all threads and all
+ * GDALThreadSafeDataset instances, may be bounded with the
+ * GDAL_THREAD_SAFE_DATASET_MAX_HANDLES configuration option. When that limit
+ * is reached, the least recently used thread-local dataset that is not
+ * currently in use by its thread is closed before opening a new one, whatever
+ * the thread that owns it.
  */
 
 /************************************************************************/
@@ -136,6 +145,15 @@ class GDALThreadLocalDatasetCache
      */
     std::map<GDALRasterBand *, GDALDataset *> m_oMapReferencedDSFromBand{};
 
+    /** Maps a GDALThreadSafeDataset* instance to the value of the global
+     * use counter (GDALThreadSafeDataset::GlobalCache::nUseCounter) when its
+     * thread-local dataset was last referenced by this thread. Used to
+     * determine which thread-local dataset to evict, among all threads, when
+     * the limit set by GDAL_THREAD_SAFE_DATASET_MAX_HANDLES is reached.
+     * Entries might be stale, if m_oCache has evicted the dataset.
+     */
+    std::map<const GDALThreadSafeDataset *, GUIntBig> m_oMapLastUse{};
+
     static bool IsInDestruction()
     {
         return tl_inDestruction;
@@ -286,6 +304,16 @@ class GDALThreadSafeDataset final : public GDALProxyDataset
          */
         std::set<GDALThreadLocalDatasetCache *> oSetOfCache{};
 
+        /** Number of thread-local datasets currently opened, among all
+         * threads.
+         */
+        std::atomic<int> nOpenedDatasets{0};
+
+        /** Counter incremented each time a thread-local dataset is referenced.
+         * Used as a clock for least-recently-used eviction among all threads.
+         */
+        std::atomic<GUIntBig> nUseCounter{0};
+
         GlobalCache()
         {
             bGlobalCacheValid = true;
@@ -312,6 +340,8 @@ class GDALThreadSafeDataset final : public GDALProxyDataset
     void UnrefUnderlyingDataset(GDALDataset *poUnderlyingDataset,
                                 GDALThreadLocalDatasetCache *poCache) const;
 
+    static void EvictIdleDatasetsIfNeeded();
+
     GDALThreadSafeDataset(const GDALThreadSafeDataset &) = delete;
     GDALThreadSafeDataset &operator=(const GDALThreadSafeDataset &) = delete;
 };
@@ -649,6 +679,7 @@ GDALThreadSafeDataset::~GDALThreadSafeDataset()
                 aoDSToFree.emplace_back(std::move(poDS), poCache->m_nThreadID);
                 poCache->m_oCache.remove(this);
             }
+            poCache->m_oMapLastUse.erase(this);
         }
     }
 
@@ -737,11 +768,15 @@ GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
         tl_poCache = std::move(poCacheUniquePtr);
     }
 
+    auto &oSetOfCache = GetSetOfCache();
+
     // Check if there's an entry in this cache for our current GDALThreadSafeDataset
     // instance.
     std::unique_lock oLock(poCache->m_oMutex);
     if (poCache->m_oCache.tryGet(this, poTLSDS))
     {
+        poCache->m_oMapLastUse[this] = ++oSetOfCache.nUseCounter;
+
         // If so, return it, but before returning, make sure to creates a
         // "hard" reference to the thread-local dataset, in case it would
         // get evicted from poCache->m_oCache (by other threads that would
@@ -759,7 +794,23 @@ GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
     // doing a GDALDataset::Open() call to re-open it. Do that by temporarily
     // dropping the lock that protects poCache->m_oCache.
     oLock.unlock();
-    poTLSDS = m_poPrototypeDS->Clone(GDAL_OF_RASTER, /* bCanShareState=*/true);
+    EvictIdleDatasetsIfNeeded();
+    auto poClonedDS =
+        m_poPrototypeDS->Clone(GDAL_OF_RASTER, /* bCanShareState=*/true);
+    if (poClonedDS)
+    {
+        // Keep track of the number of thread-local datasets, to be able
+        // to enforce GDAL_THREAD_SAFE_DATASET_MAX_HANDLES
+        ++oSetOfCache.nOpenedDatasets;
+        poTLSDS = std::shared_ptr<GDALDataset>(
+            poClonedDS.release(),
+            [](GDALDataset *poDS)
+            {
+                if (bGlobalCacheValid)
+                    --GetSetOfCache().nOpenedDatasets;
+                delete poDS;
+            });
+    }
     if (poTLSDS)
     {
         CPLDebug("GDAL", "GDALOpen(%s, this=%p) for thread " CPL_FRMT_GIB,
@@ -795,6 +846,7 @@ GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
     auto poDSRet = poTLSDS.get();
     {
         poCache->m_oCache.insert(this, poTLSDS);
+        poCache->m_oMapLastUse[this] = ++oSetOfCache.nUseCounter;
         CPLAssert(!cpl::contains(poCache->m_oMapReferencedDS, this));
         poCache->m_oMapReferencedDS.insert(
             {this, GDALThreadLocalDatasetCache::
@@ -804,6 +856,95 @@ GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
     return poDSRet;
 }
 
+/************************************************************************/
+/*                     EvictIdleDatasetsIfNeeded()                      */
+/************************************************************************/
+
+/** Closes thread-local datasets, in least-recently-used order among all
+ * threads, while the number of opened thread-local datasets is at or above
+ * the limit set by the GDAL_THREAD_SAFE_DATASET_MAX_HANDLES configuration
+ * option.
+ *
+ * Only thread-local datasets that are not currently referenced by their
+ * thread (that is not in GDALThreadLocalDatasetCache::m_oMapReferencedDS)
+ * are candidate for eviction. Hence the limit is a soft one: if all
+ * thread-local datasets are in use, a new one will still be opened.
+ *
+ * This method must be called without any GDALThreadLocalDatasetCache::m_oMutex
+ * being held.
+ */
+/* static */ void GDALThreadSafeDataset::EvictIdleDatasetsIfNeeded()
+{
+    const int nMaxHandles = atoi(
+        CPLGetConfigOption("GDAL_THREAD_SAFE_DATASET_MAX_HANDLES", "0"));
+    if (nMaxHandles <= 0)
+        return;
+
+    auto &oSetOfCache = GetSetOfCache();
+    while (oSetOfCache.nOpenedDatasets >= nMaxHandles)
+    {
+        std::shared_ptr<GDALDataset> poDSToFree;
+        GIntBig nVictimThreadID = 0;
+        {
+            std::lock_guard oLock(oSetOfCache.oMutex);
+
+            // Find the least recently used thread-local dataset that is not
+            // currently in use.
+            GDALThreadLocalDatasetCache *poVictimCache = nullptr;
+            const GDALThreadSafeDataset *poVictimKey = nullptr;
+            GUIntBig nOldestUse = std::numeric_limits<GUIntBig>::max();
+            for (auto *poCache : oSetOfCache.oSetOfCache)
+            {
+                std::lock_guard oLockCache(poCache->m_oMutex);
+                for (auto oIter = poCache->m_oMapLastUse.begin();
+                     oIter != poCache->m_oMapLastUse.end();)
+                {
+                    if (!poCache->m_oCache.contains(oIter->first))
+                    {
+                        // Already evicted by the thread-local LRU cache
+                        oIter = poCache->m_oMapLastUse.erase(oIter);
+                        continue;
+                    }
+                    if (oIter->second < nOldestUse &&
+                        !cpl::contains(poCache->m_oMapReferencedDS,
+                                       oIter->first))
+                    {
+                        nOldestUse = oIter->second;
+                        poVictimCache = poCache;
+                        poVictimKey = oIter->first;
+                    }
+                    ++oIter;
+                }
+            }
+            if (!poVictimCache)
+                break;
+
+            std::lock_guard oLockCache(poVictimCache->m_oMutex);
+            // Re-check that the dataset has not been referenced in the
+            // meantime by its thread.
+            if (!cpl::contains(poVictimCache->m_oMapReferencedDS,
+                               poVictimKey) &&
+                poVictimCache->m_oCache.tryGet(poVictimKey, poDSToFree))
+            {
+                poVictimCache->m_oCache.remove(poVictimKey);
+                poVictimCache->m_oMapLastUse.erase(poVictimKey);
+                nVictimThreadID = poVictimCache->m_nThreadID;
+            }
+        }
+        if (!poDSToFree)
+            break;
+
+        CPLDebug("GDAL",
+                 "GDALThreadSafeDataset: GDALClose(%s, this=%p) of dataset of "
+                 "thread " CPL_FRMT_GIB
+                 " since GDAL_THREAD_SAFE_DATASET_MAX_HANDLES=%d is reached",
+                 poDSToFree->GetDescription(), poDSToFree.get(),
+                 nVictimThreadID, nMaxHandles);
+        // Actually close the dataset, outside of any lock
+        poDSToFree.reset();
+    }
+}
+
 /************************************************************************/
 /*                      UnrefUnderlyingDataset()                        */
 /************************************************************************/
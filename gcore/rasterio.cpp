@@ -2016,6 +2016,47 @@ CPLErr GDALDataset::RasterIOResampled(
 
 //! @endcond
 
+#ifdef HAVE_SSE2
+
+/************************************************************************/
+/*                      GDALSwapPackedWords_SSE2()                      */
+/************************************************************************/
+
+/** Byte swap words of a packed buffer, 16 bytes at a time.
+ *
+ * @return the number of words swapped, that is nWordCount rounded down to
+ * a multiple of 16 / WORD_SIZE.
+ */
+template <int WORD_SIZE>
+static int GDALSwapPackedWords_SSE2(GByte *pabyData, int nWordCount)
+{
+    constexpr int WORDS_PER_REG = 16 / WORD_SIZE;
+    int i = 0;
+    for (; i + WORDS_PER_REG <= nWordCount; i += WORDS_PER_REG)
+    {
+        GByte *pabyReg = pabyData + static_cast<size_t>(i) * WORD_SIZE;
+        __m128i reg =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pabyReg));
+        // Reverse the order of the 16-bit words within each word...
+        if constexpr (WORD_SIZE == 8)
+        {
+            reg = _mm_shufflelo_epi16(reg, _MM_SHUFFLE(0, 1, 2, 3));
+            reg = _mm_shufflehi_epi16(reg, _MM_SHUFFLE(0, 1, 2, 3));
+        }
+        else if constexpr (WORD_SIZE == 4)
+        {
+            reg = _mm_shufflelo_epi16(reg, _MM_SHUFFLE(2, 3, 0, 1));
+            reg = _mm_shufflehi_epi16(reg, _MM_SHUFFLE(2, 3, 0, 1));
+        }
+        // ... and then the 2 bytes of each 16-bit word.
+        reg = _mm_or_si128(_mm_slli_epi16(reg, 8), _mm_srli_epi16(reg, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyReg), reg);
+    }
+    return i;
+}
+
+#endif  // HAVE_SSE2
+
 /************************************************************************/
 /*                           GDALSwapWords()                            */
 /************************************************************************/
@@ -2053,6 +2094,15 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
         case 2:
             CPLAssert(nWordSkip >= 2 || nWordCount == 1);
+#ifdef HAVE_SSE2
+            if (nWordSkip == 2)
+            {
+                const int nSwapped =
+                    GDALSwapPackedWords_SSE2<2>(pabyData, nWordCount);
+                pabyData += static_cast<size_t>(nSwapped) * 2;
+                nWordCount -= nSwapped;
+            }
+#endif
             for (int i = 0; i < nWordCount; i++)
             {
                 CPL_SWAP16PTR(pabyData);
@@ -2062,6 +2112,15 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
         case 4:
             CPLAssert(nWordSkip >= 4 || nWordCount == 1);
+#ifdef HAVE_SSE2
+            if (nWordSkip == 4)
+            {
+                const int nSwapped =
+                    GDALSwapPackedWords_SSE2<4>(pabyData, nWordCount);
+                pabyData += static_cast<size_t>(nSwapped) * 4;
+                nWordCount -= nSwapped;
+            }
+#endif
             if (CPL_IS_ALIGNED(pabyData, 4) && (nWordSkip % 4) == 0)
             {
                 for (int i = 0; i < nWordCount; i++)
@@ -2083,6 +2142,15 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
         case 8:
             CPLAssert(nWordSkip >= 8 || nWordCount == 1);
+#ifdef HAVE_SSE2
+            if (nWordSkip == 8)
+            {
+                const int nSwapped =
+                    GDALSwapPackedWords_SSE2<8>(pabyData, nWordCount);
+                pabyData += static_cast<size_t>(nSwapped) * 8;
+                nWordCount -= nSwapped;
+            }
+#endif
             if (CPL_IS_ALIGNED(pabyData, 8) && (nWordSkip % 8) == 0)
             {
                 for (int i = 0; i < nWordCount; i++)
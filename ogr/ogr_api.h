@@ -351,6 +351,12 @@ int CPL_DLL OGRPreparedGeometryIntersects(OGRPreparedGeometryH hPreparedGeom,
                                           OGRGeometryH hOtherGeom);
 int CPL_DLL OGRPreparedGeometryContains(OGRPreparedGeometryH hPreparedGeom,
                                         OGRGeometryH hOtherGeom);
+int CPL_DLL OGRPreparedGeometryIntersectsBatch(
+    OGRPreparedGeometryH hPreparedGeom, int nGeomCount,
+    const OGRGeometryH *pahGeoms, int *pabResults, CSLConstList papszOptions);
+int CPL_DLL OGRPreparedGeometryContainsBatch(
+    OGRPreparedGeometryH hPreparedGeom, int nGeomCount,
+    const OGRGeometryH *pahGeoms, int *pabResults, CSLConstList papszOptions);
 
 /* -------------------------------------------------------------------- */
 /*      Feature related (ogr_feature.h)                                 */
@@ -652,6 +658,8 @@ void CPL_DLL OGR_L_SetSpatialFilterRectEx(OGRLayerH, int iGeomField,
 OGRErr CPL_DLL OGR_L_SetAttributeFilter(OGRLayerH, const char *);
 void CPL_DLL OGR_L_ResetReading(OGRLayerH);
 OGRFeatureH CPL_DLL OGR_L_GetNextFeature(OGRLayerH) CPL_WARN_UNUSED_RESULT;
+OGRFeatureH CPL_DLL OGR_L_GetNextFeatureReusing(OGRLayerH, OGRFeatureH)
+    CPL_WARN_UNUSED_RESULT;
 
 /** Conveniency macro to iterate over features of a layer.
  *
@@ -684,9 +692,7 @@ OGRFeatureH CPL_DLL OGR_L_GetNextFeature(OGRLayerH) CPL_WARN_UNUSED_RESULT;
         OGR_L_ResetReading(hLayer);                                            \
         while (true)                                                           \
         {                                                                      \
-            if (hFeat)                                                         \
-                OGR_F_Destroy(hFeat);                                          \
-            hFeat = OGR_L_GetNextFeature(hLayer);                              \
+            hFeat = OGR_L_GetNextFeatureReusing(hLayer, hFeat);                \
             if (!hFeat)                                                        \
                 break;
 
@@ -0,0 +1,172 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Compiled evaluation of attribute filters
+ * Author:   NextGIS <info at nextgis dot com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, NextGIS <info at nextgis dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGR_COMPILED_FILTER_H_INCLUDED
+#define OGR_COMPILED_FILTER_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "cpl_port.h"
+#include "ogr_core.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class OGRFeature;
+class OGRFeatureDefn;
+class swq_expr_node;
+
+/************************************************************************/
+/*                          OGRCompiledFilter                           */
+/************************************************************************/
+
+/** Attribute filter compiled from a swq expression into a flat program.
+ *
+ * Only a subset of expressions can be compiled: comparisons, IN, BETWEEN
+ * and IS NULL on columns of integer, real or string type, against constants
+ * or another column, combined with AND, OR and NOT. Compile() returns
+ * nullptr for other expressions, which must then be evaluated with
+ * swq_expr_node::Evaluate(). The result of the program is the same as the
+ * one of SWQGeneralEvaluator(), including for NULL values.
+ *
+ * The program is evaluated one instruction at a time over batches of rows,
+ * whose values are provided column by column, so that no allocation is done
+ * per row.
+ */
+class OGRCompiledFilter
+{
+  public:
+    //! Type of the values of a column.
+    enum class ValueType
+    {
+        NONE,  //!< Only whether the value is null is used.
+        INTEGER,
+        REAL,
+        STRING
+    };
+
+    //! Column used by the filter.
+    struct Column
+    {
+        //! Index of the OGR field, or -1 for the FID.
+        int iField = -1;
+        //! Type of the OGR field (OFTInteger64 for the FID).
+        OGRFieldType eFieldType = OFTInteger64;
+        //! Type of the values expected in ColumnValues.
+        ValueType eType = ValueType::NONE;
+    };
+
+    //! Values of a column for a batch of rows.
+    struct ColumnValues
+    {
+        //! Values, if the column type is INTEGER.
+        const int64_t *panValues = nullptr;
+        //! Values, if the column type is REAL.
+        const double *padfValues = nullptr;
+        //! Values, if the column type is STRING. They need not be
+        //! nul-terminated.
+        const char *const *papszValues = nullptr;
+        //! Length of strings, that must not include any nul character.
+        const size_t *panLengths = nullptr;
+        //! Non-zero for null values. May be nullptr if there is none.
+        const uint8_t *pabyIsNull = nullptr;
+    };
+
+    //! Scratch buffers of EvaluateBatch(), that can be reused between calls.
+    struct Workspace
+    {
+        std::vector<uint8_t> abyRegisters{};
+        std::vector<double> adfValues{};
+        std::vector<ColumnValues> asColumns{};
+    };
+
+    static std::unique_ptr<OGRCompiledFilter>
+    Compile(const swq_expr_node *poExpr, const OGRFeatureDefn *poDefn);
+
+    const std::vector<Column> &GetColumns() const
+    {
+        return m_aoColumns;
+    }
+
+    bool Evaluate(const OGRFeature *poFeature) const;
+
+    void EvaluateBatch(const ColumnValues *pasColumns, size_t nRows,
+                       uint8_t *pabyResult, Workspace &oWorkspace) const;
+
+  private:
+    enum class Opcode
+    {
+        IS_NULL,
+        IS_TRUE,
+        COMPARE,
+        IN_LIST,
+        BETWEEN,
+        AND,
+        OR,
+        NOT
+    };
+
+    struct Instruction
+    {
+        Opcode eOpcode = Opcode::AND;
+        //! swq_op of COMPARE.
+        int nOperation = 0;
+        //! Type in which values are compared.
+        ValueType eCompareType = ValueType::NONE;
+        int iColumn = -1;
+        //! Second column of COMPARE, or -1 if comparing to a constant.
+        int iOtherColumn = -1;
+        std::vector<int64_t> anConstants{};
+        std::vector<double> adfConstants{};
+        std::vector<std::string> aosConstants{};
+    };
+
+    const OGRFeatureDefn *m_poDefn = nullptr;
+    std::vector<Column> m_aoColumns{};
+    std::vector<Instruction> m_aoInstructions{};
+    int m_nMaxDepth = 0;
+
+    OGRCompiledFilter() = default;
+
+    int AddColumn(const swq_expr_node *poNode, bool bOnlyNullness);
+    bool CompileBoolean(const swq_expr_node *poNode, int nLevel, int &nDepth);
+    bool CompileComparison(const swq_expr_node *poNode, int nLevel);
+
+    void EvaluateRows(const ColumnValues *pasColumns, size_t nRows,
+                      uint8_t *pabyResult, uint8_t *pabyRegisters,
+                      double *padfTmp) const;
+
+    void EvaluateInstruction(const Instruction &oInstr,
+                             const ColumnValues *pasColumns, size_t nRows,
+                             uint8_t *pabyValue, uint8_t *pabyIsNull,
+                             double *padfTmp) const;
+
+    template <class T>
+    static void EvaluateNumeric(const Instruction &oInstr, const T *paValues,
+                                const T *paOtherValues,
+                                const std::vector<T> &aConstants,
+                                size_t nRows, uint8_t *pabyValue);
+
+    static void EvaluateString(const Instruction &oInstr,
+                               const ColumnValues &sValues,
+                               const ColumnValues *psOtherValues,
+                               size_t nRows, const uint8_t *pabyIsNull,
+                               uint8_t *pabyValue);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRCompiledFilter)
+};
+
+#endif  // DOXYGEN_SKIP
+
+#endif  // OGR_COMPILED_FILTER_H_INCLUDED
@@ -34,6 +34,7 @@
  */
 
 class OGRStyleTable;
+class OGRWKBGeometryView;
 
 /************************************************************************/
 /*                             OGRFieldDefn                             */
@@ -1266,6 +1267,7 @@ class CPL_DLL OGRFeature
     OGRErr SetGeomFieldDirectly(int iField, OGRGeometry *);
     OGRErr SetGeomField(int iField, const OGRGeometry *);
     OGRErr SetGeomField(int iField, std::unique_ptr<OGRGeometry>);
+    OGRErr SetGeomField(int iField, const OGRWKBGeometryView &oView);
 
     void Reset();
 
@@ -1966,6 +1968,7 @@ class CPL_DLL OGRGlobFieldDomain final : public OGRFieldDomain
 
 //! @cond Doxygen_Suppress
 class OGRLayer;
+class OGRCompiledFilter;
 class swq_expr_node;
 class swq_custom_func_registrar;
 struct swq_evaluation_context;
@@ -1976,6 +1979,7 @@ class CPL_DLL OGRFeatureQuery
     const OGRFeatureDefn *poTargetDefn;
     void *pSWQExpr;
     swq_evaluation_context *m_psContext = nullptr;
+    OGRCompiledFilter *m_poCompiledFilter = nullptr;
 
     char **FieldCollector(void *, char **);
 
@@ -2010,6 +2014,11 @@ class CPL_DLL OGRFeatureQuery
     {
         return pSWQExpr;
     }
+
+    OGRCompiledFilter *GetCompiledFilter()
+    {
+        return m_poCompiledFilter;
+    }
 };
 
 //! @endcond
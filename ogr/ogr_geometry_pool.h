@@ -0,0 +1,111 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Pool of geometry objects reused between features
+ * Author:   NextGIS <info at nextgis dot com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, NextGIS <info at nextgis dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGR_GEOMETRY_POOL_H_INCLUDED
+#define OGR_GEOMETRY_POOL_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "ogr_geometry.h"
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+class OGRFeature;
+
+/************************************************************************/
+/*                           OGRGeometryPool                            */
+/************************************************************************/
+
+/** Pool of geometry objects of features that are no longer used, so that
+ * drivers can refill them when reading the next features instead of
+ * allocating new objects.
+ *
+ * Recycled geometries are broken down into their parts, and objects of the
+ * simple feature types are kept in free lists. Acquire() returns an object
+ * from the matching free list, or a new one. Simple curves keep their
+ * point arrays, so that setting points on them does not reallocate memory
+ * as long as the capacity is large enough. The state of a returned object
+ * (points, spatial reference, dimension flags) is the one it had when it
+ * was recycled, and must be fully overwritten by the caller.
+ *
+ * This class is not thread-safe.
+ */
+class OGRGeometryPool
+{
+  public:
+    //! Maximum number of objects kept in each free list.
+    static constexpr size_t MAX_OBJECTS_PER_TYPE = 1024;
+
+    OGRGeometryPool() = default;
+
+    void Recycle(OGRGeometry *poGeom);
+    void RecycleGeometries(OGRFeature *poFeature);
+
+    /** Return an object of type T, either from the pool or newly allocated.
+     * Ownership is transferred to the caller. */
+    template <class T> T *Acquire()
+    {
+        if constexpr (std::is_same_v<T, OGRPoint>)
+            return Pop(m_apoPoints);
+        else if constexpr (std::is_same_v<T, OGRLineString>)
+            return Pop(m_apoLineStrings);
+        else if constexpr (std::is_same_v<T, OGRLinearRing>)
+            return Pop(m_apoLinearRings);
+        else if constexpr (std::is_same_v<T, OGRPolygon>)
+            return Pop(m_apoPolygons);
+        else if constexpr (std::is_same_v<T, OGRMultiPoint>)
+            return Pop(m_apoMultiPoints);
+        else if constexpr (std::is_same_v<T, OGRMultiLineString>)
+            return Pop(m_apoMultiLineStrings);
+        else if constexpr (std::is_same_v<T, OGRMultiPolygon>)
+            return Pop(m_apoMultiPolygons);
+        else
+            return new T();
+    }
+
+  private:
+    std::vector<std::unique_ptr<OGRPoint>> m_apoPoints{};
+    std::vector<std::unique_ptr<OGRLineString>> m_apoLineStrings{};
+    std::vector<std::unique_ptr<OGRLinearRing>> m_apoLinearRings{};
+    std::vector<std::unique_ptr<OGRPolygon>> m_apoPolygons{};
+    std::vector<std::unique_ptr<OGRMultiPoint>> m_apoMultiPoints{};
+    std::vector<std::unique_ptr<OGRMultiLineString>> m_apoMultiLineStrings{};
+    std::vector<std::unique_ptr<OGRMultiPolygon>> m_apoMultiPolygons{};
+
+    template <class T> static T *Pop(std::vector<std::unique_ptr<T>> &apoList)
+    {
+        if (apoList.empty())
+            return new T();
+        T *poRet = apoList.back().release();
+        apoList.pop_back();
+        return poRet;
+    }
+
+    template <class T>
+    static void Push(std::vector<std::unique_ptr<T>> &apoList, T *poGeom)
+    {
+        if (apoList.size() < MAX_OBJECTS_PER_TYPE)
+            apoList.emplace_back(poGeom);
+        else
+            delete poGeom;
+    }
+
+    void RecycleParts(OGRGeometryCollection *poColl);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGeometryPool)
+};
+
+#endif  // DOXYGEN_SKIP
+
+#endif  // OGR_GEOMETRY_POOL_H_INCLUDED
@@ -29,6 +29,11 @@
 #include "include_fast_float.h"
 #endif
 
+#if defined(__x86_64) || defined(_M_X64)
+#include <emmintrin.h>
+#define HAVE_SSE2
+#endif
+
 /************************************************************************/
 /*                          OGRWKBNeedSwap()                            */
 /************************************************************************/
@@ -298,6 +303,33 @@ static bool ReadWKBPointSequence(const uint8_t *data, size_t size,
         OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffset);
     if (nPoints > (size - iOffset) / (nDim * sizeof(double)))
         return false;
+#ifdef HAVE_SSE2
+    if (!OGR_SWAP(eByteOrder) && !(INCLUDE_Z && bHasZ))
+    {
+        // Update the X and Y bounds of a point at once.
+        // _mm_min_pd(a, b) is a < b ? a : b, as std::min(b, a).
+        __m128d xyMin = _mm_set_pd(sEnvelope.MinY, sEnvelope.MinX);
+        __m128d xyMax = _mm_set_pd(sEnvelope.MaxY, sEnvelope.MaxX);
+        const size_t nPointSize = nDim * sizeof(double);
+        for (uint32_t j = 0; j < nPoints; j++)
+        {
+            const __m128d xy =
+                _mm_loadu_pd(reinterpret_cast<const double *>(data + iOffset));
+            xyMin = _mm_min_pd(xy, xyMin);
+            xyMax = _mm_max_pd(xy, xyMax);
+            iOffset += nPointSize;
+        }
+        double adfMin[2];
+        double adfMax[2];
+        _mm_storeu_pd(adfMin, xyMin);
+        _mm_storeu_pd(adfMax, xyMax);
+        sEnvelope.MinX = adfMin[0];
+        sEnvelope.MinY = adfMin[1];
+        sEnvelope.MaxX = adfMax[0];
+        sEnvelope.MaxY = adfMax[1];
+        return true;
+    }
+#endif
     double dfX = 0;
     double dfY = 0;
     [[maybe_unused]] double dfZ = 0;
@@ -1409,6 +1441,702 @@ bool OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
 #endif
 }
 
+/************************************************************************/
+/*                 OGRWKBPointSequenceView::GetLength()                 */
+/************************************************************************/
+
+/** Return the 2D length of the sequence, as a linestring. */
+double OGRWKBPointSequenceView::GetLength() const
+{
+    double dfLength = 0;
+    if (m_nPointCount == 0)
+        return dfLength;
+    double dfPrevX = GetX(0);
+    double dfPrevY = GetY(0);
+    for (uint32_t i = 1; i < m_nPointCount; ++i)
+    {
+        const double dfX = GetX(i);
+        const double dfY = GetY(i);
+        const double dfDeltaX = dfX - dfPrevX;
+        const double dfDeltaY = dfY - dfPrevY;
+        dfLength += sqrt(dfDeltaX * dfDeltaX + dfDeltaY * dfDeltaY);
+        dfPrevX = dfX;
+        dfPrevY = dfY;
+    }
+    return dfLength;
+}
+
+/************************************************************************/
+/*                 OGRWKBPointSequenceGetLinearArea()                   */
+/************************************************************************/
+
+// Cf OGRSimpleCurve::get_LinearArea()
+static double
+OGRWKBPointSequenceGetLinearArea(const OGRWKBPointSequenceView &oPoints,
+                                 bool bCheckClosed)
+{
+    const uint32_t nPoints = oPoints.GetPointCount();
+    if (nPoints < 2 ||
+        (bCheckClosed && (oPoints.GetX(0) != oPoints.GetX(nPoints - 1) ||
+                          oPoints.GetY(0) != oPoints.GetY(nPoints - 1))))
+    {
+        return 0;
+    }
+
+    double dfAreaSum =
+        oPoints.GetX(0) * (oPoints.GetY(1) - oPoints.GetY(nPoints - 1));
+    for (uint32_t i = 1; i < nPoints - 1; i++)
+    {
+        dfAreaSum +=
+            oPoints.GetX(i) * (oPoints.GetY(i + 1) - oPoints.GetY(i - 1));
+    }
+    dfAreaSum += oPoints.GetX(nPoints - 1) *
+                 (oPoints.GetY(0) - oPoints.GetY(nPoints - 2));
+
+    return 0.5 * fabs(dfAreaSum);
+}
+
+/************************************************************************/
+/*                 OGRWKBPointSequenceContainsPoint()                   */
+/************************************************************************/
+
+/** Flip bInside each time a half-line starting at (dfX, dfY) crosses an
+ * edge of the ring (even-odd rule). */
+static void OGRWKBRingUpdateContainsPoint(const OGRWKBPointSequenceView &oRing,
+                                          double dfX, double dfY,
+                                          bool &bInside)
+{
+    const uint32_t nPoints = oRing.GetPointCount();
+    if (nPoints == 0)
+        return;
+    double dfPrevX = oRing.GetX(nPoints - 1);
+    double dfPrevY = oRing.GetY(nPoints - 1);
+    for (uint32_t i = 0; i < nPoints; ++i)
+    {
+        const double dfCurX = oRing.GetX(i);
+        const double dfCurY = oRing.GetY(i);
+        if ((dfCurY > dfY) != (dfPrevY > dfY) &&
+            dfX < (dfPrevX - dfCurX) * (dfY - dfCurY) / (dfPrevY - dfCurY) +
+                      dfCurX)
+        {
+            bInside = !bInside;
+        }
+        dfPrevX = dfCurX;
+        dfPrevY = dfCurY;
+    }
+}
+
+/************************************************************************/
+/*                   OGRWKBSegmentIntersectsEnvelope()                  */
+/************************************************************************/
+
+/** Return whether the closed segment (x0,y0)-(x1,y1) intersects the closed
+ * rectangle sEnvelope. */
+static bool OGRWKBSegmentIntersectsEnvelope(double dfX0, double dfY0,
+                                            double dfX1, double dfY1,
+                                            const OGREnvelope &sEnvelope)
+{
+    if (std::max(dfX0, dfX1) < sEnvelope.MinX ||
+        std::min(dfX0, dfX1) > sEnvelope.MaxX ||
+        std::max(dfY0, dfY1) < sEnvelope.MinY ||
+        std::min(dfY0, dfY1) > sEnvelope.MaxY)
+    {
+        return false;
+    }
+
+    // The bounding boxes intersect: the segment intersects the rectangle
+    // unless all its corners are strictly on the same side of the line
+    // supporting the segment.
+    const double dfDeltaX = dfX1 - dfX0;
+    const double dfDeltaY = dfY1 - dfY0;
+    const auto Side = [dfX0, dfY0, dfDeltaX, dfDeltaY](double dfX, double dfY)
+    { return dfDeltaX * (dfY - dfY0) - dfDeltaY * (dfX - dfX0); };
+    const double adfSides[] = {
+        Side(sEnvelope.MinX, sEnvelope.MinY),
+        Side(sEnvelope.MinX, sEnvelope.MaxY),
+        Side(sEnvelope.MaxX, sEnvelope.MinY),
+        Side(sEnvelope.MaxX, sEnvelope.MaxY)};
+    const bool bAllPositive = adfSides[0] > 0 && adfSides[1] > 0 &&
+                              adfSides[2] > 0 && adfSides[3] > 0;
+    const bool bAllNegative = adfSides[0] < 0 && adfSides[1] < 0 &&
+                              adfSides[2] < 0 && adfSides[3] < 0;
+    return !bAllPositive && !bAllNegative;
+}
+
+/************************************************************************/
+/*                  OGRWKBPointSequenceIntersectsEnvelope()             */
+/************************************************************************/
+
+static bool
+OGRWKBPointSequenceIntersectsEnvelope(const OGRWKBPointSequenceView &oPoints,
+                                      const OGREnvelope &sEnvelope)
+{
+    const uint32_t nPoints = oPoints.GetPointCount();
+    if (nPoints == 1)
+    {
+        const double dfX = oPoints.GetX(0);
+        const double dfY = oPoints.GetY(0);
+        return dfX >= sEnvelope.MinX && dfX <= sEnvelope.MaxX &&
+               dfY >= sEnvelope.MinY && dfY <= sEnvelope.MaxY;
+    }
+    for (uint32_t i = 1; i < nPoints; ++i)
+    {
+        if (OGRWKBSegmentIntersectsEnvelope(oPoints.GetX(i - 1),
+                                            oPoints.GetY(i - 1),
+                                            oPoints.GetX(i), oPoints.GetY(i),
+                                            sEnvelope))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                       OGRWKBIsCollectionType()                       */
+/************************************************************************/
+
+/** Return whether geometries of a flat type are made of sub-geometries with
+ * their own WKB header. */
+static bool OGRWKBIsCollectionType(OGRwkbGeometryType eFlatType)
+{
+    switch (eFlatType)
+    {
+        case wkbMultiPoint:
+        case wkbMultiLineString:
+        case wkbMultiPolygon:
+        case wkbGeometryCollection:
+        case wkbCompoundCurve:
+        case wkbCurvePolygon:
+        case wkbMultiCurve:
+        case wkbMultiSurface:
+        case wkbPolyhedralSurface:
+        case wkbTIN:
+            return true;
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                     OGRWKBGeometryView::Init()                       */
+/************************************************************************/
+
+/** Initialize the view over the WKB geometry at the start of pabyWkb.
+ *
+ * @param pabyWkb WKB buffer, that must stay valid as long as the view is used.
+ * @param nWKBSize size of the buffer, which may be larger than the geometry.
+ * @return true if the buffer starts with a valid WKB geometry.
+ */
+bool OGRWKBGeometryView::Init(const GByte *pabyWkb, size_t nWKBSize)
+{
+    return Init(pabyWkb, nWKBSize, 0);
+}
+
+bool OGRWKBGeometryView::Init(const GByte *pabyWkb, size_t nWKBSize, int nRec)
+{
+    *this = OGRWKBGeometryView();
+
+    if (nRec == 128 || nWKBSize < WKB_PREFIX_SIZE)
+        return false;
+    const int nByteOrder = DB2_V72_FIX_BYTE_ORDER(pabyWkb[0]);
+    if (!(nByteOrder == wkbXDR || nByteOrder == wkbNDR))
+        return false;
+    OGRwkbGeometryType eGeometryType = wkbUnknown;
+    if (OGRReadWKBGeometryType(pabyWkb, wkbVariantIso, &eGeometryType) !=
+        OGRERR_NONE)
+        return false;
+    const bool bNeedSwap = OGR_SWAP(static_cast<OGRwkbByteOrder>(nByteOrder));
+    const int nDim = 2 + (OGR_GT_HasZ(eGeometryType) ? 1 : 0) +
+                     (OGR_GT_HasM(eGeometryType) ? 1 : 0);
+    const auto eFlatType = wkbFlatten(eGeometryType);
+
+    size_t iOffset = WKB_PREFIX_SIZE;
+    uint32_t nCount = 0;
+    if (eFlatType == wkbPoint)
+    {
+        if (nWKBSize - iOffset < nDim * sizeof(double))
+            return false;
+        iOffset += nDim * sizeof(double);
+        nCount = 1;
+    }
+    else
+    {
+        if (nWKBSize - iOffset < sizeof(uint32_t))
+            return false;
+        nCount = OGRWKBReadUInt32(pabyWkb + iOffset, bNeedSwap);
+        iOffset += sizeof(uint32_t);
+
+        if (eFlatType == wkbLineString || eFlatType == wkbCircularString)
+        {
+            if (nCount > (nWKBSize - iOffset) / (nDim * sizeof(double)))
+                return false;
+            iOffset += static_cast<size_t>(nCount) * nDim * sizeof(double);
+        }
+        else if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+        {
+            if (nCount > (nWKBSize - iOffset) / sizeof(uint32_t))
+                return false;
+            for (uint32_t i = 0; i < nCount; ++i)
+            {
+                if (nWKBSize - iOffset < sizeof(uint32_t))
+                    return false;
+                const uint32_t nPoints =
+                    OGRWKBReadUInt32(pabyWkb + iOffset, bNeedSwap);
+                iOffset += sizeof(uint32_t);
+                if (nPoints > (nWKBSize - iOffset) / (nDim * sizeof(double)))
+                    return false;
+                iOffset +=
+                    static_cast<size_t>(nPoints) * nDim * sizeof(double);
+            }
+        }
+        else if (OGRWKBIsCollectionType(eFlatType))
+        {
+            if (nCount > (nWKBSize - iOffset) / MIN_WKB_SIZE)
+                return false;
+            OGRWKBGeometryView oSubGeom;
+            for (uint32_t i = 0; i < nCount; ++i)
+            {
+                if (!oSubGeom.Init(pabyWkb + iOffset, nWKBSize - iOffset,
+                                   nRec + 1))
+                    return false;
+                iOffset += oSubGeom.m_nSize;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    m_pabyData = pabyWkb;
+    m_nSize = iOffset;
+    m_eGeometryType = eGeometryType;
+    m_bNeedSwap = bNeedSwap;
+    m_nDim = nDim;
+    m_nCount = nCount;
+    return true;
+}
+
+/************************************************************************/
+/*                 OGRWKBGeometryView::IsCollection()                   */
+/************************************************************************/
+
+/** Return whether the geometry is made of sub-geometries with their own
+ * WKB header. */
+bool OGRWKBGeometryView::IsCollection() const
+{
+    return OGRWKBIsCollectionType(wkbFlatten(m_eGeometryType));
+}
+
+/************************************************************************/
+/*                    OGRWKBGeometryView::IsEmpty()                     */
+/************************************************************************/
+
+/** Return whether the geometry is empty. */
+bool OGRWKBGeometryView::IsEmpty() const
+{
+    OGRWKBPointSequenceView oPoints;
+    if (GetPoints(oPoints))
+        return oPoints.GetPointCount() == 0;
+
+    for (uint32_t i = 0; i < GetRingCount(); ++i)
+    {
+        if (GetRing(i, oPoints) && oPoints.GetPointCount() > 0)
+            return false;
+    }
+
+    for (const auto &oSubGeom : *this)
+    {
+        if (!oSubGeom.IsEmpty())
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                   OGRWKBGeometryView::GetPoints()                    */
+/************************************************************************/
+
+/** Get the points of a point, linestring or circular string.
+ *
+ * An empty point has no point.
+ *
+ * @return false for other geometry types.
+ */
+bool OGRWKBGeometryView::GetPoints(OGRWKBPointSequenceView &oPoints) const
+{
+    oPoints = OGRWKBPointSequenceView();
+    const auto eFlatType = wkbFlatten(m_eGeometryType);
+    if (m_pabyData == nullptr ||
+        (eFlatType != wkbPoint && eFlatType != wkbLineString &&
+         eFlatType != wkbCircularString))
+    {
+        return false;
+    }
+
+    oPoints.m_nDim = m_nDim;
+    oPoints.m_bHasZ = CPL_TO_BOOL(OGR_GT_HasZ(m_eGeometryType));
+    oPoints.m_bHasM = CPL_TO_BOOL(OGR_GT_HasM(m_eGeometryType));
+    oPoints.m_bNeedSwap = m_bNeedSwap;
+    if (eFlatType == wkbPoint)
+    {
+        oPoints.m_pabyData = m_pabyData + WKB_PREFIX_SIZE;
+        oPoints.m_nPointCount = 1;
+        if (std::isnan(oPoints.GetX(0)) && std::isnan(oPoints.GetY(0)))
+            oPoints.m_nPointCount = 0;
+    }
+    else
+    {
+        oPoints.m_pabyData = m_pabyData + MIN_WKB_SIZE;
+        oPoints.m_nPointCount = m_nCount;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                  OGRWKBGeometryView::GetRingCount()                  */
+/************************************************************************/
+
+/** Return the number of rings of a polygon or triangle, or 0 for other
+ * geometry types. */
+uint32_t OGRWKBGeometryView::GetRingCount() const
+{
+    const auto eFlatType = wkbFlatten(m_eGeometryType);
+    return m_pabyData != nullptr &&
+                   (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+               ? m_nCount
+               : 0;
+}
+
+/************************************************************************/
+/*                    OGRWKBGeometryView::GetRing()                     */
+/************************************************************************/
+
+/** Get a ring of a polygon or triangle, the first one being the exterior
+ * ring.
+ *
+ * Finding a ring requires skipping the previous ones, so iterating over
+ * all rings with this method is quadratic in the number of rings, but not
+ * in the number of points.
+ */
+bool OGRWKBGeometryView::GetRing(uint32_t iRing,
+                                 OGRWKBPointSequenceView &oRing) const
+{
+    oRing = OGRWKBPointSequenceView();
+    if (iRing >= GetRingCount())
+        return false;
+
+    const GByte *pabyData = m_pabyData + MIN_WKB_SIZE;
+    for (uint32_t i = 0;; ++i)
+    {
+        const uint32_t nPoints = OGRWKBReadUInt32(pabyData, m_bNeedSwap);
+        pabyData += sizeof(uint32_t);
+        if (i == iRing)
+        {
+            oRing.m_pabyData = pabyData;
+            oRing.m_nPointCount = nPoints;
+            oRing.m_nDim = m_nDim;
+            oRing.m_bHasZ = CPL_TO_BOOL(OGR_GT_HasZ(m_eGeometryType));
+            oRing.m_bHasM = CPL_TO_BOOL(OGR_GT_HasM(m_eGeometryType));
+            oRing.m_bNeedSwap = m_bNeedSwap;
+            return true;
+        }
+        pabyData += static_cast<size_t>(nPoints) * m_nDim * sizeof(double);
+    }
+}
+
+/************************************************************************/
+/*                OGRWKBGeometryView::GetGeometryCount()                */
+/************************************************************************/
+
+/** Return the number of sub-geometries of a collection (including compound
+ * curves, curve polygons, polyhedral surfaces and TINs), or 0 for other
+ * geometry types. */
+uint32_t OGRWKBGeometryView::GetGeometryCount() const
+{
+    return m_pabyData != nullptr && IsCollection() ? m_nCount : 0;
+}
+
+/************************************************************************/
+/*                  OGRWKBGeometryView::ConstIterator                   */
+/************************************************************************/
+
+OGRWKBGeometryView::ConstIterator::ConstIterator(const GByte *pabyData,
+                                                 size_t nRemainingSize,
+                                                 uint32_t nRemainingCount)
+    : m_nRemainingSize(nRemainingSize), m_nRemainingCount(nRemainingCount)
+{
+    if (m_nRemainingCount > 0)
+    {
+        // Cannot fail, as the parent geometry has been validated
+        CPL_IGNORE_RET_VAL(m_oView.Init(pabyData, m_nRemainingSize));
+    }
+}
+
+OGRWKBGeometryView::ConstIterator &
+OGRWKBGeometryView::ConstIterator::operator++()
+{
+    const GByte *pabyNext = m_oView.m_pabyData + m_oView.m_nSize;
+    m_nRemainingSize -= m_oView.m_nSize;
+    --m_nRemainingCount;
+    if (m_nRemainingCount > 0)
+        CPL_IGNORE_RET_VAL(m_oView.Init(pabyNext, m_nRemainingSize));
+    return *this;
+}
+
+/** Return an iterator over the sub-geometries of a collection, that is
+ * empty for other geometry types. */
+OGRWKBGeometryView::ConstIterator OGRWKBGeometryView::begin() const
+{
+    if (GetGeometryCount() == 0)
+        return end();
+    return ConstIterator(m_pabyData + MIN_WKB_SIZE, m_nSize - MIN_WKB_SIZE,
+                         m_nCount);
+}
+
+/** Return the end iterator over the sub-geometries of a collection. */
+OGRWKBGeometryView::ConstIterator OGRWKBGeometryView::end() const
+{
+    return ConstIterator(nullptr, 0, 0);
+}
+
+/************************************************************************/
+/*                  OGRWKBGeometryView::GetEnvelope()                   */
+/************************************************************************/
+
+/** Compute the 2D envelope of the vertices of the geometry. */
+bool OGRWKBGeometryView::GetEnvelope(OGREnvelope &sEnvelope) const
+{
+    return m_pabyData != nullptr &&
+           OGRWKBGetBoundingBox(m_pabyData, m_nSize, sEnvelope);
+}
+
+/************************************************************************/
+/*                   OGRWKBGeometryView::GetLength()                    */
+/************************************************************************/
+
+/** Return the length of curves, or the perimeter of surfaces, with the
+ * same conventions as OGRGeometryCollection::get_Length(). */
+double OGRWKBGeometryView::GetLength() const
+{
+    OGRWKBPointSequenceView oPoints;
+    if (GetPoints(oPoints))
+    {
+        if (wkbFlatten(m_eGeometryType) != wkbCircularString)
+            return wkbFlatten(m_eGeometryType) == wkbPoint
+                       ? 0.0
+                       : oPoints.GetLength();
+
+        // Cf OGRCircularString::get_Length()
+        double dfLength = 0.0;
+        for (uint32_t i = 0; i + 2 < oPoints.GetPointCount(); i += 2)
+        {
+            const double x0 = oPoints.GetX(i);
+            const double y0 = oPoints.GetY(i);
+            const double x2 = oPoints.GetX(i + 2);
+            const double y2 = oPoints.GetY(i + 2);
+            double R = 0.0;
+            double cx = 0.0;
+            double cy = 0.0;
+            double alpha0 = 0.0;
+            double alpha1 = 0.0;
+            double alpha2 = 0.0;
+            if (OGRGeometryFactory::GetCurveParameters(
+                    x0, y0, oPoints.GetX(i + 1), oPoints.GetY(i + 1), x2, y2,
+                    R, cx, cy, alpha0, alpha1, alpha2))
+            {
+                dfLength += fabs(alpha2 - alpha0) * R;
+            }
+            else
+            {
+                dfLength += sqrt((x2 - x0) * (x2 - x0) + (y2 - y0) * (y2 - y0));
+            }
+        }
+        return dfLength;
+    }
+
+    double dfLength = 0.0;
+    for (uint32_t i = 0; i < GetRingCount(); ++i)
+    {
+        if (GetRing(i, oPoints))
+            dfLength += oPoints.GetLength();
+    }
+    for (const auto &oSubGeom : *this)
+        dfLength += oSubGeom.GetLength();
+    return dfLength;
+}
+
+/************************************************************************/
+/*                    OGRWKBGeometryView::GetArea()                     */
+/************************************************************************/
+
+/** Return the area of surfaces and of closed curves, with the same
+ * conventions as OGRGeometryCollection::get_Area().
+ *
+ * The area of geometries with circular arcs is computed by materializing
+ * them as OGRGeometry.
+ */
+double OGRWKBGeometryView::GetArea() const
+{
+    const auto eFlatType = wkbFlatten(m_eGeometryType);
+    if (eFlatType == wkbCircularString || eFlatType == wkbCompoundCurve ||
+        eFlatType == wkbCurvePolygon)
+    {
+        const auto poGeom = ToGeometry();
+        if (!poGeom)
+            return 0.0;
+        return eFlatType == wkbCurvePolygon
+                   ? poGeom->toCurvePolygon()->get_Area()
+                   : poGeom->toCurve()->get_Area();
+    }
+
+    OGRWKBPointSequenceView oPoints;
+    if (GetPoints(oPoints))
+    {
+        return eFlatType == wkbLineString
+                   ? OGRWKBPointSequenceGetLinearArea(oPoints,
+                                                      /* bCheckClosed = */ true)
+                   : 0.0;
+    }
+
+    double dfArea = 0.0;
+    for (uint32_t i = 0; i < GetRingCount(); ++i)
+    {
+        if (GetRing(i, oPoints))
+        {
+            const double dfRingArea = OGRWKBPointSequenceGetLinearArea(
+                oPoints, /* bCheckClosed = */ false);
+            dfArea += i == 0 ? dfRingArea : -dfRingArea;
+        }
+    }
+    for (const auto &oSubGeom : *this)
+        dfArea += oSubGeom.GetArea();
+    return dfArea;
+}
+
+/************************************************************************/
+/*                  OGRWKBGeometryView::ContainsPoint()                 */
+/************************************************************************/
+
+/** Return whether a point is inside a polygon, a triangle, or one of the
+ * polygons of a collection, according to the even-odd rule.
+ *
+ * Points on the boundary may be reported either inside or outside, and
+ * curve polygons are considered as not containing any point.
+ */
+bool OGRWKBGeometryView::ContainsPoint(double dfX, double dfY) const
+{
+    const uint32_t nRings = GetRingCount();
+    if (nRings > 0)
+    {
+        bool bInside = false;
+        OGRWKBPointSequenceView oRing;
+        for (uint32_t i = 0; i < nRings; ++i)
+        {
+            if (GetRing(i, oRing))
+                OGRWKBRingUpdateContainsPoint(oRing, dfX, dfY, bInside);
+        }
+        return bInside;
+    }
+
+    if (wkbFlatten(m_eGeometryType) == wkbCurvePolygon)
+        return false;
+
+    for (const auto &oSubGeom : *this)
+    {
+        if (oSubGeom.ContainsPoint(dfX, dfY))
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*               OGRWKBGeometryView::IntersectsEnvelope()               */
+/************************************************************************/
+
+/** Compute whether the geometry intersects a rectangle, boundaries
+ * included.
+ *
+ * Unlike OGRWKBIntersectsPessimistic(), the result is exact for geometries
+ * made of linear segments, as a GEOS Intersects() test would be for valid
+ * geometries.
+ *
+ * @param sEnvelope the rectangle.
+ * @param[out] bIntersects set to the result of the test.
+ * @return false if the test cannot be done without GEOS, because the
+ * geometry has circular arcs.
+ */
+bool OGRWKBGeometryView::IntersectsEnvelope(const OGREnvelope &sEnvelope,
+                                            bool &bIntersects) const
+{
+    const int nRet = IntersectsEnvelopeInternal(sEnvelope);
+    bIntersects = nRet == 1;
+    return nRet >= 0;
+}
+
+/** Return 1 if the geometry intersects the envelope, 0 if it does not, and
+ * -1 if it is not known. */
+int OGRWKBGeometryView::IntersectsEnvelopeInternal(
+    const OGREnvelope &sEnvelope) const
+{
+    const auto eFlatType = wkbFlatten(m_eGeometryType);
+    if (eFlatType == wkbCircularString || eFlatType == wkbCompoundCurve ||
+        eFlatType == wkbCurvePolygon)
+    {
+        return IsEmpty() ? 0 : -1;
+    }
+
+    OGRWKBPointSequenceView oPoints;
+    if (GetPoints(oPoints))
+        return OGRWKBPointSequenceIntersectsEnvelope(oPoints, sEnvelope) ? 1
+                                                                         : 0;
+
+    const uint32_t nRings = GetRingCount();
+    if (nRings > 0)
+    {
+        if (!GetRing(0, oPoints) || oPoints.GetPointCount() == 0)
+            return 0;
+        for (uint32_t i = 0; i < nRings; ++i)
+        {
+            if (GetRing(i, oPoints) &&
+                OGRWKBPointSequenceIntersectsEnvelope(oPoints, sEnvelope))
+                return 1;
+        }
+        // No edge intersects the rectangle, so it is either completely
+        // inside or outside of the polygon.
+        return ContainsPoint(sEnvelope.MinX, sEnvelope.MinY) ? 1 : 0;
+    }
+
+    int nRet = 0;
+    for (const auto &oSubGeom : *this)
+    {
+        const int nSubRet = oSubGeom.IntersectsEnvelopeInternal(sEnvelope);
+        if (nSubRet == 1)
+            return 1;
+        if (nSubRet < 0)
+            nRet = -1;
+    }
+    return nRet;
+}
+
+/************************************************************************/
+/*                  OGRWKBGeometryView::ToGeometry()                    */
+/************************************************************************/
+
+/** Materialize the geometry as an OGRGeometry, or return nullptr in case
+ * of error. */
+std::unique_ptr<OGRGeometry>
+OGRWKBGeometryView::ToGeometry(const OGRSpatialReference *poSRS) const
+{
+    if (m_pabyData == nullptr)
+        return nullptr;
+    OGRGeometry *poGeom = nullptr;
+    OGRGeometryFactory::createFromWkb(m_pabyData, poSRS, &poGeom, m_nSize);
+    return std::unique_ptr<OGRGeometry>(poGeom);
+}
+
 /************************************************************************/
 /*                         OGRAppendBuffer()                            */
 /************************************************************************/
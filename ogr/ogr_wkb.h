@@ -18,6 +18,8 @@
 #include "cpl_port.h"
 #include "ogr_core.h"
 
+#include <cstring>
+#include <memory>
 #include <vector>
 
 bool CPL_DLL OGRWKBGetGeomType(const GByte *pabyWkb, size_t nWKBSize,
@@ -90,6 +92,190 @@ bool CPL_DLL OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
                              OGRWKBTransformCache &oCache,
                              OGREnvelope3D &sEnvelope);
 
+/************************************************************************/
+/*                      OGRWKBPointSequenceView                         */
+/************************************************************************/
+
+/** Read-only view over the coordinates of a sequence of points of a WKB
+ * geometry, that is a curve or a ring of a polygon.
+ *
+ * Coordinates are read from the WKB buffer on demand, and the view is only
+ * valid as long as that buffer.
+ *
+ * @since GDAL 3.13
+ */
+class CPL_DLL OGRWKBPointSequenceView
+{
+  public:
+    /** Constructor of an empty sequence */
+    OGRWKBPointSequenceView() = default;
+
+    /** Return the number of points. */
+    inline uint32_t GetPointCount() const
+    {
+        return m_nPointCount;
+    }
+
+    /** Return the X coordinate of the point at index i. */
+    inline double GetX(uint32_t i) const
+    {
+        return Read(i, 0);
+    }
+
+    /** Return the Y coordinate of the point at index i. */
+    inline double GetY(uint32_t i) const
+    {
+        return Read(i, 1);
+    }
+
+    /** Return the Z coordinate of the point at index i, or 0. */
+    inline double GetZ(uint32_t i) const
+    {
+        return m_bHasZ ? Read(i, 2) : 0.0;
+    }
+
+    /** Return the M value of the point at index i, or 0. */
+    inline double GetM(uint32_t i) const
+    {
+        return m_bHasM ? Read(i, m_bHasZ ? 3 : 2) : 0.0;
+    }
+
+    double GetLength() const;
+
+  private:
+    friend class OGRWKBGeometryView;
+
+    const GByte *m_pabyData = nullptr;
+    uint32_t m_nPointCount = 0;
+    int m_nDim = 2;
+    bool m_bHasZ = false;
+    bool m_bHasM = false;
+    bool m_bNeedSwap = false;
+
+    inline double Read(uint32_t i, int iDim) const
+    {
+        double dfVal;
+        memcpy(&dfVal,
+               m_pabyData + (static_cast<size_t>(i) * m_nDim + iDim) *
+                                sizeof(double),
+               sizeof(double));
+        if (m_bNeedSwap)
+            CPL_SWAP64PTR(&dfVal);
+        return dfVal;
+    }
+};
+
+/************************************************************************/
+/*                        OGRWKBGeometryView                            */
+/************************************************************************/
+
+class OGRGeometry;
+class OGRSpatialReference;
+
+/** Read-only view over a WKB geometry (ISO or extended OGC variant), that
+ * gives access to its structure and computes envelope, length, area and
+ * simple predicates without materializing an OGRGeometry, nor copying its
+ * coordinates.
+ *
+ * Init() validates the whole structure of the geometry, so that accessors
+ * do not need to check it again. The view is only valid as long as the
+ * WKB buffer.
+ *
+ * @since GDAL 3.13
+ */
+class CPL_DLL OGRWKBGeometryView
+{
+  public:
+    /** Constructor of an uninitialized view */
+    OGRWKBGeometryView() = default;
+
+    bool Init(const GByte *pabyWkb, size_t nWKBSize);
+
+    /** Return the pointer to the start of the WKB geometry. */
+    inline const GByte *GetData() const
+    {
+        return m_pabyData;
+    }
+
+    /** Return the size of the WKB geometry, which may be smaller than the
+     * size of the buffer passed to Init(). */
+    inline size_t GetSize() const
+    {
+        return m_nSize;
+    }
+
+    /** Return the geometry type. */
+    inline OGRwkbGeometryType GetGeometryType() const
+    {
+        return m_eGeometryType;
+    }
+
+    bool IsEmpty() const;
+
+    bool GetPoints(OGRWKBPointSequenceView &oPoints) const;
+
+    uint32_t GetRingCount() const;
+    bool GetRing(uint32_t iRing, OGRWKBPointSequenceView &oRing) const;
+
+    uint32_t GetGeometryCount() const;
+
+    class ConstIterator;
+
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+    bool GetEnvelope(OGREnvelope &sEnvelope) const;
+    double GetLength() const;
+    double GetArea() const;
+    bool ContainsPoint(double dfX, double dfY) const;
+    bool IntersectsEnvelope(const OGREnvelope &sEnvelope,
+                            bool &bIntersects) const;
+
+    std::unique_ptr<OGRGeometry>
+    ToGeometry(const OGRSpatialReference *poSRS = nullptr) const;
+
+  private:
+    const GByte *m_pabyData = nullptr;
+    size_t m_nSize = 0;
+    OGRwkbGeometryType m_eGeometryType = wkbUnknown;
+    bool m_bNeedSwap = false;
+    int m_nDim = 2;
+    //! Number of points, rings or sub-geometries, depending on the type
+    uint32_t m_nCount = 0;
+
+    bool Init(const GByte *pabyWkb, size_t nWKBSize, int nRec);
+    bool IsCollection() const;
+    int IntersectsEnvelopeInternal(const OGREnvelope &sEnvelope) const;
+};
+
+/** Iterator over the sub-geometries of a collection. */
+class CPL_DLL OGRWKBGeometryView::ConstIterator
+{
+  public:
+    //! @cond Doxygen_Suppress
+    ConstIterator(const GByte *pabyData, size_t nRemainingSize,
+                  uint32_t nRemainingCount);
+
+    inline const OGRWKBGeometryView &operator*() const
+    {
+        return m_oView;
+    }
+
+    ConstIterator &operator++();
+
+    inline bool operator!=(const ConstIterator &other) const
+    {
+        return m_nRemainingCount != other.m_nRemainingCount;
+    }
+
+    //! @endcond
+
+  private:
+    OGRWKBGeometryView m_oView{};
+    size_t m_nRemainingSize = 0;
+    uint32_t m_nRemainingCount = 0;
+};
+
 /************************************************************************/
 /*                       OGRAppendBuffer                                */
 /************************************************************************/
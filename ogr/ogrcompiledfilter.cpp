@@ -0,0 +1,971 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Compiled evaluation of attribute filters
+ * Author:   NextGIS <info at nextgis dot com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, NextGIS <info at nextgis dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "ogr_compiled_filter.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+
+#include "cpl_error.h"
+#include "ogr_feature.h"
+#include "ogr_p.h"
+#include "ogr_swq.h"
+
+//! @cond Doxygen_Suppress
+
+// Number of rows evaluated at once by each instruction
+constexpr size_t BATCH_SIZE = 1024;
+
+// Same value as in swq_expr_node::Evaluate()
+constexpr int MAX_RECURSION_LEVEL = 32;
+
+/************************************************************************/
+/*                         CompareStrings()                             */
+/************************************************************************/
+
+// Same result as strcasecmp() on the nul-terminated versions of the strings.
+static int CompareStrings(const char *pszA, size_t nLenA, const char *pszB,
+                          size_t nLenB)
+{
+    const size_t nLen = std::min(nLenA, nLenB);
+    for (size_t i = 0; i < nLen; ++i)
+    {
+        const int chA = tolower(static_cast<unsigned char>(pszA[i]));
+        const int chB = tolower(static_cast<unsigned char>(pszB[i]));
+        if (chA != chB)
+            return chA - chB;
+    }
+    return nLenA < nLenB ? -1 : nLenA > nLenB ? 1 : 0;
+}
+
+/************************************************************************/
+/*                           EqualStrings()                             */
+/************************************************************************/
+
+// Same result as the SWQ_EQ case of SWQGeneralEvaluator() for strings.
+static bool EqualStrings(const char *pszA, size_t nLenA, const char *pszB,
+                         size_t nLenB)
+{
+    // When comparing timestamps, the +00 at the end might be discarded if
+    // the other member has no explicit timezone.
+    if (nLenA > 3 && nLenB > 3)
+    {
+        if (memcmp(pszA + nLenA - 3, "+00", 3) == 0 && pszB[nLenB - 3] == ':')
+            return CompareStrings(pszA, std::min(nLenA, nLenB), pszB,
+                                  nLenB) == 0;
+        if (pszA[nLenA - 3] == ':' && memcmp(pszB + nLenB - 3, "+00", 3) == 0)
+            return CompareStrings(pszA, nLenA, pszB,
+                                  std::min(nLenA, nLenB)) == 0;
+    }
+    return CompareStrings(pszA, nLenA, pszB, nLenB) == 0;
+}
+
+/************************************************************************/
+/*                           CompareValues()                            */
+/************************************************************************/
+
+template <class GetA, class GetB>
+static void CompareValues(int nOperation, size_t nRows, const GetA &getA,
+                          const GetB &getB, uint8_t *pabyValue)
+{
+    switch (nOperation)
+    {
+        case SWQ_EQ:
+            for (size_t i = 0; i < nRows; ++i)
+                pabyValue[i] = getA(i) == getB(i);
+            break;
+        case SWQ_NE:
+            for (size_t i = 0; i < nRows; ++i)
+                pabyValue[i] = getA(i) != getB(i);
+            break;
+        case SWQ_LT:
+            for (size_t i = 0; i < nRows; ++i)
+                pabyValue[i] = getA(i) < getB(i);
+            break;
+        case SWQ_LE:
+            for (size_t i = 0; i < nRows; ++i)
+                pabyValue[i] = getA(i) <= getB(i);
+            break;
+        case SWQ_GT:
+            for (size_t i = 0; i < nRows; ++i)
+                pabyValue[i] = getA(i) > getB(i);
+            break;
+        case SWQ_GE:
+            for (size_t i = 0; i < nRows; ++i)
+                pabyValue[i] = getA(i) >= getB(i);
+            break;
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                          TestComparison()                            */
+/************************************************************************/
+
+// Return whether "a op b" is true, given the sign of the comparison of a
+// with b.
+static bool TestComparison(int nOperation, int nCmp)
+{
+    switch (nOperation)
+    {
+        case SWQ_EQ:
+            return nCmp == 0;
+        case SWQ_NE:
+            return nCmp != 0;
+        case SWQ_LT:
+            return nCmp < 0;
+        case SWQ_LE:
+            return nCmp <= 0;
+        case SWQ_GT:
+            return nCmp > 0;
+        case SWQ_GE:
+            return nCmp >= 0;
+        default:
+            CPLAssert(false);
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                      GetMirroredOperation()                          */
+/************************************************************************/
+
+// Return the operation such that "b op' a" is equivalent to "a op b"
+static int GetMirroredOperation(int nOperation)
+{
+    switch (nOperation)
+    {
+        case SWQ_LT:
+            return SWQ_GT;
+        case SWQ_LE:
+            return SWQ_GE;
+        case SWQ_GT:
+            return SWQ_LT;
+        case SWQ_GE:
+            return SWQ_LE;
+        default:
+            break;
+    }
+    return nOperation;
+}
+
+/************************************************************************/
+/*                        OffsetColumnValues()                          */
+/************************************************************************/
+
+static OGRCompiledFilter::ColumnValues
+OffsetColumnValues(const OGRCompiledFilter::ColumnValues &sValues,
+                   size_t nOffset)
+{
+    OGRCompiledFilter::ColumnValues sRet;
+    if (sValues.panValues)
+        sRet.panValues = sValues.panValues + nOffset;
+    if (sValues.padfValues)
+        sRet.padfValues = sValues.padfValues + nOffset;
+    if (sValues.papszValues)
+        sRet.papszValues = sValues.papszValues + nOffset;
+    if (sValues.panLengths)
+        sRet.panLengths = sValues.panLengths + nOffset;
+    if (sValues.pabyIsNull)
+        sRet.pabyIsNull = sValues.pabyIsNull + nOffset;
+    return sRet;
+}
+
+/************************************************************************/
+/*                             Compile()                                */
+/************************************************************************/
+
+/** Compile an expression, whose column indices refer to the fields of
+ * poDefn as in OGRFeatureQuery::Compile().
+ *
+ * @return the compiled filter, or nullptr if the expression uses
+ * constructs that are not supported.
+ */
+std::unique_ptr<OGRCompiledFilter>
+OGRCompiledFilter::Compile(const swq_expr_node *poExpr,
+                           const OGRFeatureDefn *poDefn)
+{
+    if (poExpr == nullptr)
+        return nullptr;
+
+    std::unique_ptr<OGRCompiledFilter> poFilter(new OGRCompiledFilter());
+    poFilter->m_poDefn = poDefn;
+    int nDepth = 0;
+    if (!poFilter->CompileBoolean(poExpr, 0, nDepth))
+        return nullptr;
+    CPLAssert(nDepth == 1);
+
+    return poFilter;
+}
+
+/************************************************************************/
+/*                            AddColumn()                               */
+/************************************************************************/
+
+/** Return the index of the column for a SNT_COLUMN node, or -1 if the value
+ * fetched by OGRFeatureFetcher() for it is not the raw value of the field.
+ */
+int OGRCompiledFilter::AddColumn(const swq_expr_node *poNode,
+                                 bool bOnlyNullness)
+{
+    if (poNode->eNodeType != SNT_COLUMN || poNode->table_index != 0)
+        return -1;
+
+    const int nFieldCount = m_poDefn->GetFieldCount();
+    int iField = poNode->field_index;
+    // Same as OGRFeatureFetcherFixFieldIndex(): a FID column may have been
+    // added after regular fields, special fields and geometry fields.
+    if (iField ==
+        nFieldCount + SPECIAL_FIELD_COUNT + m_poDefn->GetGeomFieldCount())
+    {
+        iField = nFieldCount + SPF_FID;
+    }
+
+    Column oColumn;
+    if (iField == nFieldCount + SPF_FID)
+    {
+        // A SWQ_INTEGER FID would be clamped by GetFieldAsInteger()
+        if (!bOnlyNullness && poNode->field_type != SWQ_INTEGER64)
+            return -1;
+        oColumn.eType = bOnlyNullness ? ValueType::NONE : ValueType::INTEGER;
+    }
+    else if (iField >= 0 && iField < nFieldCount)
+    {
+        oColumn.iField = iField;
+        oColumn.eFieldType = m_poDefn->GetFieldDefn(iField)->GetType();
+        if (!bOnlyNullness)
+        {
+            switch (poNode->field_type)
+            {
+                case SWQ_INTEGER:
+                case SWQ_BOOLEAN:
+                    if (oColumn.eFieldType != OFTInteger)
+                        return -1;
+                    oColumn.eType = ValueType::INTEGER;
+                    break;
+                case SWQ_INTEGER64:
+                    if (oColumn.eFieldType != OFTInteger64)
+                        return -1;
+                    oColumn.eType = ValueType::INTEGER;
+                    break;
+                case SWQ_FLOAT:
+                    if (oColumn.eFieldType != OFTReal)
+                        return -1;
+                    oColumn.eType = ValueType::REAL;
+                    break;
+                case SWQ_STRING:
+                    if (oColumn.eFieldType != OFTString)
+                        return -1;
+                    oColumn.eType = ValueType::STRING;
+                    break;
+                default:
+                    return -1;
+            }
+        }
+    }
+    else
+    {
+        return -1;
+    }
+
+    for (size_t i = 0; i < m_aoColumns.size(); ++i)
+    {
+        if (m_aoColumns[i].iField == oColumn.iField &&
+            m_aoColumns[i].eType == oColumn.eType)
+        {
+            return static_cast<int>(i);
+        }
+    }
+    m_aoColumns.push_back(oColumn);
+    return static_cast<int>(m_aoColumns.size()) - 1;
+}
+
+/************************************************************************/
+/*                          CompileBoolean()                            */
+/************************************************************************/
+
+/** Append the instructions evaluating poNode, whose result is pushed on
+ * the stack of registers, of which nDepth is the current size.
+ */
+bool OGRCompiledFilter::CompileBoolean(const swq_expr_node *poNode,
+                                       int nLevel, int &nDepth)
+{
+    // swq_expr_node::Evaluate() errors out on such expressions
+    if (nLevel >= MAX_RECURSION_LEVEL)
+        return false;
+
+    Instruction oInstr;
+    if (poNode->eNodeType == SNT_COLUMN)
+    {
+        // Integer column used as a logical value
+        if (poNode->field_type != SWQ_INTEGER &&
+            poNode->field_type != SWQ_BOOLEAN)
+            return false;
+        oInstr.eOpcode = Opcode::IS_TRUE;
+        oInstr.iColumn = AddColumn(poNode, false);
+        if (oInstr.iColumn < 0)
+            return false;
+    }
+    else if (poNode->eNodeType != SNT_OPERATION ||
+             poNode->field_type != SWQ_BOOLEAN)
+    {
+        return false;
+    }
+    else if ((poNode->nOperation == SWQ_AND ||
+              poNode->nOperation == SWQ_OR) &&
+             poNode->nSubExprCount == 2)
+    {
+        if (!CompileBoolean(poNode->papoSubExpr[0], nLevel + 1, nDepth) ||
+            !CompileBoolean(poNode->papoSubExpr[1], nLevel + 1, nDepth))
+        {
+            return false;
+        }
+        oInstr.eOpcode =
+            poNode->nOperation == SWQ_AND ? Opcode::AND : Opcode::OR;
+        m_aoInstructions.push_back(std::move(oInstr));
+        --nDepth;
+        return true;
+    }
+    else if (poNode->nOperation == SWQ_NOT && poNode->nSubExprCount == 1)
+    {
+        if (!CompileBoolean(poNode->papoSubExpr[0], nLevel + 1, nDepth))
+            return false;
+        oInstr.eOpcode = Opcode::NOT;
+        m_aoInstructions.push_back(std::move(oInstr));
+        return true;
+    }
+    else if (poNode->nOperation == SWQ_ISNULL && poNode->nSubExprCount == 1)
+    {
+        if (nLevel + 1 >= MAX_RECURSION_LEVEL)
+            return false;
+        oInstr.eOpcode = Opcode::IS_NULL;
+        oInstr.iColumn = AddColumn(poNode->papoSubExpr[0], true);
+        if (oInstr.iColumn < 0)
+            return false;
+    }
+    else
+    {
+        return CompileComparison(poNode, nLevel) &&
+               (++nDepth, m_nMaxDepth = std::max(m_nMaxDepth, nDepth), true);
+    }
+
+    m_aoInstructions.push_back(std::move(oInstr));
+    ++nDepth;
+    m_nMaxDepth = std::max(m_nMaxDepth, nDepth);
+    return true;
+}
+
+/************************************************************************/
+/*                        CompileComparison()                           */
+/************************************************************************/
+
+bool OGRCompiledFilter::CompileComparison(const swq_expr_node *poNode,
+                                          int nLevel)
+{
+    const int nOperation = poNode->nOperation;
+    const int nCount = poNode->nSubExprCount;
+    Instruction oInstr;
+    oInstr.nOperation = nOperation;
+    switch (nOperation)
+    {
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_LT:
+        case SWQ_LE:
+        case SWQ_GT:
+        case SWQ_GE:
+            if (nCount != 2)
+                return false;
+            oInstr.eOpcode = Opcode::COMPARE;
+            break;
+        case SWQ_BETWEEN:
+            if (nCount != 3)
+                return false;
+            oInstr.eOpcode = Opcode::BETWEEN;
+            break;
+        case SWQ_IN:
+            if (nCount < 2)
+                return false;
+            oInstr.eOpcode = Opcode::IN_LIST;
+            break;
+        default:
+            return false;
+    }
+
+    const swq_expr_node *const *papoSubExpr = poNode->papoSubExpr;
+    for (int i = 0; i < nCount; ++i)
+    {
+        const swq_expr_node *poSubExpr = papoSubExpr[i];
+        if (poSubExpr->eNodeType == SNT_COLUMN)
+        {
+            if (nLevel + 1 >= MAX_RECURSION_LEVEL)
+                return false;
+        }
+        else if (poSubExpr->eNodeType != SNT_CONSTANT || poSubExpr->is_null)
+        {
+            return false;
+        }
+    }
+
+    // Determine which branch of SWQGeneralEvaluator() is taken
+    const auto IsIntegerOrBoolean = [](swq_field_type eType)
+    { return SWQ_IS_INTEGER(eType) || eType == SWQ_BOOLEAN; };
+    const swq_field_type eType0 = papoSubExpr[0]->field_type;
+    const swq_field_type eType1 = papoSubExpr[1]->field_type;
+    if (eType0 == SWQ_FLOAT || eType1 == SWQ_FLOAT)
+    {
+        // Only the first two operands are converted from integer
+        for (int i = 0; i < nCount; ++i)
+        {
+            const swq_field_type eType = papoSubExpr[i]->field_type;
+            if (eType != SWQ_FLOAT && !(i < 2 && SWQ_IS_INTEGER(eType)))
+                return false;
+        }
+        oInstr.eCompareType = ValueType::REAL;
+    }
+    else if (IsIntegerOrBoolean(eType0))
+    {
+        for (int i = 0; i < nCount; ++i)
+        {
+            if (!IsIntegerOrBoolean(papoSubExpr[i]->field_type))
+                return false;
+        }
+        oInstr.eCompareType = ValueType::INTEGER;
+    }
+    else if (eType0 == SWQ_STRING)
+    {
+        for (int i = 0; i < nCount; ++i)
+        {
+            if (papoSubExpr[i]->field_type != SWQ_STRING ||
+                (papoSubExpr[i]->eNodeType == SNT_CONSTANT &&
+                 papoSubExpr[i]->string_value == nullptr))
+                return false;
+        }
+        oInstr.eCompareType = ValueType::STRING;
+    }
+    else
+    {
+        return false;
+    }
+
+    // Make sure the column is the first operand
+    int iColumnOperand = 0;
+    if (papoSubExpr[0]->eNodeType != SNT_COLUMN)
+    {
+        if (oInstr.eOpcode != Opcode::COMPARE ||
+            papoSubExpr[1]->eNodeType != SNT_COLUMN)
+            return false;
+        iColumnOperand = 1;
+        oInstr.nOperation = GetMirroredOperation(nOperation);
+    }
+    oInstr.iColumn = AddColumn(papoSubExpr[iColumnOperand], false);
+    if (oInstr.iColumn < 0)
+        return false;
+
+    for (int i = 0; i < nCount; ++i)
+    {
+        if (i == iColumnOperand)
+            continue;
+        const swq_expr_node *poSubExpr = papoSubExpr[i];
+        if (poSubExpr->eNodeType == SNT_COLUMN)
+        {
+            if (oInstr.eOpcode != Opcode::COMPARE)
+                return false;
+            oInstr.iOtherColumn = AddColumn(poSubExpr, false);
+            if (oInstr.iOtherColumn < 0)
+                return false;
+        }
+        else if (oInstr.eCompareType == ValueType::INTEGER)
+        {
+            oInstr.anConstants.push_back(poSubExpr->int_value);
+        }
+        else if (oInstr.eCompareType == ValueType::REAL)
+        {
+            oInstr.adfConstants.push_back(
+                SWQ_IS_INTEGER(poSubExpr->field_type)
+                    ? static_cast<double>(poSubExpr->int_value)
+                    : poSubExpr->float_value);
+        }
+        else
+        {
+            oInstr.aosConstants.push_back(poSubExpr->string_value);
+        }
+    }
+
+    // Allow binary searches in IN lists
+    if (oInstr.eOpcode == Opcode::IN_LIST)
+    {
+        // NaN equals no value, and would break the ordering
+        oInstr.adfConstants.erase(
+            std::remove_if(oInstr.adfConstants.begin(),
+                           oInstr.adfConstants.end(),
+                           [](double dfVal) { return std::isnan(dfVal); }),
+            oInstr.adfConstants.end());
+        std::sort(oInstr.anConstants.begin(), oInstr.anConstants.end());
+        std::sort(oInstr.adfConstants.begin(), oInstr.adfConstants.end());
+        std::sort(oInstr.aosConstants.begin(), oInstr.aosConstants.end(),
+                  [](const std::string &a, const std::string &b) {
+                      return CompareStrings(a.c_str(), a.size(), b.c_str(),
+                                            b.size()) < 0;
+                  });
+    }
+
+    m_aoInstructions.push_back(std::move(oInstr));
+    return true;
+}
+
+/************************************************************************/
+/*                             Evaluate()                               */
+/************************************************************************/
+
+/** Evaluate the filter on a feature, which must be of the layer definition
+ * passed to Compile().
+ */
+bool OGRCompiledFilter::Evaluate(const OGRFeature *poFeature) const
+{
+    CPLAssert(poFeature->GetDefnRef() == m_poDefn);
+
+    // Values of the columns for the single row of the feature
+    struct FeatureValue
+    {
+        int64_t nValue = 0;
+        double dfValue = 0;
+        const char *pszValue = nullptr;
+        size_t nLength = 0;
+        uint8_t byIsNull = 0;
+    };
+
+    // Buffers are on the stack, so that no allocation is done per feature,
+    // except for the values of filters using many columns. The nesting
+    // level checked by CompileBoolean() bounds the number of registers.
+    constexpr size_t MAX_STACK_COLUMNS = 16;
+    FeatureValue asStackFeatureValues[MAX_STACK_COLUMNS];
+    ColumnValues asStackColumns[MAX_STACK_COLUMNS];
+    uint8_t abyRegisters[2 * MAX_RECURSION_LEVEL];
+    double adfTmp[2];
+    CPLAssert(m_nMaxDepth <= MAX_RECURSION_LEVEL);
+
+    const size_t nColumns = m_aoColumns.size();
+    std::vector<FeatureValue> asHeapFeatureValues;
+    std::vector<ColumnValues> asHeapColumns;
+    FeatureValue *pasFeatureValues = asStackFeatureValues;
+    ColumnValues *pasColumns = asStackColumns;
+    if (nColumns > MAX_STACK_COLUMNS)
+    {
+        asHeapFeatureValues.resize(nColumns);
+        asHeapColumns.resize(nColumns);
+        pasFeatureValues = asHeapFeatureValues.data();
+        pasColumns = asHeapColumns.data();
+    }
+
+    for (size_t i = 0; i < nColumns; ++i)
+    {
+        const Column &oColumn = m_aoColumns[i];
+        FeatureValue &sValue = pasFeatureValues[i];
+        ColumnValues &sColumn = pasColumns[i];
+        sColumn.panValues = &sValue.nValue;
+        sColumn.padfValues = &sValue.dfValue;
+        sColumn.papszValues = &sValue.pszValue;
+        sColumn.panLengths = &sValue.nLength;
+        sColumn.pabyIsNull = &sValue.byIsNull;
+
+        bool bIsNull;
+        if (oColumn.iField < 0)
+        {
+            const GIntBig nFID = poFeature->GetFID();
+            bIsNull = nFID == OGRNullFID;
+            sValue.nValue = nFID;
+        }
+        else
+        {
+            bIsNull = !poFeature->IsFieldSetAndNotNull(oColumn.iField);
+            if (!bIsNull)
+            {
+                const OGRField *psField =
+                    poFeature->GetRawFieldRef(oColumn.iField);
+                switch (oColumn.eType)
+                {
+                    case ValueType::NONE:
+                        break;
+                    case ValueType::INTEGER:
+                        sValue.nValue = oColumn.eFieldType == OFTInteger
+                                            ? psField->Integer
+                                            : psField->Integer64;
+                        break;
+                    case ValueType::REAL:
+                        sValue.dfValue = psField->Real;
+                        break;
+                    case ValueType::STRING:
+                        sValue.pszValue = psField->String;
+                        sValue.nLength = strlen(psField->String);
+                        break;
+                }
+            }
+        }
+        sValue.byIsNull = bIsNull;
+    }
+
+    uint8_t byResult = 0;
+    EvaluateRows(pasColumns, 1, &byResult, abyRegisters, adfTmp);
+    return byResult != 0;
+}
+
+/************************************************************************/
+/*                          EvaluateBatch()                             */
+/************************************************************************/
+
+/** Evaluate the filter on nRows rows.
+ *
+ * @param pasColumns Values of the columns returned by GetColumns(), in the
+ *                   same order.
+ * @param nRows Number of rows.
+ * @param pabyResult Array of nRows values, set to 1 for rows that match the
+ *                   filter, and 0 otherwise.
+ * @param oWorkspace Scratch buffers. A different instance must be used by
+ *                   each thread evaluating the filter concurrently.
+ */
+void OGRCompiledFilter::EvaluateBatch(const ColumnValues *pasColumns,
+                                      size_t nRows, uint8_t *pabyResult,
+                                      Workspace &oWorkspace) const
+{
+    const size_t nBatchSize =
+        std::min(BATCH_SIZE, std::max<size_t>(1, nRows));
+    oWorkspace.abyRegisters.resize(static_cast<size_t>(m_nMaxDepth) * 2 *
+                                   nBatchSize);
+    oWorkspace.adfValues.resize(2 * nBatchSize);
+    oWorkspace.asColumns.resize(m_aoColumns.size());
+
+    for (size_t iStart = 0; iStart < nRows; iStart += nBatchSize)
+    {
+        const size_t nCount = std::min(nBatchSize, nRows - iStart);
+        for (size_t i = 0; i < m_aoColumns.size(); ++i)
+        {
+            oWorkspace.asColumns[i] =
+                OffsetColumnValues(pasColumns[i], iStart);
+        }
+        EvaluateRows(oWorkspace.asColumns.data(), nCount, pabyResult + iStart,
+                     oWorkspace.abyRegisters.data(),
+                     oWorkspace.adfValues.data());
+    }
+}
+
+/************************************************************************/
+/*                           EvaluateRows()                             */
+/************************************************************************/
+
+// Evaluate the program on nRows rows, with pabyRegisters of at least
+// 2 * m_nMaxDepth * nRows bytes, and padfTmp of at least 2 * nRows values.
+void OGRCompiledFilter::EvaluateRows(const ColumnValues *pasColumns,
+                                     size_t nRows, uint8_t *pabyResult,
+                                     uint8_t *pabyRegisters,
+                                     double *padfTmp) const
+{
+    // Each register holds the value and the nullness of nRows rows
+    const size_t nRegisterSize = 2 * nRows;
+
+    int nDepth = 0;
+    for (const auto &oInstr : m_aoInstructions)
+    {
+        switch (oInstr.eOpcode)
+        {
+            case Opcode::AND:
+            case Opcode::OR:
+            {
+                // Same as the integer branch of SWQGeneralEvaluator()
+                CPLAssert(nDepth >= 2);
+                uint8_t *pabyValueA =
+                    pabyRegisters + (nDepth - 2) * nRegisterSize;
+                uint8_t *pabyIsNullA = pabyValueA + nRows;
+                const uint8_t *pabyValueB = pabyValueA + nRegisterSize;
+                const uint8_t *pabyIsNullB = pabyValueB + nRows;
+                if (oInstr.eOpcode == Opcode::AND)
+                {
+                    for (size_t i = 0; i < nRows; ++i)
+                    {
+                        pabyValueA[i] &= pabyValueB[i];
+                        pabyIsNullA[i] &= pabyIsNullB[i];
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < nRows; ++i)
+                    {
+                        pabyValueA[i] |= pabyValueB[i];
+                        pabyIsNullA[i] |= pabyIsNullB[i];
+                    }
+                }
+                --nDepth;
+                break;
+            }
+
+            case Opcode::NOT:
+            {
+                CPLAssert(nDepth >= 1);
+                uint8_t *pabyValue =
+                    pabyRegisters + (nDepth - 1) * nRegisterSize;
+                const uint8_t *pabyIsNull = pabyValue + nRows;
+                for (size_t i = 0; i < nRows; ++i)
+                    pabyValue[i] = (pabyValue[i] | pabyIsNull[i]) ^ 1;
+                break;
+            }
+
+            default:
+            {
+                uint8_t *pabyValue = pabyRegisters + nDepth * nRegisterSize;
+                EvaluateInstruction(oInstr, pasColumns, nRows, pabyValue,
+                                    pabyValue + nRows, padfTmp);
+                ++nDepth;
+                break;
+            }
+        }
+    }
+    CPLAssert(nDepth == 1);
+
+    memcpy(pabyResult, pabyRegisters, nRows);
+}
+
+/************************************************************************/
+/*                        EvaluateInstruction()                         */
+/************************************************************************/
+
+void OGRCompiledFilter::EvaluateInstruction(const Instruction &oInstr,
+                                            const ColumnValues *pasColumns,
+                                            size_t nRows, uint8_t *pabyValue,
+                                            uint8_t *pabyIsNull,
+                                            double *padfTmp) const
+{
+    const ColumnValues &sValues = pasColumns[oInstr.iColumn];
+    if (oInstr.eOpcode == Opcode::IS_NULL)
+    {
+        if (sValues.pabyIsNull)
+        {
+            for (size_t i = 0; i < nRows; ++i)
+                pabyValue[i] = sValues.pabyIsNull[i] != 0;
+        }
+        else
+        {
+            memset(pabyValue, 0, nRows);
+        }
+        memset(pabyIsNull, 0, nRows);
+        return;
+    }
+
+    // Any null operand makes the result null
+    const ColumnValues *psOtherValues =
+        oInstr.iOtherColumn >= 0 ? &pasColumns[oInstr.iOtherColumn] : nullptr;
+    if (sValues.pabyIsNull)
+    {
+        for (size_t i = 0; i < nRows; ++i)
+            pabyIsNull[i] = sValues.pabyIsNull[i] != 0;
+    }
+    else
+    {
+        memset(pabyIsNull, 0, nRows);
+    }
+    if (psOtherValues && psOtherValues->pabyIsNull)
+    {
+        for (size_t i = 0; i < nRows; ++i)
+            pabyIsNull[i] |= psOtherValues->pabyIsNull[i] != 0;
+    }
+
+    if (oInstr.eOpcode == Opcode::IS_TRUE)
+    {
+        const int64_t *panValues = sValues.panValues;
+        for (size_t i = 0; i < nRows; ++i)
+            pabyValue[i] = panValues[i] != 0;
+    }
+    else if (oInstr.eCompareType == ValueType::STRING)
+    {
+        EvaluateString(oInstr, sValues, psOtherValues, nRows, pabyIsNull,
+                       pabyValue);
+    }
+    else if (oInstr.eCompareType == ValueType::INTEGER)
+    {
+        EvaluateNumeric(oInstr, sValues.panValues,
+                        psOtherValues ? psOtherValues->panValues : nullptr,
+                        oInstr.anConstants, nRows, pabyValue);
+    }
+    else
+    {
+        // Convert integer values to double, as SWQGeneralEvaluator() does
+        const auto GetAsDouble =
+            [nRows](const Column &oColumn, const ColumnValues &sColValues,
+                    double *padfDst)
+        {
+            if (oColumn.eType == ValueType::REAL)
+                return sColValues.padfValues;
+            for (size_t i = 0; i < nRows; ++i)
+                padfDst[i] = static_cast<double>(sColValues.panValues[i]);
+            return static_cast<const double *>(padfDst);
+        };
+        const double *padfValues =
+            GetAsDouble(m_aoColumns[oInstr.iColumn], sValues, padfTmp);
+        const double *padfOtherValues =
+            psOtherValues ? GetAsDouble(m_aoColumns[oInstr.iOtherColumn],
+                                        *psOtherValues, padfTmp + nRows)
+                          : nullptr;
+        EvaluateNumeric(oInstr, padfValues, padfOtherValues,
+                        oInstr.adfConstants, nRows, pabyValue);
+    }
+
+    // Null results are false
+    for (size_t i = 0; i < nRows; ++i)
+        pabyValue[i] &= static_cast<uint8_t>(pabyIsNull[i] ^ 1);
+}
+
+/************************************************************************/
+/*                         EvaluateNumeric()                            */
+/************************************************************************/
+
+template <class T>
+void OGRCompiledFilter::EvaluateNumeric(const Instruction &oInstr,
+                                        const T *paValues,
+                                        const T *paOtherValues,
+                                        const std::vector<T> &aConstants,
+                                        size_t nRows, uint8_t *pabyValue)
+{
+    const auto GetValue = [paValues](size_t i) { return paValues[i]; };
+    switch (oInstr.eOpcode)
+    {
+        case Opcode::COMPARE:
+            if (paOtherValues)
+            {
+                CompareValues(
+                    oInstr.nOperation, nRows, GetValue,
+                    [paOtherValues](size_t i) { return paOtherValues[i]; },
+                    pabyValue);
+            }
+            else
+            {
+                const T tConstant = aConstants[0];
+                CompareValues(
+                    oInstr.nOperation, nRows, GetValue,
+                    [tConstant](size_t) { return tConstant; }, pabyValue);
+            }
+            break;
+
+        case Opcode::BETWEEN:
+        {
+            const T tLow = aConstants[0];
+            const T tHigh = aConstants[1];
+            for (size_t i = 0; i < nRows; ++i)
+                pabyValue[i] = paValues[i] >= tLow && paValues[i] <= tHigh;
+            break;
+        }
+
+        case Opcode::IN_LIST:
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                // Not std::binary_search(), that considers NaN as equivalent
+                // to any value.
+                const auto oIter = std::lower_bound(
+                    aConstants.begin(), aConstants.end(), paValues[i]);
+                pabyValue[i] =
+                    oIter != aConstants.end() && *oIter == paValues[i];
+            }
+            break;
+
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                          EvaluateString()                            */
+/************************************************************************/
+
+void OGRCompiledFilter::EvaluateString(const Instruction &oInstr,
+                                       const ColumnValues &sValues,
+                                       const ColumnValues *psOtherValues,
+                                       size_t nRows, const uint8_t *pabyIsNull,
+                                       uint8_t *pabyValue)
+{
+    const auto &aosConstants = oInstr.aosConstants;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        // String pointers of null values might not be valid
+        if (pabyIsNull[i])
+        {
+            pabyValue[i] = 0;
+            continue;
+        }
+
+        const char *pszValue = sValues.papszValues[i];
+        const size_t nLen = sValues.panLengths[i];
+        switch (oInstr.eOpcode)
+        {
+            case Opcode::COMPARE:
+            {
+                const char *pszOther;
+                size_t nOtherLen;
+                if (psOtherValues)
+                {
+                    pszOther = psOtherValues->papszValues[i];
+                    nOtherLen = psOtherValues->panLengths[i];
+                }
+                else
+                {
+                    pszOther = aosConstants[0].c_str();
+                    nOtherLen = aosConstants[0].size();
+                }
+                if (oInstr.nOperation == SWQ_EQ)
+                {
+                    pabyValue[i] =
+                        EqualStrings(pszValue, nLen, pszOther, nOtherLen);
+                }
+                else
+                {
+                    pabyValue[i] = TestComparison(
+                        oInstr.nOperation,
+                        CompareStrings(pszValue, nLen, pszOther, nOtherLen));
+                }
+                break;
+            }
+
+            case Opcode::BETWEEN:
+                pabyValue[i] =
+                    CompareStrings(pszValue, nLen, aosConstants[0].c_str(),
+                                   aosConstants[0].size()) >= 0 &&
+                    CompareStrings(pszValue, nLen, aosConstants[1].c_str(),
+                                   aosConstants[1].size()) <= 0;
+                break;
+
+            case Opcode::IN_LIST:
+            {
+                const auto oIter = std::lower_bound(
+                    aosConstants.begin(), aosConstants.end(), pszValue,
+                    [nLen](const std::string &osConstant, const char *pszVal)
+                    {
+                        return CompareStrings(osConstant.c_str(),
+                                              osConstant.size(), pszVal,
+                                              nLen) < 0;
+                    });
+                pabyValue[i] = oIter != aosConstants.end() &&
+                               CompareStrings(oIter->c_str(), oIter->size(),
+                                              pszValue, nLen) == 0;
+                break;
+            }
+
+            default:
+                CPLAssert(false);
+                break;
+        }
+    }
+}
+
+//! @endcond
@@ -39,6 +39,7 @@
 #include "ogr_featurestyle.h"
 #include "ogr_geometry.h"
 #include "ogr_p.h"
+#include "ogr_wkb.h"
 #include "ogrlibjsonutils.h"
 
 #include "cpl_json_header.h"
@@ -1107,6 +1108,60 @@ OGRErr OGRFeature::SetGeomField(int iField,
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                       SetGeomField()                                 */
+/************************************************************************/
+
+/**
+ * \brief Set feature geometry of a specified geometry field from a view
+ * over a WKB geometry.
+ *
+ * If the field already holds a geometry of the same type, it is refilled in
+ * place from the WKB, which saves dynamic memory allocations when features
+ * are reused. Otherwise the geometry is materialized as a new OGRGeometry.
+ * In both cases, it is assigned the spatial reference system of the geometry
+ * field.
+ *
+ * @param iField geometry field to set.
+ * @param oView view over a WKB geometry, initialized with
+ * OGRWKBGeometryView::Init().
+ *
+ * @return OGRERR_NONE if successful, OGRERR_FAILURE if the index is invalid,
+ * or OGRERR_CORRUPT_DATA if the geometry cannot be materialized.
+ *
+ * @since GDAL 3.13
+ */
+
+OGRErr OGRFeature::SetGeomField(int iField, const OGRWKBGeometryView &oView)
+
+{
+    if (iField < 0 || iField >= GetGeomFieldCount())
+    {
+        return OGRERR_FAILURE;
+    }
+
+    const OGRSpatialReference *poSRS =
+        GetGeomFieldDefnRef(iField)->GetSpatialRef();
+    OGRGeometry *poExistingGeom = papoGeometries[iField];
+    if (poExistingGeom && oView.GetData() &&
+        poExistingGeom->getGeometryType() == oView.GetGeometryType())
+    {
+        size_t nBytesConsumed = 0;
+        if (poExistingGeom->importFromWkb(oView.GetData(), oView.GetSize(),
+                                          wkbVariantIso,
+                                          nBytesConsumed) == OGRERR_NONE)
+        {
+            poExistingGeom->assignSpatialReference(poSRS);
+            return OGRERR_NONE;
+        }
+    }
+
+    auto poGeom = oView.ToGeometry(poSRS);
+    if (!poGeom)
+        return OGRERR_CORRUPT_DATA;
+    return SetGeomField(iField, std::move(poGeom));
+}
+
 /************************************************************************/
 /*                               Clone()                                */
 /************************************************************************/
@@ -18,11 +18,14 @@
 
 #include <cstddef>
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_string.h"
 #include "ogr_attrind.h"
+#include "ogr_compiled_filter.h"
 #include "ogr_core.h"
 #include "ogr_p.h"
 #include "ogrsf_frmts.h"
@@ -57,6 +60,7 @@ OGRFeatureQuery::~OGRFeatureQuery()
 
 {
     delete m_psContext;
+    delete m_poCompiledFilter;
     delete static_cast<swq_expr_node *>(pSWQExpr);
 }
 
@@ -105,6 +109,8 @@ OGRFeatureQuery::Compile(const OGRLayer *poLayer, const OGRFeatureDefn *poDefn,
         delete static_cast<swq_expr_node *>(pSWQExpr);
         pSWQExpr = nullptr;
     }
+    delete m_poCompiledFilter;
+    m_poCompiledFilter = nullptr;
 
     const char *pszFIDColumn = nullptr;
     bool bMustAddFID = false;
@@ -228,6 +234,15 @@ OGRFeatureQuery::Compile(const OGRLayer *poLayer, const OGRFeatureDefn *poDefn,
         eErr = OGRERR_CORRUPT_DATA;
         pSWQExpr = nullptr;
     }
+    else if (CPLTestBool(CPLGetConfigOption("OGR_SQL_COMPILED_FILTER", "YES")))
+    {
+        // Evaluation without going through swq_expr_node::Evaluate(), for
+        // the expressions that support it.
+        m_poCompiledFilter =
+            OGRCompiledFilter::Compile(
+                static_cast<const swq_expr_node *>(pSWQExpr), poDefn)
+                .release();
+    }
 
     CPLFree(papszFieldNames);
     CPLFree(paeFieldTypes);
@@ -314,6 +329,9 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     if (pSWQExpr == nullptr)
         return FALSE;
 
+    if (m_poCompiledFilter && poFeature->GetDefnRef() == poTargetDefn)
+        return m_poCompiledFilter->Evaluate(poFeature);
+
     swq_expr_node *poResult = static_cast<swq_expr_node *>(pSWQExpr)->Evaluate(
         OGRFeatureFetcher, poFeature, *m_psContext);
 
@@ -331,6 +349,110 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     return bLogicalResult;
 }
 
+/************************************************************************/
+/*                  OGRFeatureQueryIsRangeOperation()                   */
+/************************************************************************/
+
+static bool OGRFeatureQueryIsRangeOperation(const swq_expr_node *psExpr)
+{
+    return ((psExpr->nOperation == SWQ_LT || psExpr->nOperation == SWQ_LE ||
+             psExpr->nOperation == SWQ_GT || psExpr->nOperation == SWQ_GE) &&
+            psExpr->nSubExprCount == 2) ||
+           (psExpr->nOperation == SWQ_BETWEEN && psExpr->nSubExprCount == 3);
+}
+
+/************************************************************************/
+/*                  OGRFeatureQueryIsIndexableString()                  */
+/************************************************************************/
+
+// swq_op_general.cpp considers that a timestamp string with a "+00" suffix
+// is equal to the same one without it. Such values cannot be looked up in
+// an index of exact values.
+static bool OGRFeatureQueryIsIndexableString(const char *pszVal)
+{
+    if (pszVal == nullptr)
+        return false;
+    const size_t nLen = strlen(pszVal);
+    return nLen <= 3 || (strcmp(pszVal + nLen - 3, "+00") != 0 &&
+                         pszVal[nLen - 3] != ':');
+}
+
+/************************************************************************/
+/*                   OGRFeatureQueryGetRangeBound()                     */
+/************************************************************************/
+
+// Convert the constant of a comparison to a bound of a range of values of a
+// field. Non-integral bounds of integer fields are rounded outwards and made
+// exclusive, so that the range contains the same integers.
+static bool OGRFeatureQueryGetRangeBound(const OGRFieldDefn *poFieldDefn,
+                                         const swq_expr_node *poValue,
+                                         bool bLower, OGRField &sBound,
+                                         bool &bIncluded)
+{
+    const bool bIsInteger = poValue->field_type == SWQ_INTEGER ||
+                            poValue->field_type == SWQ_INTEGER64 ||
+                            poValue->field_type == SWQ_BOOLEAN;
+    switch (poFieldDefn->GetType())
+    {
+        case OFTInteger:
+        case OFTInteger64:
+        {
+            GIntBig nVal = 0;
+            if (bIsInteger)
+            {
+                nVal = poValue->int_value;
+            }
+            else if (poValue->field_type == SWQ_FLOAT)
+            {
+                const double dfVal = poValue->float_value;
+                const double dfRounded =
+                    bLower ? std::floor(dfVal) : std::ceil(dfVal);
+                // Also rejects NaN
+                if (!(dfRounded >= -9.0e18 && dfRounded <= 9.0e18))
+                    return false;
+                if (dfRounded != dfVal)
+                    bIncluded = false;
+                nVal = static_cast<GIntBig>(dfRounded);
+            }
+            else
+            {
+                return false;
+            }
+            if (poFieldDefn->GetType() == OFTInteger64)
+            {
+                sBound.Integer64 = nVal;
+                return true;
+            }
+            if (nVal < std::numeric_limits<int>::min() ||
+                nVal > std::numeric_limits<int>::max())
+                return false;
+            sBound.Integer = static_cast<int>(nVal);
+            return true;
+        }
+
+        case OFTReal:
+            if (bIsInteger)
+                sBound.Real = static_cast<double>(poValue->int_value);
+            else if (poValue->field_type == SWQ_FLOAT &&
+                     !std::isnan(poValue->float_value))
+                sBound.Real = poValue->float_value;
+            else
+                return false;
+            return true;
+
+        case OFTString:
+            if (poValue->field_type != SWQ_STRING ||
+                !OGRFeatureQueryIsIndexableString(poValue->string_value))
+                return false;
+            sBound.String = poValue->string_value;
+            return true;
+
+        default:
+            break;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                            CanUseIndex()                             */
 /************************************************************************/
@@ -359,21 +481,33 @@ int OGRFeatureQuery::CanUseIndex(const swq_expr_node *psExpr, OGRLayer *poLayer)
                CanUseIndex(psExpr->papoSubExpr[1], poLayer);
     }
 
-    if (!(psExpr->nOperation == SWQ_EQ || psExpr->nOperation == SWQ_IN) ||
+    const bool bRangeOp = OGRFeatureQueryIsRangeOperation(psExpr);
+    if (!(psExpr->nOperation == SWQ_EQ || psExpr->nOperation == SWQ_IN ||
+          bRangeOp) ||
         psExpr->nSubExprCount < 2)
         return FALSE;
 
     swq_expr_node *poColumn = psExpr->papoSubExpr[0];
-    swq_expr_node *poValue = psExpr->papoSubExpr[1];
-
-    if (poColumn->eNodeType != SNT_COLUMN || poValue->eNodeType != SNT_CONSTANT)
+    if (poColumn->eNodeType != SNT_COLUMN)
         return FALSE;
+    for (int i = 1; i < psExpr->nSubExprCount; ++i)
+    {
+        const swq_expr_node *poValue = psExpr->papoSubExpr[i];
+        if (poValue->eNodeType != SNT_CONSTANT ||
+            (poValue->field_type == SWQ_STRING &&
+             !OGRFeatureQueryIsIndexableString(poValue->string_value)))
+        {
+            return FALSE;
+        }
+    }
 
     OGRAttrIndex *poIndex =
         poLayer->GetIndex()->GetFieldIndex(OGRFeatureFetcherFixFieldIndex(
             poLayer->GetLayerDefn(), poColumn->field_index));
     if (poIndex == nullptr)
         return FALSE;
+    if (bRangeOp && !poIndex->SupportsRangeQueries())
+        return FALSE;
 
     // Have an index.
     return TRUE;
@@ -570,16 +704,12 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
         return panFIDList;
     }
 
-    if (!(psExpr->nOperation == SWQ_EQ || psExpr->nOperation == SWQ_IN) ||
-        psExpr->nSubExprCount < 2)
+    if (!CanUseIndex(psExpr, poLayer))
         return nullptr;
 
     const swq_expr_node *poColumn = psExpr->papoSubExpr[0];
     const swq_expr_node *poValue = psExpr->papoSubExpr[1];
 
-    if (poColumn->eNodeType != SNT_COLUMN || poValue->eNodeType != SNT_CONSTANT)
-        return nullptr;
-
     const int nIdx = OGRFeatureFetcherFixFieldIndex(poLayer->GetLayerDefn(),
                                                     poColumn->field_index);
 
@@ -592,6 +722,52 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
     const OGRFieldDefn *poFieldDefn =
         poLayer->GetLayerDefn()->GetFieldDefn(nIdx);
 
+    // Handle the case of a comparison or a BETWEEN operation.
+    if (OGRFeatureQueryIsRangeOperation(psExpr))
+    {
+        OGRField sMin;
+        OGRField sMax;
+        bool bHasMin = false;
+        bool bHasMax = false;
+        bool bMinIncluded = true;
+        bool bMaxIncluded = true;
+        if (psExpr->nOperation == SWQ_BETWEEN)
+        {
+            bHasMin = OGRFeatureQueryGetRangeBound(
+                poFieldDefn, psExpr->papoSubExpr[1], true, sMin, bMinIncluded);
+            bHasMax = OGRFeatureQueryGetRangeBound(
+                poFieldDefn, psExpr->papoSubExpr[2], false, sMax, bMaxIncluded);
+            if (!bHasMin || !bHasMax)
+                return nullptr;
+        }
+        else if (psExpr->nOperation == SWQ_GT || psExpr->nOperation == SWQ_GE)
+        {
+            bMinIncluded = psExpr->nOperation == SWQ_GE;
+            bHasMin = OGRFeatureQueryGetRangeBound(poFieldDefn, poValue, true,
+                                                   sMin, bMinIncluded);
+            if (!bHasMin)
+                return nullptr;
+        }
+        else
+        {
+            bMaxIncluded = psExpr->nOperation == SWQ_LE;
+            bHasMax = OGRFeatureQueryGetRangeBound(poFieldDefn, poValue, false,
+                                                   sMax, bMaxIncluded);
+            if (!bHasMax)
+                return nullptr;
+        }
+
+        GIntBig *panFIDs = poIndex->GetRangeMatches(
+            bHasMin ? &sMin : nullptr, bMinIncluded, bHasMax ? &sMax : nullptr,
+            bMaxIncluded, &nFIDCount);
+        if (panFIDs && nFIDCount > 1)
+        {
+            // The returned FIDs are expected to be sorted.
+            std::sort(panFIDs, panFIDs + nFIDCount);
+        }
+        return panFIDs;
+    }
+
     // Handle the case of an IN operation.
     if (psExpr->nOperation == SWQ_IN)
     {
@@ -14,6 +14,7 @@
 #include "cpl_port.h"
 #include "ogr_geometry.h"
 
+#include <algorithm>
 #include <climits>
 #include <cstdarg>
 #include <cstddef>
@@ -24,11 +25,14 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_geos.h"
@@ -7064,7 +7068,42 @@ struct _OGRPreparedGeometry
     GEOSContextHandle_t hGEOSCtxt;
     GEOSGeom hGEOSGeom;
     const GEOSPreparedGeometry *poPreparedGEOSGeom;
+    //! Envelope of the geometry, to reject other geometries without GEOS.
+    OGREnvelope sEnvelope;
 };
+
+/************************************************************************/
+/*                   OGRCreatePreparedGeometryFromGEOS()                */
+/************************************************************************/
+
+/** Prepare a GEOS geometry, taking ownership of it and of its context. */
+static OGRPreparedGeometry *
+OGRCreatePreparedGeometryFromGEOS(GEOSContextHandle_t hGEOSCtxt,
+                                  GEOSGeom hGEOSGeom,
+                                  const OGREnvelope &sEnvelope)
+{
+    if (hGEOSGeom == nullptr)
+    {
+        OGRGeometry::freeGEOSContext(hGEOSCtxt);
+        return nullptr;
+    }
+    const GEOSPreparedGeometry *poPreparedGEOSGeom =
+        GEOSPrepare_r(hGEOSCtxt, hGEOSGeom);
+    if (poPreparedGEOSGeom == nullptr)
+    {
+        GEOSGeom_destroy_r(hGEOSCtxt, hGEOSGeom);
+        OGRGeometry::freeGEOSContext(hGEOSCtxt);
+        return nullptr;
+    }
+
+    OGRPreparedGeometry *poPreparedGeom = new OGRPreparedGeometry;
+    poPreparedGeom->hGEOSCtxt = hGEOSCtxt;
+    poPreparedGeom->hGEOSGeom = hGEOSGeom;
+    poPreparedGeom->poPreparedGEOSGeom = poPreparedGEOSGeom;
+    poPreparedGeom->sEnvelope = sEnvelope;
+
+    return poPreparedGeom;
+}
 #endif
 
 /************************************************************************/
@@ -7101,27 +7140,10 @@ OGRPreparedGeometryH OGRCreatePreparedGeometry(OGRGeometryH hGeom)
 #if defined(HAVE_GEOS)
     OGRGeometry *poGeom = OGRGeometry::FromHandle(hGeom);
     GEOSContextHandle_t hGEOSCtxt = OGRGeometry::createGEOSContext();
-    GEOSGeom hGEOSGeom = poGeom->exportToGEOS(hGEOSCtxt);
-    if (hGEOSGeom == nullptr)
-    {
-        OGRGeometry::freeGEOSContext(hGEOSCtxt);
-        return nullptr;
-    }
-    const GEOSPreparedGeometry *poPreparedGEOSGeom =
-        GEOSPrepare_r(hGEOSCtxt, hGEOSGeom);
-    if (poPreparedGEOSGeom == nullptr)
-    {
-        GEOSGeom_destroy_r(hGEOSCtxt, hGEOSGeom);
-        OGRGeometry::freeGEOSContext(hGEOSCtxt);
-        return nullptr;
-    }
-
-    OGRPreparedGeometry *poPreparedGeom = new OGRPreparedGeometry;
-    poPreparedGeom->hGEOSCtxt = hGEOSCtxt;
-    poPreparedGeom->hGEOSGeom = hGEOSGeom;
-    poPreparedGeom->poPreparedGEOSGeom = poPreparedGEOSGeom;
-
-    return poPreparedGeom;
+    OGREnvelope sEnvelope;
+    poGeom->getEnvelope(&sEnvelope);
+    return OGRCreatePreparedGeometryFromGEOS(
+        hGEOSCtxt, poGeom->exportToGEOS(hGEOSCtxt), sEnvelope);
 #else
     return nullptr;
 #endif
@@ -7176,6 +7198,11 @@ int OGRPreparedGeometryIntersects(const OGRPreparedGeometryH hPreparedGeom,
         return FALSE;
     }
 
+    OGREnvelope sOtherEnvelope;
+    poOtherGeom->getEnvelope(&sOtherEnvelope);
+    if (!hPreparedGeom->sEnvelope.Intersects(sOtherEnvelope))
+        return FALSE;
+
     GEOSGeom hGEOSOtherGeom =
         poOtherGeom->exportToGEOS(hPreparedGeom->hGEOSCtxt);
     if (hGEOSOtherGeom == nullptr)
@@ -7213,6 +7240,11 @@ int OGRPreparedGeometryContains(const OGRPreparedGeometryH hPreparedGeom,
         return FALSE;
     }
 
+    OGREnvelope sOtherEnvelope;
+    poOtherGeom->getEnvelope(&sOtherEnvelope);
+    if (!hPreparedGeom->sEnvelope.Contains(sOtherEnvelope))
+        return FALSE;
+
     GEOSGeom hGEOSOtherGeom =
         poOtherGeom->exportToGEOS(hPreparedGeom->hGEOSCtxt);
     if (hGEOSOtherGeom == nullptr)
@@ -7229,6 +7261,173 @@ int OGRPreparedGeometryContains(const OGRPreparedGeometryH hPreparedGeom,
 #endif
 }
 
+#if defined(HAVE_GEOS)
+
+/************************************************************************/
+/*                    OGRPreparedGeometryTestBatch()                    */
+/************************************************************************/
+
+/** Evaluate pfnTest(hPreparedGeom, pahGeoms[i]) for each geometry, splitting
+ * them into ranges evaluated concurrently on the global thread pool.
+ *
+ * Prepared geometries are not thread-safe, so all ranges but the first one
+ * use their own copy of hPreparedGeom, in their own GEOS context.
+ */
+static int OGRPreparedGeometryTestBatch(
+    OGRPreparedGeometryH hPreparedGeom, int nGeomCount,
+    const OGRGeometryH *pahGeoms, int *pabResults, CSLConstList papszOptions,
+    int (*pfnTest)(OGRPreparedGeometryH, OGRGeometryH))
+{
+    if (hPreparedGeom == nullptr || nGeomCount < 0 ||
+        (nGeomCount > 0 && (pahGeoms == nullptr || pabResults == nullptr)))
+    {
+        return FALSE;
+    }
+
+    // Also bounds the number of prepared geometry copies
+    const int nThreads =
+        GDALGetNumThreads(papszOptions, "NUM_THREADS", "1", 128);
+    constexpr int MIN_GEOMS_PER_JOB = 64;
+    int nJobs = std::min(nThreads, nGeomCount / MIN_GEOMS_PER_JOB);
+
+    std::vector<OGRPreparedGeometryUniquePtr> apoPreparedGeoms;
+    for (int iJob = 1; iJob < nJobs; ++iJob)
+    {
+        GEOSContextHandle_t hGEOSCtxt = OGRGeometry::createGEOSContext();
+        GEOSGeom hGEOSGeom =
+            GEOSGeom_clone_r(hGEOSCtxt, hPreparedGeom->hGEOSGeom);
+        OGRPreparedGeometryUniquePtr poPreparedGeom(
+            OGRCreatePreparedGeometryFromGEOS(hGEOSCtxt, hGEOSGeom,
+                                              hPreparedGeom->sEnvelope));
+        if (!poPreparedGeom)
+            break;
+        apoPreparedGeoms.push_back(std::move(poPreparedGeom));
+    }
+    nJobs = 1 + static_cast<int>(apoPreparedGeoms.size());
+
+    const auto TestRange =
+        [pahGeoms, pabResults, pfnTest](OGRPreparedGeometryH hPrepared,
+                                        int iStart, int iEnd)
+    {
+        for (int i = iStart; i < iEnd; ++i)
+            pabResults[i] = pfnTest(hPrepared, pahGeoms[i]);
+    };
+
+    auto poThreadPool =
+        nJobs > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    if (!poJobQueue)
+    {
+        TestRange(hPreparedGeom, 0, nGeomCount);
+        return TRUE;
+    }
+
+    for (int iJob = 0; iJob < nJobs; ++iJob)
+    {
+        OGRPreparedGeometryH hPrepared =
+            iJob == 0 ? hPreparedGeom : apoPreparedGeoms[iJob - 1].get();
+        const int iStart = static_cast<int>(
+            static_cast<int64_t>(iJob) * nGeomCount / nJobs);
+        const int iEnd = static_cast<int>(
+            static_cast<int64_t>(iJob + 1) * nGeomCount / nJobs);
+        poJobQueue->SubmitJob([&TestRange, hPrepared, iStart, iEnd]()
+                              { TestRange(hPrepared, iStart, iEnd); });
+    }
+    poJobQueue->WaitCompletion();
+
+    return TRUE;
+}
+
+#endif  // HAVE_GEOS
+
+/************************************************************************/
+/*                   OGRPreparedGeometryIntersectsBatch()               */
+/************************************************************************/
+
+/** Returns whether a prepared geometry intersects with each geometry of an
+ * array.
+ *
+ * This is equivalent to calling OGRPreparedGeometryIntersects() on each of
+ * them, but the geometries can be tested in parallel.
+ *
+ * The following options are supported:
+ * <ul>
+ * <li>NUM_THREADS=number|ALL_CPUS: number of threads used to test the
+ * geometries. Defaults to the value of the GDAL_NUM_THREADS configuration
+ * option, or 1, and limited by GDAL_MAX_NUM_THREADS.</li>
+ * </ul>
+ *
+ * @param hPreparedGeom prepared geometry.
+ * @param nGeomCount number of geometries in pahGeoms.
+ * @param pahGeoms array of nGeomCount geometries to test.
+ * @param[out] pabResults array of nGeomCount values, set to TRUE or FALSE.
+ * @param papszOptions NULL terminated list of options, or NULL.
+ * @return TRUE in case of success, FALSE in case of invalid arguments or
+ * if GDAL is built without GEOS.
+ * @since GDAL 3.13
+ */
+int OGRPreparedGeometryIntersectsBatch(OGRPreparedGeometryH hPreparedGeom,
+                                       int nGeomCount,
+                                       const OGRGeometryH *pahGeoms,
+                                       int *pabResults,
+                                       CSLConstList papszOptions)
+{
+    (void)hPreparedGeom;
+    (void)nGeomCount;
+    (void)pahGeoms;
+    (void)pabResults;
+    (void)papszOptions;
+#if defined(HAVE_GEOS)
+    return OGRPreparedGeometryTestBatch(hPreparedGeom, nGeomCount, pahGeoms,
+                                        pabResults, papszOptions,
+                                        OGRPreparedGeometryIntersects);
+#else
+    return FALSE;
+#endif
+}
+
+/************************************************************************/
+/*                    OGRPreparedGeometryContainsBatch()                */
+/************************************************************************/
+
+/** Returns whether a prepared geometry contains each geometry of an array.
+ *
+ * This is equivalent to calling OGRPreparedGeometryContains() on each of
+ * them, but the geometries can be tested in parallel.
+ *
+ * The supported options are the ones of
+ * OGRPreparedGeometryIntersectsBatch().
+ *
+ * @param hPreparedGeom prepared geometry.
+ * @param nGeomCount number of geometries in pahGeoms.
+ * @param pahGeoms array of nGeomCount geometries to test.
+ * @param[out] pabResults array of nGeomCount values, set to TRUE or FALSE.
+ * @param papszOptions NULL terminated list of options, or NULL.
+ * @return TRUE in case of success, FALSE in case of invalid arguments or
+ * if GDAL is built without GEOS.
+ * @since GDAL 3.13
+ */
+int OGRPreparedGeometryContainsBatch(OGRPreparedGeometryH hPreparedGeom,
+                                     int nGeomCount,
+                                     const OGRGeometryH *pahGeoms,
+                                     int *pabResults,
+                                     CSLConstList papszOptions)
+{
+    (void)hPreparedGeom;
+    (void)nGeomCount;
+    (void)pahGeoms;
+    (void)pabResults;
+    (void)papszOptions;
+#if defined(HAVE_GEOS)
+    return OGRPreparedGeometryTestBatch(hPreparedGeom, nGeomCount, pahGeoms,
+                                        pabResults, papszOptions,
+                                        OGRPreparedGeometryContains);
+#else
+    return FALSE;
+#endif
+}
+
 /************************************************************************/
 /*                       OGRGeometryFromEWKB()                          */
 /************************************************************************/
@@ -0,0 +1,122 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Pool of geometry objects reused between features
+ * Author:   NextGIS <info at nextgis dot com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, NextGIS <info at nextgis dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "ogr_geometry_pool.h"
+#include "ogr_feature.h"
+
+/************************************************************************/
+/*                              Recycle()                               */
+/************************************************************************/
+
+/** Give a geometry back to the pool, which takes ownership of it. */
+void OGRGeometryPool::Recycle(OGRGeometry *poGeom)
+{
+    if (poGeom == nullptr)
+        return;
+
+    switch (poGeom->getGeometryType())
+    {
+        case wkbPoint:
+        case wkbPoint25D:
+        case wkbPointM:
+        case wkbPointZM:
+            Push(m_apoPoints, poGeom->toPoint());
+            return;
+
+        case wkbLineString:
+        case wkbLineString25D:
+        case wkbLineStringM:
+        case wkbLineStringZM:
+            if (auto poRing = dynamic_cast<OGRLinearRing *>(poGeom))
+                Push(m_apoLinearRings, poRing);
+            else
+                Push(m_apoLineStrings, poGeom->toLineString());
+            return;
+
+        case wkbPolygon:
+        case wkbPolygon25D:
+        case wkbPolygonM:
+        case wkbPolygonZM:
+        {
+            auto poPolygon = poGeom->toPolygon();
+            for (int i = poPolygon->getNumInteriorRings(); i >= 0; --i)
+            {
+                OGRCurve *poRing = i == 0 ? poPolygon->getExteriorRingCurve()
+                                          : poPolygon->getInteriorRingCurve(
+                                                i - 1);
+                if (poRing)
+                {
+                    poPolygon->removeRing(i, /* bDelete = */ false);
+                    Recycle(poRing);
+                }
+            }
+            Push(m_apoPolygons, poPolygon);
+            return;
+        }
+
+        case wkbMultiPoint:
+        case wkbMultiPoint25D:
+        case wkbMultiPointM:
+        case wkbMultiPointZM:
+            RecycleParts(poGeom->toGeometryCollection());
+            Push(m_apoMultiPoints, poGeom->toMultiPoint());
+            return;
+
+        case wkbMultiLineString:
+        case wkbMultiLineString25D:
+        case wkbMultiLineStringM:
+        case wkbMultiLineStringZM:
+            RecycleParts(poGeom->toGeometryCollection());
+            Push(m_apoMultiLineStrings, poGeom->toMultiLineString());
+            return;
+
+        case wkbMultiPolygon:
+        case wkbMultiPolygon25D:
+        case wkbMultiPolygonM:
+        case wkbMultiPolygonZM:
+            RecycleParts(poGeom->toGeometryCollection());
+            Push(m_apoMultiPolygons, poGeom->toMultiPolygon());
+            return;
+
+        default:
+            break;
+    }
+
+    delete poGeom;
+}
+
+/************************************************************************/
+/*                            RecycleParts()                            */
+/************************************************************************/
+
+void OGRGeometryPool::RecycleParts(OGRGeometryCollection *poColl)
+{
+    for (int i = poColl->getNumGeometries() - 1; i >= 0; --i)
+    {
+        OGRGeometry *poPart = poColl->getGeometryRef(i);
+        poColl->removeGeometry(i, /* bDelete = */ FALSE);
+        Recycle(poPart);
+    }
+}
+
+/************************************************************************/
+/*                         RecycleGeometries()                          */
+/************************************************************************/
+
+/** Give the geometries of a feature back to the pool. They are removed
+ * from the feature. */
+void OGRGeometryPool::RecycleGeometries(OGRFeature *poFeature)
+{
+    const int nGeomFieldCount = poFeature->GetGeomFieldCount();
+    for (int i = 0; i < nGeomFieldCount; ++i)
+        Recycle(poFeature->StealGeometry(i));
+}
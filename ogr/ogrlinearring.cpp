@@ -20,6 +20,7 @@
 #include <limits>
 
 #include "cpl_error.h"
+#include "gdal.h"
 #include "ogr_core.h"
 #include "ogr_geometry.h"
 #include "ogr_p.h"
@@ -241,20 +242,12 @@ OGRErr OGRLinearRing::_importFromWkb(OGRwkbByteOrder eByteOrder, int _flags,
     /* -------------------------------------------------------------------- */
     if (OGR_SWAP(eByteOrder))
     {
-        for (size_t i = 0; i < static_cast<size_t>(nPointCount); i++)
-        {
-            CPL_SWAPDOUBLE(&(paoPoints[i].x));
-            CPL_SWAPDOUBLE(&(paoPoints[i].y));
-
-            if (flags & OGR_G_3D)
-            {
-                CPL_SWAPDOUBLE(padfZ + i);
-            }
-            if (flags & OGR_G_MEASURED)
-            {
-                CPL_SWAPDOUBLE(padfM + i);
-            }
-        }
+        GDALSwapWordsEx(paoPoints, 8, 2 * static_cast<size_t>(nPointCount),
+                        8);
+        if (flags & OGR_G_3D)
+            GDALSwapWordsEx(padfZ, 8, nPointCount, 8);
+        if (flags & OGR_G_MEASURED)
+            GDALSwapWordsEx(padfM, 8, nPointCount, 8);
     }
 
     return OGRERR_NONE;
@@ -358,10 +351,7 @@ OGRErr OGRLinearRing::_exportToWkb(int _flags, unsigned char *pabyData,
         const int nCount = CPL_SWAP32(nPointCount);
         memcpy(pabyData, &nCount, 4);
 
-        for (size_t i = 0; i < nWords; i++)
-        {
-            CPL_SWAPDOUBLE(pabyData + 4 + 8 * i);
-        }
+        GDALSwapWordsEx(pabyData + 4, 8, nWords, 8);
     }
 
     return OGRERR_NONE;
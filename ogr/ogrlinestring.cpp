@@ -11,6 +11,7 @@
  * SPDX-License-Identifier: MIT
  ****************************************************************************/
 
+#include "gdal.h"
 #include "ogr_geometry.h"
 #include "ogr_geos.h"
 #include "ogr_p.h"
@@ -1733,27 +1734,12 @@ OGRErr OGRSimpleCurve::importFromWkb(const unsigned char *pabyData,
     /* -------------------------------------------------------------------- */
     if (OGR_SWAP(eByteOrder))
     {
-        for (size_t i = 0; i < static_cast<size_t>(nPointCount); i++)
-        {
-            CPL_SWAPDOUBLE(&(paoPoints[i].x));
-            CPL_SWAPDOUBLE(&(paoPoints[i].y));
-        }
-
+        GDALSwapWordsEx(paoPoints, 8, 2 * static_cast<size_t>(nPointCount),
+                        8);
         if (flags & OGR_G_3D)
-        {
-            for (size_t i = 0; i < static_cast<size_t>(nPointCount); i++)
-            {
-                CPL_SWAPDOUBLE(padfZ + i);
-            }
-        }
-
+            GDALSwapWordsEx(padfZ, 8, nPointCount, 8);
         if (flags & OGR_G_MEASURED)
-        {
-            for (size_t i = 0; i < static_cast<size_t>(nPointCount); i++)
-            {
-                CPL_SWAPDOUBLE(padfM + i);
-            }
-        }
+            GDALSwapWordsEx(padfM, 8, nPointCount, 8);
     }
 
     return OGRERR_NONE;
@@ -1878,10 +1864,7 @@ OGRErr OGRSimpleCurve::exportToWkb(unsigned char *pabyData,
 
         const size_t nCoords =
             CoordinateDimension() * static_cast<size_t>(nPointCount);
-        for (size_t i = 0; i < nCoords; i++)
-        {
-            CPL_SWAP64PTR(pabyData + 9 + 8 * i);
-        }
+        GDALSwapWordsEx(pabyData + 9, 8, nCoords, 8);
     }
 
     return OGRERR_NONE;
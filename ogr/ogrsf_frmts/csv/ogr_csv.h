@@ -79,6 +79,12 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     static constexpr int64_t FID_INITIAL_VALUE = 1;
     int64_t m_nNextFID = FID_INITIAL_VALUE;
 
+    // Result of the evaluation of the attribute and spatial filters against
+    // indexes
+    bool m_bMatchingFIDsScanned = false;
+    GIntBig *m_panMatchingFIDs = nullptr;
+    size_t m_iMatchingFID = 0;
+
     bool bHasFieldNames = false;
 
     OGRFeature *GetNextUnfilteredFeature();
@@ -216,6 +222,10 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     OGRFeature *GetNextFeature() override;
     OGRFeature *GetFeature(GIntBig nFID) override;
 
+    OGRErr SetAttributeFilter(const char *pszQuery) override;
+    OGRErr ISetSpatialFilter(int iGeomField,
+                             const OGRGeometry *poGeom) override;
+
     using OGRLayer::GetLayerDefn;
 
     const OGRFeatureDefn *GetLayerDefn() const override
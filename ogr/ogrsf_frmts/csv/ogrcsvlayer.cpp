@@ -65,6 +65,9 @@ OGRCSVLayer::OGRCSVLayer(GDALDataset *poDS, const char *pszLayerNameIn,
     SetDescription(poFeatureDefn->GetName());
     poFeatureDefn->Reference();
     poFeatureDefn->SetGeomType(wkbNone);
+
+    if (!bNew)
+        InitializeSidecarIndexSupport(pszFilename);
 }
 
 /************************************************************************/
@@ -1246,6 +1249,7 @@ OGRCSVLayer::~OGRCSVLayer()
         WriteHeader();
 
     CPLFree(panGeomFieldIndex);
+    CPLFree(m_panMatchingFIDs);
 
     poFeatureDefn->Release();
     CPLFree(pszFilename);
@@ -1275,6 +1279,35 @@ void OGRCSVLayer::ResetReading()
     bNeedRewindBeforeRead = false;
 
     m_nNextFID = FID_INITIAL_VALUE;
+    m_iMatchingFID = 0;
+}
+
+/************************************************************************/
+/*                         SetAttributeFilter()                         */
+/************************************************************************/
+
+OGRErr OGRCSVLayer::SetAttributeFilter(const char *pszQuery)
+
+{
+    CPLFree(m_panMatchingFIDs);
+    m_panMatchingFIDs = nullptr;
+    m_bMatchingFIDsScanned = false;
+
+    return OGRLayer::SetAttributeFilter(pszQuery);
+}
+
+/************************************************************************/
+/*                         ISetSpatialFilter()                          */
+/************************************************************************/
+
+OGRErr OGRCSVLayer::ISetSpatialFilter(int iGeomField,
+                                      const OGRGeometry *poGeom)
+{
+    CPLFree(m_panMatchingFIDs);
+    m_panMatchingFIDs = nullptr;
+    m_bMatchingFIDsScanned = false;
+
+    return OGRLayer::ISetSpatialFilter(iGeomField, poGeom);
 }
 
 /************************************************************************/
@@ -1738,11 +1771,67 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
     if (bNeedRewindBeforeRead)
         ResetReading();
 
+    // Use the attribute and spatial indexes, if any, to only read the lines
+    // of the features that may match the filters.
+    if ((m_poAttrQuery != nullptr || m_poFilterGeom != nullptr) &&
+        !m_bMatchingFIDsScanned)
+    {
+        m_bMatchingFIDsScanned = true;
+        if (m_poAttrQuery != nullptr && m_poAttrIndex != nullptr &&
+            !bInWriteMode)
+            m_panMatchingFIDs =
+                m_poAttrQuery->EvaluateAgainstIndices(this, nullptr);
+
+        const std::vector<GIntBig> *panSpatialFIDs =
+            m_poFilterGeom != nullptr && !bInWriteMode
+                ? GetSidecarSpatialIndexFIDs()
+                : nullptr;
+        if (panSpatialFIDs != nullptr && m_panMatchingFIDs != nullptr)
+        {
+            // Both lists are sorted: keep the FIDs that are in both
+            size_t j = 0;
+            for (size_t i = 0; m_panMatchingFIDs[i] != OGRNullFID; ++i)
+            {
+                if (std::binary_search(panSpatialFIDs->begin(),
+                                       panSpatialFIDs->end(),
+                                       m_panMatchingFIDs[i]))
+                    m_panMatchingFIDs[j++] = m_panMatchingFIDs[i];
+            }
+            m_panMatchingFIDs[j] = OGRNullFID;
+        }
+        else if (panSpatialFIDs != nullptr)
+        {
+            m_panMatchingFIDs = static_cast<GIntBig *>(VSI_MALLOC2_VERBOSE(
+                panSpatialFIDs->size() + 1, sizeof(GIntBig)));
+            if (m_panMatchingFIDs != nullptr)
+            {
+                std::copy(panSpatialFIDs->begin(), panSpatialFIDs->end(),
+                          m_panMatchingFIDs);
+                m_panMatchingFIDs[panSpatialFIDs->size()] = OGRNullFID;
+            }
+        }
+    }
+
     // Read features till we find one that satisfies our current
     // spatial criteria.
     while (true)
     {
-        OGRFeature *poFeature = GetNextUnfilteredFeature();
+        OGRFeature *poFeature = nullptr;
+        if (m_panMatchingFIDs != nullptr)
+        {
+            // FIDs are sorted, so GetFeature() just skips lines forward.
+            const GIntBig nFID = m_panMatchingFIDs[m_iMatchingFID];
+            if (nFID == OGRNullFID)
+                return nullptr;
+            ++m_iMatchingFID;
+            if (nFID < m_nNextFID)
+                continue;
+            poFeature = GetFeature(nFID);
+        }
+        else
+        {
+            poFeature = GetNextUnfilteredFeature();
+        }
         if (poFeature == nullptr)
             return nullptr;
 
@@ -49,16 +49,16 @@ OGRPoint *GeometryReader::readPoint()
             if (m_offset >= pM->size())
                 return CPLErrorInvalidLength("M data");
             const auto aM = pM->data();
-            return new OGRPoint{EndianScalar(m_xy[offsetXy + 0]),
-                                EndianScalar(m_xy[offsetXy + 1]),
-                                EndianScalar(aZ[m_offset]),
-                                EndianScalar(aM[m_offset])};
+            return newPoint(OGRPoint{EndianScalar(m_xy[offsetXy + 0]),
+                                     EndianScalar(m_xy[offsetXy + 1]),
+                                     EndianScalar(aZ[m_offset]),
+                                     EndianScalar(aM[m_offset])});
         }
         else
         {
-            return new OGRPoint{EndianScalar(m_xy[offsetXy + 0]),
-                                EndianScalar(m_xy[offsetXy + 1]),
-                                EndianScalar(aZ[m_offset])};
+            return newPoint(OGRPoint{EndianScalar(m_xy[offsetXy + 0]),
+                                     EndianScalar(m_xy[offsetXy + 1]),
+                                     EndianScalar(aZ[m_offset])});
         }
     }
     else if (m_hasM)
@@ -69,14 +69,16 @@ OGRPoint *GeometryReader::readPoint()
         if (m_offset >= pM->size())
             return CPLErrorInvalidLength("M data");
         const auto aM = pM->data();
-        return OGRPoint::createXYM(EndianScalar(m_xy[offsetXy + 0]),
-                                   EndianScalar(m_xy[offsetXy + 1]),
-                                   EndianScalar(aM[m_offset]));
+        OGRPoint point{EndianScalar(m_xy[offsetXy + 0]),
+                       EndianScalar(m_xy[offsetXy + 1]), 0,
+                       EndianScalar(aM[m_offset])};
+        point.set3D(FALSE);
+        return newPoint(point);
     }
     else
     {
-        return new OGRPoint{EndianScalar(m_xy[offsetXy + 0]),
-                            EndianScalar(m_xy[offsetXy + 1])};
+        return newPoint(OGRPoint{EndianScalar(m_xy[offsetXy + 0]),
+                                 EndianScalar(m_xy[offsetXy + 1])});
     }
 }
 
@@ -85,7 +87,7 @@ OGRMultiPoint *GeometryReader::readMultiPoint()
     auto length = m_length / 2;
     if (length >= feature_max_buffer_size)
         return CPLErrorInvalidLength("MultiPoint");
-    auto mp = std::make_unique<OGRMultiPoint>();
+    auto mp = std::unique_ptr<OGRMultiPoint>(newGeometry<OGRMultiPoint>());
     for (uint32_t i = 0; i < length; i++)
     {
         m_offset = i;
@@ -100,7 +102,8 @@ OGRMultiPoint *GeometryReader::readMultiPoint()
 OGRMultiLineString *GeometryReader::readMultiLineString()
 {
     const auto ends = m_geometry->ends();
-    auto mls = std::make_unique<OGRMultiLineString>();
+    auto mls =
+        std::unique_ptr<OGRMultiLineString>(newGeometry<OGRMultiLineString>());
     if (ends == nullptr || ends->size() < 2)
     {
         m_length = m_length / 2;
@@ -227,7 +230,7 @@ OGRErr GeometryReader::readSimpleCurve(OGRSimpleCurve *sc)
 OGRPolygon *GeometryReader::readPolygon()
 {
     const auto ends = m_geometry->ends();
-    auto p = std::make_unique<OGRPolygon>();
+    auto p = std::unique_ptr<OGRPolygon>(newGeometry<OGRPolygon>());
     if (ends == nullptr || ends->size() < 2)
     {
         m_length = m_length / 2;
@@ -261,7 +264,8 @@ OGRMultiPolygon *GeometryReader::readMultiPolygon()
     auto parts = m_geometry->parts();
     if (parts == nullptr)
         return CPLErrorInvalidPointer("parts data");
-    auto mp = std::make_unique<OGRMultiPolygon>();
+    auto mp =
+        std::unique_ptr<OGRMultiPolygon>(newGeometry<OGRMultiPolygon>());
     for (uoffset_t i = 0; i < parts->size(); i++)
     {
         auto g = std::unique_ptr<OGRGeometry>(
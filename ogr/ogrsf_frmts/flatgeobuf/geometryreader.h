@@ -23,6 +23,7 @@
 #endif
 
 #include "ogr_p.h"
+#include "ogr_geometry_pool.h"
 
 namespace ogr_flatgeobuf
 {
@@ -34,6 +35,7 @@ class GeometryReader
     const FlatGeobuf::GeometryType m_geometryType;
     const bool m_hasZ;
     const bool m_hasM;
+    OGRGeometryPool *const m_pool;
 
     const double *m_xy = nullptr;
     uint32_t m_xylength = 0;
@@ -57,20 +59,42 @@ class GeometryReader
 
     OGRGeometry *readPart(const FlatGeobuf::Geometry *part)
     {
-        return GeometryReader(part, m_hasZ, m_hasM).read();
+        return GeometryReader(part, m_hasZ, m_hasM, m_pool).read();
     }
 
     OGRGeometry *readPart(const FlatGeobuf::Geometry *part,
                           const FlatGeobuf::GeometryType geometryType)
     {
-        return GeometryReader(part, geometryType, m_hasZ, m_hasM).read();
+        return GeometryReader(part, geometryType, m_hasZ, m_hasM, m_pool)
+            .read();
+    }
+
+    // Return an object from the pool, if any, with the dimension flags of
+    // the layer, or a new object.
+    template <class T> T *newGeometry()
+    {
+        if (m_pool == nullptr)
+            return new T();
+        T *geom = m_pool->Acquire<T>();
+        geom->set3D(m_hasZ);
+        geom->setMeasured(m_hasM);
+        return geom;
+    }
+
+    OGRPoint *newPoint(const OGRPoint &point)
+    {
+        if (m_pool == nullptr)
+            return new OGRPoint(point);
+        OGRPoint *poPoint = m_pool->Acquire<OGRPoint>();
+        *poPoint = point;
+        return poPoint;
     }
 
     template <class T> T *readSimpleCurve(const bool halfLength = false)
     {
         if (halfLength)
             m_length = m_length / 2;
-        const auto csc = new T();
+        const auto csc = newGeometry<T>();
         if (readSimpleCurve(csc) != OGRERR_NONE)
         {
             delete csc;
@@ -80,18 +104,19 @@ class GeometryReader
     }
 
   public:
+    // If pool is not null, geometry objects are taken from it when possible
     GeometryReader(const FlatGeobuf::Geometry *geometry,
                    const FlatGeobuf::GeometryType geometryType, const bool hasZ,
-                   const bool hasM)
+                   const bool hasM, OGRGeometryPool *pool = nullptr)
         : m_geometry(geometry), m_geometryType(geometryType), m_hasZ(hasZ),
-          m_hasM(hasM)
+          m_hasM(hasM), m_pool(pool)
     {
     }
 
     GeometryReader(const FlatGeobuf::Geometry *geometry, const bool hasZ,
-                   const bool hasM)
+                   const bool hasM, OGRGeometryPool *pool = nullptr)
         : m_geometry(geometry), m_geometryType(geometry->type()), m_hasZ(hasZ),
-          m_hasM(hasM)
+          m_hasM(hasM), m_pool(pool)
     {
     }
 
@@ -15,6 +15,7 @@
 
 #include "ogrsf_frmts.h"
 #include "ogr_p.h"
+#include "ogr_geometry_pool.h"
 #include "ogreditablelayer.h"
 
 #if defined(__clang__)
@@ -94,6 +95,7 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     bool m_queriedSpatialIndex = false;
     bool m_ignoreSpatialFilter = false;
     bool m_ignoreAttributeFilter = false;
+    OGRGeometryPool m_oGeometryPool{};  // geometries of recycled features
 
     // creation
     GDALDataset *m_poDS = nullptr;  // parent dataset to get metadata from it
@@ -102,6 +104,7 @@ class OGRFlatGeobufLayer final : public OGRLayer,
                                              // create spatial index
     bool m_bCreateSpatialIndexAtClose = true;
     bool m_bVerifyBuffers = true;
+    bool m_bUseMmap = false;
     VSILFILE *m_poFpWrite = nullptr;
     CPLStringList m_aosCreationOption{};  // layer creation options
     uint64_t m_writeOffset = 0;           // current write offset
@@ -121,7 +124,9 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     // deserialize
     void ensurePadfBuffers(size_t count);
     OGRErr ensureFeatureBuf(uint32_t featureSize);
-    OGRErr parseFeature(OGRFeature *poFeature);
+    const GByte *readFeatureBuf(uint32_t featureSize);
+    OGRErr parseFeature(OGRFeature *poFeature,
+                        OGRGeometryPool *poGeometryPool = nullptr);
     const std::vector<flatbuffers::Offset<FlatGeobuf::Column>>
     writeColumns(flatbuffers::FlatBufferBuilder &fbb);
     void readColumns();
@@ -165,6 +170,7 @@ class OGRFlatGeobufLayer final : public OGRLayer,
 
     OGRFeature *GetFeature(GIntBig nFeatureId) override;
     OGRFeature *GetNextFeature() override;
+    OGRFeature *GetNextFeatureReusing(OGRFeature *poFeature) override;
     virtual OGRErr CreateField(const OGRFieldDefn *poField,
                                int bApproxOK = true) override;
     OGRErr ICreateFeature(OGRFeature *poFeature) override;
@@ -186,6 +192,11 @@ class OGRFlatGeobufLayer final : public OGRLayer,
         m_bVerifyBuffers = CPL_TO_BOOL(bFlag);
     }
 
+    void UseMmap(bool bFlag)
+    {
+        m_bUseMmap = bFlag;
+    }
+
     GDALDataset *GetDataset() override
     {
         return m_poDS;
@@ -250,7 +261,8 @@ class OGRFlatGeobufDataset final : public GDALDataset
     bool m_bUpdate = false;
     bool m_bIsDir = false;
 
-    bool OpenFile(const char *pszFilename, VSILFILE *fp, bool bVerifyBuffers);
+    bool OpenFile(const char *pszFilename, VSILFILE *fp, bool bVerifyBuffers,
+                  bool bUseMmap);
 
     CPLErr Close() override;
 
@@ -158,6 +158,9 @@ void RegisterOGRFlatGeobuf()
         "<OpenOptionList>"
         "  <Option name='VERIFY_BUFFERS' type='boolean' description='Verify "
         "flatbuffers integrity' default='YES'/>"
+        "  <Option name='USE_MMAP' type='boolean' description='Whether "
+        "features may be read in place from the file mapped in memory' "
+        "default='NO'/>"
         "</OpenOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DCAP_COORDINATE_EPOCH, "YES");
@@ -228,6 +231,8 @@ GDALDataset *OGRFlatGeobufDataset::Open(GDALOpenInfo *poOpenInfo)
 
     const auto bVerifyBuffers =
         CPLFetchBool(poOpenInfo->papszOpenOptions, "VERIFY_BUFFERS", true);
+    const bool bUseMmap =
+        CPLFetchBool(poOpenInfo->papszOpenOptions, "USE_MMAP", false);
 
     auto isDir = CPL_TO_BOOL(poOpenInfo->bIsDirectory);
     auto bUpdate = poOpenInfo->eAccess == GA_Update;
@@ -269,7 +274,8 @@ GDALDataset *OGRFlatGeobufDataset::Open(GDALOpenInfo *poOpenInfo)
                 VSILFILE *fp = VSIFOpenL(osFilename, "rb");
                 if (fp)
                 {
-                    if (!poDS->OpenFile(osFilename, fp, bVerifyBuffers))
+                    if (!poDS->OpenFile(osFilename, fp, bVerifyBuffers,
+                                        bUseMmap))
                         VSIFCloseL(fp);
                 }
             }
@@ -280,7 +286,7 @@ GDALDataset *OGRFlatGeobufDataset::Open(GDALOpenInfo *poOpenInfo)
         if (poOpenInfo->fpL != nullptr)
         {
             if (poDS->OpenFile(poOpenInfo->pszFilename, poOpenInfo->fpL,
-                               bVerifyBuffers))
+                               bVerifyBuffers, bUseMmap))
                 poOpenInfo->fpL = nullptr;
         }
         else
@@ -296,13 +302,14 @@ GDALDataset *OGRFlatGeobufDataset::Open(GDALOpenInfo *poOpenInfo)
 /************************************************************************/
 
 bool OGRFlatGeobufDataset::OpenFile(const char *pszFilename, VSILFILE *fp,
-                                    bool bVerifyBuffers)
+                                    bool bVerifyBuffers, bool bUseMmap)
 {
     CPLDebugOnly("FlatGeobuf", "Opening OGRFlatGeobufLayer");
     auto poLayer = std::unique_ptr<OGRFlatGeobufLayer>(
         OGRFlatGeobufLayer::Open(pszFilename, fp, bVerifyBuffers));
     if (!poLayer)
         return false;
+    poLayer->UseMmap(bUseMmap);
 
     if (m_bUpdate)
     {
@@ -68,6 +68,9 @@ OGRFlatGeobufLayer::OGRFlatGeobufLayer(const Header *poHeader, GByte *headerBuf,
     m_featuresCount = m_poHeader->features_count();
     m_geometryType = m_poHeader->geometry_type();
     m_indexNodeSize = m_poHeader->index_node_size();
+    // Attribute indexes require random access to features.
+    if (m_indexNodeSize > 0 && pszFilename)
+        InitializeSidecarIndexSupport(pszFilename);
     m_hasZ = m_poHeader->has_z();
     m_hasM = m_poHeader->has_m();
     m_hasT = m_poHeader->has_t();
@@ -840,12 +843,14 @@ OGRErr OGRFlatGeobufLayer::readFeatureOffset(uint64_t index,
 {
     try
     {
-        const auto treeSize =
-            PackedRTree::size(m_featuresCount, m_indexNodeSize);
+        // m_featuresCount may be the number of features found by a spatial
+        // index search.
+        const auto featuresCount = m_poHeader->features_count();
+        const auto treeSize = PackedRTree::size(featuresCount, m_indexNodeSize);
         const auto levelBounds =
-            PackedRTree::generateLevelBounds(m_featuresCount, m_indexNodeSize);
+            PackedRTree::generateLevelBounds(featuresCount, m_indexNodeSize);
         const auto bottomLevelOffset =
-            m_offset - treeSize +
+            m_offsetFeatures - treeSize +
             (levelBounds.front().first * sizeof(NodeItem));
         const auto nodeItemOffset =
             bottomLevelOffset + (index * sizeof(NodeItem));
@@ -902,13 +907,18 @@ OGRFeature *OGRFlatGeobufLayer::GetFeature(GIntBig nFeatureId)
 
 OGRErr OGRFlatGeobufLayer::readIndex()
 {
-    if (m_queriedSpatialIndex || !m_poFilterGeom)
+    if (m_queriedSpatialIndex)
         return OGRERR_NONE;
-    if (m_sFilterEnvelope.IsInit() && m_sExtent.IsInit() &&
-        m_sFilterEnvelope.MinX <= m_sExtent.MinX &&
-        m_sFilterEnvelope.MinY <= m_sExtent.MinY &&
-        m_sFilterEnvelope.MaxX >= m_sExtent.MaxX &&
-        m_sFilterEnvelope.MaxY >= m_sExtent.MaxY)
+    const bool useSpatialIndex =
+        m_poFilterGeom && !m_ignoreSpatialFilter &&
+        !(m_sFilterEnvelope.IsInit() && m_sExtent.IsInit() &&
+          m_sFilterEnvelope.MinX <= m_sExtent.MinX &&
+          m_sFilterEnvelope.MinY <= m_sExtent.MinY &&
+          m_sFilterEnvelope.MaxX >= m_sExtent.MaxX &&
+          m_sFilterEnvelope.MaxY >= m_sExtent.MaxY);
+    const bool useAttributeIndex =
+        m_poAttrQuery && !m_ignoreAttributeFilter && m_poAttrIndex;
+    if (!useSpatialIndex && !useAttributeIndex)
         return OGRERR_NONE;
     const auto indexNodeSize = m_poHeader->index_node_size();
     if (indexNodeSize == 0)
@@ -917,6 +927,25 @@ OGRErr OGRFlatGeobufLayer::readIndex()
     if (featuresCount == 0)
         return OGRERR_NONE;
 
+    // Sorted list of the FIDs matching the attribute filter, if it can be
+    // evaluated with the attribute indexes.
+    std::unique_ptr<GIntBig, VSIFreeReleaser> matchingFIDs;
+    GIntBig matchingFIDsCount = 0;
+    if (useAttributeIndex)
+    {
+        matchingFIDs.reset(
+            m_poAttrQuery->EvaluateAgainstIndices(this, nullptr));
+        if (matchingFIDs)
+        {
+            while (matchingFIDs.get()[matchingFIDsCount] != OGRNullFID)
+                ++matchingFIDsCount;
+        }
+        else if (!useSpatialIndex)
+        {
+            return OGRERR_NONE;
+        }
+    }
+
     if (VSIFSeekL(m_poFp, sizeof(magicbytes), SEEK_SET) ==
         -1)  // skip magic bytes
         return CPLErrorIO("seeking past magic bytes");
@@ -929,7 +958,7 @@ OGRErr OGRFlatGeobufLayer::readIndex()
     {
         const auto treeSize =
             indexNodeSize > 0 ? PackedRTree::size(featuresCount) : 0;
-        if (treeSize > 0 && m_poFilterGeom && !m_ignoreSpatialFilter)
+        if (treeSize > 0 && useSpatialIndex)
         {
             CPLDebugOnly("FlatGeobuf", "Attempting spatial index query");
             OGREnvelope env;
@@ -956,6 +985,47 @@ OGRErr OGRFlatGeobufLayer::readIndex()
 
             m_queriedSpatialIndex = true;
         }
+
+        if (treeSize > 0 && matchingFIDs)
+        {
+            const GIntBig *fidsBegin = matchingFIDs.get();
+            const GIntBig *fidsEnd = fidsBegin + matchingFIDsCount;
+            if (m_queriedSpatialIndex)
+            {
+                // Keep the items of the spatial index search that match
+                // the attribute filter.
+                m_foundItems.erase(
+                    std::remove_if(m_foundItems.begin(), m_foundItems.end(),
+                                   [fidsBegin, fidsEnd](const auto &item)
+                                   {
+                                       return !std::binary_search(
+                                           fidsBegin, fidsEnd,
+                                           static_cast<GIntBig>(item.index));
+                                   }),
+                    m_foundItems.end());
+            }
+            else
+            {
+                m_foundItems.clear();
+                for (const GIntBig *fid = fidsBegin; fid != fidsEnd; ++fid)
+                {
+                    if (*fid < 0 ||
+                        static_cast<uint64_t>(*fid) >= featuresCount)
+                        continue;
+                    uint64_t featureOffset;
+                    const auto err = readFeatureOffset(*fid, featureOffset);
+                    if (err != OGRERR_NONE)
+                        return err;
+                    m_foundItems.push_back(
+                        {featureOffset, static_cast<uint64_t>(*fid)});
+                }
+                m_queriedSpatialIndex = true;
+            }
+            m_featuresCount = m_foundItems.size();
+            CPLDebugOnly("FlatGeobuf",
+                         "%lu features found with attribute index search",
+                         static_cast<long unsigned int>(m_featuresCount));
+        }
     }
     catch (const std::exception &e)
     {
@@ -988,6 +1058,12 @@ static inline bool ParseDateTime(std::string_view sInput, OGRField *psField)
 
 OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
 {
+    return GetNextFeatureReusing(nullptr);
+}
+
+OGRFeature *OGRFlatGeobufLayer::GetNextFeatureReusing(OGRFeature *poReused)
+{
+    std::unique_ptr<OGRFeature> poFeature(poReused);
     if (m_create)
         return nullptr;
 
@@ -1011,8 +1087,12 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
             return nullptr;
         }
 
-        auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
-        if (parseFeature(poFeature.get()) != OGRERR_NONE)
+        // Refill the feature, and its geometry objects, of the previous
+        // iteration or of the caller, instead of allocating new ones.
+        if (poFeature && poFeature->GetDefnRef() == m_poFeatureDefn)
+            m_oGeometryPool.RecycleGeometries(poFeature.get());
+        poFeature.reset(RecycleFeature(poFeature.release(), m_poFeatureDefn));
+        if (parseFeature(poFeature.get(), &m_oGeometryPool) != OGRERR_NONE)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Fatal error parsing feature");
@@ -1064,7 +1144,42 @@ OGRErr OGRFlatGeobufLayer::ensureFeatureBuf(uint32_t featureSize)
     return OGRERR_NONE;
 }
 
-OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
+// Return a pointer to the content of the feature of size featureSize that
+// starts at the current file position, and advance past it. The content is
+// accessed in place when the USE_MMAP open option is set and the file can be
+// mapped in memory, and is otherwise read into m_featureBuf.
+const GByte *OGRFlatGeobufLayer::readFeatureBuf(uint32_t featureSize)
+{
+    const auto pabyMapped =
+        m_bUseMmap ? static_cast<const GByte *>(VSIFGetMappedRegionL(
+                         m_poFp, m_offset + sizeof(featureSize), featureSize))
+                   : nullptr;
+    // Flatbuffers accessors dereference scalars directly, so the mapped
+    // feature must be suitably aligned for doubles.
+    if (pabyMapped &&
+        (reinterpret_cast<uintptr_t>(pabyMapped) % sizeof(double)) == 0)
+    {
+        if (VSIFSeekL(m_poFp, m_offset + sizeof(featureSize) + featureSize,
+                      SEEK_SET) != 0)
+        {
+            CPLErrorIO("seeking after feature");
+            return nullptr;
+        }
+        return pabyMapped;
+    }
+
+    if (ensureFeatureBuf(featureSize) != OGRERR_NONE)
+        return nullptr;
+    if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
+    {
+        CPLErrorIO("reading feature");
+        return nullptr;
+    }
+    return m_featureBuf;
+}
+
+OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature,
+                                        OGRGeometryPool *poGeometryPool)
 {
     GIntBig fid;
     auto seek = false;
@@ -1123,16 +1238,14 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
         }
     }
 
-    const auto err = ensureFeatureBuf(featureSize);
-    if (err != OGRERR_NONE)
-        return err;
-    if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
-        return CPLErrorIO("reading feature");
+    const GByte *pabyFeature = readFeatureBuf(featureSize);
+    if (pabyFeature == nullptr)
+        return OGRERR_FAILURE;
     m_offset += featureSize + sizeof(featureSize);
 
     if (m_bVerifyBuffers)
     {
-        Verifier v(m_featureBuf, featureSize);
+        Verifier v(pabyFeature, featureSize);
         const auto ok = VerifyFeatureBuffer(v);
         if (!ok)
         {
@@ -1146,7 +1259,7 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
         }
     }
 
-    const auto feature = GetRoot<Feature>(m_featureBuf);
+    const auto feature = GetRoot<Feature>(pabyFeature);
     const auto geometry = feature->geometry();
     if (!m_poFeatureDefn->IsGeometryIgnored() && geometry != nullptr)
     {
@@ -1154,7 +1267,9 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
         if (geometryType == GeometryType::Unknown)
             geometryType = geometry->type();
         OGRGeometry *poOGRGeometry =
-            GeometryReader(geometry, geometryType, m_hasZ, m_hasM).read();
+            GeometryReader(geometry, geometryType, m_hasZ, m_hasM,
+                           poGeometryPool)
+                .read();
         if (poOGRGeometry == nullptr)
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Failed to read geometry");
@@ -1166,7 +1281,8 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
         //             CPLDebugOnly("FlatGeobuf", "readGeometry as wkt: %s",
         //             wkt);
         // #endif
-        if (m_poSRS != nullptr)
+        // Objects from the pool may have kept another spatial reference
+        if (m_poSRS != nullptr || poGeometryPool != nullptr)
             poOGRGeometry->assignSpatialReference(m_poSRS);
         poFeature->SetGeometryDirectly(poOGRGeometry);
     }
@@ -1569,19 +1685,14 @@ begin:
             }
         }
 
-        const auto err = ensureFeatureBuf(featureSize);
-        if (err != OGRERR_NONE)
+        const GByte *pabyFeature = readFeatureBuf(featureSize);
+        if (pabyFeature == nullptr)
             goto error;
-        if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
-        {
-            CPLErrorIO("reading feature");
-            goto error;
-        }
         m_offset += featureSize + sizeof(featureSize);
 
         if (m_bVerifyBuffers)
         {
-            Verifier v(m_featureBuf, featureSize);
+            Verifier v(pabyFeature, featureSize);
             const auto ok = VerifyFeatureBuffer(v);
             if (!ok)
             {
@@ -1596,7 +1707,7 @@ begin:
             }
         }
 
-        const auto feature = GetRoot<Feature>(m_featureBuf);
+        const auto feature = GetRoot<Feature>(pabyFeature);
         const auto geometry = feature->geometry();
         const auto properties = feature->properties();
         if (!m_poFeatureDefn->IsGeometryIgnored() && geometry != nullptr)
@@ -62,4 +62,34 @@ OGRAttrIndex::~OGRAttrIndex()
 {
 }
 
+/************************************************************************/
+/*                        SupportsRangeQueries()                        */
+/************************************************************************/
+
+/** Return whether GetRangeMatches() is implemented. */
+bool OGRAttrIndex::SupportsRangeQueries() const
+{
+    return false;
+}
+
+/************************************************************************/
+/*                          GetRangeMatches()                           */
+/************************************************************************/
+
+/** Return the FIDs of the features whose key is within a range, as a list
+ * terminated by OGRNullFID to free with CPLFree(), or nullptr in case of
+ * error or if range queries are not supported.
+ *
+ * psMin or psMax may be nullptr for an unbounded range. The FIDs are not
+ * necessarily sorted.
+ */
+GIntBig *OGRAttrIndex::GetRangeMatches(const OGRField * /* psMin */,
+                                       bool /* bMinIncluded */,
+                                       const OGRField * /* psMax */,
+                                       bool /* bMaxIncluded */,
+                                       GIntBig * /* pnFIDCount */)
+{
+    return nullptr;
+}
+
 //! @endcond
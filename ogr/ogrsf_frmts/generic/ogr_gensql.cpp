@@ -19,10 +19,16 @@
 #include "ogr_recordbatch.h"
 #include "ogrlayerarrow.h"
 #include "cpl_time.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+#include "ogr_attrind.h"
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -46,6 +52,1245 @@ class OGRGenSQLGeomFieldDefn final : public OGRGeomFieldDefn
 
 OGRGenSQLGeomFieldDefn::~OGRGenSQLGeomFieldDefn() = default;
 
+/************************************************************************/
+/*                       OGRGenSQLGetMaxMemory()                        */
+/************************************************************************/
+
+/** Return the maximum amount of RAM, in bytes, that the generic SQL layer
+ * may use for its intermediate structures before spilling them to disk. */
+size_t OGRGenSQLGetMaxMemory()
+{
+    const char *pszVal = CPLGetConfigOption("OGR_SQL_MAX_MEMORY", nullptr);
+    if (pszVal)
+    {
+        GIntBig nRet = 0;
+        if (CPLParseMemorySize(pszVal, &nRet, nullptr) == CE_None)
+        {
+            return static_cast<size_t>(std::min<GIntBig>(
+                std::max<GIntBig>(0, nRet),
+                static_cast<GIntBig>(std::numeric_limits<size_t>::max() / 2)));
+        }
+    }
+    const GIntBig nUsableRAM = CPLGetUsablePhysicalRAM();
+    if (nUsableRAM > 0)
+    {
+        return static_cast<size_t>(std::min<GIntBig>(
+            nUsableRAM / 4,
+            static_cast<GIntBig>(std::numeric_limits<size_t>::max() / 2)));
+    }
+    return 256 * 1024 * 1024;
+}
+
+OGRGenSQLSpillableBuffer::~OGRGenSQLSpillableBuffer()
+{
+    if (m_fp)
+    {
+        VSIFCloseL(m_fp);
+        VSIUnlink(m_osTmpFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                              Append()                                */
+/************************************************************************/
+
+bool OGRGenSQLSpillableBuffer::Append(const GByte *pabyData, size_t nSize,
+                                      uint64_t &nOffset)
+{
+    nOffset = m_nSize;
+    if (!m_fp && m_abyMem.size() + nSize > m_nMaxMemory)
+    {
+        m_osTmpFilename = CPLGenerateTempFilenameSafe("ogr_sql");
+        m_fp = VSIFOpenL(m_osTmpFilename.c_str(), "wb+");
+        if (!m_fp)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     m_osTmpFilename.c_str());
+            return false;
+        }
+        CPLDebug("GenSQL", "Spilling intermediate data to %s",
+                 m_osTmpFilename.c_str());
+        if (!m_abyMem.empty() &&
+            VSIFWriteL(m_abyMem.data(), m_abyMem.size(), 1, m_fp) != 1)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot write into %s",
+                     m_osTmpFilename.c_str());
+            return false;
+        }
+        m_abyMem.clear();
+        m_abyMem.shrink_to_fit();
+    }
+
+    if (m_fp)
+    {
+        if (!m_bLastOpIsWrite)
+        {
+            VSIFSeekL(m_fp, 0, SEEK_END);
+            m_bLastOpIsWrite = true;
+        }
+        if (nSize > 0 && VSIFWriteL(pabyData, nSize, 1, m_fp) != 1)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot write into %s",
+                     m_osTmpFilename.c_str());
+            return false;
+        }
+    }
+    else
+    {
+        m_abyMem.insert(m_abyMem.end(), pabyData, pabyData + nSize);
+    }
+    m_nSize += nSize;
+    return true;
+}
+
+/************************************************************************/
+/*                                Get()                                 */
+/************************************************************************/
+
+/** Return a pointer to nSize bytes at nOffset. The pointer is either into
+ * the in-memory buffer, or into abyTmp when data has been spilled, and is
+ * valid until the next call to Append() or Get(). */
+const GByte *OGRGenSQLSpillableBuffer::Get(uint64_t nOffset, size_t nSize,
+                                           std::vector<GByte> &abyTmp)
+{
+    if (!m_fp)
+        return m_abyMem.data() + static_cast<size_t>(nOffset);
+
+    abyTmp.resize(nSize);
+    if (!Read(nOffset, nSize, abyTmp.data()))
+        return nullptr;
+    return abyTmp.data();
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+/** Copy nSize bytes at nOffset into pDst. */
+bool OGRGenSQLSpillableBuffer::Read(uint64_t nOffset, size_t nSize,
+                                    void *pDst)
+{
+    if (!m_fp)
+    {
+        if (nSize > 0)
+            memcpy(pDst, m_abyMem.data() + static_cast<size_t>(nOffset),
+                   nSize);
+        return true;
+    }
+
+    m_bLastOpIsWrite = false;
+    if (VSIFSeekL(m_fp, nOffset, SEEK_SET) != 0 ||
+        (nSize > 0 && VSIFReadL(pDst, nSize, 1, m_fp) != 1))
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read from %s",
+                 m_osTmpFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          OGRGenSQLHashJoin                           */
+/************************************************************************/
+
+/** Hash table of the features of the secondary layer of an equality JOIN,
+ * indexed by the value of their key field.
+ *
+ * Keys are kept in RAM, and the serialized features in a
+ * OGRGenSQLSpillableBuffer. Comparison rules follow the ones of
+ * swq_op_general.cpp: strings are compared case-insensitively, and numbers
+ * of different types are compared as doubles.
+ */
+class OGRGenSQLHashJoin
+{
+  public:
+    static std::unique_ptr<OGRGenSQLHashJoin>
+    Create(const swq_join_def *psJoinDef, const OGRFeatureDefn *poSrcDefn,
+           OGRLayer *poJoinLayer, size_t nMaxMemory);
+
+    bool Build();
+    std::unique_ptr<OGRFeature> Lookup(const OGRFeature *poSrcFeat);
+
+  private:
+    enum class KeyType
+    {
+        INTEGER,
+        REAL,
+        STRING
+    };
+
+    struct Location
+    {
+        uint64_t nOffset = 0;
+        size_t nSize = 0;
+    };
+
+    OGRLayer *const m_poJoinLayer;
+    const int m_iPrimaryField;
+    const int m_iSecondaryField;
+    const KeyType m_eKeyType;
+    OGRGenSQLSpillableBuffer m_oBuffer;
+    std::unordered_map<std::string, Location> m_oMap{};
+    std::vector<GByte> m_abyTmp{};
+
+    OGRGenSQLHashJoin(OGRLayer *poJoinLayer, int iPrimaryField,
+                      int iSecondaryField, KeyType eKeyType,
+                      size_t nMaxMemory)
+        : m_poJoinLayer(poJoinLayer), m_iPrimaryField(iPrimaryField),
+          m_iSecondaryField(iSecondaryField), m_eKeyType(eKeyType),
+          m_oBuffer(nMaxMemory)
+    {
+    }
+
+    bool GetKey(const OGRFeature *poFeature, int iField,
+                std::string &osKey) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLHashJoin)
+};
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+/** Return a hash join for the passed join definition, or nullptr if it is
+ * not a simple equality between a field of the primary table and a field
+ * of the secondary table, in which case the per-feature attribute filter
+ * must be used. */
+std::unique_ptr<OGRGenSQLHashJoin>
+OGRGenSQLHashJoin::Create(const swq_join_def *psJoinDef,
+                          const OGRFeatureDefn *poSrcDefn,
+                          OGRLayer *poJoinLayer, size_t nMaxMemory)
+{
+    const swq_expr_node *poExpr = psJoinDef->poExpr;
+    if (poExpr == nullptr || poExpr->eNodeType != SNT_OPERATION ||
+        poExpr->nOperation != SWQ_EQ || poExpr->nSubExprCount != 2 ||
+        poExpr->papoSubExpr[0]->eNodeType != SNT_COLUMN ||
+        poExpr->papoSubExpr[1]->eNodeType != SNT_COLUMN)
+    {
+        return nullptr;
+    }
+
+    const swq_expr_node *poPrimary = poExpr->papoSubExpr[0];
+    const swq_expr_node *poSecondary = poExpr->papoSubExpr[1];
+    if (poPrimary->table_index != 0)
+        std::swap(poPrimary, poSecondary);
+    if (poPrimary->table_index != 0 ||
+        poSecondary->table_index != psJoinDef->secondary_table)
+    {
+        return nullptr;
+    }
+
+    const auto GetKeyType = [](OGRFieldType eType, KeyType &eKeyType)
+    {
+        switch (eType)
+        {
+            case OFTInteger:
+            case OFTInteger64:
+                eKeyType = KeyType::INTEGER;
+                return true;
+            case OFTReal:
+                eKeyType = KeyType::REAL;
+                return true;
+            case OFTString:
+                eKeyType = KeyType::STRING;
+                return true;
+            default:
+                break;
+        }
+        return false;
+    };
+
+    // Only regular fields of the secondary layer, and not indexed ones, for
+    // which the attribute filter is already efficient.
+    const OGRFeatureDefn *poJoinDefn = poJoinLayer->GetLayerDefn();
+    const int iSecondaryField = poSecondary->field_index;
+    if (iSecondaryField < 0 || iSecondaryField >= poJoinDefn->GetFieldCount())
+        return nullptr;
+    if (poJoinLayer->GetIndex() &&
+        poJoinLayer->GetIndex()->GetFieldIndex(iSecondaryField))
+    {
+        return nullptr;
+    }
+    KeyType eSecondaryType = KeyType::INTEGER;
+    if (!GetKeyType(poJoinDefn->GetFieldDefn(iSecondaryField)->GetType(),
+                    eSecondaryType))
+    {
+        return nullptr;
+    }
+
+    const int iPrimaryField = poPrimary->field_index;
+    const int nSrcFieldCount = poSrcDefn->GetFieldCount();
+    KeyType ePrimaryType = KeyType::INTEGER;
+    if (iPrimaryField >= 0 && iPrimaryField < nSrcFieldCount)
+    {
+        if (!GetKeyType(poSrcDefn->GetFieldDefn(iPrimaryField)->GetType(),
+                        ePrimaryType))
+        {
+            return nullptr;
+        }
+    }
+    else if (iPrimaryField >= nSrcFieldCount &&
+             iPrimaryField < nSrcFieldCount + SPECIAL_FIELD_COUNT)
+    {
+        switch (SpecialFieldTypes[iPrimaryField - nSrcFieldCount])
+        {
+            case SWQ_INTEGER:
+            case SWQ_INTEGER64:
+                ePrimaryType = KeyType::INTEGER;
+                break;
+            case SWQ_FLOAT:
+                ePrimaryType = KeyType::REAL;
+                break;
+            case SWQ_STRING:
+                ePrimaryType = KeyType::STRING;
+                break;
+            default:
+                return nullptr;
+        }
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    KeyType eKeyType;
+    if (ePrimaryType == eSecondaryType)
+        eKeyType = ePrimaryType;
+    else if (ePrimaryType != KeyType::STRING &&
+             eSecondaryType != KeyType::STRING)
+        eKeyType = KeyType::REAL;
+    else
+        return nullptr;
+
+    return std::unique_ptr<OGRGenSQLHashJoin>(
+        new OGRGenSQLHashJoin(poJoinLayer, iPrimaryField, iSecondaryField,
+                              eKeyType, nMaxMemory));
+}
+
+/************************************************************************/
+/*                               GetKey()                               */
+/************************************************************************/
+
+bool OGRGenSQLHashJoin::GetKey(const OGRFeature *poFeature, int iField,
+                               std::string &osKey) const
+{
+    if (!poFeature->IsFieldSetAndNotNull(iField))
+        return false;
+
+    switch (m_eKeyType)
+    {
+        case KeyType::INTEGER:
+        {
+            const GIntBig nVal = poFeature->GetFieldAsInteger64(iField);
+            osKey.assign(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+            break;
+        }
+
+        case KeyType::REAL:
+        {
+            double dfVal = poFeature->GetFieldAsDouble(iField);
+            if (std::isnan(dfVal))
+                return false;
+            if (dfVal == 0)
+                dfVal = 0;  // normalize -0
+            osKey.assign(reinterpret_cast<const char *>(&dfVal),
+                         sizeof(dfVal));
+            break;
+        }
+
+        case KeyType::STRING:
+        {
+            osKey = poFeature->GetFieldAsString(iField);
+            for (char &ch : osKey)
+            {
+                if (ch >= 'A' && ch <= 'Z')
+                    ch = static_cast<char>(ch - 'A' + 'a');
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+/** Read the secondary layer and index its features by key. Only the first
+ * feature of a given key is kept, as the attribute filter approach only
+ * returns the first matching feature. */
+bool OGRGenSQLHashJoin::Build()
+{
+    m_poJoinLayer->SetAttributeFilter(nullptr);
+    m_poJoinLayer->ResetReading();
+
+    std::string osKey;
+    std::vector<GByte> abyFeature;
+    bool bRet = true;
+    for (auto &&poFeature : *m_poJoinLayer)
+    {
+        if (!GetKey(poFeature.get(), m_iSecondaryField, osKey) ||
+            cpl::contains(m_oMap, osKey))
+        {
+            continue;
+        }
+        Location sLoc;
+        if (!poFeature->SerializeToBinary(abyFeature) ||
+            !m_oBuffer.Append(abyFeature.data(), abyFeature.size(),
+                              sLoc.nOffset))
+        {
+            bRet = false;
+            break;
+        }
+        sLoc.nSize = abyFeature.size();
+        m_oMap[osKey] = sLoc;
+    }
+    m_poJoinLayer->ResetReading();
+
+    CPLDebug("GenSQL",
+             "Hash join on layer %s: %d keys, " CPL_FRMT_GUIB " bytes",
+             m_poJoinLayer->GetName(), static_cast<int>(m_oMap.size()),
+             static_cast<GUIntBig>(m_oBuffer.GetSize()));
+    return bRet;
+}
+
+/************************************************************************/
+/*                               Lookup()                               */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature>
+OGRGenSQLHashJoin::Lookup(const OGRFeature *poSrcFeat)
+{
+    std::string osKey;
+    if (!GetKey(poSrcFeat, m_iPrimaryField, osKey))
+        return nullptr;
+    const auto oIter = m_oMap.find(osKey);
+    if (oIter == m_oMap.end())
+        return nullptr;
+
+    const GByte *pabyData =
+        m_oBuffer.Get(oIter->second.nOffset, oIter->second.nSize, m_abyTmp);
+    if (!pabyData)
+        return nullptr;
+    auto poFeature =
+        std::make_unique<OGRFeature>(m_poJoinLayer->GetLayerDefn());
+    if (!poFeature->DeserializeFromBinary(pabyData, oIter->second.nSize))
+        return nullptr;
+    return poFeature;
+}
+
+/************************************************************************/
+/*                     Sort key encoding functions.                     */
+/*                                                                      */
+/*      Values are encoded such that comparing the resulting byte       */
+/*      strings with memcmp() gives the same ordering as comparing      */
+/*      the values. A leading marker byte sorts NULL values first.      */
+/************************************************************************/
+
+static void OGRGenSQLAppendSortKeyNull(std::string &osKey)
+{
+    osKey += '\0';
+}
+
+void OGRGenSQLAppendSortKeyInteger(std::string &osKey, GIntBig nVal)
+{
+    const uint64_t nEncoded =
+        static_cast<uint64_t>(nVal) ^ (static_cast<uint64_t>(1) << 63);
+    osKey += '\1';
+    for (int i = 56; i >= 0; i -= 8)
+        osKey += static_cast<char>((nEncoded >> i) & 0xff);
+}
+
+void OGRGenSQLAppendSortKeyReal(std::string &osKey, double dfVal)
+{
+    if (dfVal == 0)
+        dfVal = 0;  // normalize -0
+    uint64_t nEncoded;
+    memcpy(&nEncoded, &dfVal, sizeof(nEncoded));
+    if (nEncoded >> 63)
+        nEncoded = ~nEncoded;
+    else
+        nEncoded |= static_cast<uint64_t>(1) << 63;
+    osKey += '\1';
+    for (int i = 56; i >= 0; i -= 8)
+        osKey += static_cast<char>((nEncoded >> i) & 0xff);
+}
+
+void OGRGenSQLAppendSortKeyString(std::string &osKey, const char *pszVal)
+{
+    // Strings cannot contain a nul character, so a terminating one gives
+    // strcmp() ordering, including for strings that are prefix of others.
+    osKey += '\1';
+    osKey += pszVal;
+    osKey += '\0';
+}
+
+static void OGRGenSQLAppendSortKeyDate(std::string &osKey,
+                                       const OGRField *psField)
+{
+    // Same ordering as OGRCompareDate(), that ignores TZFlag
+    const uint16_t nYear = static_cast<uint16_t>(
+        static_cast<uint16_t>(psField->Date.Year) ^ 0x8000);
+    osKey += '\1';
+    osKey += static_cast<char>(nYear >> 8);
+    osKey += static_cast<char>(nYear & 0xff);
+    osKey += static_cast<char>(psField->Date.Month);
+    osKey += static_cast<char>(psField->Date.Day);
+    osKey += static_cast<char>(psField->Date.Hour);
+    osKey += static_cast<char>(psField->Date.Minute);
+    float fSecond = psField->Date.Second;
+    if (fSecond == 0)
+        fSecond = 0;  // normalize -0
+    uint32_t nSecond;
+    memcpy(&nSecond, &fSecond, sizeof(nSecond));
+    if (nSecond >> 31)
+        nSecond = ~nSecond;
+    else
+        nSecond |= static_cast<uint32_t>(1) << 31;
+    for (int i = 24; i >= 0; i -= 8)
+        osKey += static_cast<char>((nSecond >> i) & 0xff);
+}
+
+/** Invert the bytes of osKey from nStart, to get a descending ordering. */
+static void OGRGenSQLInvertSortKey(std::string &osKey, size_t nStart)
+{
+    for (size_t i = nStart; i < osKey.size(); ++i)
+        osKey[i] = static_cast<char>(~static_cast<unsigned char>(osKey[i]));
+}
+
+/************************************************************************/
+/*                  OGRGenSQLExternalSorter::RunReader                  */
+/************************************************************************/
+
+/** Buffered reader of the records of a sorted run. */
+class OGRGenSQLExternalSorter::RunReader
+{
+  public:
+    RunReader(OGRGenSQLSpillableBuffer &oRuns, int nIdx, uint64_t nStart,
+              uint64_t nSize, size_t nBlockSize)
+        : m_oRuns(oRuns), m_nIdx(nIdx), m_nFileOffset(nStart),
+          m_nEnd(nStart + nSize), m_nBlockSize(nBlockSize)
+    {
+    }
+
+    bool Next(bool &bError);
+
+    const Record &GetRecord() const
+    {
+        return m_sRecord;
+    }
+
+    int GetIdx() const
+    {
+        return m_nIdx;
+    }
+
+  private:
+    OGRGenSQLSpillableBuffer &m_oRuns;
+    const int m_nIdx;
+    uint64_t m_nFileOffset;
+    const uint64_t m_nEnd;
+    const size_t m_nBlockSize;
+    std::vector<GByte> m_abyBuffer{};
+    size_t m_nBufferPos = 0;
+    size_t m_nBufferSize = 0;
+    Record m_sRecord{};
+
+    bool Ensure(size_t nSize);
+
+    CPL_DISALLOW_COPY_ASSIGN(RunReader)
+};
+
+/** Make sure that at least nSize bytes are available in the buffer from
+ * m_nBufferPos. */
+bool OGRGenSQLExternalSorter::RunReader::Ensure(size_t nSize)
+{
+    if (m_nBufferSize - m_nBufferPos >= nSize)
+        return true;
+
+    if (m_nBufferPos > 0)
+    {
+        memmove(m_abyBuffer.data(), m_abyBuffer.data() + m_nBufferPos,
+                m_nBufferSize - m_nBufferPos);
+        m_nBufferSize -= m_nBufferPos;
+        m_nBufferPos = 0;
+    }
+
+    const size_t nTarget = std::max(nSize, m_nBlockSize);
+    const size_t nToRead = static_cast<size_t>(std::min<uint64_t>(
+        nTarget - m_nBufferSize, m_nEnd - m_nFileOffset));
+    if (m_nBufferSize + nToRead < nSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Truncated sorted run");
+        return false;
+    }
+    if (m_abyBuffer.size() < m_nBufferSize + nToRead)
+        m_abyBuffer.resize(m_nBufferSize + nToRead);
+    if (!m_oRuns.Read(m_nFileOffset, nToRead,
+                      m_abyBuffer.data() + m_nBufferSize))
+    {
+        return false;
+    }
+    m_nFileOffset += nToRead;
+    m_nBufferSize += nToRead;
+    return true;
+}
+
+/** Load the next record of the run. Returns false at end of the run or
+ * in case of error. */
+bool OGRGenSQLExternalSorter::RunReader::Next(bool &bError)
+{
+    if (m_nBufferPos == m_nBufferSize && m_nFileOffset == m_nEnd)
+        return false;
+
+    uint32_t anSizes[2];
+    if (!Ensure(sizeof(anSizes)))
+    {
+        bError = true;
+        return false;
+    }
+    memcpy(anSizes, m_abyBuffer.data() + m_nBufferPos, sizeof(anSizes));
+    const size_t nRecordSize =
+        sizeof(anSizes) + static_cast<size_t>(anSizes[0]) + anSizes[1];
+    if (!Ensure(nRecordSize))
+    {
+        bError = true;
+        return false;
+    }
+    const GByte *pabyRecord = m_abyBuffer.data() + m_nBufferPos;
+    m_sRecord.pabyKey = pabyRecord + sizeof(anSizes);
+    m_sRecord.nKeySize = anSizes[0];
+    m_sRecord.pabyPayload = m_sRecord.pabyKey + anSizes[0];
+    m_sRecord.nPayloadSize = anSizes[1];
+    m_nBufferPos += nRecordSize;
+    return true;
+}
+
+/************************************************************************/
+/*                        OGRGenSQLCompareKeys()                        */
+/************************************************************************/
+
+static int OGRGenSQLCompareKeys(const GByte *pabyKey1, size_t nKeySize1,
+                                const GByte *pabyKey2, size_t nKeySize2)
+{
+    const size_t nMinSize = std::min(nKeySize1, nKeySize2);
+    const int nRet = nMinSize ? memcmp(pabyKey1, pabyKey2, nMinSize) : 0;
+    if (nRet != 0)
+        return nRet;
+    return nKeySize1 < nKeySize2 ? -1 : nKeySize1 > nKeySize2 ? 1 : 0;
+}
+
+/************************************************************************/
+/*                      OGRGenSQLExternalSorter()                       */
+/************************************************************************/
+
+OGRGenSQLExternalSorter::OGRGenSQLExternalSorter(size_t nMaxMemory)
+    : m_nMaxMemory(nMaxMemory)
+{
+}
+
+OGRGenSQLExternalSorter::~OGRGenSQLExternalSorter() = default;
+
+/************************************************************************/
+/*                                Add()                                 */
+/************************************************************************/
+
+bool OGRGenSQLExternalSorter::Add(const void *pKey, size_t nKeySize,
+                                  const void *pPayload, size_t nPayloadSize)
+{
+    CPLAssert(!m_bFinished);
+    if (nKeySize > std::numeric_limits<uint32_t>::max() ||
+        nPayloadSize > std::numeric_limits<uint32_t>::max())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Too large sort record");
+        m_bError = true;
+        return false;
+    }
+
+    if (!m_asEntries.empty() &&
+        m_abyArena.size() + m_asEntries.size() * sizeof(Entry) + nKeySize +
+                nPayloadSize >
+            m_nMaxMemory)
+    {
+        if (!FlushRun())
+            return false;
+    }
+
+    try
+    {
+        Entry sEntry;
+        sEntry.nOffset = m_abyArena.size();
+        sEntry.nKeySize = static_cast<uint32_t>(nKeySize);
+        sEntry.nPayloadSize = static_cast<uint32_t>(nPayloadSize);
+        m_abyArena.insert(m_abyArena.end(), static_cast<const GByte *>(pKey),
+                          static_cast<const GByte *>(pKey) + nKeySize);
+        m_abyArena.insert(m_abyArena.end(),
+                          static_cast<const GByte *>(pPayload),
+                          static_cast<const GByte *>(pPayload) + nPayloadSize);
+        m_asEntries.push_back(sEntry);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "OGRGenSQLExternalSorter::Add(): out of memory");
+        m_bError = true;
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            SortEntries()                             */
+/************************************************************************/
+
+/** Sort m_asEntries. Large arrays are split into slices that are sorted
+ * in parallel, and then merged pairwise, also in parallel. */
+void OGRGenSQLExternalSorter::SortEntries()
+{
+    const GByte *pabyArena = m_abyArena.data();
+    const auto oLess = [pabyArena](const Entry &a, const Entry &b)
+    {
+        return OGRGenSQLCompareKeys(pabyArena + a.nOffset, a.nKeySize,
+                                    pabyArena + b.nOffset, b.nKeySize) < 0;
+    };
+
+    const size_t nMinEntriesPerThread = static_cast<size_t>(std::max(
+        1, atoi(CPLGetConfigOption("OGR_SQL_SORT_MIN_ENTRIES_PER_THREAD",
+                                   "100000"))));
+    const int nThreads = GDALGetNumThreads(nullptr, nullptr, "ALL_CPUS", 128);
+    const size_t nSlices =
+        std::min(static_cast<size_t>(nThreads),
+                 m_asEntries.size() / nMinEntriesPerThread);
+    auto poThreadPool = nSlices > 1 ? GDALGetGlobalThreadPool(nThreads)
+                                    : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    if (!poJobQueue)
+    {
+        std::stable_sort(m_asEntries.begin(), m_asEntries.end(), oLess);
+        return;
+    }
+
+    std::vector<size_t> anBounds;
+    for (size_t i = 0; i <= nSlices; ++i)
+        anBounds.push_back(i * m_asEntries.size() / nSlices);
+    const auto oBegin = m_asEntries.begin();
+    for (size_t i = 0; i < nSlices; ++i)
+    {
+        poJobQueue->SubmitJob(
+            [oBegin, &anBounds, &oLess, i]()
+            {
+                std::stable_sort(oBegin + anBounds[i], oBegin + anBounds[i + 1],
+                                 oLess);
+            });
+    }
+    poJobQueue->WaitCompletion();
+
+    for (size_t nWidth = 1; nWidth < nSlices; nWidth *= 2)
+    {
+        for (size_t i = 0; i + nWidth < nSlices; i += 2 * nWidth)
+        {
+            const size_t iEnd = std::min(i + 2 * nWidth, nSlices);
+            poJobQueue->SubmitJob(
+                [oBegin, &anBounds, &oLess, i, nWidth, iEnd]()
+                {
+                    std::inplace_merge(oBegin + anBounds[i],
+                                       oBegin + anBounds[i + nWidth],
+                                       oBegin + anBounds[iEnd], oLess);
+                });
+        }
+        poJobQueue->WaitCompletion();
+    }
+}
+
+/************************************************************************/
+/*                              FlushRun()                              */
+/************************************************************************/
+
+/** Sort the in-memory records and write them as a run in the temporary
+ * file. */
+bool OGRGenSQLExternalSorter::FlushRun()
+{
+    SortEntries();
+
+    const uint64_t nRunStart = m_oRuns.GetSize();
+    std::vector<GByte> abyChunk;
+    constexpr size_t CHUNK_SIZE = 1024 * 1024;
+    uint64_t nDummy = 0;
+    for (const auto &sEntry : m_asEntries)
+    {
+        const uint32_t anSizes[2] = {sEntry.nKeySize, sEntry.nPayloadSize};
+        const GByte *pabySizes = reinterpret_cast<const GByte *>(anSizes);
+        abyChunk.insert(abyChunk.end(), pabySizes,
+                        pabySizes + sizeof(anSizes));
+        const GByte *pabyRecord = m_abyArena.data() + sEntry.nOffset;
+        abyChunk.insert(abyChunk.end(), pabyRecord,
+                        pabyRecord + sEntry.nKeySize + sEntry.nPayloadSize);
+        if (abyChunk.size() >= CHUNK_SIZE)
+        {
+            if (!m_oRuns.Append(abyChunk.data(), abyChunk.size(), nDummy))
+            {
+                m_bError = true;
+                return false;
+            }
+            abyChunk.clear();
+        }
+    }
+    if (!m_oRuns.Append(abyChunk.data(), abyChunk.size(), nDummy))
+    {
+        m_bError = true;
+        return false;
+    }
+    m_anRuns.emplace_back(nRunStart, m_oRuns.GetSize() - nRunStart);
+
+    m_abyArena.clear();
+    m_asEntries.clear();
+    return true;
+}
+
+/************************************************************************/
+/*                               Finish()                               */
+/************************************************************************/
+
+/** Must be called once all records have been added, and before GetNext().
+ */
+bool OGRGenSQLExternalSorter::Finish()
+{
+    CPLAssert(!m_bFinished);
+    m_bFinished = true;
+    if (m_bError)
+        return false;
+
+    if (m_anRuns.empty())
+    {
+        SortEntries();
+        return true;
+    }
+
+    if (!m_asEntries.empty() && !FlushRun())
+        return false;
+    m_abyArena = std::vector<GByte>();
+    m_asEntries = std::vector<Entry>();
+
+    CPLDebug("GenSQL", "Merging %d sorted runs",
+             static_cast<int>(m_anRuns.size()));
+
+    const size_t nBlockSize = std::max<size_t>(
+        4096, std::min<size_t>(1024 * 1024, m_nMaxMemory / m_anRuns.size()));
+    for (const auto &oRun : m_anRuns)
+    {
+        auto poReader = std::make_unique<RunReader>(
+            m_oRuns, static_cast<int>(m_apoReaders.size()), oRun.first,
+            oRun.second, nBlockSize);
+        if (poReader->Next(m_bError))
+            m_apoHeap.push_back(poReader.get());
+        else if (m_bError)
+            return false;
+        m_apoReaders.push_back(std::move(poReader));
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          ReaderGreater()                             */
+/************************************************************************/
+
+namespace
+{
+// Comparator of run readers for the min-heap of the merge: smallest key
+// first, and then smallest run index to keep the sort stable.
+struct ReaderGreater
+{
+    template <class T> bool operator()(const T *a, const T *b) const
+    {
+        const auto &sA = a->GetRecord();
+        const auto &sB = b->GetRecord();
+        const int nRet = OGRGenSQLCompareKeys(sA.pabyKey, sA.nKeySize,
+                                              sB.pabyKey, sB.nKeySize);
+        if (nRet != 0)
+            return nRet > 0;
+        return a->GetIdx() > b->GetIdx();
+    }
+};
+}  // namespace
+
+/************************************************************************/
+/*                              GetNext()                               */
+/************************************************************************/
+
+/** Return the next record in sorted order. Pointers of the record are
+ * valid until the next call. Returns false at the end of the records or in
+ * case of error (cf HasError()). */
+bool OGRGenSQLExternalSorter::GetNext(Record &sRecord)
+{
+    CPLAssert(m_bFinished);
+    if (m_bError)
+        return false;
+
+    if (m_anRuns.empty())
+    {
+        if (m_nNextEntry == m_asEntries.size())
+            return false;
+        const Entry &sEntry = m_asEntries[m_nNextEntry++];
+        sRecord.pabyKey = m_abyArena.data() + sEntry.nOffset;
+        sRecord.nKeySize = sEntry.nKeySize;
+        sRecord.pabyPayload = sRecord.pabyKey + sEntry.nKeySize;
+        sRecord.nPayloadSize = sEntry.nPayloadSize;
+        return true;
+    }
+
+    // Advance the reader whose record was returned by the previous call
+    if (m_poPendingReader)
+    {
+        if (m_poPendingReader->Next(m_bError))
+        {
+            m_apoHeap.push_back(m_poPendingReader);
+            std::push_heap(m_apoHeap.begin(), m_apoHeap.end(),
+                           ReaderGreater());
+        }
+        m_poPendingReader = nullptr;
+        if (m_bError)
+            return false;
+    }
+    else if (m_nNextEntry == 0)
+    {
+        m_nNextEntry = 1;
+        std::make_heap(m_apoHeap.begin(), m_apoHeap.end(), ReaderGreater());
+    }
+
+    if (m_apoHeap.empty())
+        return false;
+    std::pop_heap(m_apoHeap.begin(), m_apoHeap.end(), ReaderGreater());
+    m_poPendingReader = m_apoHeap.back();
+    m_apoHeap.pop_back();
+    sRecord = m_poPendingReader->GetRecord();
+    return true;
+}
+
+/************************************************************************/
+/*                     OGRGenSQLDistinctAggregator                      */
+/************************************************************************/
+
+/** Collect the distinct values of a column by hash aggregation.
+ *
+ * When the hash table exceeds its memory budget, its content is spilled to
+ * an OGRGenSQLExternalSorter, sorted on the value, and the duplicates
+ * between spills are eliminated when merging the sorted runs. Values are
+ * returned in order of first occurrence, or sorted when requested, with
+ * the same comparison rules as swq_summary::Comparator.
+ */
+class OGRGenSQLDistinctAggregator
+{
+  public:
+    OGRGenSQLDistinctAggregator(swq_field_type eType, bool bSorted,
+                                bool bAscending, bool bKeepValues,
+                                size_t nMaxMemory)
+        : m_eType(eType), m_bSorted(bSorted), m_bAscending(bAscending),
+          m_bKeepValues(bKeepValues), m_nMaxMemory(nMaxMemory),
+          m_oValues(nMaxMemory / 2)
+    {
+    }
+
+    bool Add(const char *pszValue);
+    bool Finish();
+
+    GIntBig GetCount() const
+    {
+        return m_nCount;
+    }
+
+    bool GetValue(GIntBig nIdx, std::string &osValue, bool &bIsNull);
+
+  private:
+    struct Value
+    {
+        GIntBig nSeq = 0;
+        bool bIsNull = false;
+        std::string osValue{};
+    };
+
+    const swq_field_type m_eType;
+    const bool m_bSorted;
+    const bool m_bAscending;
+    const bool m_bKeepValues;
+    const size_t m_nMaxMemory;
+    std::unordered_map<std::string, Value> m_oMap{};
+    size_t m_nMapMemory = 0;
+    GIntBig m_nSeq = 0;
+    std::unique_ptr<OGRGenSQLExternalSorter> m_poSorter{};
+    std::string m_osKey{};
+
+    GIntBig m_nCount = 0;
+    OGRGenSQLSpillableBuffer m_oValues;
+    std::vector<uint64_t> m_anValueOffsets{};
+    std::vector<GByte> m_abyTmp{};
+
+    void BuildKey(const char *pszValue, std::string &osKey) const;
+    bool Spill();
+    bool Emit(bool bIsNull, const char *pszValue, size_t nSize);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLDistinctAggregator)
+};
+
+/************************************************************************/
+/*                              BuildKey()                              */
+/************************************************************************/
+
+void OGRGenSQLDistinctAggregator::BuildKey(const char *pszValue,
+                                           std::string &osKey) const
+{
+    osKey.clear();
+    if (pszValue == nullptr)
+        OGRGenSQLAppendSortKeyNull(osKey);
+    else if (m_eType == SWQ_INTEGER64)
+        OGRGenSQLAppendSortKeyInteger(osKey, CPLAtoGIntBig(pszValue));
+    else if (m_eType == SWQ_FLOAT)
+        OGRGenSQLAppendSortKeyReal(osKey, CPLAtof(pszValue));
+    else
+        OGRGenSQLAppendSortKeyString(osKey, pszValue);
+    if (!m_bAscending)
+        OGRGenSQLInvertSortKey(osKey, 0);
+}
+
+/************************************************************************/
+/*                                Add()                                 */
+/************************************************************************/
+
+/** Add a value, or nullptr for a NULL value. */
+bool OGRGenSQLDistinctAggregator::Add(const char *pszValue)
+{
+    BuildKey(pszValue, m_osKey);
+    try
+    {
+        auto oRes = m_oMap.emplace(m_osKey, Value());
+        if (!oRes.second)
+            return true;
+        Value &sValue = oRes.first->second;
+        sValue.nSeq = m_nSeq++;
+        sValue.bIsNull = pszValue == nullptr;
+        if (pszValue && m_bKeepValues)
+            sValue.osValue = pszValue;
+        // Rough estimate of the size of a node of the hash table
+        m_nMapMemory += 2 * sizeof(std::string) + sizeof(Value) +
+                        4 * sizeof(void *) + m_osKey.size() +
+                        sValue.osValue.size();
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "OGRGenSQLDistinctAggregator::Add(): out of memory");
+        return false;
+    }
+
+    if (m_nMapMemory > m_nMaxMemory / 2)
+        return Spill();
+    return true;
+}
+
+/************************************************************************/
+/*                               Spill()                                */
+/************************************************************************/
+
+/** Move the content of the hash table to the external sorter, with the
+ * sequence number of the value and its string as the payload. */
+bool OGRGenSQLDistinctAggregator::Spill()
+{
+    if (!m_poSorter)
+    {
+        CPLDebug("GenSQL", "Spilling DISTINCT values");
+        m_poSorter =
+            std::make_unique<OGRGenSQLExternalSorter>(m_nMaxMemory / 2);
+    }
+
+    std::string osPayload;
+    for (const auto &oIter : m_oMap)
+    {
+        const Value &sValue = oIter.second;
+        osPayload.assign(reinterpret_cast<const char *>(&sValue.nSeq),
+                         sizeof(sValue.nSeq));
+        osPayload += sValue.bIsNull ? '\1' : '\0';
+        osPayload += sValue.osValue;
+        if (!m_poSorter->Add(oIter.first.data(), oIter.first.size(),
+                             osPayload.data(), osPayload.size()))
+        {
+            return false;
+        }
+    }
+    m_oMap.clear();
+    m_nMapMemory = 0;
+    return true;
+}
+
+/************************************************************************/
+/*                                Emit()                                */
+/************************************************************************/
+
+/** Append a distinct value to the result. */
+bool OGRGenSQLDistinctAggregator::Emit(bool bIsNull, const char *pszValue,
+                                       size_t nSize)
+{
+    ++m_nCount;
+    if (!m_bKeepValues)
+        return true;
+
+    uint64_t nOffset = 0;
+    uint64_t nDummy = 0;
+    const GByte byIsNull = bIsNull ? 1 : 0;
+    if (!m_oValues.Append(&byIsNull, 1, nOffset) ||
+        !m_oValues.Append(reinterpret_cast<const GByte *>(pszValue), nSize,
+                          nDummy))
+    {
+        return false;
+    }
+    try
+    {
+        m_anValueOffsets.push_back(nOffset);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "OGRGenSQLDistinctAggregator::Emit(): out of memory");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Finish()                               */
+/************************************************************************/
+
+/** Must be called once all values have been added. */
+bool OGRGenSQLDistinctAggregator::Finish()
+{
+    if (!m_poSorter)
+    {
+        // Everything fits in RAM: order the hash table entries by key or by
+        // order of first occurrence.
+        std::vector<std::pair<const std::string, Value> *> apoValues;
+        apoValues.reserve(m_oMap.size());
+        for (auto &oIter : m_oMap)
+            apoValues.push_back(&oIter);
+        if (m_bSorted)
+        {
+            std::sort(apoValues.begin(), apoValues.end(),
+                      [](const std::pair<const std::string, Value> *a,
+                         const std::pair<const std::string, Value> *b)
+                      { return a->first < b->first; });
+        }
+        else
+        {
+            std::sort(apoValues.begin(), apoValues.end(),
+                      [](const std::pair<const std::string, Value> *a,
+                         const std::pair<const std::string, Value> *b)
+                      { return a->second.nSeq < b->second.nSeq; });
+        }
+        for (const auto *poValue : apoValues)
+        {
+            if (!Emit(poValue->second.bIsNull, poValue->second.osValue.data(),
+                      poValue->second.osValue.size()))
+            {
+                return false;
+            }
+        }
+        m_oMap.clear();
+        return true;
+    }
+
+    if (!Spill() || !m_poSorter->Finish())
+        return false;
+
+    // Merge sorted spills, keeping the first occurrence of each value, which
+    // comes first since the sort is stable.
+    std::unique_ptr<OGRGenSQLExternalSorter> poSeqSorter;
+    if (!m_bSorted && m_bKeepValues)
+    {
+        poSeqSorter =
+            std::make_unique<OGRGenSQLExternalSorter>(m_nMaxMemory / 2);
+    }
+    std::string osPrevKey;
+    bool bFirst = true;
+    OGRGenSQLExternalSorter::Record sRecord;
+    while (m_poSorter->GetNext(sRecord))
+    {
+        const char *pszKey = reinterpret_cast<const char *>(sRecord.pabyKey);
+        if (!bFirst && osPrevKey.size() == sRecord.nKeySize &&
+            memcmp(osPrevKey.data(), pszKey, sRecord.nKeySize) == 0)
+        {
+            continue;
+        }
+        bFirst = false;
+        osPrevKey.assign(pszKey, sRecord.nKeySize);
+
+        GIntBig nSeq = 0;
+        memcpy(&nSeq, sRecord.pabyPayload, sizeof(nSeq));
+        const bool bIsNull = sRecord.pabyPayload[sizeof(nSeq)] != 0;
+        const char *pszValue = reinterpret_cast<const char *>(
+            sRecord.pabyPayload + sizeof(nSeq) + 1);
+        const size_t nValueSize = sRecord.nPayloadSize - sizeof(nSeq) - 1;
+        if (poSeqSorter)
+        {
+            // Re-sort by order of first occurrence. The sequence number is
+            // encoded in big endian order to be sorted by memcmp().
+            std::string osSeqKey;
+            OGRGenSQLAppendSortKeyInteger(osSeqKey, nSeq);
+            if (!poSeqSorter->Add(osSeqKey.data(), osSeqKey.size(),
+                                  sRecord.pabyPayload + sizeof(nSeq),
+                                  sRecord.nPayloadSize - sizeof(nSeq)))
+            {
+                return false;
+            }
+        }
+        else if (!Emit(bIsNull, pszValue, nValueSize))
+        {
+            return false;
+        }
+    }
+    if (m_poSorter->HasError())
+        return false;
+    m_poSorter.reset();
+
+    if (poSeqSorter)
+    {
+        if (!poSeqSorter->Finish())
+            return false;
+        while (poSeqSorter->GetNext(sRecord))
+        {
+            if (!Emit(sRecord.pabyPayload[0] != 0,
+                      reinterpret_cast<const char *>(sRecord.pabyPayload + 1),
+                      sRecord.nPayloadSize - 1))
+            {
+                return false;
+            }
+        }
+        if (poSeqSorter->HasError())
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                              GetValue()                              */
+/************************************************************************/
+
+bool OGRGenSQLDistinctAggregator::GetValue(GIntBig nIdx, std::string &osValue,
+                                           bool &bIsNull)
+{
+    if (nIdx < 0 || nIdx >= static_cast<GIntBig>(m_anValueOffsets.size()))
+        return false;
+    const size_t nIdxSizeT = static_cast<size_t>(nIdx);
+    const uint64_t nStart = m_anValueOffsets[nIdxSizeT];
+    const uint64_t nEnd = nIdxSizeT + 1 < m_anValueOffsets.size()
+                              ? m_anValueOffsets[nIdxSizeT + 1]
+                              : m_oValues.GetSize();
+    const size_t nSize = static_cast<size_t>(nEnd - nStart);
+    const GByte *pabyData = m_oValues.Get(nStart, nSize, m_abyTmp);
+    if (!pabyData)
+        return false;
+    bIsNull = pabyData[0] != 0;
+    osValue.assign(reinterpret_cast<const char *>(pabyData + 1), nSize - 1);
+    return true;
+}
+
 /************************************************************************/
 /*               OGRGenSQLResultsLayerHasSpecialField()                 */
 /************************************************************************/
@@ -90,6 +1335,7 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
     /*      Identify all the layers involved in the SELECT.                 */
     /* -------------------------------------------------------------------- */
     m_apoTableLayers.reserve(psSelectInfo->table_count);
+    m_apoTableDS.reserve(psSelectInfo->table_count);
 
     for (int iTable = 0; iTable < psSelectInfo->table_count; iTable++)
     {
@@ -115,6 +1361,7 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
             poTableDS = m_apoExtraDS.back().get();
         }
 
+        m_apoTableDS.push_back(poTableDS);
         m_apoTableLayers.push_back(
             poTableDS->GetLayerByName(psTableDef->table_name));
         if (!m_apoTableLayers.back())
@@ -964,6 +2211,65 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
         return TRUE;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      DISTINCT values are collected by hash aggregation, that may     */
+    /*      spill to disk, rather than with the std::set of swq_summary.    */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->query_mode == SWQM_DISTINCT_LIST &&
+        psSelectInfo->order_specs > 0)
+    {
+        const char *pszError = nullptr;
+        if (psSelectInfo->order_specs > 1)
+            pszError = "Can't ORDER BY a DISTINCT list by more than one key.";
+        else if (psSelectInfo->order_defs[0].field_index !=
+                 psSelectInfo->column_defs[0].field_index)
+            pszError = "Only selected DISTINCT field can be used for ORDER BY.";
+        if (pszError)
+        {
+            m_poSummaryFeature.reset();
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", pszError);
+            return false;
+        }
+    }
+
+    m_apoDistinctAggregators.clear();
+    m_apoDistinctAggregators.resize(psSelectInfo->result_columns());
+    const size_t nMaxMemory = OGRGenSQLGetMaxMemory();
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        const swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+        if (!psColDef->distinct_flag)
+            continue;
+        const swq_field_type eType =
+            (psColDef->field_type == SWQ_INTEGER ||
+             psColDef->field_type == SWQ_INTEGER64)
+                ? SWQ_INTEGER64
+            : psColDef->field_type == SWQ_FLOAT ? SWQ_FLOAT
+                                                : SWQ_STRING;
+        const bool bDistinctList =
+            psSelectInfo->query_mode == SWQM_DISTINCT_LIST;
+        const bool bSorted = bDistinctList && psSelectInfo->order_specs > 0;
+        m_apoDistinctAggregators[iField] =
+            std::make_unique<OGRGenSQLDistinctAggregator>(
+                eType, bSorted,
+                !bSorted || psSelectInfo->order_defs[0].ascending_flag,
+                /* bKeepValues = */ bDistinctList, nMaxMemory);
+    }
+
+    const auto Summarize = [this, psSelectInfo](int iField,
+                                                const char *pszValue,
+                                                const double *pdfValue)
+    {
+        auto poAggregator = m_apoDistinctAggregators[iField].get();
+        if (poAggregator)
+        {
+            return poAggregator->Add(pszValue)
+                       ? nullptr
+                       : "Cannot collect DISTINCT values";
+        }
+        return swq_select_summarize(psSelectInfo, iField, pszValue, pdfValue);
+    };
+
     /* -------------------------------------------------------------------- */
     /*      Otherwise, process all source feature through the summary       */
     /*      building facilities of SWQ.                                     */
@@ -980,8 +2286,7 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
             {
                 /* psColDef->field_index can be -1 in the case of a COUNT(*) */
                 if (psColDef->field_index < 0)
-                    pszError =
-                        swq_select_summarize(psSelectInfo, iField, "", nullptr);
+                    pszError = Summarize(iField, "", nullptr);
                 else if (IS_GEOM_FIELD_INDEX(poSrcLayerDefn,
                                              psColDef->field_index))
                 {
@@ -991,23 +2296,20 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
                     const OGRGeometry *poGeom =
                         poSrcFeature->GetGeomFieldRef(iSrcGeomField);
                     if (poGeom != nullptr)
-                        pszError = swq_select_summarize(psSelectInfo, iField,
-                                                        "", nullptr);
+                        pszError = Summarize(iField, "", nullptr);
                 }
                 else if (poSrcFeature->IsFieldSetAndNotNull(
                              psColDef->field_index))
                 {
                     if (!psColDef->distinct_flag)
                     {
-                        pszError = swq_select_summarize(psSelectInfo, iField,
-                                                        "", nullptr);
+                        pszError = Summarize(iField, "", nullptr);
                     }
                     else
                     {
                         const char *pszVal = poSrcFeature->GetFieldAsString(
                             psColDef->field_index);
-                        pszError = swq_select_summarize(psSelectInfo, iField,
-                                                        pszVal, nullptr);
+                        pszError = Summarize(iField, pszVal, nullptr);
                     }
                 }
             }
@@ -1023,21 +2325,18 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
                     {
                         const double dfValue = poSrcFeature->GetFieldAsDouble(
                             psColDef->field_index);
-                        pszError = swq_select_summarize(psSelectInfo, iField,
-                                                        nullptr, &dfValue);
+                        pszError = Summarize(iField, nullptr, &dfValue);
                     }
                     else
                     {
                         const char *pszVal = poSrcFeature->GetFieldAsString(
                             psColDef->field_index);
-                        pszError = swq_select_summarize(psSelectInfo, iField,
-                                                        pszVal, nullptr);
+                        pszError = Summarize(iField, pszVal, nullptr);
                     }
                 }
                 else
                 {
-                    pszError = swq_select_summarize(psSelectInfo, iField,
-                                                    nullptr, nullptr);
+                    pszError = Summarize(iField, nullptr, nullptr);
                 }
             }
 
@@ -1051,6 +2350,22 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
         }
     }
 
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        auto poAggregator = m_apoDistinctAggregators[iField].get();
+        if (!poAggregator)
+            continue;
+        if (!poAggregator->Finish())
+        {
+            m_poSummaryFeature.reset();
+            return false;
+        }
+        if (psSelectInfo->column_summary.empty())
+            psSelectInfo->column_summary.resize(
+                psSelectInfo->column_defs.size());
+        psSelectInfo->column_summary[iField].count = poAggregator->GetCount();
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Clear away the filters we have installed till a next run through*/
     /*      the features.                                                   */
@@ -1470,16 +2785,79 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
         CPLString osExpr =
             poExpr->UnparseOperationFromUnparsedSubExpr(&apszSubExpr[0]);
 
-        /* ----------------------------------------------------------------- */
-        /*      cleanup subexpressions.                                      */
-        /* ----------------------------------------------------------------- */
-        for (int i = 0; i < poExpr->nSubExprCount; i++)
-            CPLFree(apszSubExpr[i]);
+        /* ----------------------------------------------------------------- */
+        /*      cleanup subexpressions.                                      */
+        /* ----------------------------------------------------------------- */
+        for (int i = 0; i < poExpr->nSubExprCount; i++)
+            CPLFree(apszSubExpr[i]);
+
+        return osExpr;
+    }
+
+    return "";
+}
+
+/************************************************************************/
+/*                 OGRGenSQLHasNativeAttributeFilter()                  */
+/************************************************************************/
+
+/** Return whether the driver of the dataset has its own SQL dialect as the
+ * default one (GPKG, SQLite, PostgreSQL, ...), in which case its layers
+ * translate attribute filters to that SQL, that may use indexes that are not
+ * exposed through OGRLayer::GetIndex(). */
+static bool OGRGenSQLHasNativeAttributeFilter(GDALDataset *poDS)
+{
+    GDALDriver *poDriver = poDS->GetDriver();
+    const char *pszDialects =
+        poDriver ? poDriver->GetMetadataItem(GDAL_DMD_SUPPORTED_SQL_DIALECTS)
+                 : nullptr;
+    return pszDialects && !STARTS_WITH_CI(pszDialects, "OGRSQL");
+}
+
+/************************************************************************/
+/*                          PrepareHashJoins()                          */
+/*                                                                      */
+/*      Build, on first use, an in-memory hash table of the features   */
+/*      of each secondary layer involved in an equality join, to avoid  */
+/*      installing an attribute filter on it for each primary feature. */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::PrepareHashJoins()
+{
+    if (m_bHashJoinsPrepared)
+        return;
+    m_bHashJoinsPrepared = true;
 
-        return osExpr;
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    m_apoHashJoins.resize(psSelectInfo->join_count);
+    if (psSelectInfo->join_count == 0 ||
+        !CPLTestBool(CPLGetConfigOption("OGR_SQL_HASH_JOIN", "YES")))
+    {
+        return;
     }
 
-    return "";
+    const size_t nMaxMemory = OGRGenSQLGetMaxMemory();
+    for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
+    {
+        const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+        OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+        // Reading the secondary layer would disturb the iteration of the
+        // primary one in a self join.
+        if (poJoinLayer == m_poSrcLayer)
+            continue;
+        // A per-feature attribute filter is evaluated efficiently by the
+        // driver itself.
+        if (OGRGenSQLHasNativeAttributeFilter(
+                m_apoTableDS[psJoinInfo->secondary_table]))
+        {
+            continue;
+        }
+        auto poHashJoin = OGRGenSQLHashJoin::Create(
+            psJoinInfo, m_poSrcLayer->GetLayerDefn(), poJoinLayer,
+            nMaxMemory);
+        if (poHashJoin && poHashJoin->Build())
+            m_apoHashJoins[iJoin] = std::move(poHashJoin);
+    }
 }
 
 /************************************************************************/
@@ -1501,6 +2879,8 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
     apoFeatures.push_back(std::move(poSrcFeatUniquePtr));
     auto poSrcFeat = apoFeatures.front().get();
 
+    PrepareHashJoins();
+
     /* -------------------------------------------------------------------- */
     /*      Fetch the corresponding features from any jointed tables.       */
     /* -------------------------------------------------------------------- */
@@ -1513,6 +2893,12 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
         /* we have taken care of this */
         CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
 
+        if (m_apoHashJoins[iJoin])
+        {
+            apoFeatures.push_back(m_apoHashJoins[iJoin]->Lookup(poSrcFeat));
+            continue;
+        }
+
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
         const std::string osFilter =
@@ -1869,6 +3255,7 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
             psSelectInfo->limit)
         return nullptr;
 
+    PrepareHashJoins();
     CreateOrderByIndex();
     if (m_anFIDIndex.empty() && m_nIteratedFeatures < 0 &&
         psSelectInfo->offset > 0 && psSelectInfo->query_mode == SWQM_RECORDSET)
@@ -1966,61 +3353,19 @@ OGRFeature *OGRGenSQLResultsLayer::GetFeature(GIntBig nFID)
         if (!PrepareSummary())
             return nullptr;
 
-        if (psSelectInfo->column_summary.empty())
+        OGRGenSQLDistinctAggregator *poAggregator =
+            m_apoDistinctAggregators.empty()
+                ? nullptr
+                : m_apoDistinctAggregators[0].get();
+        std::string osValue;
+        bool bIsNull = false;
+        if (!poAggregator || !poAggregator->GetValue(nFID, osValue, bIsNull))
             return nullptr;
 
-        swq_summary &oSummary = psSelectInfo->column_summary[0];
-        if (psSelectInfo->order_specs == 0)
-        {
-            if (nFID < 0 || nFID >= static_cast<GIntBig>(
-                                        oSummary.oVectorDistinctValues.size()))
-            {
-                return nullptr;
-            }
-            const size_t nIdx = static_cast<size_t>(nFID);
-            if (oSummary.oVectorDistinctValues[nIdx] != SZ_OGR_NULL)
-            {
-                m_poSummaryFeature->SetField(
-                    0, oSummary.oVectorDistinctValues[nIdx].c_str());
-            }
-            else
-                m_poSummaryFeature->SetFieldNull(0);
-        }
+        if (!bIsNull)
+            m_poSummaryFeature->SetField(0, osValue.c_str());
         else
-        {
-            if (m_aosDistinctList.empty())
-            {
-                std::set<CPLString, swq_summary::Comparator>::const_iterator
-                    oIter = oSummary.oSetDistinctValues.begin();
-                std::set<CPLString, swq_summary::Comparator>::const_iterator
-                    oEnd = oSummary.oSetDistinctValues.end();
-                try
-                {
-                    m_aosDistinctList.reserve(
-                        oSummary.oSetDistinctValues.size());
-                    for (; oIter != oEnd; ++oIter)
-                    {
-                        m_aosDistinctList.push_back(*oIter);
-                    }
-                }
-                catch (std::bad_alloc &)
-                {
-                    return nullptr;
-                }
-                oSummary.oSetDistinctValues.clear();
-            }
-
-            if (nFID < 0 ||
-                nFID >= static_cast<GIntBig>(m_aosDistinctList.size()))
-                return nullptr;
-
-            const size_t nIdx = static_cast<size_t>(nFID);
-            if (m_aosDistinctList[nIdx] != SZ_OGR_NULL)
-                m_poSummaryFeature->SetField(0,
-                                             m_aosDistinctList[nIdx].c_str());
-            else
-                m_poSummaryFeature->SetFieldNull(0);
-        }
+            m_poSummaryFeature->SetFieldNull(0);
 
         m_poSummaryFeature->SetFID(nFID);
 
@@ -2075,70 +3420,24 @@ const OGRFeatureDefn *OGRGenSQLResultsLayer::GetLayerDefn() const
 }
 
 /************************************************************************/
-/*                         FreeIndexFields()                            */
+/*                            BuildSortKey()                            */
+/*                                                                      */
+/*      Build the binary sort key of a source feature, according to    */
+/*      the ORDER BY clauses, such that comparing keys with memcmp()    */
+/*      gives the requested order.                                      */
 /************************************************************************/
 
-void OGRGenSQLResultsLayer::FreeIndexFields(OGRField *pasIndexFields,
-                                            size_t l_nIndexSize)
+void OGRGenSQLResultsLayer::BuildSortKey(const OGRFeature *poSrcFeat,
+                                         std::string &osKey) const
 {
-    swq_select *psSelectInfo = m_pSelectInfo.get();
-    const int nOrderItems = psSelectInfo->order_specs;
-
-    /* -------------------------------------------------------------------- */
-    /*      Free the key field values.                                      */
-    /* -------------------------------------------------------------------- */
-    for (int iKey = 0; iKey < nOrderItems; iKey++)
-    {
-        swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
-
-        if (psKeyDef->field_index >= m_iFIDFieldIndex)
-        {
-            CPLAssert(psKeyDef->field_index <
-                      m_iFIDFieldIndex + SPECIAL_FIELD_COUNT);
-            /* warning: only special fields of type string should be deallocated
-             */
-            if (SpecialFieldTypes[psKeyDef->field_index - m_iFIDFieldIndex] ==
-                SWQ_STRING)
-            {
-                for (size_t i = 0; i < l_nIndexSize; i++)
-                {
-                    OGRField *psField = pasIndexFields + iKey + i * nOrderItems;
-                    CPLFree(psField->String);
-                }
-            }
-            continue;
-        }
-
-        OGRFieldDefn *poFDefn =
-            m_poSrcLayer->GetLayerDefn()->GetFieldDefn(psKeyDef->field_index);
-
-        if (poFDefn->GetType() == OFTString)
-        {
-            for (size_t i = 0; i < l_nIndexSize; i++)
-            {
-                OGRField *psField = pasIndexFields + iKey + i * nOrderItems;
-
-                if (!OGR_RawField_IsUnset(psField) &&
-                    !OGR_RawField_IsNull(psField))
-                    CPLFree(psField->String);
-            }
-        }
-    }
-}
-
-/************************************************************************/
-/*                         ReadIndexFields()                            */
-/************************************************************************/
+    const swq_select *psSelectInfo = m_pSelectInfo.get();
+    const OGRFeatureDefn *poSrcDefn = m_poSrcLayer->GetLayerDefn();
 
-void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
-                                            int nOrderItems,
-                                            OGRField *pasIndexFields)
-{
-    swq_select *psSelectInfo = m_pSelectInfo.get();
-    for (int iKey = 0; iKey < nOrderItems; iKey++)
+    osKey.clear();
+    for (int iKey = 0; iKey < psSelectInfo->order_specs; iKey++)
     {
         const swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
-        OGRField *psDstField = pasIndexFields + iKey;
+        const size_t nStart = osKey.size();
 
         if (psKeyDef->field_index >= m_iFIDFieldIndex)
         {
@@ -2149,43 +3448,65 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
             {
                 case SWQ_INTEGER:
                 case SWQ_INTEGER64:
-                    // Yes, store Integer as Integer64.
-                    // This is consistent with the test in Compare()
-                    psDstField->Integer64 =
-                        poSrcFeat->GetFieldAsInteger64(psKeyDef->field_index);
+                    OGRGenSQLAppendSortKeyInteger(
+                        osKey,
+                        poSrcFeat->GetFieldAsInteger64(psKeyDef->field_index));
                     break;
 
                 case SWQ_FLOAT:
-                    psDstField->Real =
-                        poSrcFeat->GetFieldAsDouble(psKeyDef->field_index);
+                    OGRGenSQLAppendSortKeyReal(
+                        osKey,
+                        poSrcFeat->GetFieldAsDouble(psKeyDef->field_index));
                     break;
 
                 default:
-                    psDstField->String = CPLStrdup(
+                    OGRGenSQLAppendSortKeyString(
+                        osKey,
                         poSrcFeat->GetFieldAsString(psKeyDef->field_index));
                     break;
             }
-
-            continue;
         }
+        else if (!poSrcFeat->IsFieldSetAndNotNull(psKeyDef->field_index))
+        {
+            OGRGenSQLAppendSortKeyNull(osKey);
+        }
+        else
+        {
+            const OGRField *psSrcField =
+                poSrcFeat->GetRawFieldRef(psKeyDef->field_index);
+            switch (poSrcDefn->GetFieldDefn(psKeyDef->field_index)->GetType())
+            {
+                case OFTInteger:
+                    OGRGenSQLAppendSortKeyInteger(osKey, psSrcField->Integer);
+                    break;
 
-        OGRFieldDefn *poFDefn =
-            m_poSrcLayer->GetLayerDefn()->GetFieldDefn(psKeyDef->field_index);
+                case OFTInteger64:
+                    OGRGenSQLAppendSortKeyInteger(osKey,
+                                                  psSrcField->Integer64);
+                    break;
 
-        OGRField *psSrcField = poSrcFeat->GetRawFieldRef(psKeyDef->field_index);
+                case OFTReal:
+                    OGRGenSQLAppendSortKeyReal(osKey, psSrcField->Real);
+                    break;
 
-        if (poFDefn->GetType() == OFTInteger ||
-            poFDefn->GetType() == OFTInteger64 ||
-            poFDefn->GetType() == OFTReal || poFDefn->GetType() == OFTDate ||
-            poFDefn->GetType() == OFTTime || poFDefn->GetType() == OFTDateTime)
-            memcpy(psDstField, psSrcField, sizeof(OGRField));
-        else if (poFDefn->GetType() == OFTString)
-        {
-            if (poSrcFeat->IsFieldSetAndNotNull(psKeyDef->field_index))
-                psDstField->String = CPLStrdup(psSrcField->String);
-            else
-                memcpy(psDstField, psSrcField, sizeof(OGRField));
+                case OFTString:
+                    OGRGenSQLAppendSortKeyString(osKey, psSrcField->String);
+                    break;
+
+                case OFTDate:
+                case OFTTime:
+                case OFTDateTime:
+                    OGRGenSQLAppendSortKeyDate(osKey, psSrcField);
+                    break;
+
+                default:
+                    // Other types do not participate to the ordering
+                    break;
+            }
         }
+
+        if (!psKeyDef->ascending_flag)
+            OGRGenSQLInvertSortKey(osKey, nStart);
     }
 }
 
@@ -2197,13 +3518,10 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
 /*      ORDER BY clauses.                                               */
 /*                                                                      */
 /*      This is accomplished by making one pass through all the         */
-/*      eligible source features, and capturing the order by fields     */
-/*      of all records in memory.  A quick sort is then applied to      */
-/*      this in memory copy of the order-by fields to create the        */
-/*      required index.                                                 */
-/*                                                                      */
-/*      Keeping all the key values in memory will *not* scale up to     */
-/*      very large input datasets.                                      */
+/*      eligible source features, and capturing a binary sort key and   */
+/*      the FID of each record. Keys are sorted with an external merge  */
+/*      sort, whose memory usage is bounded by OGR_SQL_MAX_MEMORY.      */
+/*      Only the resulting FID index is kept in memory.                 */
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::CreateOrderByIndex()
@@ -2223,37 +3541,26 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
     ResetReading();
 
+    std::string osKey;
+
     /* -------------------------------------------------------------------- */
     /*      Optimize (memory-wise) ORDER BY ... LIMIT 1 [OFFSET 0] case.    */
     /* -------------------------------------------------------------------- */
     if (psSelectInfo->offset == 0 && psSelectInfo->limit == 1)
     {
-        std::vector<OGRField> asCurrentFields(nOrderItems);
-        std::vector<OGRField> asBestFields(nOrderItems);
-        memset(asCurrentFields.data(), 0, sizeof(OGRField) * nOrderItems);
-        memset(asBestFields.data(), 0, sizeof(OGRField) * nOrderItems);
+        std::string osBestKey;
         bool bFoundSrcFeature = false;
         GIntBig nBestFID = 0;
         for (auto &&poSrcFeat : *m_poSrcLayer)
         {
-            ReadIndexFields(poSrcFeat.get(), nOrderItems,
-                            asCurrentFields.data());
-            if (!bFoundSrcFeature ||
-                Compare(asCurrentFields.data(), asBestFields.data()) < 0)
+            BuildSortKey(poSrcFeat.get(), osKey);
+            if (!bFoundSrcFeature || osKey < osBestKey)
             {
                 bFoundSrcFeature = true;
                 nBestFID = poSrcFeat->GetFID();
-                FreeIndexFields(asBestFields.data(), 1);
-                memcpy(asBestFields.data(), asCurrentFields.data(),
-                       sizeof(OGRField) * nOrderItems);
-            }
-            else
-            {
-                FreeIndexFields(asCurrentFields.data(), 1);
+                std::swap(osKey, osBestKey);
             }
-            memset(asCurrentFields.data(), 0, sizeof(OGRField) * nOrderItems);
         }
-        FreeIndexFields(asBestFields.data(), 1);
 
         if (bFoundSrcFeature)
         {
@@ -2263,99 +3570,44 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         return;
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Allocate set of key values, and the output index.               */
-    /* -------------------------------------------------------------------- */
-    size_t nFeaturesAlloc = 100;
-    size_t nIndexSize = 0;
-    std::vector<OGRField> asIndexFields(nOrderItems * nFeaturesAlloc);
-    memset(asIndexFields.data(), 0,
-           sizeof(OGRField) * nOrderItems * nFeaturesAlloc);
-    std::vector<GIntBig> anFIDList;
-
-    // Frees nIndexSize rows of asIndexFields
-    struct IndexFieldsFreer
-    {
-        OGRGenSQLResultsLayer &m_oLayer;
-        std::vector<OGRField> &m_asIndexFields;
-        size_t &m_nIndexSize;
-
-        IndexFieldsFreer(OGRGenSQLResultsLayer &poLayerIn,
-                         std::vector<OGRField> &asIndexFieldsIn,
-                         size_t &nIndexSizeIn)
-            : m_oLayer(poLayerIn), m_asIndexFields(asIndexFieldsIn),
-              m_nIndexSize(nIndexSizeIn)
-        {
-        }
-
-        ~IndexFieldsFreer()
-        {
-            m_oLayer.FreeIndexFields(m_asIndexFields.data(), m_nIndexSize);
-        }
-
-        IndexFieldsFreer(const IndexFieldsFreer &) = delete;
-        IndexFieldsFreer &operator=(const IndexFieldsFreer &) = delete;
-    };
-
-    IndexFieldsFreer oIndexFieldsFreer(*this, asIndexFields, nIndexSize);
-
     /* -------------------------------------------------------------------- */
     /*      Read in all the key values.                                     */
     /* -------------------------------------------------------------------- */
+    OGRGenSQLExternalSorter oSorter(OGRGenSQLGetMaxMemory());
+    std::string osPrevKey;
+    size_t nIndexSize = 0;
+    bool bAlreadySorted = true;
 
     for (auto &&poSrcFeat : *m_poSrcLayer)
     {
-        if (nIndexSize == nFeaturesAlloc)
-        {
-            const uint64_t nNewFeaturesAlloc64 =
-                static_cast<uint64_t>(nFeaturesAlloc) + nFeaturesAlloc / 3;
-#if SIZEOF_SIZE_T == 4
-            if (static_cast<size_t>(nNewFeaturesAlloc64) !=
-                    nNewFeaturesAlloc64 ||
-                static_cast<size_t>(sizeof(OGRField) * nOrderItems *
-                                    nNewFeaturesAlloc64) !=
-                    static_cast<uint64_t>(sizeof(OGRField)) * nOrderItems *
-                        nNewFeaturesAlloc64)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot allocate pasIndexFields");
-                return;
-            }
-#endif
-            const size_t nNewFeaturesAlloc =
-                static_cast<size_t>(nNewFeaturesAlloc64);
-
-            try
-            {
-                asIndexFields.resize(nOrderItems * nNewFeaturesAlloc);
-                anFIDList.reserve(nNewFeaturesAlloc);
-            }
-            catch (const std::bad_alloc &)
-            {
-                CPLError(CE_Failure, CPLE_OutOfMemory,
-                         "CreateOrderByIndex(): out of memory");
-                return;
-            }
-
-            memset(asIndexFields.data() + nFeaturesAlloc * nOrderItems, 0,
-                   sizeof(OGRField) * nOrderItems *
-                       (nNewFeaturesAlloc - nFeaturesAlloc));
-
-            nFeaturesAlloc = nNewFeaturesAlloc;
+        BuildSortKey(poSrcFeat.get(), osKey);
+        const GIntBig nFID = poSrcFeat->GetFID();
+        if (!oSorter.Add(osKey.data(), osKey.size(), &nFID, sizeof(nFID)))
+        {
+            ResetReading();
+            return;
         }
-
-        ReadIndexFields(poSrcFeat.get(), nOrderItems,
-                        asIndexFields.data() + nIndexSize * nOrderItems);
-
-        anFIDList.push_back(poSrcFeat->GetFID());
-
+        if (bAlreadySorted && nIndexSize > 0 && osKey < osPrevKey)
+            bAlreadySorted = false;
+        std::swap(osKey, osPrevKey);
         nIndexSize++;
     }
 
     // CPLDebug("GenSQL", "CreateOrderByIndex() = %zu features", nIndexSize);
 
+    /* If it is already sorted, then do not build m_anFIDIndex array */
+    /* so that GetNextFeature() can call a sequential GetNextFeature() */
+    /* on the source array. Very useful for layers where random access */
+    /* is slow. */
+    /* Use case: the GML result of a WFS GetFeature with a SORTBY */
+    if (bAlreadySorted)
+    {
+        ResetReading();
+        return;
+    }
+
     /* -------------------------------------------------------------------- */
-    /*      Initialize m_anFIDIndex                                         */
+    /*      Sort the records, and initialize m_anFIDIndex.                  */
     /* -------------------------------------------------------------------- */
     try
     {
@@ -2365,216 +3617,24 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     {
         CPLError(CE_Failure, CPLE_OutOfMemory,
                  "CreateOrderByIndex(): out of memory");
+        ResetReading();
         return;
     }
-    for (size_t i = 0; i < nIndexSize; i++)
-        m_anFIDIndex.push_back(static_cast<GIntBig>(i));
-
-    /* -------------------------------------------------------------------- */
-    /*      Quick sort the records.                                         */
-    /* -------------------------------------------------------------------- */
-
-    GIntBig *panMerged = static_cast<GIntBig *>(
-        VSI_MALLOC_VERBOSE(sizeof(GIntBig) * nIndexSize));
-    if (panMerged == nullptr)
-    {
-        m_anFIDIndex.clear();
-        return;
-    }
-
-    // Note: this merge sort is slightly faster than std::sort()
-    SortIndexSection(asIndexFields.data(), panMerged, 0, nIndexSize);
-    VSIFree(panMerged);
-
-    /* -------------------------------------------------------------------- */
-    /*      Rework the FID map to map to real FIDs.                         */
-    /* -------------------------------------------------------------------- */
-    bool bAlreadySorted = true;
-    for (size_t i = 0; i < nIndexSize; i++)
-    {
-        if (m_anFIDIndex[i] != static_cast<GIntBig>(i))
-            bAlreadySorted = false;
-        m_anFIDIndex[i] = anFIDList[static_cast<size_t>(m_anFIDIndex[i])];
-    }
-
-    /* If it is already sorted, then free than m_anFIDIndex array */
-    /* so that GetNextFeature() can call a sequential GetNextFeature() */
-    /* on the source array. Very useful for layers where random access */
-    /* is slow. */
-    /* Use case: the GML result of a WFS GetFeature with a SORTBY */
-    if (bAlreadySorted)
-    {
-        m_anFIDIndex.clear();
-    }
-
-    ResetReading();
-}
-
-/************************************************************************/
-/*                          SortIndexSection()                          */
-/*                                                                      */
-/*      Sort the records in a section of the index.                     */
-/************************************************************************/
-
-void OGRGenSQLResultsLayer::SortIndexSection(const OGRField *pasIndexFields,
-                                             GIntBig *panMerged, size_t nStart,
-                                             size_t nEntries)
-
-{
-    if (nEntries < 2)
-        return;
-
-    swq_select *psSelectInfo = m_pSelectInfo.get();
-    const int nOrderItems = psSelectInfo->order_specs;
-
-    size_t nFirstGroup = nEntries / 2;
-    size_t nFirstStart = nStart;
-    size_t nSecondGroup = nEntries - nFirstGroup;
-    size_t nSecondStart = nStart + nFirstGroup;
-
-    SortIndexSection(pasIndexFields, panMerged, nFirstStart, nFirstGroup);
-    SortIndexSection(pasIndexFields, panMerged, nSecondStart, nSecondGroup);
-
-    for (size_t iMerge = 0; iMerge < nEntries; ++iMerge)
-    {
-        int nResult = 0;
-
-        if (nFirstGroup == 0)
-            nResult = 1;
-        else if (nSecondGroup == 0)
-            nResult = -1;
-        else
-            nResult = Compare(
-                pasIndexFields + m_anFIDIndex[nFirstStart] * nOrderItems,
-                pasIndexFields + m_anFIDIndex[nSecondStart] * nOrderItems);
-
-        if (nResult > 0)
-        {
-            panMerged[iMerge] = m_anFIDIndex[nSecondStart];
-            nSecondStart++;
-            nSecondGroup--;
-        }
-        else
-        {
-            panMerged[iMerge] = m_anFIDIndex[nFirstStart];
-            nFirstStart++;
-            nFirstGroup--;
-        }
-    }
-
-    /* Copy the merge list back into the main index */
-    memcpy(m_anFIDIndex.data() + nStart, panMerged, sizeof(GIntBig) * nEntries);
-}
-
-/************************************************************************/
-/*                           ComparePrimitive()                         */
-/************************************************************************/
 
-template <class T> static inline int ComparePrimitive(const T &a, const T &b)
-{
-    if (a < b)
-        return -1;
-    if (a > b)
-        return 1;
-    return 0;
-}
-
-/************************************************************************/
-/*                              Compare()                               */
-/************************************************************************/
-
-int OGRGenSQLResultsLayer::Compare(const OGRField *pasFirstTuple,
-                                   const OGRField *pasSecondTuple)
-
-{
-    swq_select *psSelectInfo = m_pSelectInfo.get();
-    int nResult = 0, iKey;
-
-    for (iKey = 0; nResult == 0 && iKey < psSelectInfo->order_specs; iKey++)
+    if (oSorter.Finish())
     {
-        swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
-        OGRFieldDefn *poFDefn = nullptr;
-
-        if (psKeyDef->field_index >= m_iFIDFieldIndex)
-            poFDefn = nullptr;
-        else
-            poFDefn = m_poSrcLayer->GetLayerDefn()->GetFieldDefn(
-                psKeyDef->field_index);
-
-        if (OGR_RawField_IsUnset(&pasFirstTuple[iKey]) ||
-            OGR_RawField_IsNull(&pasFirstTuple[iKey]))
-        {
-            if (OGR_RawField_IsUnset(&pasSecondTuple[iKey]) ||
-                OGR_RawField_IsNull(&pasSecondTuple[iKey]))
-                nResult = 0;
-            else
-                nResult = -1;
-        }
-        else if (OGR_RawField_IsUnset(&pasSecondTuple[iKey]) ||
-                 OGR_RawField_IsNull(&pasSecondTuple[iKey]))
-        {
-            nResult = 1;
-        }
-        else if (poFDefn == nullptr)
-        {
-            CPLAssert(psKeyDef->field_index <
-                      m_iFIDFieldIndex + SPECIAL_FIELD_COUNT);
-            switch (SpecialFieldTypes[psKeyDef->field_index - m_iFIDFieldIndex])
-            {
-                case SWQ_INTEGER:
-                    // Yes, read Integer in Integer64.
-                    // This is consistent with what is done ReadIndexFields()
-                case SWQ_INTEGER64:
-                    nResult = ComparePrimitive(pasFirstTuple[iKey].Integer64,
-                                               pasSecondTuple[iKey].Integer64);
-                    break;
-                case SWQ_FLOAT:
-                    nResult = ComparePrimitive(pasFirstTuple[iKey].Real,
-                                               pasSecondTuple[iKey].Real);
-                    break;
-                case SWQ_STRING:
-                    nResult = strcmp(pasFirstTuple[iKey].String,
-                                     pasSecondTuple[iKey].String);
-                    break;
-
-                default:
-                    CPLAssert(false);
-                    nResult = 0;
-            }
-        }
-        else if (poFDefn->GetType() == OFTInteger)
-        {
-            nResult = ComparePrimitive(pasFirstTuple[iKey].Integer,
-                                       pasSecondTuple[iKey].Integer);
-        }
-        else if (poFDefn->GetType() == OFTInteger64)
-        {
-            nResult = ComparePrimitive(pasFirstTuple[iKey].Integer64,
-                                       pasSecondTuple[iKey].Integer64);
-        }
-        else if (poFDefn->GetType() == OFTString)
-        {
-            nResult =
-                strcmp(pasFirstTuple[iKey].String, pasSecondTuple[iKey].String);
-        }
-        else if (poFDefn->GetType() == OFTReal)
-        {
-            nResult = ComparePrimitive(pasFirstTuple[iKey].Real,
-                                       pasSecondTuple[iKey].Real);
-        }
-        else if (poFDefn->GetType() == OFTDate ||
-                 poFDefn->GetType() == OFTTime ||
-                 poFDefn->GetType() == OFTDateTime)
+        OGRGenSQLExternalSorter::Record sRecord;
+        while (oSorter.GetNext(sRecord))
         {
-            nResult =
-                OGRCompareDate(&pasFirstTuple[iKey], &pasSecondTuple[iKey]);
+            GIntBig nFID = 0;
+            memcpy(&nFID, sRecord.pabyPayload, sizeof(nFID));
+            m_anFIDIndex.push_back(nFID);
         }
-
-        if (!(psKeyDef->ascending_flag))
-            nResult *= -1;
     }
+    if (oSorter.HasError())
+        m_anFIDIndex.clear();
 
-    return nResult;
+    ResetReading();
 }
 
 /************************************************************************/
@@ -19,6 +19,10 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -38,7 +42,121 @@
 /*                        OGRGenSQLResultsLayer                         */
 /************************************************************************/
 
+/************************************************************************/
+/*            Helpers shared with other generic OGR modules             */
+/************************************************************************/
+
+size_t OGRGenSQLGetMaxMemory();
+
+void OGRGenSQLAppendSortKeyInteger(std::string &osKey, GIntBig nVal);
+void OGRGenSQLAppendSortKeyReal(std::string &osKey, double dfVal);
+void OGRGenSQLAppendSortKeyString(std::string &osKey, const char *pszVal);
+
+/************************************************************************/
+/*                     OGRGenSQLSpillableBuffer                         */
+/************************************************************************/
+
+/** Append-only byte store, kept in RAM up to a given size, and spilled to
+ * a temporary file beyond it. */
+class OGRGenSQLSpillableBuffer
+{
+  public:
+    explicit OGRGenSQLSpillableBuffer(size_t nMaxMemory)
+        : m_nMaxMemory(nMaxMemory)
+    {
+    }
+
+    ~OGRGenSQLSpillableBuffer();
+
+    bool Append(const GByte *pabyData, size_t nSize, uint64_t &nOffset);
+    const GByte *Get(uint64_t nOffset, size_t nSize,
+                     std::vector<GByte> &abyTmp);
+    bool Read(uint64_t nOffset, size_t nSize, void *pDst);
+
+    uint64_t GetSize() const
+    {
+        return m_nSize;
+    }
+
+  private:
+    const size_t m_nMaxMemory;
+    std::vector<GByte> m_abyMem{};
+    std::string m_osTmpFilename{};
+    VSILFILE *m_fp = nullptr;
+    bool m_bLastOpIsWrite = true;
+    uint64_t m_nSize = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLSpillableBuffer)
+};
+
+/************************************************************************/
+/*                      OGRGenSQLExternalSorter                         */
+/************************************************************************/
+
+/** Sorter of (key, payload) records by increasing binary key, with bounded
+ * memory usage.
+ *
+ * Records are accumulated in RAM up to a given size, beyond which they are
+ * sorted, using several threads, and written as a sorted run into a
+ * temporary file. Runs are merged while iterating over the result.
+ * Sorting is stable: records with equal keys are returned in insertion
+ * order.
+ */
+class OGRGenSQLExternalSorter
+{
+  public:
+    struct Record
+    {
+        const GByte *pabyKey = nullptr;
+        size_t nKeySize = 0;
+        const GByte *pabyPayload = nullptr;
+        size_t nPayloadSize = 0;
+    };
+
+    explicit OGRGenSQLExternalSorter(size_t nMaxMemory);
+    ~OGRGenSQLExternalSorter();
+
+    bool Add(const void *pKey, size_t nKeySize, const void *pPayload,
+             size_t nPayloadSize);
+    bool Finish();
+    bool GetNext(Record &sRecord);
+
+    bool HasError() const
+    {
+        return m_bError;
+    }
+
+  private:
+    struct Entry
+    {
+        size_t nOffset = 0;
+        uint32_t nKeySize = 0;
+        uint32_t nPayloadSize = 0;
+    };
+
+    class RunReader;
+
+    const size_t m_nMaxMemory;
+    std::vector<GByte> m_abyArena{};
+    std::vector<Entry> m_asEntries{};
+    OGRGenSQLSpillableBuffer m_oRuns{0};
+    std::vector<std::pair<uint64_t, uint64_t>> m_anRuns{};
+    std::vector<std::unique_ptr<RunReader>> m_apoReaders{};
+    std::vector<RunReader *> m_apoHeap{};
+    RunReader *m_poPendingReader = nullptr;
+    size_t m_nNextEntry = 0;
+    bool m_bFinished = false;
+    bool m_bError = false;
+
+    void SortEntries();
+    bool FlushRun();
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLExternalSorter)
+};
+
 class swq_select;
+class OGRGenSQLDistinctAggregator;
+class OGRGenSQLHashJoin;
 
 class OGRGenSQLResultsLayer final : public OGRLayer
 {
@@ -54,6 +172,9 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     // Array of source layers (owned by m_poSrcDS or m_apoExtraDS)
     std::vector<OGRLayer *> m_apoTableLayers{};
 
+    // Array of the datasets of m_apoTableLayers
+    std::vector<GDALDataset *> m_apoTableDS{};
+
     // Array of extra datasets when referencing a table/layer by a dataset name
     std::vector<std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>>
         m_apoExtraDS{};
@@ -71,18 +192,23 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     int m_iFIDFieldIndex = 0;
 
     GIntBig m_nIteratedFeatures = -1;
-    std::vector<std::string> m_aosDistinctList{};
+
+    // DISTINCT values of each column with a distinct_flag (nullptr for
+    // other columns), collected by PrepareSummary()
+    mutable std::vector<std::unique_ptr<OGRGenSQLDistinctAggregator>>
+        m_apoDistinctAggregators{};
+
+    // Hash tables of the secondary layers of equality joins, indexed by
+    // join (nullptr when the attribute filter approach must be used)
+    std::vector<std::unique_ptr<OGRGenSQLHashJoin>> m_apoHashJoins{};
+    bool m_bHashJoinsPrepared = false;
 
     bool PrepareSummary() const;
 
+    void PrepareHashJoins();
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
     void CreateOrderByIndex();
-    void ReadIndexFields(OGRFeature *poSrcFeat, int nOrderItems,
-                         OGRField *pasIndexFields);
-    void SortIndexSection(const OGRField *pasIndexFields, GIntBig *panMerged,
-                          size_t nStart, size_t nEntries);
-    void FreeIndexFields(OGRField *pasIndexFields, size_t l_nIndexSize);
-    int Compare(const OGRField *pasFirst, const OGRField *pasSecond);
+    void BuildSortKey(const OGRFeature *poSrcFeat, std::string &osKey) const;
 
     void ClearFilters();
     void ApplyFiltersToSource();
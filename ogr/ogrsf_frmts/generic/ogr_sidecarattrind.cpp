@@ -0,0 +1,938 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Driver-agnostic attribute indexes stored in sidecar files.
+ * Author:   NextGIS <info at nextgis dot com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, NextGIS <info at nextgis dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "ogr_attrind.h"
+#include "ogr_gensql.h"
+#include "ogr_sidecarindex.h"
+#include "cpl_conv.h"
+#include "cpl_vsi.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+/*
+ * An index of a field of a layer is stored in a
+ * "<source file>.<layer name>.<field name>.ogridx" file, that is a static
+ * two-level B+tree:
+ *
+ * - a header of HEADER_SIZE bytes, with all numbers in little-endian order:
+ *   magic (8 bytes), OGRFieldType of the field (uint32), target page size
+ *   (uint32), size (uint64) and modification time (int64) of the source
+ *   file when the index was built, number of entries (uint64), number of
+ *   pages (uint64), offset (uint64) and size (uint64) of the directory.
+ * - leaf pages of entries sorted by increasing key, each one made of the
+ *   size of the key (uint32), the key, and the FID (int64). A page is
+ *   closed when adding the next entry would exceed the target page size.
+ * - the directory, with the offset (uint64) and size (uint32) of each
+ *   page, followed by the size (uint32) and value of its first key.
+ *
+ * Keys are encoded with the OGRGenSQLAppendSortKeyXXX() functions of the
+ * OGR SQL engine, so that comparing them as bytes gives the order of the
+ * values. Strings are lower-cased, since OGR SQL compares them in a
+ * case-insensitive way. Null values and NaN are not indexed, as they never
+ * match a comparison.
+ *
+ * The index is read-only: it is ignored as soon as the size or modification
+ * time of the source file differs from the ones recorded in its header,
+ * and must then be re-created with CREATE INDEX.
+ */
+
+constexpr char SIDECAR_INDEX_MAGIC[] = "OGRIDX\x01";
+constexpr size_t SIDECAR_INDEX_HEADER_SIZE = 64;
+constexpr uint32_t SIDECAR_INDEX_PAGE_SIZE = 4096;
+constexpr const char *SIDECAR_INDEX_EXTENSION = "ogridx";
+
+/************************************************************************/
+/*                       Little-endian encoding                         */
+/************************************************************************/
+
+static void AppendUInt32(std::string &osBuffer, uint32_t nVal)
+{
+    CPL_LSBPTR32(&nVal);
+    osBuffer.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+}
+
+static void AppendUInt64(std::string &osBuffer, uint64_t nVal)
+{
+    CPL_LSBPTR64(&nVal);
+    osBuffer.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+}
+
+static uint32_t ReadUInt32(const GByte *pabyData)
+{
+    uint32_t nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_LSBPTR32(&nVal);
+    return nVal;
+}
+
+static uint64_t ReadUInt64(const GByte *pabyData)
+{
+    uint64_t nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_LSBPTR64(&nVal);
+    return nVal;
+}
+
+/************************************************************************/
+/*                       OGRSidecarIndexBuildKey()                      */
+/************************************************************************/
+
+static bool OGRSidecarIndexIsSupportedType(OGRFieldType eType)
+{
+    return eType == OFTInteger || eType == OFTInteger64 || eType == OFTReal ||
+           eType == OFTString;
+}
+
+/** Build the key of a value, or return false if it must not be indexed. */
+static bool OGRSidecarIndexBuildKey(OGRFieldType eType, const OGRField *psField,
+                                    std::string &osKey)
+{
+    osKey.clear();
+    if (OGR_RawField_IsNull(psField) || OGR_RawField_IsUnset(psField))
+        return false;
+    switch (eType)
+    {
+        case OFTInteger:
+            OGRGenSQLAppendSortKeyInteger(osKey, psField->Integer);
+            return true;
+
+        case OFTInteger64:
+            OGRGenSQLAppendSortKeyInteger(osKey, psField->Integer64);
+            return true;
+
+        case OFTReal:
+            if (std::isnan(psField->Real))
+                return false;
+            OGRGenSQLAppendSortKeyReal(osKey, psField->Real);
+            return true;
+
+        case OFTString:
+        {
+            if (psField->String == nullptr)
+                return false;
+            std::string osLower(psField->String);
+            for (char &ch : osLower)
+            {
+                if (ch >= 'A' && ch <= 'Z')
+                    ch = static_cast<char>(ch - 'A' + 'a');
+            }
+            OGRGenSQLAppendSortKeyString(osKey, osLower.c_str());
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                         OGRSidecarAttrIndex                          */
+/*                                                                      */
+/*      Access to the index of one field, opened from its file.         */
+/************************************************************************/
+
+class OGRSidecarAttrIndex final : public OGRAttrIndex
+{
+  public:
+    OGRSidecarAttrIndex(OGRFieldType eType, VSILFILE *fp)
+        : m_eType(eType), m_fp(fp)
+    {
+    }
+
+    ~OGRSidecarAttrIndex() override;
+
+    static std::unique_ptr<OGRSidecarAttrIndex>
+    Open(const std::string &osFilename, OGRFieldType eType,
+         const OGRSidecarIndexSignature &sSignature);
+
+    GIntBig GetFirstMatch(OGRField *psKey) override;
+    GIntBig *GetAllMatches(OGRField *psKey) override;
+    GIntBig *GetAllMatches(OGRField *psKey, GIntBig *panFIDList, int *nFIDCount,
+                           int *nLength) override;
+
+    OGRErr AddEntry(OGRField *psKey, GIntBig nFID) override;
+    OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) override;
+
+    OGRErr Clear() override;
+
+    bool SupportsRangeQueries() const override;
+    GIntBig *GetRangeMatches(const OGRField *psMin, bool bMinIncluded,
+                             const OGRField *psMax, bool bMaxIncluded,
+                             GIntBig *pnFIDCount) override;
+
+    bool IsUpToDate(OGRFieldType eType,
+                    const OGRSidecarIndexSignature &sSignature) const
+    {
+        return eType == m_eType && sSignature == m_sSignature;
+    }
+
+  private:
+    struct Page
+    {
+        uint64_t nOffset = 0;
+        uint32_t nSize = 0;
+        std::string osFirstKey{};
+    };
+
+    const OGRFieldType m_eType;
+    VSILFILE *const m_fp;
+    OGRSidecarIndexSignature m_sSignature{};
+    std::vector<Page> m_asPages{};
+    std::vector<GByte> m_abyPage{};
+
+    bool Scan(const std::string *posMin, bool bMinIncluded,
+              const std::string *posMax, bool bMaxIncluded,
+              std::vector<GIntBig> &anFIDs, size_t nMaxCount = 0);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRSidecarAttrIndex)
+};
+
+/************************************************************************/
+/*                        ~OGRSidecarAttrIndex()                        */
+/************************************************************************/
+
+OGRSidecarAttrIndex::~OGRSidecarAttrIndex()
+{
+    VSIFCloseL(m_fp);
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+/** Open the index of a field, and return nullptr if it does not exist, is
+ * corrupted or out of date. */
+std::unique_ptr<OGRSidecarAttrIndex>
+OGRSidecarAttrIndex::Open(const std::string &osFilename, OGRFieldType eType,
+                          const OGRSidecarIndexSignature &sSignature)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+        return nullptr;
+
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return nullptr;
+    auto poIndex = std::make_unique<OGRSidecarAttrIndex>(eType, fp);
+
+    GByte abyHeader[SIDECAR_INDEX_HEADER_SIZE];
+    if (VSIFReadL(abyHeader, sizeof(abyHeader), 1, fp) != 1 ||
+        memcmp(abyHeader, SIDECAR_INDEX_MAGIC, sizeof(SIDECAR_INDEX_MAGIC)) !=
+            0)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined, "%s is not a valid index",
+                 osFilename.c_str());
+        return nullptr;
+    }
+
+    const uint32_t nFieldType = ReadUInt32(abyHeader + 8);
+    const uint64_t nSourceSize = ReadUInt64(abyHeader + 16);
+    const uint64_t nSourceMTime = ReadUInt64(abyHeader + 24);
+    const uint64_t nPageCount = ReadUInt64(abyHeader + 40);
+    const uint64_t nDirOffset = ReadUInt64(abyHeader + 48);
+    const uint64_t nDirSize = ReadUInt64(abyHeader + 56);
+    if (nFieldType != static_cast<uint32_t>(eType))
+    {
+        CPLDebug("OGR", "Ignoring %s, built for another field type",
+                 osFilename.c_str());
+        return nullptr;
+    }
+    poIndex->m_sSignature.nSize = nSourceSize;
+    poIndex->m_sSignature.nMTime = nSourceMTime;
+    if (!poIndex->IsUpToDate(eType, sSignature))
+    {
+        CPLDebug("OGR",
+                 "Ignoring %s, as the indexed file has been modified since "
+                 "it was built",
+                 osFilename.c_str());
+        return nullptr;
+    }
+
+    const uint64_t nFileSize = static_cast<uint64_t>(sStat.st_size);
+    if (nDirOffset > nFileSize || nDirSize > nFileSize - nDirOffset ||
+        nPageCount > nDirSize / (sizeof(uint64_t) + 2 * sizeof(uint32_t)))
+    {
+        CPLError(CE_Warning, CPLE_AppDefined, "%s is corrupted",
+                 osFilename.c_str());
+        return nullptr;
+    }
+
+    std::vector<GByte> abyDir;
+    try
+    {
+        abyDir.resize(static_cast<size_t>(nDirSize));
+        poIndex->m_asPages.resize(static_cast<size_t>(nPageCount));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate directory of %s", osFilename.c_str());
+        return nullptr;
+    }
+    if (!abyDir.empty() &&
+        (VSIFSeekL(fp, nDirOffset, SEEK_SET) != 0 ||
+         VSIFReadL(abyDir.data(), abyDir.size(), 1, fp) != 1))
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Cannot read directory of %s",
+                 osFilename.c_str());
+        return nullptr;
+    }
+
+    size_t nPos = 0;
+    for (auto &sPage : poIndex->m_asPages)
+    {
+        constexpr size_t PAGE_HEADER_SIZE =
+            sizeof(uint64_t) + 2 * sizeof(uint32_t);
+        if (abyDir.size() - nPos < PAGE_HEADER_SIZE)
+            break;
+        sPage.nOffset = ReadUInt64(abyDir.data() + nPos);
+        sPage.nSize = ReadUInt32(abyDir.data() + nPos + 8);
+        const uint32_t nKeySize = ReadUInt32(abyDir.data() + nPos + 12);
+        nPos += PAGE_HEADER_SIZE;
+        if (sPage.nOffset > nDirOffset ||
+            sPage.nSize > nDirOffset - sPage.nOffset ||
+            nKeySize > abyDir.size() - nPos)
+        {
+            nPos = abyDir.size() + 1;
+            break;
+        }
+        sPage.osFirstKey.assign(
+            reinterpret_cast<const char *>(abyDir.data() + nPos), nKeySize);
+        nPos += nKeySize;
+    }
+    if (nPos != abyDir.size())
+    {
+        CPLError(CE_Warning, CPLE_AppDefined, "%s is corrupted",
+                 osFilename.c_str());
+        return nullptr;
+    }
+
+    return poIndex;
+}
+
+/************************************************************************/
+/*                                Scan()                                */
+/************************************************************************/
+
+/** Append to anFIDs the FIDs of the entries whose key is in a range, that
+ * is unbounded on a side if posMin or posMax is nullptr. */
+bool OGRSidecarAttrIndex::Scan(const std::string *posMin, bool bMinIncluded,
+                               const std::string *posMax, bool bMaxIncluded,
+                               std::vector<GIntBig> &anFIDs, size_t nMaxCount)
+{
+    // Start from the last page whose first key is lower than the minimum,
+    // since entries equal to it may precede the first page that starts
+    // with it.
+    size_t iPage = 0;
+    if (posMin)
+    {
+        const auto oIter = std::lower_bound(
+            m_asPages.begin(), m_asPages.end(), *posMin,
+            [](const Page &sPage, const std::string &osKey)
+            { return sPage.osFirstKey < osKey; });
+        iPage = static_cast<size_t>(oIter - m_asPages.begin());
+        if (iPage > 0)
+            --iPage;
+    }
+
+    for (; iPage < m_asPages.size(); ++iPage)
+    {
+        const Page &sPage = m_asPages[iPage];
+        if (posMax)
+        {
+            const int nCmp = sPage.osFirstKey.compare(*posMax);
+            if (nCmp > 0 || (nCmp == 0 && !bMaxIncluded))
+                break;
+        }
+
+        m_abyPage.resize(sPage.nSize);
+        if (VSIFSeekL(m_fp, sPage.nOffset, SEEK_SET) != 0 ||
+            (sPage.nSize &&
+             VSIFReadL(m_abyPage.data(), sPage.nSize, 1, m_fp) != 1))
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot read index page");
+            return false;
+        }
+
+        size_t nPos = 0;
+        while (nPos < m_abyPage.size())
+        {
+            if (m_abyPage.size() - nPos < sizeof(uint32_t))
+                break;
+            const uint32_t nKeySize = ReadUInt32(m_abyPage.data() + nPos);
+            nPos += sizeof(uint32_t);
+            if (nKeySize > m_abyPage.size() - nPos ||
+                m_abyPage.size() - nPos - nKeySize < sizeof(uint64_t))
+            {
+                nPos = m_abyPage.size() + 1;
+                break;
+            }
+            const std::string_view osKey(
+                reinterpret_cast<const char *>(m_abyPage.data() + nPos),
+                nKeySize);
+            nPos += nKeySize;
+            const GIntBig nFID =
+                static_cast<GIntBig>(ReadUInt64(m_abyPage.data() + nPos));
+            nPos += sizeof(uint64_t);
+
+            if (posMin)
+            {
+                const int nCmp = osKey.compare(*posMin);
+                if (nCmp < 0 || (nCmp == 0 && !bMinIncluded))
+                    continue;
+            }
+            if (posMax)
+            {
+                const int nCmp = osKey.compare(*posMax);
+                if (nCmp > 0 || (nCmp == 0 && !bMaxIncluded))
+                    return true;
+            }
+            anFIDs.push_back(nFID);
+            if (anFIDs.size() == nMaxCount)
+                return true;
+        }
+        if (nPos != m_abyPage.size())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Corrupted index page");
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           GetFirstMatch()                            */
+/************************************************************************/
+
+GIntBig OGRSidecarAttrIndex::GetFirstMatch(OGRField *psKey)
+{
+    std::string osKey;
+    if (!OGRSidecarIndexBuildKey(m_eType, psKey, osKey))
+        return OGRNullFID;
+    std::vector<GIntBig> anFIDs;
+    if (!Scan(&osKey, true, &osKey, true, anFIDs, 1) || anFIDs.empty())
+        return OGRNullFID;
+    return anFIDs[0];
+}
+
+/************************************************************************/
+/*                           GetAllMatches()                            */
+/************************************************************************/
+
+GIntBig *OGRSidecarAttrIndex::GetAllMatches(OGRField *psKey)
+{
+    int nFIDCount = 0;
+    int nLength = 0;
+    return GetAllMatches(psKey, nullptr, &nFIDCount, &nLength);
+}
+
+GIntBig *OGRSidecarAttrIndex::GetAllMatches(OGRField *psKey,
+                                            GIntBig *panFIDList,
+                                            int *nFIDCount, int *nLength)
+{
+    if (panFIDList == nullptr)
+    {
+        panFIDList = static_cast<GIntBig *>(CPLMalloc(sizeof(GIntBig) * 2));
+        *nFIDCount = 0;
+        *nLength = 2;
+    }
+
+    std::string osKey;
+    std::vector<GIntBig> anFIDs;
+    if (OGRSidecarIndexBuildKey(m_eType, psKey, osKey))
+        Scan(&osKey, true, &osKey, true, anFIDs);
+
+    for (const GIntBig nFID : anFIDs)
+    {
+        if (*nFIDCount >= *nLength - 1)
+        {
+            *nLength = *nLength * 2 + 10;
+            panFIDList = static_cast<GIntBig *>(
+                CPLRealloc(panFIDList, sizeof(GIntBig) * *nLength));
+        }
+        panFIDList[(*nFIDCount)++] = nFID;
+    }
+    panFIDList[*nFIDCount] = OGRNullFID;
+
+    return panFIDList;
+}
+
+/************************************************************************/
+/*                       SupportsRangeQueries()                         */
+/************************************************************************/
+
+bool OGRSidecarAttrIndex::SupportsRangeQueries() const
+{
+    return true;
+}
+
+/************************************************************************/
+/*                          GetRangeMatches()                           */
+/************************************************************************/
+
+GIntBig *OGRSidecarAttrIndex::GetRangeMatches(const OGRField *psMin,
+                                              bool bMinIncluded,
+                                              const OGRField *psMax,
+                                              bool bMaxIncluded,
+                                              GIntBig *pnFIDCount)
+{
+    std::string osMin;
+    std::string osMax;
+    if ((psMin && !OGRSidecarIndexBuildKey(m_eType, psMin, osMin)) ||
+        (psMax && !OGRSidecarIndexBuildKey(m_eType, psMax, osMax)))
+    {
+        return nullptr;
+    }
+
+    std::vector<GIntBig> anFIDs;
+    if (!Scan(psMin ? &osMin : nullptr, bMinIncluded,
+              psMax ? &osMax : nullptr, bMaxIncluded, anFIDs))
+    {
+        return nullptr;
+    }
+
+    GIntBig *panFIDList = static_cast<GIntBig *>(
+        VSI_MALLOC2_VERBOSE(anFIDs.size() + 1, sizeof(GIntBig)));
+    if (panFIDList == nullptr)
+        return nullptr;
+    if (!anFIDs.empty())
+        memcpy(panFIDList, anFIDs.data(), anFIDs.size() * sizeof(GIntBig));
+    panFIDList[anFIDs.size()] = OGRNullFID;
+    *pnFIDCount = static_cast<GIntBig>(anFIDs.size());
+    return panFIDList;
+}
+
+/************************************************************************/
+/*                    AddEntry() / RemoveEntry()                        */
+/************************************************************************/
+
+OGRErr OGRSidecarAttrIndex::AddEntry(OGRField *, GIntBig)
+{
+    return OGRERR_UNSUPPORTED_OPERATION;
+}
+
+OGRErr OGRSidecarAttrIndex::RemoveEntry(OGRField *, GIntBig)
+{
+    return OGRERR_UNSUPPORTED_OPERATION;
+}
+
+/************************************************************************/
+/*                               Clear()                                */
+/************************************************************************/
+
+OGRErr OGRSidecarAttrIndex::Clear()
+{
+    return OGRERR_UNSUPPORTED_OPERATION;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                      OGRSidecarLayerAttrIndex                        */
+/* ==================================================================== */
+/************************************************************************/
+
+class OGRSidecarLayerAttrIndex final : public OGRLayerAttrIndex
+{
+  public:
+    OGRSidecarLayerAttrIndex() = default;
+    ~OGRSidecarLayerAttrIndex() override;
+
+    OGRErr Initialize(const char *pszIndexPath, OGRLayer *) override;
+
+    OGRErr CreateIndex(int iField) override;
+    OGRErr DropIndex(int iField) override;
+    OGRErr IndexAllFeatures(int iField = -1) override;
+
+    OGRErr AddToIndex(OGRFeature *poFeature, int iField = -1) override;
+    OGRErr RemoveFromIndex(OGRFeature *poFeature) override;
+
+    OGRAttrIndex *GetFieldIndex(int iField) override;
+
+  private:
+    //! Indexes opened by GetFieldIndex(), by field name.
+    std::map<std::string, std::unique_ptr<OGRSidecarAttrIndex>> m_oMapIndexes{};
+    //! Fields passed to CreateIndex() and not yet indexed.
+    std::set<int> m_oSetPendingFields{};
+
+    std::string GetIndexFilename(int iField) const;
+    bool IsIndexableField(int iField, bool bEmitError) const;
+    OGRErr BuildIndexes(const std::vector<int> &anFields);
+};
+
+/************************************************************************/
+/*                     ~OGRSidecarLayerAttrIndex()                      */
+/************************************************************************/
+
+OGRSidecarLayerAttrIndex::~OGRSidecarLayerAttrIndex() = default;
+
+/************************************************************************/
+/*                             Initialize()                             */
+/************************************************************************/
+
+OGRErr OGRSidecarLayerAttrIndex::Initialize(const char *pszIndexPathIn,
+                                            OGRLayer *poLayerIn)
+{
+    if (pszIndexPathIn == nullptr || pszIndexPathIn[0] == '\0')
+        return OGRERR_FAILURE;
+
+    poLayer = poLayerIn;
+    CPLFree(pszIndexPath);
+    pszIndexPath = CPLStrdup(pszIndexPathIn);
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          GetIndexFilename()                          */
+/************************************************************************/
+
+std::string OGRSidecarLayerAttrIndex::GetIndexFilename(int iField) const
+{
+    return OGRSidecarIndexGetFilename(
+        pszIndexPath, poLayer->GetName(),
+        poLayer->GetLayerDefn()->GetFieldDefn(iField)->GetNameRef(),
+        SIDECAR_INDEX_EXTENSION);
+}
+
+/************************************************************************/
+/*                          IsIndexableField()                          */
+/************************************************************************/
+
+bool OGRSidecarLayerAttrIndex::IsIndexableField(int iField,
+                                                bool bEmitError) const
+{
+    const OGRFeatureDefn *poDefn = poLayer->GetLayerDefn();
+    if (iField < 0 || iField >= poDefn->GetFieldCount())
+    {
+        if (bEmitError)
+            CPLError(CE_Failure, CPLE_AppDefined, "Invalid field index");
+        return false;
+    }
+    const OGRFieldDefn *poFieldDefn = poDefn->GetFieldDefn(iField);
+    if (!OGRSidecarIndexIsSupportedType(poFieldDefn->GetType()))
+    {
+        if (bEmitError)
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Indexing field %s of type %s is not supported",
+                     poFieldDefn->GetNameRef(),
+                     OGRFieldDefn::GetFieldTypeName(poFieldDefn->GetType()));
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            CreateIndex()                             */
+/*                                                                      */
+/*      The index is actually built by IndexAllFeatures().              */
+/************************************************************************/
+
+OGRErr OGRSidecarLayerAttrIndex::CreateIndex(int iField)
+{
+    if (!IsIndexableField(iField, true))
+        return OGRERR_FAILURE;
+    m_oSetPendingFields.insert(iField);
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                             DropIndex()                              */
+/************************************************************************/
+
+OGRErr OGRSidecarLayerAttrIndex::DropIndex(int iField)
+{
+    if (iField < 0 || iField >= poLayer->GetLayerDefn()->GetFieldCount())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid field index");
+        return OGRERR_FAILURE;
+    }
+    m_oSetPendingFields.erase(iField);
+    m_oMapIndexes.erase(
+        poLayer->GetLayerDefn()->GetFieldDefn(iField)->GetNameRef());
+
+    const std::string osFilename = GetIndexFilename(iField);
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "DROP INDEX on field (%s) that doesn't have an index.",
+                 poLayer->GetLayerDefn()->GetFieldDefn(iField)->GetNameRef());
+        return OGRERR_FAILURE;
+    }
+    if (VSIUnlink(osFilename.c_str()) != 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot delete %s",
+                 osFilename.c_str());
+        return OGRERR_FAILURE;
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          IndexAllFeatures()                          */
+/************************************************************************/
+
+OGRErr OGRSidecarLayerAttrIndex::IndexAllFeatures(int iField)
+{
+    std::vector<int> anFields;
+    if (iField >= 0)
+    {
+        if (!IsIndexableField(iField, true))
+            return OGRERR_FAILURE;
+        anFields.push_back(iField);
+    }
+    else
+    {
+        for (const int iPendingField : m_oSetPendingFields)
+        {
+            if (IsIndexableField(iPendingField, false))
+                anFields.push_back(iPendingField);
+        }
+    }
+    if (anFields.empty())
+        return OGRERR_NONE;
+
+    // Index all features, whatever the current filters
+    OGRErr eErr;
+    {
+        OGRSidecarIndexLayerFiltersSaver oFiltersSaver(poLayer);
+        eErr = BuildIndexes(anFields);
+    }
+
+    if (eErr == OGRERR_NONE)
+    {
+        for (const int iIndexedField : anFields)
+            m_oSetPendingFields.erase(iIndexedField);
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                            BuildIndexes()                            */
+/************************************************************************/
+
+/** Build the index files of several fields, with a single pass over the
+ * features, whose (key, FID) pairs are sorted with an external sorter. */
+OGRErr
+OGRSidecarLayerAttrIndex::BuildIndexes(const std::vector<int> &anFields)
+{
+    const OGRFeatureDefn *poDefn = poLayer->GetLayerDefn();
+    const size_t nMaxMemoryPerField =
+        std::max<size_t>(1, OGRGenSQLGetMaxMemory() / anFields.size());
+    std::vector<std::unique_ptr<OGRGenSQLExternalSorter>> apoSorters;
+    for (size_t i = 0; i < anFields.size(); ++i)
+    {
+        apoSorters.push_back(
+            std::make_unique<OGRGenSQLExternalSorter>(nMaxMemoryPerField));
+        m_oMapIndexes.erase(poDefn->GetFieldDefn(anFields[i])->GetNameRef());
+    }
+
+    std::string osKey;
+    poLayer->ResetReading();
+    for (auto &&poFeature : *poLayer)
+    {
+        const GIntBig nFID = poFeature->GetFID();
+        for (size_t i = 0; i < anFields.size(); ++i)
+        {
+            const int iField = anFields[i];
+            if (OGRSidecarIndexBuildKey(
+                    poDefn->GetFieldDefn(iField)->GetType(),
+                    poFeature->GetRawFieldRef(iField), osKey) &&
+                !apoSorters[i]->Add(osKey.data(), osKey.size(), &nFID,
+                                    sizeof(nFID)))
+            {
+                return OGRERR_FAILURE;
+            }
+        }
+    }
+
+    // The signature of the source is taken once it has been fully read, in
+    // case reading it updates it.
+    OGRSidecarIndexSignature sSignature;
+    if (!OGRSidecarIndexSignature::Get(pszIndexPath, sSignature))
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot stat %s", pszIndexPath);
+        return OGRERR_FAILURE;
+    }
+
+    for (size_t i = 0; i < anFields.size(); ++i)
+    {
+        auto &poSorter = apoSorters[i];
+        if (!poSorter->Finish())
+            return OGRERR_FAILURE;
+
+        const std::string osFilename = GetIndexFilename(anFields[i]);
+        const std::string osTmpFilename = osFilename + ".tmp";
+        VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+        if (fp == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     osTmpFilename.c_str());
+            return OGRERR_FAILURE;
+        }
+
+        bool bOK = VSIFSeekL(fp, SIDECAR_INDEX_HEADER_SIZE, SEEK_SET) == 0;
+        uint64_t nOffset = SIDECAR_INDEX_HEADER_SIZE;
+        uint64_t nEntryCount = 0;
+        uint64_t nPageCount = 0;
+        std::string osPage;
+        std::string osFirstKey;
+        std::string osDir;
+        const auto FlushPage = [&]()
+        {
+            AppendUInt64(osDir, nOffset);
+            AppendUInt32(osDir, static_cast<uint32_t>(osPage.size()));
+            AppendUInt32(osDir, static_cast<uint32_t>(osFirstKey.size()));
+            osDir += osFirstKey;
+            ++nPageCount;
+            bOK = bOK && VSIFWriteL(osPage.data(), osPage.size(), 1, fp) == 1;
+            nOffset += osPage.size();
+            osPage.clear();
+        };
+
+        OGRGenSQLExternalSorter::Record sRecord;
+        while (bOK && poSorter->GetNext(sRecord))
+        {
+            GIntBig nFID;
+            CPLAssert(sRecord.nPayloadSize == sizeof(nFID));
+            memcpy(&nFID, sRecord.pabyPayload, sizeof(nFID));
+            const size_t nEntrySize =
+                sizeof(uint32_t) + sRecord.nKeySize + sizeof(uint64_t);
+            if (!osPage.empty() &&
+                osPage.size() + nEntrySize > SIDECAR_INDEX_PAGE_SIZE)
+            {
+                FlushPage();
+            }
+            if (osPage.empty())
+            {
+                osFirstKey.assign(
+                    reinterpret_cast<const char *>(sRecord.pabyKey),
+                    sRecord.nKeySize);
+            }
+            AppendUInt32(osPage, static_cast<uint32_t>(sRecord.nKeySize));
+            osPage.append(reinterpret_cast<const char *>(sRecord.pabyKey),
+                          sRecord.nKeySize);
+            AppendUInt64(osPage, static_cast<uint64_t>(nFID));
+            ++nEntryCount;
+        }
+        if (!osPage.empty())
+            FlushPage();
+        bOK = bOK && !poSorter->HasError();
+        poSorter.reset();
+
+        std::string osHeader(SIDECAR_INDEX_MAGIC, sizeof(SIDECAR_INDEX_MAGIC));
+        const OGRFieldType eType = poDefn->GetFieldDefn(anFields[i])->GetType();
+        AppendUInt32(osHeader, static_cast<uint32_t>(eType));
+        AppendUInt32(osHeader, SIDECAR_INDEX_PAGE_SIZE);
+        AppendUInt64(osHeader, sSignature.nSize);
+        AppendUInt64(osHeader, sSignature.nMTime);
+        AppendUInt64(osHeader, nEntryCount);
+        AppendUInt64(osHeader, nPageCount);
+        AppendUInt64(osHeader, nOffset);
+        AppendUInt64(osHeader, osDir.size());
+        CPLAssert(osHeader.size() == SIDECAR_INDEX_HEADER_SIZE);
+
+        bOK = bOK && (osDir.empty() ||
+                      VSIFWriteL(osDir.data(), osDir.size(), 1, fp) == 1);
+        bOK = bOK && VSIFSeekL(fp, 0, SEEK_SET) == 0 &&
+              VSIFWriteL(osHeader.data(), osHeader.size(), 1, fp) == 1;
+        bOK = VSIFCloseL(fp) == 0 && bOK;
+        if (bOK)
+        {
+            VSIUnlink(osFilename.c_str());
+            bOK = VSIRename(osTmpFilename.c_str(), osFilename.c_str()) == 0;
+        }
+        if (!bOK)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot write %s",
+                     osFilename.c_str());
+            VSIUnlink(osTmpFilename.c_str());
+            return OGRERR_FAILURE;
+        }
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                     AddToIndex() / RemoveFromIndex()                 */
+/*                                                                      */
+/*      Modifications of the source file make the indexes out of date, */
+/*      so we just close them.                                          */
+/************************************************************************/
+
+OGRErr OGRSidecarLayerAttrIndex::AddToIndex(OGRFeature *, int)
+{
+    m_oMapIndexes.clear();
+    return OGRERR_NONE;
+}
+
+OGRErr OGRSidecarLayerAttrIndex::RemoveFromIndex(OGRFeature *)
+{
+    m_oMapIndexes.clear();
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                           GetFieldIndex()                            */
+/************************************************************************/
+
+OGRAttrIndex *OGRSidecarLayerAttrIndex::GetFieldIndex(int iField)
+{
+    if (!IsIndexableField(iField, false))
+        return nullptr;
+    const OGRFieldDefn *poFieldDefn =
+        poLayer->GetLayerDefn()->GetFieldDefn(iField);
+
+    // Check that the source has not been modified since the index was
+    // opened, as well as the field type.
+    OGRSidecarIndexSignature sSignature;
+    if (!OGRSidecarIndexSignature::Get(pszIndexPath, sSignature))
+        return nullptr;
+
+    const auto oIter = m_oMapIndexes.find(poFieldDefn->GetNameRef());
+    if (oIter != m_oMapIndexes.end())
+    {
+        if (oIter->second->IsUpToDate(poFieldDefn->GetType(), sSignature))
+            return oIter->second.get();
+        m_oMapIndexes.erase(oIter);
+    }
+    auto poIndex = OGRSidecarAttrIndex::Open(
+        GetIndexFilename(iField), poFieldDefn->GetType(), sSignature);
+    if (!poIndex)
+        return nullptr;
+    auto poRet = poIndex.get();
+    m_oMapIndexes[poFieldDefn->GetNameRef()] = std::move(poIndex);
+    return poRet;
+}
+
+/************************************************************************/
+/*                     OGRCreateSidecarLayerIndex()                     */
+/************************************************************************/
+
+OGRLayerAttrIndex *OGRCreateSidecarLayerIndex()
+
+{
+    return new OGRSidecarLayerAttrIndex();
+}
+
+//! @endcond
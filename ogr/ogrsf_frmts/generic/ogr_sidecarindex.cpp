@@ -0,0 +1,622 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Driver-agnostic indexes stored in sidecar files.
+ * Author:   NextGIS <info at nextgis dot com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, NextGIS <info at nextgis dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "ogr_sidecarindex.h"
+#include "ogrsf_frmts.h"
+#include "cpl_conv.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+//! @cond Doxygen_Suppress
+
+/*
+ * Layout of a sidecar spatial index file, with all numbers in little-endian
+ * order:
+ *
+ * - a header of SIDECAR_SPATIAL_INDEX_HEADER_SIZE bytes: magic (8 bytes),
+ *   node size (uint32), reserved (uint32), number of items (uint64), size
+ *   (uint64) and modification time (int64) of the source file when the
+ *   index was built, and extent of the items (4 doubles).
+ * - the nodes of the packed R-tree, level by level, from the root to the
+ *   leaves, each one made of its envelope (4 doubles: minx, miny, maxx,
+ *   maxy) and of an uint64 that is the FID of the feature for leaves, and
+ *   the index of the first child for other nodes.
+ */
+
+constexpr char SIDECAR_SPATIAL_INDEX_MAGIC[] = "OGRSIDX";
+constexpr size_t SIDECAR_SPATIAL_INDEX_HEADER_SIZE = 72;
+constexpr size_t SIDECAR_SPATIAL_INDEX_NODE_SIZE = 4 * sizeof(double) + 8;
+constexpr const char *SIDECAR_SPATIAL_INDEX_EXTENSION = "ogrsidx";
+
+/************************************************************************/
+/*                   OGRSidecarIndexSignature::Get()                    */
+/************************************************************************/
+
+/** Get the signature of a file, or return false if it cannot be stat'ed. */
+bool OGRSidecarIndexSignature::Get(const char *pszSourceFilename,
+                                   OGRSidecarIndexSignature &sSignature)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(pszSourceFilename, &sStat) != 0)
+        return false;
+    sSignature.nSize = static_cast<uint64_t>(sStat.st_size);
+    sSignature.nMTime = static_cast<uint64_t>(sStat.st_mtime);
+    return true;
+}
+
+/************************************************************************/
+/*                     OGRSidecarIndexGetFilename()                     */
+/************************************************************************/
+
+/** Return "<source file>.<layer name>.<field name>.<extension>", with
+ * the layer and field names laundered to be safe in filenames. */
+std::string OGRSidecarIndexGetFilename(const char *pszSourceFilename,
+                                       const char *pszLayerName,
+                                       const char *pszFieldName,
+                                       const char *pszExtension)
+{
+    return std::string(pszSourceFilename)
+        .append(".")
+        .append(CPLLaunderForFilenameSafe(pszLayerName, nullptr))
+        .append(".")
+        .append(CPLLaunderForFilenameSafe(pszFieldName, nullptr))
+        .append(".")
+        .append(pszExtension);
+}
+
+/************************************************************************/
+/*               OGRSidecarIndexLayerFiltersSaver                       */
+/************************************************************************/
+
+OGRSidecarIndexLayerFiltersSaver::OGRSidecarIndexLayerFiltersSaver(
+    OGRLayer *poLayer)
+    : m_poLayer(poLayer),
+      m_osAttrQuery(poLayer->GetAttrQueryString()
+                        ? poLayer->GetAttrQueryString()
+                        : ""),
+      m_iGeomFieldFilter(poLayer->GetGeomFieldFilter())
+{
+    if (poLayer->GetSpatialFilter())
+        m_poSpatialFilter.reset(poLayer->GetSpatialFilter()->clone());
+    poLayer->SetAttributeFilter(nullptr);
+    if (m_poSpatialFilter)
+        poLayer->SetSpatialFilter(m_iGeomFieldFilter, nullptr);
+    poLayer->ResetReading();
+}
+
+OGRSidecarIndexLayerFiltersSaver::~OGRSidecarIndexLayerFiltersSaver()
+{
+    m_poLayer->SetAttributeFilter(
+        m_osAttrQuery.empty() ? nullptr : m_osAttrQuery.c_str());
+    if (m_poSpatialFilter)
+        m_poLayer->SetSpatialFilter(m_iGeomFieldFilter,
+                                    m_poSpatialFilter.get());
+    m_poLayer->ResetReading();
+}
+
+/************************************************************************/
+/*                           Hilbert curve                              */
+/************************************************************************/
+
+// Based on public domain code at
+// https://github.com/rawrunprotected/hilbert_curves, as the one used by
+// the FlatGeobuf driver for its packed R-tree.
+static uint32_t OGRSidecarHilbert(uint32_t x, uint32_t y)
+{
+    uint32_t a = x ^ y;
+    uint32_t b = 0xFFFF ^ a;
+    uint32_t c = 0xFFFF ^ (x | y);
+    uint32_t d = x & (y ^ 0xFFFF);
+
+    uint32_t A = a | (b >> 1);
+    uint32_t B = (a >> 1) ^ a;
+    uint32_t C = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+    uint32_t D = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 2)) ^ (b & (b >> 2)));
+    B = ((a & (b >> 2)) ^ (b & ((a ^ b) >> 2)));
+    C ^= ((a & (c >> 2)) ^ (b & (d >> 2)));
+    D ^= ((b & (c >> 2)) ^ ((a ^ b) & (d >> 2)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 4)) ^ (b & (b >> 4)));
+    B = ((a & (b >> 4)) ^ (b & ((a ^ b) >> 4)));
+    C ^= ((a & (c >> 4)) ^ (b & (d >> 4)));
+    D ^= ((b & (c >> 4)) ^ ((a ^ b) & (d >> 4)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    C ^= ((a & (c >> 8)) ^ (b & (d >> 8)));
+    D ^= ((b & (c >> 8)) ^ ((a ^ b) & (d >> 8)));
+
+    a = C ^ (C >> 1);
+    b = D ^ (D >> 1);
+
+    uint32_t i0 = x ^ y;
+    uint32_t i1 = b | (0xFFFF ^ (i0 | a));
+
+    i0 = (i0 | (i0 << 8)) & 0x00FF00FF;
+    i0 = (i0 | (i0 << 4)) & 0x0F0F0F0F;
+    i0 = (i0 | (i0 << 2)) & 0x33333333;
+    i0 = (i0 | (i0 << 1)) & 0x55555555;
+
+    i1 = (i1 | (i1 << 8)) & 0x00FF00FF;
+    i1 = (i1 | (i1 << 4)) & 0x0F0F0F0F;
+    i1 = (i1 | (i1 << 2)) & 0x33333333;
+    i1 = (i1 | (i1 << 1)) & 0x55555555;
+
+    return (i1 << 1) | i0;
+}
+
+/************************************************************************/
+/*                         ComputeLevels()                              */
+/************************************************************************/
+
+/** Compute the index of the first node and the number of nodes of each
+ * level of a packed R-tree, from the leaves to the root, and return the
+ * total number of nodes. */
+static uint64_t OGRSidecarComputeLevels(uint64_t nItemCount,
+                                        uint32_t nNodeSize,
+                                        std::vector<uint64_t> &anLevelStart,
+                                        std::vector<uint64_t> &anLevelCount)
+{
+    anLevelStart.clear();
+    anLevelCount.clear();
+    if (nItemCount == 0)
+        return 0;
+    uint64_t nCount = nItemCount;
+    uint64_t nNodeCount = 0;
+    while (true)
+    {
+        anLevelCount.push_back(nCount);
+        nNodeCount += nCount;
+        if (nCount == 1)
+            break;
+        nCount = (nCount + nNodeSize - 1) / nNodeSize;
+    }
+    // The root is stored first, and the leaves last.
+    anLevelStart.resize(anLevelCount.size());
+    uint64_t nStart = nNodeCount;
+    for (size_t i = 0; i < anLevelCount.size(); ++i)
+    {
+        nStart -= anLevelCount[i];
+        anLevelStart[i] = nStart;
+    }
+    return nNodeCount;
+}
+
+/************************************************************************/
+/*                       ~OGRSidecarSpatialIndex()                      */
+/************************************************************************/
+
+OGRSidecarSpatialIndex::~OGRSidecarSpatialIndex()
+{
+    if (m_fp)
+        VSIFCloseL(m_fp);
+}
+
+/************************************************************************/
+/*                            GetFilename()                             */
+/************************************************************************/
+
+std::string OGRSidecarSpatialIndex::GetFilename(const char *pszSourceFilename,
+                                                OGRLayer *poLayer,
+                                                int iGeomField)
+{
+    const char *pszGeomFieldName = poLayer->GetLayerDefn()
+                                       ->GetGeomFieldDefn(iGeomField)
+                                       ->GetNameRef();
+    return OGRSidecarIndexGetFilename(
+        pszSourceFilename, poLayer->GetName(),
+        pszGeomFieldName[0] ? pszGeomFieldName : "geometry",
+        SIDECAR_SPATIAL_INDEX_EXTENSION);
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+/** Build the spatial index of a geometry field of a layer, whatever its
+ * current filters. */
+bool OGRSidecarSpatialIndex::Build(const char *pszSourceFilename,
+                                   OGRLayer *poLayer, int iGeomField)
+{
+    if (iGeomField < 0 ||
+        iGeomField >= poLayer->GetLayerDefn()->GetGeomFieldCount())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid geometry field index");
+        return false;
+    }
+
+    struct Item
+    {
+        double dfMinX = 0;
+        double dfMinY = 0;
+        double dfMaxX = 0;
+        double dfMaxY = 0;
+        GIntBig nFID = 0;
+        uint32_t nHilbert = 0;
+    };
+
+    std::vector<Item> asItems;
+    OGREnvelope sExtent;
+    {
+        OGRSidecarIndexLayerFiltersSaver oFiltersSaver(poLayer);
+        for (auto &&poFeature : *poLayer)
+        {
+            const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(iGeomField);
+            if (poGeom == nullptr || poGeom->IsEmpty())
+                continue;
+            OGREnvelope sEnvelope;
+            poGeom->getEnvelope(&sEnvelope);
+            if (std::isnan(sEnvelope.MinX) || std::isnan(sEnvelope.MinY) ||
+                std::isnan(sEnvelope.MaxX) || std::isnan(sEnvelope.MaxY))
+                continue;
+            Item sItem;
+            sItem.dfMinX = sEnvelope.MinX;
+            sItem.dfMinY = sEnvelope.MinY;
+            sItem.dfMaxX = sEnvelope.MaxX;
+            sItem.dfMaxY = sEnvelope.MaxY;
+            sItem.nFID = poFeature->GetFID();
+            try
+            {
+                asItems.push_back(sItem);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory while building spatial index");
+                return false;
+            }
+            sExtent.Merge(sEnvelope);
+        }
+    }
+
+    // The signature of the source is taken once it has been fully read, in
+    // case reading it updates it.
+    OGRSidecarIndexSignature sSignature;
+    if (!OGRSidecarIndexSignature::Get(pszSourceFilename, sSignature))
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot stat %s",
+                 pszSourceFilename);
+        return false;
+    }
+
+    // Sort items along the Hilbert curve of their center
+    constexpr uint32_t HILBERT_MAX = (1 << 16) - 1;
+    const double dfWidth = sExtent.MaxX - sExtent.MinX;
+    const double dfHeight = sExtent.MaxY - sExtent.MinY;
+    for (auto &sItem : asItems)
+    {
+        uint32_t x = 0;
+        uint32_t y = 0;
+        if (dfWidth > 0)
+            x = static_cast<uint32_t>(std::floor(
+                HILBERT_MAX * ((sItem.dfMinX + sItem.dfMaxX) / 2 -
+                               sExtent.MinX) /
+                dfWidth));
+        if (dfHeight > 0)
+            y = static_cast<uint32_t>(std::floor(
+                HILBERT_MAX * ((sItem.dfMinY + sItem.dfMaxY) / 2 -
+                               sExtent.MinY) /
+                dfHeight));
+        sItem.nHilbert = OGRSidecarHilbert(std::min(x, HILBERT_MAX),
+                                           std::min(y, HILBERT_MAX));
+    }
+    std::sort(asItems.begin(), asItems.end(),
+              [](const Item &a, const Item &b)
+              {
+                  return a.nHilbert < b.nHilbert ||
+                         (a.nHilbert == b.nHilbert && a.nFID < b.nFID);
+              });
+
+    // Build the nodes from the leaves to the root
+    std::vector<uint64_t> anLevelStart;
+    std::vector<uint64_t> anLevelCount;
+    const uint64_t nNodeCount = OGRSidecarComputeLevels(
+        asItems.size(), NODE_SIZE, anLevelStart, anLevelCount);
+    std::vector<GByte> abyNodes;
+    try
+    {
+        abyNodes.resize(static_cast<size_t>(nNodeCount) *
+                        SIDECAR_SPATIAL_INDEX_NODE_SIZE);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory while building spatial index");
+        return false;
+    }
+
+    const auto WriteNode = [&abyNodes](uint64_t nIdx, const double adfEnv[4],
+                                       uint64_t nValue)
+    {
+        GByte *pabyNode =
+            abyNodes.data() +
+            static_cast<size_t>(nIdx) * SIDECAR_SPATIAL_INDEX_NODE_SIZE;
+        for (int i = 0; i < 4; ++i)
+        {
+            double dfVal = adfEnv[i];
+            CPL_LSBPTR64(&dfVal);
+            memcpy(pabyNode + i * sizeof(double), &dfVal, sizeof(double));
+        }
+        CPL_LSBPTR64(&nValue);
+        memcpy(pabyNode + 4 * sizeof(double), &nValue, sizeof(nValue));
+    };
+
+    // Node envelopes, kept in memory to compute the ones of their parents
+    std::vector<OGREnvelope> asLevelEnvelopes;
+    std::vector<OGREnvelope> asParentEnvelopes;
+    asLevelEnvelopes.reserve(asItems.size());
+    for (size_t i = 0; i < asItems.size(); ++i)
+    {
+        const Item &sItem = asItems[i];
+        const double adfEnv[] = {sItem.dfMinX, sItem.dfMinY, sItem.dfMaxX,
+                                 sItem.dfMaxY};
+        WriteNode(anLevelStart[0] + i, adfEnv,
+                  static_cast<uint64_t>(sItem.nFID));
+        OGREnvelope sEnvelope;
+        sEnvelope.MinX = sItem.dfMinX;
+        sEnvelope.MinY = sItem.dfMinY;
+        sEnvelope.MaxX = sItem.dfMaxX;
+        sEnvelope.MaxY = sItem.dfMaxY;
+        asLevelEnvelopes.push_back(sEnvelope);
+    }
+    for (size_t iLevel = 1; iLevel < anLevelCount.size(); ++iLevel)
+    {
+        asParentEnvelopes.clear();
+        for (uint64_t j = 0; j < anLevelCount[iLevel]; ++j)
+        {
+            const size_t nFirstChild = static_cast<size_t>(j * NODE_SIZE);
+            const size_t nLastChild = static_cast<size_t>(
+                std::min<uint64_t>(nFirstChild + NODE_SIZE,
+                                   anLevelCount[iLevel - 1]));
+            OGREnvelope sEnvelope;
+            for (size_t k = nFirstChild; k < nLastChild; ++k)
+                sEnvelope.Merge(asLevelEnvelopes[k]);
+            const double adfEnv[] = {sEnvelope.MinX, sEnvelope.MinY,
+                                     sEnvelope.MaxX, sEnvelope.MaxY};
+            WriteNode(anLevelStart[iLevel] + j, adfEnv,
+                      anLevelStart[iLevel - 1] + nFirstChild);
+            asParentEnvelopes.push_back(sEnvelope);
+        }
+        std::swap(asLevelEnvelopes, asParentEnvelopes);
+    }
+
+    // Write the header and the nodes
+    GByte abyHeader[SIDECAR_SPATIAL_INDEX_HEADER_SIZE] = {0};
+    memcpy(abyHeader, SIDECAR_SPATIAL_INDEX_MAGIC,
+           sizeof(SIDECAR_SPATIAL_INDEX_MAGIC));
+    abyHeader[7] = 1;  // version
+    size_t nPos = 8;
+    const auto WriteUInt32 = [&abyHeader, &nPos](uint32_t nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        memcpy(abyHeader + nPos, &nVal, sizeof(nVal));
+        nPos += sizeof(nVal);
+    };
+    const auto WriteUInt64 = [&abyHeader, &nPos](uint64_t nVal)
+    {
+        CPL_LSBPTR64(&nVal);
+        memcpy(abyHeader + nPos, &nVal, sizeof(nVal));
+        nPos += sizeof(nVal);
+    };
+    const auto WriteDouble = [&abyHeader, &nPos](double dfVal)
+    {
+        CPL_LSBPTR64(&dfVal);
+        memcpy(abyHeader + nPos, &dfVal, sizeof(dfVal));
+        nPos += sizeof(dfVal);
+    };
+    WriteUInt32(NODE_SIZE);
+    WriteUInt32(0);
+    WriteUInt64(asItems.size());
+    WriteUInt64(sSignature.nSize);
+    WriteUInt64(sSignature.nMTime);
+    WriteDouble(sExtent.IsInit() ? sExtent.MinX : 0);
+    WriteDouble(sExtent.IsInit() ? sExtent.MinY : 0);
+    WriteDouble(sExtent.IsInit() ? sExtent.MaxX : 0);
+    WriteDouble(sExtent.IsInit() ? sExtent.MaxY : 0);
+    CPLAssert(nPos == SIDECAR_SPATIAL_INDEX_HEADER_SIZE);
+
+    const std::string osFilename =
+        GetFilename(pszSourceFilename, poLayer, iGeomField);
+    const std::string osTmpFilename = osFilename + ".tmp";
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 osTmpFilename.c_str());
+        return false;
+    }
+    bool bOK = VSIFWriteL(abyHeader, sizeof(abyHeader), 1, fp) == 1 &&
+               (abyNodes.empty() ||
+                VSIFWriteL(abyNodes.data(), abyNodes.size(), 1, fp) == 1);
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    if (bOK)
+    {
+        VSIUnlink(osFilename.c_str());
+        bOK = VSIRename(osTmpFilename.c_str(), osFilename.c_str()) == 0;
+    }
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write %s",
+                 osFilename.c_str());
+        VSIUnlink(osTmpFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+/** Open the spatial index of a geometry field of a layer, and return
+ * nullptr if it does not exist, is corrupted or out of date. */
+std::unique_ptr<OGRSidecarSpatialIndex>
+OGRSidecarSpatialIndex::Open(const char *pszSourceFilename, OGRLayer *poLayer,
+                             int iGeomField)
+{
+    if (iGeomField < 0 ||
+        iGeomField >= poLayer->GetLayerDefn()->GetGeomFieldCount())
+        return nullptr;
+
+    const std::string osFilename =
+        GetFilename(pszSourceFilename, poLayer, iGeomField);
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+        return nullptr;
+    OGRSidecarIndexSignature sSignature;
+    if (!OGRSidecarIndexSignature::Get(pszSourceFilename, sSignature))
+        return nullptr;
+
+    auto poIndex =
+        std::unique_ptr<OGRSidecarSpatialIndex>(new OGRSidecarSpatialIndex());
+    poIndex->m_fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (poIndex->m_fp == nullptr)
+        return nullptr;
+
+    GByte abyHeader[SIDECAR_SPATIAL_INDEX_HEADER_SIZE];
+    if (VSIFReadL(abyHeader, sizeof(abyHeader), 1, poIndex->m_fp) != 1 ||
+        memcmp(abyHeader, SIDECAR_SPATIAL_INDEX_MAGIC,
+               sizeof(SIDECAR_SPATIAL_INDEX_MAGIC) - 1) != 0 ||
+        abyHeader[7] != 1)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined, "%s is not a valid index",
+                 osFilename.c_str());
+        return nullptr;
+    }
+
+    uint32_t nNodeSize;
+    memcpy(&nNodeSize, abyHeader + 8, sizeof(nNodeSize));
+    CPL_LSBPTR32(&nNodeSize);
+    memcpy(&poIndex->m_nItemCount, abyHeader + 16, sizeof(uint64_t));
+    CPL_LSBPTR64(&poIndex->m_nItemCount);
+    memcpy(&poIndex->m_sSignature.nSize, abyHeader + 24, sizeof(uint64_t));
+    CPL_LSBPTR64(&poIndex->m_sSignature.nSize);
+    memcpy(&poIndex->m_sSignature.nMTime, abyHeader + 32, sizeof(uint64_t));
+    CPL_LSBPTR64(&poIndex->m_sSignature.nMTime);
+
+    if (!poIndex->IsUpToDate(sSignature))
+    {
+        CPLDebug("OGR",
+                 "Ignoring %s, as the indexed file has been modified since "
+                 "it was built",
+                 osFilename.c_str());
+        return nullptr;
+    }
+
+    const uint64_t nMaxItemCount =
+        (static_cast<uint64_t>(sStat.st_size) >
+         SIDECAR_SPATIAL_INDEX_HEADER_SIZE)
+            ? (static_cast<uint64_t>(sStat.st_size) -
+               SIDECAR_SPATIAL_INDEX_HEADER_SIZE) /
+                  SIDECAR_SPATIAL_INDEX_NODE_SIZE
+            : 0;
+    if (nNodeSize != NODE_SIZE || poIndex->m_nItemCount > nMaxItemCount ||
+        OGRSidecarComputeLevels(poIndex->m_nItemCount, nNodeSize,
+                                poIndex->m_anLevelStart,
+                                poIndex->m_anLevelCount) != nMaxItemCount)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined, "%s is corrupted",
+                 osFilename.c_str());
+        return nullptr;
+    }
+
+    return poIndex;
+}
+
+/************************************************************************/
+/*                               Search()                               */
+/************************************************************************/
+
+/** Append to anFIDs the sorted FIDs of the features whose envelope
+ * intersects sEnvelope. */
+bool OGRSidecarSpatialIndex::Search(const OGREnvelope &sEnvelope,
+                                    std::vector<GIntBig> &anFIDs)
+{
+    if (m_nItemCount == 0)
+        return true;
+
+    const size_t nFirstFID = anFIDs.size();
+
+    // Stack of (index of first node, level) of the groups of sibling nodes
+    // to visit
+    std::vector<std::pair<uint64_t, size_t>> aoStack;
+    aoStack.emplace_back(0, m_anLevelCount.size() - 1);
+    while (!aoStack.empty())
+    {
+        const auto [nFirstNode, iLevel] = aoStack.back();
+        aoStack.pop_back();
+
+        const uint64_t nLevelEnd =
+            m_anLevelStart[iLevel] + m_anLevelCount[iLevel];
+        if (nFirstNode < m_anLevelStart[iLevel] || nFirstNode >= nLevelEnd)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Corrupted spatial index");
+            return false;
+        }
+        const uint64_t nNodes =
+            std::min<uint64_t>(NODE_SIZE, nLevelEnd - nFirstNode);
+        m_abyNodes.resize(static_cast<size_t>(nNodes) *
+                          SIDECAR_SPATIAL_INDEX_NODE_SIZE);
+        if (VSIFSeekL(m_fp,
+                      SIDECAR_SPATIAL_INDEX_HEADER_SIZE +
+                          nFirstNode * SIDECAR_SPATIAL_INDEX_NODE_SIZE,
+                      SEEK_SET) != 0 ||
+            VSIFReadL(m_abyNodes.data(), m_abyNodes.size(), 1, m_fp) != 1)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot read spatial index");
+            return false;
+        }
+
+        for (size_t i = 0; i < static_cast<size_t>(nNodes); ++i)
+        {
+            const GByte *pabyNode =
+                m_abyNodes.data() + i * SIDECAR_SPATIAL_INDEX_NODE_SIZE;
+            double adfEnv[4];
+            memcpy(adfEnv, pabyNode, sizeof(adfEnv));
+            uint64_t nValue;
+            memcpy(&nValue, pabyNode + sizeof(adfEnv), sizeof(nValue));
+#if !CPL_IS_LSB
+            for (double &dfVal : adfEnv)
+                CPL_SWAP64PTR(&dfVal);
+            CPL_SWAP64PTR(&nValue);
+#endif
+            if (adfEnv[2] < sEnvelope.MinX || adfEnv[3] < sEnvelope.MinY ||
+                adfEnv[0] > sEnvelope.MaxX || adfEnv[1] > sEnvelope.MaxY)
+                continue;
+            if (iLevel == 0)
+                anFIDs.push_back(static_cast<GIntBig>(nValue));
+            else
+                aoStack.emplace_back(nValue, iLevel - 1);
+        }
+    }
+
+    std::sort(anFIDs.begin() + nFirstFID, anFIDs.end());
+    return true;
+}
+
+//! @endcond
@@ -0,0 +1,137 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Driver-agnostic indexes stored in sidecar files.
+ * Author:   NextGIS <info at nextgis dot com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, NextGIS <info at nextgis dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGR_SIDECARINDEX_H_INCLUDED
+#define OGR_SIDECARINDEX_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+#include "ogr_core.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class OGRGeometry;
+class OGRLayer;
+
+/************************************************************************/
+/*                       OGRSidecarIndexSignature                       */
+/************************************************************************/
+
+/** Size and modification time of an indexed file, recorded in its sidecar
+ * indexes, that are ignored as soon as they differ from the ones of the
+ * file. */
+struct OGRSidecarIndexSignature
+{
+    uint64_t nSize = 0;
+    uint64_t nMTime = 0;
+
+    static bool Get(const char *pszSourceFilename,
+                    OGRSidecarIndexSignature &sSignature);
+
+    bool operator==(const OGRSidecarIndexSignature &other) const
+    {
+        return nSize == other.nSize && nMTime == other.nMTime;
+    }
+
+    bool operator!=(const OGRSidecarIndexSignature &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+std::string OGRSidecarIndexGetFilename(const char *pszSourceFilename,
+                                       const char *pszLayerName,
+                                       const char *pszFieldName,
+                                       const char *pszExtension);
+
+/************************************************************************/
+/*                   OGRSidecarIndexLayerFiltersSaver                   */
+/************************************************************************/
+
+/** Clear the attribute and spatial filters of a layer while its features
+ * are read to build an index, and restore them on destruction. */
+class OGRSidecarIndexLayerFiltersSaver
+{
+  public:
+    explicit OGRSidecarIndexLayerFiltersSaver(OGRLayer *poLayer);
+    ~OGRSidecarIndexLayerFiltersSaver();
+
+  private:
+    OGRLayer *m_poLayer = nullptr;
+    std::string m_osAttrQuery{};
+    std::unique_ptr<OGRGeometry> m_poSpatialFilter{};
+    int m_iGeomFieldFilter = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRSidecarIndexLayerFiltersSaver)
+};
+
+/************************************************************************/
+/*                        OGRSidecarSpatialIndex                        */
+/************************************************************************/
+
+/** Packed Hilbert R-tree of the envelopes of the geometries of a geometry
+ * field of a layer, stored in a
+ * "<source file>.<layer name>.<geometry field name>.ogrsidx" file.
+ *
+ * The tree is built in bulk by Build() in the same way as the index of
+ * FlatGeobuf files: the envelopes are sorted by the Hilbert value of their
+ * center, and grouped by nodes of NODE_SIZE items, level by level up to
+ * the root. Search() returns the FIDs of the features whose envelope
+ * intersects an area, reading only the nodes it needs from the file.
+ */
+class OGRSidecarSpatialIndex
+{
+  public:
+    //! Number of children of each node.
+    static constexpr uint32_t NODE_SIZE = 16;
+
+    ~OGRSidecarSpatialIndex();
+
+    static std::string GetFilename(const char *pszSourceFilename,
+                                   OGRLayer *poLayer, int iGeomField);
+
+    static bool Build(const char *pszSourceFilename, OGRLayer *poLayer,
+                      int iGeomField);
+
+    static std::unique_ptr<OGRSidecarSpatialIndex>
+    Open(const char *pszSourceFilename, OGRLayer *poLayer, int iGeomField);
+
+    bool IsUpToDate(const OGRSidecarIndexSignature &sSignature) const
+    {
+        return sSignature == m_sSignature;
+    }
+
+    bool Search(const OGREnvelope &sEnvelope, std::vector<GIntBig> &anFIDs);
+
+  private:
+    VSILFILE *m_fp = nullptr;
+    OGRSidecarIndexSignature m_sSignature{};
+    uint64_t m_nItemCount = 0;
+    //! Index of the first node of each level, from the leaves to the root.
+    std::vector<uint64_t> m_anLevelStart{};
+    //! Number of nodes of each level, from the leaves to the root.
+    std::vector<uint64_t> m_anLevelCount{};
+    std::vector<GByte> m_abyNodes{};
+
+    OGRSidecarSpatialIndex() = default;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRSidecarSpatialIndex)
+};
+
+#endif  // DOXYGEN_SKIP
+
+#endif  // OGR_SIDECARINDEX_H_INCLUDED
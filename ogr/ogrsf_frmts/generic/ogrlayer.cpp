@@ -19,6 +19,7 @@
 #include "ograpispy.h"
 #include "ogr_wkb.h"
 #include "ogrlayer_private.h"
+#include "ogr_sidecarindex.h"
 
 #include "cpl_time.h"
 #include <cassert>
@@ -1185,6 +1186,107 @@ OGRFeatureH OGR_L_GetNextFeature(OGRLayerH hLayer)
     return OGRFeature::ToHandle(OGRLayer::FromHandle(hLayer)->GetNextFeature());
 }
 
+/************************************************************************/
+/*                   OGRLayer::GetNextFeatureReusing()                  */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer, possibly reusing
+ the storage of a feature that is no longer needed.
+
+ This method behaves like GetNextFeature(), but takes ownership of
+ poFeature, which must be a feature previously returned by this layer
+ (or nullptr). Drivers that support it refill that feature object, and
+ its geometry objects, instead of allocating new ones, which saves a
+ significant amount of time when iterating over many features. The
+ returned feature may thus be poFeature itself, and poFeature must not be
+ used any longer by the caller, except through the returned pointer.
+ Other drivers just destroy poFeature and return a new feature.
+
+ The returned feature becomes the responsibility of the caller, exactly as
+ with GetNextFeature().
+
+ Typical usage is:
+ \code{.cpp}
+ OGRFeature *poFeature = nullptr;
+ while ((poFeature = poLayer->GetNextFeatureReusing(poFeature)) != nullptr)
+ {
+     // do something with poFeature, without keeping pointers to it or
+     // to its geometries
+ }
+ \endcode
+
+ This method is the same as the C function OGR_L_GetNextFeatureReusing().
+
+ @param poFeature feature no longer needed by the caller, or nullptr.
+ @return a feature, or NULL if no more features are available.
+ @since GDAL 3.13
+*/
+
+OGRFeature *OGRLayer::GetNextFeatureReusing(OGRFeature *poFeature)
+{
+    delete poFeature;
+    return GetNextFeature();
+}
+
+/************************************************************************/
+/*                     OGR_L_GetNextFeatureReusing()                    */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer, possibly reusing
+ the storage of a feature that is no longer needed.
+
+ This function behaves like OGR_L_GetNextFeature(), but takes ownership of
+ hFeat, which must be a feature previously returned by this layer (or
+ NULL). The returned feature may be hFeat itself, refilled with the content
+ of the next feature, and hFeat must not be used any longer by the caller,
+ except through the returned handle.
+
+ This function is the same as the C++ method
+ OGRLayer::GetNextFeatureReusing().
+
+ @param hLayer handle to the layer from which feature are read.
+ @param hFeat handle to a feature no longer needed by the caller, or NULL.
+ @return a handle to a feature, or NULL if no more features are available.
+ @since GDAL 3.13
+*/
+
+OGRFeatureH OGR_L_GetNextFeatureReusing(OGRLayerH hLayer, OGRFeatureH hFeat)
+
+{
+    VALIDATE_POINTER1(hLayer, "OGR_L_GetNextFeatureReusing", nullptr);
+
+    return OGRFeature::ToHandle(
+        OGRLayer::FromHandle(hLayer)->GetNextFeatureReusing(
+            OGRFeature::FromHandle(hFeat)));
+}
+
+/************************************************************************/
+/*                           RecycleFeature()                           */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+/** Return poFeature reset to its initial state if it is a feature of
+ * poFeatureDefn, or destroy it and return a new feature otherwise.
+ *
+ * Meant to be used by GetNextFeatureReusing() implementations.
+ */
+OGRFeature *OGRLayer::RecycleFeature(OGRFeature *poFeature,
+                                     OGRFeatureDefn *poFeatureDefn)
+{
+    if (poFeature && poFeature->GetDefnRef() == poFeatureDefn)
+    {
+        poFeature->Reset();
+        return poFeature;
+    }
+    delete poFeature;
+    return new OGRFeature(poFeatureDefn);
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                       ConvertGeomsIfNecessary()                      */
 /************************************************************************/
@@ -3369,6 +3471,8 @@ OGRErr OGRLayer::SetSpatialFilter(int iGeomField, const OGRGeometry *poFilter)
         }
     }
 
+    m_poPrivate->m_bSidecarSpatialIndexFIDsComputed = false;
+    m_poPrivate->m_anSidecarSpatialIndexFIDs.clear();
     return ISetSpatialFilter(iGeomField, poFilter);
 }
 
@@ -3938,7 +4042,18 @@ bool OGRLayer::FilterWKBGeometry(const GByte *pabyWKB, size_t nWKBSize,
             {
                 return true;
             }
-            else if (OGRGeometryFactory::haveGEOS())
+
+            // Exact test against a rectangle, without materializing the
+            // geometry, for geometries without circular arcs.
+            OGRWKBGeometryView oView;
+            bool bIntersects = false;
+            if (bFilterIsEnvelope && oView.Init(pabyWKB, nWKBSize) &&
+                oView.IntersectsEnvelope(sFilterEnvelope, bIntersects))
+            {
+                return bIntersects;
+            }
+
+            if (OGRGeometryFactory::haveGEOS())
             {
                 OGRGeometry *poGeom = nullptr;
                 int ret = FALSE;
@@ -4242,6 +4357,94 @@ OGRLayer::InitializeIndexSupport([[maybe_unused]] const char *pszFilename)
 #endif
 }
 
+/************************************************************************/
+/*                   InitializeSidecarIndexSupport()                    */
+/*                                                                      */
+/*      Same as InitializeIndexSupport(), but with the driver-agnostic  */
+/*      sidecar index format, for layers of drivers that have no        */
+/*      native attribute indexes.                                       */
+/************************************************************************/
+
+OGRErr OGRLayer::InitializeSidecarIndexSupport(const char *pszFilename)
+
+{
+    m_poPrivate->m_osSidecarIndexSource = pszFilename;
+
+    if (m_poAttrIndex != nullptr)
+        return OGRERR_NONE;
+
+    m_poAttrIndex = OGRCreateSidecarLayerIndex();
+
+    const OGRErr eErr = m_poAttrIndex->Initialize(pszFilename, this);
+    if (eErr != OGRERR_NONE)
+    {
+        delete m_poAttrIndex;
+        m_poAttrIndex = nullptr;
+    }
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                      BuildSidecarSpatialIndex()                      */
+/*                                                                      */
+/*      Build the sidecar spatial index of a geometry field, for        */
+/*      layers on which InitializeSidecarIndexSupport() has been        */
+/*      called.                                                         */
+/************************************************************************/
+
+OGRErr OGRLayer::BuildSidecarSpatialIndex(int iGeomField)
+
+{
+    if (m_poPrivate->m_osSidecarIndexSource.empty())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Spatial indexes are not supported by this driver.");
+        return OGRERR_FAILURE;
+    }
+
+    const bool bOK = OGRSidecarSpatialIndex::Build(
+        m_poPrivate->m_osSidecarIndexSource.c_str(), this, iGeomField);
+    m_poPrivate->m_bSidecarSpatialIndexFIDsComputed = false;
+    m_poPrivate->m_anSidecarSpatialIndexFIDs.clear();
+    return bOK ? OGRERR_NONE : OGRERR_FAILURE;
+}
+
+/************************************************************************/
+/*                     GetSidecarSpatialIndexFIDs()                     */
+/*                                                                      */
+/*      Return the sorted FIDs of the features whose envelope           */
+/*      intersects the one of the spatial filter, according to an       */
+/*      up-to-date sidecar spatial index of the filtered geometry       */
+/*      field, or nullptr if there is no filter or no such index.       */
+/*      The features must still be checked with FilterGeometry().       */
+/************************************************************************/
+
+const std::vector<GIntBig> *OGRLayer::GetSidecarSpatialIndexFIDs()
+
+{
+    if (!m_poPrivate->m_bSidecarSpatialIndexFIDsComputed)
+    {
+        m_poPrivate->m_bSidecarSpatialIndexFIDsComputed = true;
+        m_poPrivate->m_bSidecarSpatialIndexFIDsValid = false;
+        m_poPrivate->m_anSidecarSpatialIndexFIDs.clear();
+        if (m_poFilterGeom != nullptr &&
+            !m_poPrivate->m_osSidecarIndexSource.empty())
+        {
+            auto poIndex = OGRSidecarSpatialIndex::Open(
+                m_poPrivate->m_osSidecarIndexSource.c_str(), this,
+                m_iGeomFieldFilter);
+            m_poPrivate->m_bSidecarSpatialIndexFIDsValid =
+                poIndex &&
+                poIndex->Search(m_sFilterEnvelope,
+                                m_poPrivate->m_anSidecarSpatialIndexFIDs);
+        }
+    }
+    return m_poPrivate->m_bSidecarSpatialIndexFIDsValid
+               ? &m_poPrivate->m_anSidecarSpatialIndexFIDs
+               : nullptr;
+}
+
 //! @endcond
 
 /************************************************************************/
@@ -7958,7 +8161,11 @@ OGRFeatureUniquePtr &OGRLayer::FeatureIterator::operator*()
 
 OGRLayer::FeatureIterator &OGRLayer::FeatureIterator::operator++()
 {
-    m_poPrivate->m_poFeature.reset(m_poPrivate->m_poLayer->GetNextFeature());
+    // The feature of the previous step is no longer accessible, so the
+    // layer can refill it.
+    OGRFeature *poFeature = m_poPrivate->m_poLayer->GetNextFeatureReusing(
+        m_poPrivate->m_poFeature.release());
+    m_poPrivate->m_poFeature.reset(poFeature);
     m_poPrivate->m_bEOF = m_poPrivate->m_poFeature == nullptr;
     return *this;
 }
@@ -40,6 +40,19 @@ struct OGRLayer::Private
 
     //! Whether OGRGeometry::SetPrecision() should be applied. Only valid after ConvertGeomsIfNecessary() has been called.
     bool m_bApplyGeomSetPrecision = false;
+
+    //! Filename of the source of the layer, when it supports sidecar indexes
+    std::string m_osSidecarIndexSource{};
+
+    //! Whether m_anSidecarSpatialIndexFIDs reflects the spatial filter
+    bool m_bSidecarSpatialIndexFIDsComputed = false;
+
+    //! Whether the sidecar spatial index could be used for the filter
+    bool m_bSidecarSpatialIndexFIDsValid = false;
+
+    //! Sorted FIDs of the features whose envelope intersects the one of the
+    //! spatial filter, according to the sidecar spatial index
+    std::vector<GIntBig> m_anSidecarSpatialIndexFIDs{};
 };
 
 //! @endcond
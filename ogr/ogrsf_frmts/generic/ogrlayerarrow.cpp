@@ -12,6 +12,7 @@
 
 #include "ogrsf_frmts.h"
 #include "ogr_api.h"
+#include "ogr_compiled_filter.h"
 #include "ogr_recordbatch.h"
 #include "ograrrowarrayhelper.h"
 #include "ogrlayerarrow.h"
@@ -24,6 +25,8 @@
 #include "cpl_float.h"
 #include "cpl_json.h"
 #include "cpl_time.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <cassert>
@@ -3691,14 +3694,57 @@ static bool CompactArray(const struct ArrowSchema *schema,
     return true;
 }
 
+/************************************************************************/
+/*                          ForEachRowRange()                           */
+/************************************************************************/
+
+// Split [0, nLength[ into consecutive ranges of at least nMinRowsPerJob rows,
+// and call oFunc(iJob, iStart, iEnd) on each of them, in parallel using the
+// global thread pool. oFunc() is called once on the whole range if there are
+// not enough rows, or only one thread is allowed.
+template <class Func>
+static void ForEachRowRange(size_t nLength, size_t nMinRowsPerJob,
+                            const Func &oFunc)
+{
+    const int nThreads = GDALGetNumThreads(nullptr, nullptr, "1", 128);
+    const size_t nJobs =
+        std::min(static_cast<size_t>(nThreads), nLength / nMinRowsPerJob);
+    auto poThreadPool =
+        nJobs > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    if (!poJobQueue)
+    {
+        oFunc(0, 0, nLength);
+        return;
+    }
+
+    for (size_t iJob = 0; iJob < nJobs; ++iJob)
+    {
+        poJobQueue->SubmitJob(
+            [&oFunc, iJob, nJobs, nLength]()
+            {
+                oFunc(iJob, iJob * nLength / nJobs,
+                      (iJob + 1) * nLength / nJobs);
+            });
+    }
+    poJobQueue->WaitCompletion();
+}
+
 /************************************************************************/
 /*                  FillValidityArrayFromWKBArray()                     */
 /************************************************************************/
 
+// The first range of rows uses the prepared filter geometry of the layer,
+// which is thus reused between batches. The other ones, evaluated
+// concurrently, prepare their own, as prepared geometries are not
+// thread-safe.
 template <class OffsetType>
-static size_t
-FillValidityArrayFromWKBArray(struct ArrowArray *array, const OGRLayer *poLayer,
-                              std::vector<bool> &abyValidityFromFilters)
+static size_t FillValidityArrayFromWKBArray(
+    struct ArrowArray *array, const OGRGeometry *poFilterGeom,
+    bool bFilterIsEnvelope, const OGREnvelope &sFilterEnvelope,
+    OGRPreparedGeometry *&pPreparedFilterGeom,
+    std::vector<bool> &abyValidityFromFilters)
 {
     const size_t nLength = static_cast<size_t>(array->length);
     const uint8_t *pabyValidity =
@@ -3709,23 +3755,42 @@ FillValidityArrayFromWKBArray(struct ArrowArray *array, const OGRLayer *poLayer,
     const OffsetType *panOffsets =
         static_cast<const OffsetType *>(array->buffers[1]) + nOffset;
     const GByte *pabyData = static_cast<const GByte *>(array->buffers[2]);
-    OGREnvelope sEnvelope;
+
+    std::vector<uint8_t> abySelected(nLength);
+    constexpr size_t MIN_ROWS_PER_JOB = 4096;
+    ForEachRowRange(
+        nLength, MIN_ROWS_PER_JOB,
+        [&](size_t iJob, size_t iStart, size_t iEnd)
+        {
+            OGRPreparedGeometry *pPreparedLocal = nullptr;
+            OGRPreparedGeometry *&pPrepared =
+                iJob == 0 ? pPreparedFilterGeom : pPreparedLocal;
+            OGREnvelope sEnvelope;
+            for (size_t i = iStart; i < iEnd; ++i)
+            {
+                if (!pabyValidity || TestBit(pabyValidity, i + nOffset))
+                {
+                    const GByte *pabyWKB = pabyData + panOffsets[i];
+                    const size_t nWKBSize =
+                        static_cast<size_t>(panOffsets[i + 1] - panOffsets[i]);
+                    abySelected[i] = OGRLayer::FilterWKBGeometry(
+                        pabyWKB, nWKBSize,
+                        /* bEnvelopeAlreadySet=*/false, sEnvelope, poFilterGeom,
+                        bFilterIsEnvelope, sFilterEnvelope, pPrepared);
+                }
+            }
+            if (pPreparedLocal)
+                OGRDestroyPreparedGeometry(pPreparedLocal);
+        });
+
     abyValidityFromFilters.resize(nLength);
     size_t nCountIntersecting = 0;
     for (size_t i = 0; i < nLength; ++i)
     {
-        if (!pabyValidity || TestBit(pabyValidity, i + nOffset))
+        if (abySelected[i])
         {
-            const GByte *pabyWKB = pabyData + panOffsets[i];
-            const size_t nWKBSize =
-                static_cast<size_t>(panOffsets[i + 1] - panOffsets[i]);
-            if (poLayer->FilterWKBGeometry(pabyWKB, nWKBSize,
-                                           /* bEnvelopeAlreadySet=*/false,
-                                           sEnvelope))
-            {
-                abyValidityFromFilters[i] = true;
-                nCountIntersecting++;
-            }
+            abyValidityFromFilters[i] = true;
+            nCountIntersecting++;
         }
     }
     return nCountIntersecting;
@@ -4844,6 +4909,311 @@ static bool SetFieldForOtherFormats(OGRFeature &oFeature,
     return true;
 }
 
+/************************************************************************/
+/*                       GetArrowValuesAs()                             */
+/************************************************************************/
+
+// Return the values of an Arrow array of primitive type TSrc converted to
+// TDst, without copy if both types are the same.
+template <class TSrc, class TDst>
+static const TDst *GetArrowValuesAs(const struct ArrowArray *psArray,
+                                    size_t nLength, std::vector<TDst> &aBuffer)
+{
+    const TSrc *paSrc = static_cast<const TSrc *>(psArray->buffers[1]) +
+                        static_cast<size_t>(psArray->offset);
+    if constexpr (std::is_same_v<TSrc, TDst>)
+    {
+        return paSrc;
+    }
+    else
+    {
+        aBuffer.resize(nLength);
+        for (size_t i = 0; i < nLength; ++i)
+            aBuffer[i] = static_cast<TDst>(paSrc[i]);
+        return aBuffer.data();
+    }
+}
+
+/************************************************************************/
+/*                      GetArrowNumericValues()                         */
+/************************************************************************/
+
+// Return the values of a numeric Arrow array as TDst, or nullptr if the
+// format is not one that OGRFeature::SetField() would store without any
+// change in a field of type eFieldType and sub-type eSubType.
+template <class TDst>
+static const TDst *GetArrowNumericValues(const char *format,
+                                         OGRFieldType eFieldType,
+                                         OGRFieldSubType eSubType,
+                                         const struct ArrowArray *psArray,
+                                         size_t nLength,
+                                         std::vector<TDst> &aBuffer)
+{
+    if (IsBoolean(format))
+    {
+        aBuffer.resize(nLength);
+        const uint8_t *pabyData =
+            static_cast<const uint8_t *>(psArray->buffers[1]);
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            aBuffer[i] = TestBit(pabyData,
+                                 i + static_cast<size_t>(psArray->offset));
+        }
+        return aBuffer.data();
+    }
+    // Values of other formats might be clamped for boolean fields
+    if (eSubType == OFSTBoolean)
+        return nullptr;
+    if (IsInt8(format))
+        return GetArrowValuesAs<int8_t>(psArray, nLength, aBuffer);
+    if (IsUInt8(format))
+        return GetArrowValuesAs<uint8_t>(psArray, nLength, aBuffer);
+    if (IsInt16(format))
+        return GetArrowValuesAs<int16_t>(psArray, nLength, aBuffer);
+    // Values of other formats might be clamped for int16 fields
+    if (eSubType == OFSTInt16)
+        return nullptr;
+    if (IsUInt16(format))
+        return GetArrowValuesAs<uint16_t>(psArray, nLength, aBuffer);
+    if (IsInt32(format))
+        return GetArrowValuesAs<int32_t>(psArray, nLength, aBuffer);
+    // Values of other formats might be clamped for 32-bit integer fields
+    if (eFieldType == OFTInteger)
+        return nullptr;
+    if (IsUInt32(format))
+        return GetArrowValuesAs<uint32_t>(psArray, nLength, aBuffer);
+    if (IsInt64(format))
+        return GetArrowValuesAs<int64_t>(psArray, nLength, aBuffer);
+    if (eFieldType != OFTReal)
+        return nullptr;
+    if (IsUInt64(format))
+        return GetArrowValuesAs<uint64_t>(psArray, nLength, aBuffer);
+    if (IsFloat32(format))
+        return GetArrowValuesAs<float>(psArray, nLength, aBuffer);
+    if (IsFloat64(format))
+        return GetArrowValuesAs<double>(psArray, nLength, aBuffer);
+    return nullptr;
+}
+
+/************************************************************************/
+/*                        GetArrowStringValues()                        */
+/************************************************************************/
+
+template <class OffsetType>
+static void GetArrowStringValues(const struct ArrowArray *psArray,
+                                 size_t nLength,
+                                 std::vector<const char *> &apszValues,
+                                 std::vector<size_t> &anLengths)
+{
+    const OffsetType *panOffsets =
+        static_cast<const OffsetType *>(psArray->buffers[1]) +
+        static_cast<size_t>(psArray->offset);
+    const char *pachData = static_cast<const char *>(psArray->buffers[2]);
+    apszValues.resize(nLength);
+    anLengths.resize(nLength);
+    for (size_t i = 0; i < nLength; ++i)
+    {
+        const char *pszValue = pachData + static_cast<size_t>(panOffsets[i]);
+        const size_t nSize =
+            static_cast<size_t>(panOffsets[i + 1] - panOffsets[i]);
+        // Strings set in OGRFeature stop at the first nul character
+        const char *pszNul =
+            static_cast<const char *>(memchr(pszValue, 0, nSize));
+        apszValues[i] = pszValue;
+        anLengths[i] = pszNul ? static_cast<size_t>(pszNul - pszValue) : nSize;
+    }
+}
+
+/************************************************************************/
+/*               FillValidityArrayFromCompiledAttrQuery()               */
+/************************************************************************/
+
+// Evaluate a compiled attribute filter directly on the Arrow buffers, without
+// going through OGRFeature. Return false if a column used by the filter
+// cannot be mapped to an Arrow array of compatible format, in which case the
+// caller must fallback to OGRFeatureQuery::Evaluate().
+static bool FillValidityArrayFromCompiledAttrQuery(
+    OGRCompiledFilter *poFilter, const OGRFeatureDefn *poFeatureDefn,
+    const std::map<std::string, std::vector<int>> &oMapFieldNameToArrowPath,
+    const struct ArrowSchema *schema, const struct ArrowArray *array,
+    GIntBig nBaseSeqFID,
+    const std::vector<int> &anArrowPathToFIDColumn,
+    std::vector<bool> &abyValidityFromFilters, size_t &nCountIntersecting)
+{
+    struct ColumnBuffers
+    {
+        std::vector<int64_t> anValues{};
+        std::vector<double> adfValues{};
+        std::vector<const char *> apszValues{};
+        std::vector<size_t> anLengths{};
+        std::vector<uint8_t> abyIsNull{};
+    };
+
+    const size_t nLength = abyValidityFromFilters.size();
+    const auto &aoColumns = poFilter->GetColumns();
+    std::vector<ColumnBuffers> aoBuffers(aoColumns.size());
+    std::vector<OGRCompiledFilter::ColumnValues> asValues(aoColumns.size());
+    for (size_t iCol = 0; iCol < aoColumns.size(); ++iCol)
+    {
+        const auto &oColumn = aoColumns[iCol];
+        auto &oBuffers = aoBuffers[iCol];
+        auto &sValues = asValues[iCol];
+
+        if (oColumn.iField < 0 && nBaseSeqFID >= 0)
+        {
+            oBuffers.anValues.resize(nLength);
+            for (size_t i = 0; i < nLength; ++i)
+                oBuffers.anValues[i] = nBaseSeqFID + static_cast<GIntBig>(i);
+            sValues.panValues = oBuffers.anValues.data();
+            continue;
+        }
+
+        const std::vector<int> *panArrowPath = &anArrowPathToFIDColumn;
+        if (oColumn.iField >= 0)
+        {
+            const auto oIter = oMapFieldNameToArrowPath.find(
+                poFeatureDefn->GetFieldDefn(oColumn.iField)->GetNameRef());
+            if (oIter == oMapFieldNameToArrowPath.end())
+                return false;
+            panArrowPath = &(oIter->second);
+        }
+        // Nested fields would require to take into account the validity of
+        // their parents
+        if (panArrowPath->size() != 1)
+            return false;
+
+        const int iChild = (*panArrowPath)[0];
+        const char *format = schema->children[iChild]->format;
+        const struct ArrowArray *psArray = array->children[iChild];
+
+        if (psArray->null_count != 0 && psArray->buffers[0])
+        {
+            const uint8_t *pabyValidity =
+                static_cast<const uint8_t *>(psArray->buffers[0]);
+            oBuffers.abyIsNull.resize(nLength);
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                oBuffers.abyIsNull[i] = !TestBit(
+                    pabyValidity, i + static_cast<size_t>(psArray->offset));
+            }
+            sValues.pabyIsNull = oBuffers.abyIsNull.data();
+        }
+
+        if (oColumn.iField < 0)
+        {
+            // FID column: only the formats handled by
+            // FillValidityArrayFromAttrQuery() set the FID of the feature.
+            if (IsInt32(format))
+            {
+                sValues.panValues = GetArrowValuesAs<int32_t>(
+                    psArray, nLength, oBuffers.anValues);
+            }
+            else if (IsInt64(format))
+            {
+                sValues.panValues = GetArrowValuesAs<int64_t>(
+                    psArray, nLength, oBuffers.anValues);
+            }
+            else
+            {
+                return false;
+            }
+
+            // A FID equal to OGRNullFID is null
+            oBuffers.abyIsNull.resize(nLength);
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                if (sValues.panValues[i] == OGRNullFID)
+                    oBuffers.abyIsNull[i] = 1;
+            }
+            sValues.pabyIsNull = oBuffers.abyIsNull.data();
+            continue;
+        }
+
+        const auto poFieldDefn = poFeatureDefn->GetFieldDefn(oColumn.iField);
+        switch (oColumn.eType)
+        {
+            case OGRCompiledFilter::ValueType::NONE:
+                break;
+
+            case OGRCompiledFilter::ValueType::INTEGER:
+                sValues.panValues = GetArrowNumericValues(
+                    format, poFieldDefn->GetType(), poFieldDefn->GetSubType(),
+                    psArray, nLength, oBuffers.anValues);
+                if (!sValues.panValues)
+                    return false;
+                break;
+
+            case OGRCompiledFilter::ValueType::REAL:
+                sValues.padfValues = GetArrowNumericValues(
+                    format, poFieldDefn->GetType(), poFieldDefn->GetSubType(),
+                    psArray, nLength, oBuffers.adfValues);
+                if (!sValues.padfValues)
+                    return false;
+                break;
+
+            case OGRCompiledFilter::ValueType::STRING:
+                if (IsString(format))
+                {
+                    GetArrowStringValues<uint32_t>(psArray, nLength,
+                                                   oBuffers.apszValues,
+                                                   oBuffers.anLengths);
+                }
+                else if (IsLargeString(format))
+                {
+                    GetArrowStringValues<uint64_t>(psArray, nLength,
+                                                   oBuffers.apszValues,
+                                                   oBuffers.anLengths);
+                }
+                else
+                {
+                    return false;
+                }
+                sValues.papszValues = oBuffers.apszValues.data();
+                sValues.panLengths = oBuffers.anLengths.data();
+                break;
+        }
+    }
+
+    // EvaluateBatch() is const, and only uses the workspace as scratch
+    // memory, so ranges of rows can be evaluated concurrently.
+    std::vector<uint8_t> abyResult(nLength);
+    constexpr size_t MIN_ROWS_PER_JOB = 16 * 1024;
+    ForEachRowRange(
+        nLength, MIN_ROWS_PER_JOB,
+        [poFilter, &asValues, &abyResult](size_t, size_t iStart, size_t iEnd)
+        {
+            std::vector<OGRCompiledFilter::ColumnValues> asRangeValues(
+                asValues);
+            for (auto &sValues : asRangeValues)
+            {
+                if (sValues.panValues)
+                    sValues.panValues += iStart;
+                if (sValues.padfValues)
+                    sValues.padfValues += iStart;
+                if (sValues.papszValues)
+                    sValues.papszValues += iStart;
+                if (sValues.panLengths)
+                    sValues.panLengths += iStart;
+                if (sValues.pabyIsNull)
+                    sValues.pabyIsNull += iStart;
+            }
+            OGRCompiledFilter::Workspace oWorkspace;
+            poFilter->EvaluateBatch(asRangeValues.data(), iEnd - iStart,
+                                    abyResult.data() + iStart, oWorkspace);
+        });
+    nCountIntersecting = 0;
+    for (size_t i = 0; i < nLength; ++i)
+    {
+        if (!abyValidityFromFilters[i])
+            continue;
+        if (abyResult[i])
+            ++nCountIntersecting;
+        else
+            abyValidityFromFilters[i] = false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                 FillValidityArrayFromAttrQuery()                     */
 /************************************************************************/
@@ -4956,6 +5326,16 @@ static size_t FillValidityArrayFromAttrQuery(
         }
     }
 
+    OGRCompiledFilter *poCompiledFilter = poAttrQuery->GetCompiledFilter();
+    if (poCompiledFilter &&
+        FillValidityArrayFromCompiledAttrQuery(
+            poCompiledFilter, poFeatureDefn, oMapFieldNameToArrowPath, schema,
+            array, nBaseSeqFID, anArrowPathToFIDColumn, abyValidityFromFilters,
+            nCountIntersecting))
+    {
+        return nCountIntersecting;
+    }
+
     for (size_t iRow = 0; iRow < nLength; ++iRow)
     {
         if (!abyValidityFromFilters[iRow])
@@ -5292,14 +5672,19 @@ void OGRLayer::PostFilterArrowArray(const struct ArrowSchema *schema,
     std::vector<bool> abyValidityFromFilters;
     const size_t nLength = static_cast<size_t>(array->length);
     const size_t nCountIntersectingGeom =
-        m_poFilterGeom ? (IsBinary(schema->children[iGeomField]->format)
-                              ? FillValidityArrayFromWKBArray<uint32_t>(
-                                    array->children[iGeomField], this,
-                                    abyValidityFromFilters)
-                              : FillValidityArrayFromWKBArray<uint64_t>(
-                                    array->children[iGeomField], this,
-                                    abyValidityFromFilters))
-                       : nLength;
+        m_poFilterGeom
+            ? (IsBinary(schema->children[iGeomField]->format)
+                   ? FillValidityArrayFromWKBArray<uint32_t>(
+                         array->children[iGeomField], m_poFilterGeom,
+                         CPL_TO_BOOL(m_bFilterIsEnvelope), m_sFilterEnvelope,
+                         const_cast<OGRLayer *>(this)->m_pPreparedFilterGeom,
+                         abyValidityFromFilters)
+                   : FillValidityArrayFromWKBArray<uint64_t>(
+                         array->children[iGeomField], m_poFilterGeom,
+                         CPL_TO_BOOL(m_bFilterIsEnvelope), m_sFilterEnvelope,
+                         const_cast<OGRLayer *>(this)->m_pPreparedFilterGeom,
+                         abyValidityFromFilters))
+            : nLength;
     if (!m_poFilterGeom)
         abyValidityFromFilters.resize(nLength, true);
     const size_t nCountIntersecting =
@@ -7158,27 +7543,14 @@ FillFieldBinary(const struct ArrowArray *array, int iOGRFieldIdx,
         static_cast<size_t>(panOffsets[iFeature + 1] - panOffsets[iFeature]);
     if (asFieldInfo[iArrowIdx].bIsGeomCol)
     {
-        size_t nBytesConsumedOut = 0;
-
-        // Check if we can reuse the existing geometry, to save dynamic memory
-        // allocations.
-        if (nLen >= 5 && pabyData[0] == wkbNDR && pabyData[1] <= wkbTriangle &&
-            pabyData[2] == 0 && pabyData[3] == 0 && pabyData[4] == 0)
+        // SetGeomField() refills the existing geometry when it has the same
+        // type, to save dynamic memory allocations.
+        OGRWKBGeometryView oView;
+        if (!oView.Init(pabyData, nLen) ||
+            oFeature.SetGeomField(iOGRFieldIdx, oView) != OGRERR_NONE)
         {
-            const auto poExistingGeom = oFeature.GetGeomFieldRef(iOGRFieldIdx);
-            if (poExistingGeom &&
-                poExistingGeom->getGeometryType() == pabyData[1])
-            {
-                poExistingGeom->importFromWkb(pabyData, nLen, wkbVariantIso,
-                                              nBytesConsumedOut);
-                return true;
-            }
+            oFeature.SetGeomFieldDirectly(iOGRFieldIdx, nullptr);
         }
-
-        OGRGeometry *poGeometry = nullptr;
-        OGRGeometryFactory::createFromWkb(pabyData, nullptr, &poGeometry, nLen,
-                                          wkbVariantIso, nBytesConsumedOut);
-        oFeature.SetGeomFieldDirectly(iOGRFieldIdx, poGeometry);
     }
     else
     {
@@ -78,6 +78,24 @@ void OGRGeoPackageLayer::ClearStatement()
 OGRFeature *OGRGeoPackageLayer::GetNextFeature()
 
 {
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/************************************************************************/
+
+/** Fetch the next feature, refilling poReused, of which ownership is taken,
+ * if it is not nullptr. */
+OGRFeature *OGRGeoPackageLayer::GetNextFeatureInternal(OGRFeature *poReused)
+
+{
+    // Feature, of the caller or rejected by the filters, that is refilled
+    // instead of allocating a new one.
+    std::unique_ptr<OGRFeature> poFeatureToFill(poReused);
+    if (poFeatureToFill && poFeatureToFill->GetDefnRef() != m_poFeatureDefn)
+        poFeatureToFill.reset();
+
     if (m_bEOF)
         return nullptr;
 
@@ -119,14 +137,15 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
             m_bDoStep = true;
         }
 
-        OGRFeature *poFeature = TranslateFeature(m_poQueryStatement);
+        OGRFeature *poFeature =
+            TranslateFeature(m_poQueryStatement, poFeatureToFill.release());
 
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
             return poFeature;
 
-        delete poFeature;
+        poFeatureToFill.reset(poFeature);
     }
 }
 
@@ -328,13 +347,28 @@ bool OGRGeoPackageLayer::ParseDateTimeField(const char *pszTxt,
 /*                         TranslateFeature()                           */
 /************************************************************************/
 
-OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
+/** Return a feature from the current result. If poFeatureToFill, which must
+ * be of the layer definition, is not nullptr, it is reset and refilled, and
+ * its geometry is reused if the new one has the same type. */
+OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt,
+                                                 OGRFeature *poFeatureToFill)
 
 {
     /* -------------------------------------------------------------------- */
     /*      Create a feature from the current result.                       */
     /* -------------------------------------------------------------------- */
-    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    std::unique_ptr<OGRGeometry> poGeomToReuse;
+    OGRFeature *poFeature = poFeatureToFill;
+    if (poFeature)
+    {
+        CPLAssert(poFeature->GetDefnRef() == m_poFeatureDefn);
+        poGeomToReuse.reset(poFeature->StealGeometry());
+        poFeature->Reset();
+    }
+    else
+    {
+        poFeature = new OGRFeature(m_poFeatureDefn);
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Set FID if we have a column to set it from.                     */
@@ -370,8 +404,30 @@ OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
             // coverity[tainted_data_return]
             const GByte *pabyGpkg = static_cast<const GByte *>(
                 sqlite3_column_blob(hStmt, m_iGeomCol));
-            OGRGeometry *poGeom =
-                GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr);
+            OGRGeometry *poGeom = nullptr;
+            GPkgHeader oHeader;
+            OGRwkbGeometryType eGeomType = wkbUnknown;
+            size_t nBytesConsumed = 0;
+            // Refill the previous geometry if it has the same type, so that
+            // curves reuse their point arrays.
+            if (poGeomToReuse &&
+                GPkgHeaderFromWKB(pabyGpkg, iGpkgSize, &oHeader) ==
+                    OGRERR_NONE &&
+                OGRReadWKBGeometryType(pabyGpkg + oHeader.nHeaderLen,
+                                       wkbVariantIso,
+                                       &eGeomType) == OGRERR_NONE &&
+                eGeomType == poGeomToReuse->getGeometryType() &&
+                poGeomToReuse->importFromWkb(
+                    pabyGpkg + oHeader.nHeaderLen,
+                    iGpkgSize - oHeader.nHeaderLen, wkbVariantIso,
+                    nBytesConsumed) == OGRERR_NONE)
+            {
+                poGeom = poGeomToReuse.release();
+            }
+            else
+            {
+                poGeom = GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr);
+            }
             if (poGeom == nullptr)
             {
                 // Try also spatialite geometry blobs
@@ -3628,6 +3628,16 @@ OGRErr OGRGeoPackageTableLayer::ResetStatementInternal(GIntBig nStartIndex)
 
 OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
 {
+    return GetNextFeatureReusing(nullptr);
+}
+
+/************************************************************************/
+/*                       GetNextFeatureReusing()                        */
+/************************************************************************/
+
+OGRFeature *OGRGeoPackageTableLayer::GetNextFeatureReusing(OGRFeature *poReused)
+{
+    std::unique_ptr<OGRFeature> poFeatureToFill(poReused);
     if (m_bEOF)
         return nullptr;
     if (!m_bFeatureDefnCompleted)
@@ -3645,7 +3655,8 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
             return nullptr;
     }
 
-    OGRFeature *poFeature = OGRGeoPackageLayer::GetNextFeature();
+    OGRFeature *poFeature =
+        GetNextFeatureInternal(poFeatureToFill.release());
     if (poFeature && m_iFIDAsRegularColumnIndex >= 0)
     {
         poFeature->SetField(m_iFIDAsRegularColumnIndex, poFeature->GetFID());
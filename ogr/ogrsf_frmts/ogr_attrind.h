@@ -40,6 +40,11 @@ class CPL_DLL OGRAttrIndex
     virtual OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) = 0;
 
     virtual OGRErr Clear() = 0;
+
+    virtual bool SupportsRangeQueries() const;
+    virtual GIntBig *GetRangeMatches(const OGRField *psMin, bool bMinIncluded,
+                                     const OGRField *psMax, bool bMaxIncluded,
+                                     GIntBig *pnFIDCount);
 };
 
 /************************************************************************/
@@ -74,6 +79,7 @@ class CPL_DLL OGRLayerAttrIndex
 };
 
 OGRLayerAttrIndex CPL_DLL *OGRCreateDefaultLayerIndex();
+OGRLayerAttrIndex CPL_DLL *OGRCreateSidecarLayerIndex();
 
 //! @endcond
 
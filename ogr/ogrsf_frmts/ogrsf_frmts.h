@@ -100,6 +100,8 @@ class CPL_DLL OGRLayer : public GDALMajorObject
     // int          FilterGeometry( OGRGeometry *, OGREnvelope*
     // psGeometryEnvelope);
     int InstallFilter(const OGRGeometry *);
+    OGRFeature *RecycleFeature(OGRFeature *poFeature,
+                               OGRFeatureDefn *poFeatureDefn);
     bool
     ValidateGeometryFieldIndexForSetSpatialFilter(int iGeomField,
                                                   const OGRGeometry *poGeomIn,
@@ -211,6 +213,8 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     virtual void ResetReading() = 0;
     virtual OGRFeature *GetNextFeature() CPL_WARN_UNUSED_RESULT = 0;
+    virtual OGRFeature *
+    GetNextFeatureReusing(OGRFeature *poFeature) CPL_WARN_UNUSED_RESULT;
     virtual OGRErr SetNextByIndex(GIntBig nIndex);
     virtual OGRFeature *GetFeature(GIntBig nFID) CPL_WARN_UNUSED_RESULT;
 
@@ -359,6 +363,9 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     /* consider these private */
     OGRErr InitializeIndexSupport(const char *);
+    OGRErr InitializeSidecarIndexSupport(const char *);
+    OGRErr BuildSidecarSpatialIndex(int iGeomField);
+    const std::vector<GIntBig> *GetSidecarSpatialIndexFIDs();
 
     OGRLayerAttrIndex *GetIndex()
     {
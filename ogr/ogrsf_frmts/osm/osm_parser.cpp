@@ -30,6 +30,7 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #ifdef HAVE_EXPAT
 #include "ogr_expat.h"
@@ -2773,11 +2774,8 @@ OSMContext *OSM_Open(const char *pszFilename, NotifyNodesFunc pfnNotifyNodes,
         OSM_Close(psCtxt);
         return nullptr;
     }
-    const char *pszNumThreads =
-        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
-    int nNumCPUs = CPLGetNumCPUs();
-    if (pszNumThreads && !EQUAL(pszNumThreads, "ALL_CPUS"))
-        nNumCPUs = std::max(0, std::min(2 * nNumCPUs, atoi(pszNumThreads)));
+    const int nNumCPUs = GDALGetNumThreads(nullptr, nullptr, "ALL_CPUS",
+                                           2 * CPLGetNumCPUs());
     if (nNumCPUs > 1)
     {
         psCtxt->poWTP = new CPLWorkerThreadPool();
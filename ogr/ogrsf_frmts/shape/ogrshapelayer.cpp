@@ -883,9 +883,13 @@ OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
 /*                                                                      */
 /*      Take a shape id, a geometry, and a feature, and set the feature */
 /*      if the shapeid bbox intersects the geometry.                    */
+/*                                                                      */
+/*      If poFeatureToFill is not NULL, it is filled and returned       */
+/*      instead of a new feature, and remains owned by the caller.      */
 /************************************************************************/
 
-OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
+OGRFeature *OGRShapeLayer::FetchShape(int iShapeId,
+                                      OGRFeature *poFeatureToFill)
 
 {
     OGRFeature *poFeature = nullptr;
@@ -906,7 +910,8 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         {
             poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn,
                                           iShapeId, psShape, m_osEncoding,
-                                          m_bHasWarnedWrongWindingOrder);
+                                          m_bHasWarnedWrongWindingOrder,
+                                          poFeatureToFill, &m_oGeometryPool);
         }
         else if (m_sFilterEnvelope.MaxX < psShape->dfXMin ||
                  m_sFilterEnvelope.MaxY < psShape->dfYMin ||
@@ -920,14 +925,16 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         {
             poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn,
                                           iShapeId, psShape, m_osEncoding,
-                                          m_bHasWarnedWrongWindingOrder);
+                                          m_bHasWarnedWrongWindingOrder,
+                                          poFeatureToFill, &m_oGeometryPool);
         }
     }
     else
     {
         poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn, iShapeId,
                                       nullptr, m_osEncoding,
-                                      m_bHasWarnedWrongWindingOrder);
+                                      m_bHasWarnedWrongWindingOrder,
+                                      poFeatureToFill, &m_oGeometryPool);
     }
 
     return poFeature;
@@ -940,6 +947,22 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
 OGRFeature *OGRShapeLayer::GetNextFeature()
 
 {
+    return GetNextFeatureReusing(nullptr);
+}
+
+/************************************************************************/
+/*                       GetNextFeatureReusing()                        */
+/************************************************************************/
+
+OGRFeature *OGRShapeLayer::GetNextFeatureReusing(OGRFeature *poReused)
+
+{
+    // Feature, of the caller or of a previous iteration, that is refilled
+    // instead of allocating a new one.
+    std::unique_ptr<OGRFeature> poFeatureToFill(poReused);
+    if (poFeatureToFill && poFeatureToFill->GetDefnRef() != m_poFeatureDefn)
+        poFeatureToFill.reset();
+
     if (!TouchLayer())
         return nullptr;
 
@@ -961,6 +984,12 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
 
     while (true)
     {
+        if (poFeatureToFill)
+        {
+            m_oGeometryPool.RecycleGeometries(poFeatureToFill.get());
+            poFeatureToFill->Reset();
+        }
+
         if (m_panMatchingFIDs != nullptr)
         {
             if (m_panMatchingFIDs[m_iMatchingFID] == OGRNullFID)
@@ -971,7 +1000,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
             // Check the shape object's geometry, and if it matches
             // any spatial filter, return it.
             poFeature =
-                FetchShape(static_cast<int>(m_panMatchingFIDs[m_iMatchingFID]));
+                FetchShape(static_cast<int>(m_panMatchingFIDs[m_iMatchingFID]),
+                           poFeatureToFill.get());
 
             m_iMatchingFID++;
         }
@@ -990,10 +1020,11 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                          VSIFErrorL(VSI_SHP_GetVSIL(m_hDBF->fp)))
                     return nullptr;  //* I/O error.
                 else
-                    poFeature = FetchShape(m_iNextShapeId);
+                    poFeature =
+                        FetchShape(m_iNextShapeId, poFeatureToFill.get());
             }
             else
-                poFeature = FetchShape(m_iNextShapeId);
+                poFeature = FetchShape(m_iNextShapeId, poFeatureToFill.get());
 
             m_iNextShapeId++;
         }
@@ -1012,10 +1043,13 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                 (m_poAttrQuery == nullptr ||
                  m_poAttrQuery->Evaluate(poFeature)))
             {
+                if (poFeature == poFeatureToFill.get())
+                    CPL_IGNORE_RET_VAL(poFeatureToFill.release());
                 return poFeature;
             }
 
-            delete poFeature;
+            if (poFeature != poFeatureToFill.get())
+                poFeatureToFill.reset(poFeature);
         }
     }
 }
@@ -30,6 +30,7 @@
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_geometry.h"
+#include "ogr_geometry_pool.h"
 #include "ogrpgeogeometry.h"
 #include "ogrshape.h"
 #include "shapefil.h"
@@ -56,17 +57,46 @@ static void RingStartEnd(SHPObject *psShape, int ring, int *start, int *end)
     }
 }
 
+/************************************************************************/
+/*                            NewGeometry()                             */
+/*                                                                      */
+/*      Take an object from the pool if there is one, and reset its     */
+/*      dimension flags to the ones of a new object, or allocate one.   */
+/************************************************************************/
+
+template <class T> static T *NewGeometry(OGRGeometryPool *poGeometryPool)
+{
+    if (poGeometryPool == nullptr)
+        return new T();
+    T *poGeom = poGeometryPool->Acquire<T>();
+    poGeom->set3D(FALSE);
+    poGeom->setMeasured(FALSE);
+    return poGeom;
+}
+
+static OGRPoint *NewPoint(OGRGeometryPool *poGeometryPool,
+                          const OGRPoint &oPoint)
+{
+    if (poGeometryPool == nullptr)
+        return new OGRPoint(oPoint);
+    OGRPoint *poPoint = poGeometryPool->Acquire<OGRPoint>();
+    *poPoint = oPoint;
+    return poPoint;
+}
+
 /************************************************************************/
 /*                        CreateLinearRing                              */
 /************************************************************************/
 static OGRLinearRing *CreateLinearRing(SHPObject *psShape, int ring, bool bHasZ,
-                                       bool bHasM)
+                                       bool bHasM,
+                                       OGRGeometryPool *poGeometryPool)
 {
     int nRingStart = 0;
     int nRingEnd = 0;
     RingStartEnd(psShape, ring, &nRingStart, &nRingEnd);
 
-    OGRLinearRing *const poRing = new OGRLinearRing();
+    OGRLinearRing *const poRing =
+        NewGeometry<OGRLinearRing>(poGeometryPool);
     if (!(nRingEnd >= nRingStart))
         return poRing;
 
@@ -97,7 +127,8 @@ static OGRLinearRing *CreateLinearRing(SHPObject *psShape, int ring, bool bHasZ,
 /************************************************************************/
 
 OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
-                              bool &bHasWarnedWrongWindingOrder)
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRGeometryPool *poGeometryPool)
 {
 #if DEBUG_VERBOSE
     CPLDebug("Shape", "SHPReadOGRObject( iShape=%d )", iShape);
@@ -118,25 +149,29 @@ OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
     /* -------------------------------------------------------------------- */
     if (psShape->nSHPType == SHPT_POINT)
     {
-        poOGR = new OGRPoint(psShape->padfX[0], psShape->padfY[0]);
+        poOGR = NewPoint(poGeometryPool,
+                         OGRPoint(psShape->padfX[0], psShape->padfY[0]));
     }
     else if (psShape->nSHPType == SHPT_POINTZ)
     {
         if (psShape->bMeasureIsUsed)
         {
-            poOGR = new OGRPoint(psShape->padfX[0], psShape->padfY[0],
-                                 psShape->padfZ[0], psShape->padfM[0]);
+            poOGR = NewPoint(poGeometryPool,
+                             OGRPoint(psShape->padfX[0], psShape->padfY[0],
+                                      psShape->padfZ[0], psShape->padfM[0]));
         }
         else
         {
-            poOGR = new OGRPoint(psShape->padfX[0], psShape->padfY[0],
-                                 psShape->padfZ[0]);
+            poOGR = NewPoint(poGeometryPool,
+                             OGRPoint(psShape->padfX[0], psShape->padfY[0],
+                                      psShape->padfZ[0]));
         }
     }
     else if (psShape->nSHPType == SHPT_POINTM)
     {
-        poOGR = new OGRPoint(psShape->padfX[0], psShape->padfY[0], 0.0,
-                             psShape->padfM[0]);
+        poOGR = NewPoint(poGeometryPool,
+                         OGRPoint(psShape->padfX[0], psShape->padfY[0], 0.0,
+                                  psShape->padfM[0]));
         poOGR->set3D(FALSE);
     }
     /* -------------------------------------------------------------------- */
@@ -152,43 +187,40 @@ OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
         }
         else
         {
-            OGRMultiPoint *poOGRMPoint = new OGRMultiPoint();
+            OGRMultiPoint *poOGRMPoint =
+                NewGeometry<OGRMultiPoint>(poGeometryPool);
 
             for (int i = 0; i < psShape->nVertices; i++)
             {
-                OGRPoint *poPoint = nullptr;
+                OGRPoint oPoint;
 
                 if (psShape->nSHPType == SHPT_MULTIPOINTZ)
                 {
                     if (psShape->padfM)
                     {
-                        poPoint =
-                            new OGRPoint(psShape->padfX[i], psShape->padfY[i],
-                                         psShape->padfZ[i], psShape->padfM[i]);
+                        oPoint = OGRPoint(psShape->padfX[i], psShape->padfY[i],
+                                          psShape->padfZ[i], psShape->padfM[i]);
                     }
                     else
                     {
-                        poPoint =
-                            new OGRPoint(psShape->padfX[i], psShape->padfY[i],
-                                         psShape->padfZ[i]);
+                        oPoint = OGRPoint(psShape->padfX[i], psShape->padfY[i],
+                                          psShape->padfZ[i]);
                     }
                 }
                 else if (psShape->nSHPType == SHPT_MULTIPOINTM &&
                          psShape->padfM)
                 {
-                    poPoint = new OGRPoint(psShape->padfX[i], psShape->padfY[i],
-                                           0.0, psShape->padfM[i]);
-                    poPoint->set3D(FALSE);
+                    oPoint = OGRPoint(psShape->padfX[i], psShape->padfY[i], 0.0,
+                                      psShape->padfM[i]);
+                    oPoint.set3D(FALSE);
                 }
                 else
                 {
-                    poPoint =
-                        new OGRPoint(psShape->padfX[i], psShape->padfY[i]);
+                    oPoint = OGRPoint(psShape->padfX[i], psShape->padfY[i]);
                 }
 
-                poOGRMPoint->addGeometry(poPoint);
-
-                delete poPoint;
+                poOGRMPoint->addGeometryDirectly(
+                    NewPoint(poGeometryPool, oPoint));
             }
 
             poOGR = poOGRMPoint;
@@ -209,7 +241,8 @@ OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
         }
         else if (psShape->nParts == 1)
         {
-            OGRLineString *poOGRLine = new OGRLineString();
+            OGRLineString *poOGRLine =
+                NewGeometry<OGRLineString>(poGeometryPool);
             poOGR = poOGRLine;
 
             if (psShape->nSHPType == SHPT_ARCZ)
@@ -225,7 +258,8 @@ OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
         }
         else
         {
-            OGRMultiLineString *poOGRMulti = new OGRMultiLineString();
+            OGRMultiLineString *poOGRMulti =
+                NewGeometry<OGRMultiLineString>(poGeometryPool);
             poOGR = poOGRMulti;
 
             for (int iRing = 0; iRing < psShape->nParts; iRing++)
@@ -233,7 +267,8 @@ OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
                 int nRingPoints = 0;
                 int nRingStart = 0;
 
-                OGRLineString *poLine = new OGRLineString();
+                OGRLineString *poLine =
+                    NewGeometry<OGRLineString>(poGeometryPool);
 
                 if (psShape->panPartStart == nullptr)
                 {
@@ -295,23 +330,25 @@ OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
         else if (psShape->nParts == 1)
         {
             // Surely outer ring.
-            OGRPolygon *poOGRPoly = new OGRPolygon();
+            OGRPolygon *poOGRPoly = NewGeometry<OGRPolygon>(poGeometryPool);
             poOGR = poOGRPoly;
 
-            OGRLinearRing *poRing = CreateLinearRing(psShape, 0, bHasZ, bHasM);
+            OGRLinearRing *poRing =
+                CreateLinearRing(psShape, 0, bHasZ, bHasM, poGeometryPool);
             poOGRPoly->addRingDirectly(poRing);
         }
         else
         {
             OGRPolygon **tabPolygons = new OGRPolygon *[psShape->nParts];
-            tabPolygons[0] = new OGRPolygon();
-            auto poExteriorRing = CreateLinearRing(psShape, 0, bHasZ, bHasM);
+            tabPolygons[0] = NewGeometry<OGRPolygon>(poGeometryPool);
+            auto poExteriorRing =
+                CreateLinearRing(psShape, 0, bHasZ, bHasM, poGeometryPool);
             tabPolygons[0]->addRingDirectly(poExteriorRing);
             for (int iRing = 1; iRing < psShape->nParts; iRing++)
             {
-                tabPolygons[iRing] = new OGRPolygon();
-                tabPolygons[iRing]->addRingDirectly(
-                    CreateLinearRing(psShape, iRing, bHasZ, bHasM));
+                tabPolygons[iRing] = NewGeometry<OGRPolygon>(poGeometryPool);
+                tabPolygons[iRing]->addRingDirectly(CreateLinearRing(
+                    psShape, iRing, bHasZ, bHasM, poGeometryPool));
             }
 
             // Tries to detect bad geometries where a multi-part multipolygon is
@@ -1280,10 +1317,14 @@ OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
 /*                         SHPReadOGRFeature()                          */
 /************************************************************************/
 
+/* If poFeatureToFill is not NULL, it must be an empty feature of poDefn, */
+/* owned by the caller, which is filled and returned instead of a new one. */
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder)
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToFill,
+                              OGRGeometryPool *poGeometryPool)
 
 {
     if (iShape < 0 || (hSHP != nullptr && iShape >= hSHP->nRecords) ||
@@ -1307,7 +1348,8 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
         return nullptr;
     }
 
-    OGRFeature *poFeature = new OGRFeature(poDefn);
+    OGRFeature *poFeature =
+        poFeatureToFill ? poFeatureToFill : new OGRFeature(poDefn);
 
     /* -------------------------------------------------------------------- */
     /*      Fetch geometry from Shapefile to OGRFeature.                    */
@@ -1316,8 +1358,9 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
     {
         if (!poDefn->IsGeometryIgnored())
         {
-            OGRGeometry *poGeometry = SHPReadOGRObject(
-                hSHP, iShape, psShape, bHasWarnedWrongWindingOrder);
+            OGRGeometry *poGeometry =
+                SHPReadOGRObject(hSHP, iShape, psShape,
+                                 bHasWarnedWrongWindingOrder, poGeometryPool);
 
             // Two possibilities are expected here (both are tested by
             // GDAL Autotests):
@@ -14,6 +14,11 @@
 #include "ogr_api.h"
 #include "ogrsf_frmts.h"
 #include "ogr_recordbatch.h"
+#include "ogr_wkb.h"
+
+#include <chrono>
+#include <memory>
+#include <vector>
 
 /************************************************************************/
 /*                               Usage()                                */
@@ -25,10 +30,110 @@ static void Usage()
         "Usage: bench_ogr_batch [-where filter] [-spat xmin ymin xmax ymax]\n");
     printf("                      [--stream-opt NAME=VALUE] [-v] [-sql "
            "<statement]*\n");
+    printf("                      [-wkb NDR|XDR]\n");
     printf("                      filename [layer_name]\n");
+    printf("\n");
+    printf("-wkb: parse the WKB geometries of the batches, compute their "
+           "envelope,\n");
+    printf("      and serialize them back in the specified byte order, "
+           "reporting the\n");
+    printf("      time spent in each step.\n");
     exit(1);
 }
 
+/************************************************************************/
+/*                             WKBTimings                               */
+/************************************************************************/
+
+struct WKBTimings
+{
+    GUIntBig nGeometries = 0;
+    double dfEnvelope = 0;
+    double dfImport = 0;
+    double dfExport = 0;
+    double dfImportExported = 0;
+};
+
+/************************************************************************/
+/*                         BenchWKBGeometries()                         */
+/************************************************************************/
+
+static void BenchWKBGeometries(const struct ArrowArray *psArray,
+                               bool bLargeBinary, OGRwkbByteOrder eByteOrder,
+                               WKBTimings &sTimings)
+{
+    const GByte *pabyValidity =
+        static_cast<const GByte *>(psArray->buffers[0]);
+    const int32_t *panOffsets32 =
+        static_cast<const int32_t *>(psArray->buffers[1]);
+    const int64_t *panOffsets64 =
+        static_cast<const int64_t *>(psArray->buffers[1]);
+    const GByte *pabyData = static_cast<const GByte *>(psArray->buffers[2]);
+
+    std::vector<std::pair<const GByte *, size_t>> aoWKB;
+    for (int64_t i = 0; i < psArray->length; ++i)
+    {
+        const int64_t iRow = i + psArray->offset;
+        if (pabyValidity && (pabyValidity[iRow / 8] & (1 << (iRow % 8))) == 0)
+            continue;
+        const size_t nStart =
+            bLargeBinary ? static_cast<size_t>(panOffsets64[iRow])
+                         : static_cast<size_t>(panOffsets32[iRow]);
+        const size_t nEnd =
+            bLargeBinary ? static_cast<size_t>(panOffsets64[iRow + 1])
+                         : static_cast<size_t>(panOffsets32[iRow + 1]);
+        aoWKB.emplace_back(pabyData + nStart, nEnd - nStart);
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const auto Elapsed = [](Clock::time_point start)
+    { return std::chrono::duration<double>(Clock::now() - start).count(); };
+
+    auto start = Clock::now();
+    OGREnvelope sEnvelope;
+    for (const auto &[pabyWKB, nWKBSize] : aoWKB)
+    {
+        OGRWKBGetBoundingBox(pabyWKB, nWKBSize, sEnvelope);
+    }
+    sTimings.dfEnvelope += Elapsed(start);
+
+    std::vector<std::unique_ptr<OGRGeometry>> apoGeoms;
+    start = Clock::now();
+    for (const auto &[pabyWKB, nWKBSize] : aoWKB)
+    {
+        OGRGeometry *poGeom = nullptr;
+        OGRGeometryFactory::createFromWkb(pabyWKB, nullptr, &poGeom,
+                                          nWKBSize);
+        if (poGeom)
+            apoGeoms.emplace_back(poGeom);
+    }
+    sTimings.dfImport += Elapsed(start);
+
+    std::vector<std::vector<GByte>> aabyExported(apoGeoms.size());
+    OGRwkbExportOptions sOptions;
+    sOptions.eByteOrder = eByteOrder;
+    sOptions.eWkbVariant = wkbVariantIso;
+    start = Clock::now();
+    for (size_t i = 0; i < apoGeoms.size(); ++i)
+    {
+        aabyExported[i].resize(apoGeoms[i]->WkbSize());
+        apoGeoms[i]->exportToWkb(aabyExported[i].data(), &sOptions);
+    }
+    sTimings.dfExport += Elapsed(start);
+
+    start = Clock::now();
+    for (const auto &abyWKB : aabyExported)
+    {
+        OGRGeometry *poGeom = nullptr;
+        OGRGeometryFactory::createFromWkb(abyWKB.data(), nullptr, &poGeom,
+                                          abyWKB.size());
+        delete poGeom;
+    }
+    sTimings.dfImportExported += Elapsed(start);
+
+    sTimings.nGeometries += apoGeoms.size();
+}
+
 /************************************************************************/
 /*                               main()                                 */
 /************************************************************************/
@@ -49,6 +154,8 @@ int main(int argc, char *argv[])
     CPLStringList aosSteamOptions;
     bool bVerbose = false;
     const char *pszSQL = nullptr;
+    bool bBenchWKB = false;
+    OGRwkbByteOrder eWKBByteOrder = wkbNDR;
     for (int iArg = 1; iArg < argc; ++iArg)
     {
         if (iArg + 1 < argc && strcmp(argv[iArg], "-where") == 0)
@@ -80,6 +187,15 @@ int main(int argc, char *argv[])
             aosSteamOptions.AddString(argv[iArg + 1]);
             ++iArg;
         }
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-wkb") == 0)
+        {
+            bBenchWKB = true;
+            if (EQUAL(argv[iArg + 1], "XDR"))
+                eWKBByteOrder = wkbXDR;
+            else if (!EQUAL(argv[iArg + 1], "NDR"))
+                Usage();
+            ++iArg;
+        }
         else if (strcmp(argv[iArg], "-v") == 0)
         {
             bVerbose = true;
@@ -157,9 +273,34 @@ int main(int argc, char *argv[])
     }
 
     struct ArrowSchema schema;
+    int iWKBColumn = -1;
+    bool bWKBLargeBinary = false;
     if (stream.get_schema(&stream, &schema) == 0)
     {
-        // Do something useful
+        if (bBenchWKB)
+        {
+            std::string osGeomColumn(poLayer->GetGeometryColumn());
+            if (osGeomColumn.empty())
+                osGeomColumn = aosSteamOptions.FetchNameValueDef(
+                    "GEOMETRY_NAME", "wkb_geometry");
+            for (int64_t i = 0; i < schema.n_children; ++i)
+            {
+                const auto psChild = schema.children[i];
+                if (osGeomColumn == psChild->name &&
+                    (strcmp(psChild->format, "z") == 0 ||
+                     strcmp(psChild->format, "Z") == 0))
+                {
+                    iWKBColumn = static_cast<int>(i);
+                    bWKBLargeBinary = strcmp(psChild->format, "Z") == 0;
+                    break;
+                }
+            }
+            if (iWKBColumn < 0)
+            {
+                fprintf(stderr, "Cannot find WKB geometry column %s\n",
+                        osGeomColumn.c_str());
+            }
+        }
         schema.release(&schema);
     }
     else
@@ -175,6 +316,7 @@ int main(int argc, char *argv[])
     int64_t lastId = 0;
 #endif
     GUIntBig nFeatureCount = 0;
+    WKBTimings sWKBTimings;
     while (true)
     {
         struct ArrowArray array;
@@ -183,6 +325,11 @@ int main(int argc, char *argv[])
             break;
         }
         nFeatureCount += array.length;
+        if (iWKBColumn >= 0)
+        {
+            BenchWKBGeometries(array.children[iWKBColumn], bWKBLargeBinary,
+                               eWKBByteOrder, sWKBTimings);
+        }
 #if 0
         const int64_t* fid_col = static_cast<const int64_t*>(array.children[0]->buffers[1]);
         for(int64_t i = 0; i < array.length; ++i )
@@ -202,6 +349,19 @@ int main(int argc, char *argv[])
         printf(CPL_FRMT_GUIB " features/rows selected\n", nFeatureCount);
     }
 
+    if (iWKBColumn >= 0)
+    {
+        printf(CPL_FRMT_GUIB " geometries\n", sWKBTimings.nGeometries);
+        printf("OGRWKBGetBoundingBox():          %.3f s\n",
+               sWKBTimings.dfEnvelope);
+        printf("createFromWkb():                 %.3f s\n",
+               sWKBTimings.dfImport);
+        printf("exportToWkb(%s):                %.3f s\n",
+               eWKBByteOrder == wkbXDR ? "XDR" : "NDR", sWKBTimings.dfExport);
+        printf("createFromWkb() of exported WKB: %.3f s\n",
+               sWKBTimings.dfImportExported);
+    }
+
     if (pszSQL)
         poDS->ReleaseResultSet(poLayer);
 
@@ -29,6 +29,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_vsil_curl_class.h"
+#include "cpl_vsil_io_metrics.h"
 
 // gcc or clang complains about C-style cast in #define like
 // CURL_ZERO_TERMINATED
@@ -695,6 +696,7 @@ bool CPLHTTPRetryContext::CanRetry()
     if (m_nRetryCount >= m_oParameters.nMaxRetry)
         return false;
     m_nRetryCount++;
+    cpl::VSIIOMetrics::LogRetry();
     return true;
 }
 
@@ -716,6 +718,7 @@ bool CPLHTTPRetryContext::CanRetry(int response_code, const char *pszErrBuf,
     if (m_dfNextDelay == 0.0)
         return false;
     m_nRetryCount++;
+    cpl::VSIIOMetrics::LogRetry();
     return true;
 }
 
@@ -180,6 +180,9 @@ typedef enum
 VSIRangeStatus CPL_DLL VSIFGetRangeStatusL(VSILFILE *fp, vsi_l_offset nStart,
                                            vsi_l_offset nLength);
 
+const void CPL_DLL *VSIFGetMappedRegionL(VSILFILE *fp, vsi_l_offset nOffset,
+                                         size_t nSize);
+
 int CPL_DLL VSIIngestFile(VSILFILE *fp, const char *pszFilename,
                           GByte **ppabyRet, vsi_l_offset *pnSize,
                           GIntBig nMaxSize) CPL_WARN_UNUSED_RESULT;
@@ -461,6 +464,11 @@ int CPL_DLL VSISync(const char *pszSource, const char *pszTarget,
                     GDALProgressFunc pProgressFunc, void *pProgressData,
                     char ***ppapszOutputs);
 
+int CPL_DLL VSIZipExtractAll(const char *pszSource, const char *pszTargetDir,
+                             CSLConstList papszOptions,
+                             GDALProgressFunc pfnProgress,
+                             void *pProgressData);
+
 int CPL_DLL VSIMultipartUploadGetCapabilities(
     const char *pszFilename, int *pbNonSequentialUploadSupported,
     int *pbParallelUploadSupported, int *pbAbortSupported,
@@ -491,6 +499,9 @@ GIntBig CPL_DLL VSIGetDiskFreeSpace(const char *pszDirname);
 void CPL_DLL VSINetworkStatsReset(void);
 char CPL_DLL *VSINetworkStatsGetAsSerializedJSON(char **papszOptions);
 
+void CPL_DLL VSIIOMetricsReset(void);
+char CPL_DLL *VSIIOMetricsGetAsSerializedJSON(CSLConstList papszOptions);
+
 #if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
 extern "C++"
 {
@@ -132,6 +132,11 @@ class VSIMemFile final
     time_t mTime = 0;
     CPL_SHARED_MUTEX_TYPE m_oMutex{};
 
+    // Number of handles opened in update mode, and of handles that have
+    // returned a pointer from GetMappedRegion(). Protected by m_oMutex.
+    int nUpdateHandles = 0;
+    int nMappingHandles = 0;
+
     VSIMemFile();
     ~VSIMemFile();
 
@@ -155,6 +160,7 @@ class VSIMemHandle final : public VSIVirtualHandle
     bool bUpdate = false;
     bool bEOF = false;
     bool m_bError = false;
+    bool m_bMapped = false;
 
     VSIMemHandle() = default;
     ~VSIMemHandle() override;
@@ -176,6 +182,8 @@ class VSIMemHandle final : public VSIVirtualHandle
 
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
+
+    const void *GetMappedRegion(vsi_l_offset nOffset, size_t nSize) override;
 };
 
 /************************************************************************/
@@ -280,6 +288,17 @@ bool VSIMemFile::SetLength(vsi_l_offset nNewLength)
             return false;
         }
 
+        // Pointers returned by VSIMemHandle::GetMappedRegion() must remain
+        // valid until their handle is closed.
+        if (nMappingHandles > 0)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Cannot extend in-memory file %s while it is mapped by "
+                     "another handle",
+                     osFilename.c_str());
+            return false;
+        }
+
         // If the first allocation is 1 MB or above, just take that value
         // as the one to allocate
         // Otherwise slightly reserve more to avoid too frequent reallocations.
@@ -358,6 +377,14 @@ int VSIMemHandle::Close()
                  this, poFile->osFilename.c_str(),
                  static_cast<int>(poFile.use_count()));
 #endif
+        if (bUpdate || m_bMapped)
+        {
+            CPL_EXCLUSIVE_LOCK oLock(poFile->m_oMutex);
+            if (bUpdate)
+                --poFile->nUpdateHandles;
+            if (m_bMapped)
+                --poFile->nMappingHandles;
+        }
         poFile = nullptr;
     }
 
@@ -496,6 +523,33 @@ size_t VSIMemHandle::PRead(void *pBuffer, size_t nSize,
     return 0;
 }
 
+/************************************************************************/
+/*                          GetMappedRegion()                           */
+/************************************************************************/
+
+const void *VSIMemHandle::GetMappedRegion(vsi_l_offset nOffset, size_t nSize)
+{
+    if (bUpdate || !m_bReadAllowed)
+        return nullptr;
+
+    CPL_EXCLUSIVE_LOCK oLock(poFile->m_oMutex);
+
+    // The content of the file could be changed under our feet by writers
+    if (poFile->nUpdateHandles > 0)
+        return nullptr;
+
+    if (nOffset > poFile->nLength || nSize > poFile->nLength - nOffset)
+        return nullptr;
+
+    // Prevent the buffer from being reallocated until this handle is closed
+    if (!m_bMapped)
+    {
+        m_bMapped = true;
+        ++poFile->nMappingHandles;
+    }
+    return poFile->pabyData + static_cast<size_t>(nOffset);
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
@@ -709,6 +763,11 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     poHandle->bUpdate = strchr(pszAccess, 'w') || strchr(pszAccess, '+') ||
                         strchr(pszAccess, 'a');
     poHandle->m_bReadAllowed = strchr(pszAccess, 'r') || strchr(pszAccess, '+');
+    if (poHandle->bUpdate)
+    {
+        CPL_EXCLUSIVE_LOCK oLock(poFile->m_oMutex);
+        ++poFile->nUpdateHandles;
+    }
 
 #ifdef DEBUG_VERBOSE
     CPLDebug("VSIMEM", "Opening handle %p on %s: ref_count=%d", poHandle,
@@ -1264,6 +1323,10 @@ VSILFILE *VSIFileFromMemBuffer(const char *pszFilename, GByte *pabyData,
     /* -------------------------------------------------------------------- */
     VSIMemHandle *poHandle = new VSIMemHandle;
 
+    {
+        CPL_EXCLUSIVE_LOCK oLock(poFile->m_oMutex);
+        ++poFile->nUpdateHandles;
+    }
     poHandle->poFile = std::move(poFile);
     poHandle->bUpdate = true;
     poHandle->m_bReadAllowed = true;
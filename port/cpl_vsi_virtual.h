@@ -124,6 +124,8 @@ struct CPL_DLL VSIVirtualHandle
     virtual size_t PRead(void *pBuffer, size_t nSize,
                          vsi_l_offset nOffset) const;
 
+    virtual const void *GetMappedRegion(vsi_l_offset nOffset, size_t nSize);
+
     /** Ask current operations to be interrupted.
      * Implementations must be thread-safe, as this will typically be called
      * from another thread than the active one for this file.
@@ -278,6 +280,11 @@ class VSIProxyFileHandle /* non final */ : public VSIVirtualHandle
         return m_nativeHandle->PRead(pBuffer, nSize, nOffset);
     }
 
+    const void *GetMappedRegion(vsi_l_offset nOffset, size_t nSize) override
+    {
+        return m_nativeHandle->GetMappedRegion(nOffset, nSize);
+    }
+
     void Interrupt() override
     {
         m_nativeHandle->Interrupt();
@@ -707,7 +714,7 @@ constexpr int VSI_CACHED_DEFAULT_CHUNK_SIZE = 32768;
 VSIVirtualHandle CPL_DLL *
 VSICreateCachedFile(VSIVirtualHandle *poBaseHandle,
                     size_t nChunkSize = VSI_CACHED_DEFAULT_CHUNK_SIZE,
-                    size_t nCacheSize = 0);
+                    size_t nCacheSize = 0, const char *pszFilename = nullptr);
 
 const int CPL_DEFLATE_TYPE_GZIP = 0;
 const int CPL_DEFLATE_TYPE_ZLIB = 1;
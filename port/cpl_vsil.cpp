@@ -2846,6 +2846,12 @@ VSILFILE *VSIFOpenExL(const char *pszFilename, const char *pszAccess,
  * For /vsis3/, /vsigz/, /vsioss/, it can be up to 5000 MiB.
  * For /vsiaz/, only taken into account when BLOB_TYPE=BLOCK. It can be up to 4000 MiB.
  * </li>
+ * <li>MAX_INFLIGHT_PARTS=integer. (GDAL >= 3.13) For "w" mode. Maximum number
+ * of blocks uploaded concurrently in background threads. Default is 1, or the
+ * value of the VSIS3_MAX_INFLIGHT_PARTS (resp. VSIGS_, VSIOSS_, VSIAZ_)
+ * configuration option.
+ * For /vsiaz/, only taken into account when BLOB_TYPE=BLOCK.
+ * </li>
  * </ul>
  *
  * Options specifics to /vsiaz/ in "w" mode:
@@ -3567,6 +3573,34 @@ VSIRangeStatus VSIFGetRangeStatusL(VSILFILE *fp, vsi_l_offset nOffset,
     return fp->GetRangeStatus(nOffset, nLength);
 }
 
+/************************************************************************/
+/*                        VSIFGetMappedRegionL()                        */
+/************************************************************************/
+
+/**
+ * \brief Return a pointer to a read-only, in-memory view of a file region.
+ *
+ * This method goes through the VSIFileHandler virtualization and may
+ * work on unusual filesystems such as in memory.
+ *
+ * See VSIVirtualHandle::GetMappedRegion() for the lifetime of the returned
+ * pointer.
+ *
+ * @param fp file handle opened with VSIFOpenL().
+ * @param nOffset file offset of the start of the region.
+ * @param nSize size in bytes of the region.
+ *
+ * @return a pointer to nSize bytes, or NULL if not supported, in which case
+ * the caller should use VSIFReadL() instead.
+ * @since GDAL 3.13
+ */
+
+const void *VSIFGetMappedRegionL(VSILFILE *fp, vsi_l_offset nOffset,
+                                 size_t nSize)
+{
+    return fp->GetMappedRegion(nOffset, nSize);
+}
+
 /************************************************************************/
 /*                           VSIIngestFile()                            */
 /************************************************************************/
@@ -4422,6 +4456,43 @@ size_t VSIVirtualHandle::PRead(CPL_UNUSED void *pBuffer,
     return 0;
 }
 
+/************************************************************************/
+/*                          GetMappedRegion()                           */
+/************************************************************************/
+
+/** Return a pointer to a read-only, in-memory view of a file region.
+ *
+ * This allows callers to parse the content of a file in place, without
+ * copying it into a buffer of their own. It is currently implemented for
+ * local files opened in read-only mode on POSIX systems (using mmap()), and
+ * for /vsimem/ files (direct pointer to the file buffer), as well as for
+ * /vsisubfile/ and VSI_CACHE handles on top of them. Other implementations
+ * return nullptr, in which case callers must fall back to Read() or PRead().
+ *
+ * The returned pointer remains valid until the handle is closed. Its
+ * content is undefined if the file is modified or truncated in the meantime.
+ * The current file offset is not affected by this method.
+ *
+ * For /vsimem/ files, nullptr is returned while the file is opened in update
+ * mode by any handle, and, once a region has been returned, the file cannot
+ * be extended by other handles until this one is closed. The pointer becomes
+ * invalid if the buffer is seized with VSIGetMemFileBuffer().
+ *
+ * Using memory mapping for local files can be disabled by setting the
+ * CPL_VSIL_USE_MMAP configuration option to NO.
+ *
+ * @param nOffset file offset of the start of the region.
+ * @param nSize   size in bytes of the region.
+ * @return a pointer to nSize bytes, or nullptr if the file system does not
+ *         support it or if the region extends beyond the end of file.
+ * @since GDAL 3.13
+ */
+const void *VSIVirtualHandle::GetMappedRegion(CPL_UNUSED vsi_l_offset nOffset,
+                                              CPL_UNUSED size_t nSize)
+{
+    return nullptr;
+}
+
 #ifndef DOXYGEN_SKIP
 /************************************************************************/
 /*                  VSIProxyFileHandle::CancelCreation()                */
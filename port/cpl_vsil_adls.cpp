@@ -186,6 +186,11 @@ class VSIADLSFSHandler final : public IVSIS3LikeFSHandlerWithMultipartUpload
         return "ADLS";
     }
 
+    const char *GetConfigOptionPrefix() const override
+    {
+        return "VSIADLS";
+    }
+
     int Rename(const char *oldpath, const char *newpath, GDALProgressFunc,
                void *) override;
     int Unlink(const char *pszFilename) override;
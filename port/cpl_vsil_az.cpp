@@ -520,6 +520,11 @@ class VSIAzureFSHandler final : public IVSIS3LikeFSHandlerWithMultipartUpload
         return "AZURE";
     }
 
+    const char *GetConfigOptionPrefix() const override
+    {
+        return "VSIAZ";
+    }
+
     int Unlink(const char *pszFilename) override;
     int *UnlinkBatch(CSLConstList papszFiles) override;
 
@@ -18,9 +18,13 @@
 #include <cstring>
 
 #include <algorithm>
+#include <array>
 #include <limits>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
 #include "cpl_conv.h"
@@ -29,9 +33,84 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_mem_cache.h"
 #include "cpl_noncopyablevector.h"
+#include "cpl_vsil_io_metrics.h"
 
 //! @cond Doxygen_Suppress
 
+using VSICachedBlock = std::shared_ptr<const cpl::NonCopyableVector<GByte>>;
+
+/************************************************************************/
+/* ==================================================================== */
+/*                          VSISharedBlockCache                         */
+/* ==================================================================== */
+/************************************************************************/
+
+// Process-wide cache of blocks of files, shared by all VSICachedFile
+// instances opened on a named file when VSI_CACHE_SHARED is enabled.
+// Blocks are distributed among shards, each with its own mutex and LRU list,
+// so that concurrent readers rarely contend for the same lock. The total
+// size of the cached blocks is bounded by VSI_CACHE_SIZE.
+class VSISharedBlockCache
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSISharedBlockCache)
+
+    struct Key
+    {
+        uint64_t nFileId;
+        vsi_l_offset nBlock;
+
+        bool operator==(const Key &other) const
+        {
+            return nFileId == other.nFileId && nBlock == other.nBlock;
+        }
+    };
+
+    struct KeyHasher
+    {
+        size_t operator()(const Key &k) const
+        {
+            return std::hash<uint64_t>()(k.nFileId * 0x9E3779B97F4A7C15ULL ^
+                                         static_cast<uint64_t>(k.nBlock));
+        }
+    };
+
+    using LRUList = std::list<std::pair<Key, VSICachedBlock>>;
+
+    struct Shard
+    {
+        std::mutex oMutex{};
+        LRUList oLRU{};
+        std::unordered_map<Key, LRUList::iterator, KeyHasher> oMap{};
+        size_t nSize = 0;
+    };
+
+    static constexpr size_t SHARD_COUNT = 16;
+    std::array<Shard, SHARD_COUNT> m_aoShards{};
+    const size_t m_nMaxSizePerShard;
+
+    std::mutex m_oFileIdMutex{};
+    std::map<std::string, uint64_t> m_oMapFileIds{};
+    uint64_t m_nLastFileId = 0;
+
+    Shard &GetShard(const Key &k)
+    {
+        return m_aoShards[KeyHasher()(k) % SHARD_COUNT];
+    }
+
+    explicit VSISharedBlockCache(size_t nMaxSize)
+        : m_nMaxSizePerShard(std::max<size_t>(1, nMaxSize / SHARD_COUNT))
+    {
+    }
+
+  public:
+    static VSISharedBlockCache &Get();
+
+    uint64_t GetFileId(const std::string &osKey);
+    bool Contains(uint64_t nFileId, vsi_l_offset nBlock);
+    VSICachedBlock Lookup(uint64_t nFileId, vsi_l_offset nBlock);
+    void Insert(uint64_t nFileId, vsi_l_offset nBlock, VSICachedBlock poBlock);
+};
+
 /************************************************************************/
 /* ==================================================================== */
 /*                             VSICachedFile                            */
@@ -42,9 +121,19 @@ class VSICachedFile final : public VSIVirtualHandle
 {
     CPL_DISALLOW_COPY_ASSIGN(VSICachedFile)
 
+    // Set when blocks are stored in the process-wide cache instead of
+    // m_oCache.
+    VSISharedBlockCache *m_poSharedCache = nullptr;
+    uint64_t m_nSharedFileId = 0;
+
+    bool HasBlock(vsi_l_offset iBlock);
+    VSICachedBlock GetBlock(vsi_l_offset iBlock);
+    void InsertBlock(vsi_l_offset iBlock,
+                     cpl::NonCopyableVector<GByte> &&oData);
+
   public:
     VSICachedFile(VSIVirtualHandle *poBaseHandle, size_t nChunkSize,
-                  size_t nCacheSize);
+                  size_t nCacheSize, const char *pszFilename);
 
     ~VSICachedFile() override
     {
@@ -60,7 +149,7 @@ class VSICachedFile final : public VSIVirtualHandle
     vsi_l_offset m_nFileSize = 0;
 
     size_t m_nChunkSize = 0;
-    lru11::Cache<vsi_l_offset, cpl::NonCopyableVector<GByte>>
+    lru11::Cache<vsi_l_offset, VSICachedBlock>
         m_oCache;  // can only been initialized in constructor
 
     bool m_bEOF = false;
@@ -101,6 +190,11 @@ class VSICachedFile final : public VSIVirtualHandle
     {
         return m_poBase->PRead(pBuffer, nSize, nOffset);
     }
+
+    const void *GetMappedRegion(vsi_l_offset nOffset, size_t nSize) override
+    {
+        return m_poBase->GetMappedRegion(nOffset, nSize);
+    }
 };
 
 /************************************************************************/
@@ -135,18 +229,166 @@ static size_t GetCacheMax(size_t nCacheSize)
     return static_cast<size_t>(nMemorySize);
 }
 
+/************************************************************************/
+/*                      VSISharedBlockCache::Get()                      */
+/************************************************************************/
+
+VSISharedBlockCache &VSISharedBlockCache::Get()
+{
+    // Intentionally leaked, to avoid issues with destruction order at
+    // process termination.
+    static VSISharedBlockCache *poCache =
+        new VSISharedBlockCache(GetCacheMax(0));
+    return *poCache;
+}
+
+/************************************************************************/
+/*                VSISharedBlockCache::GetFileId()                      */
+/************************************************************************/
+
+// Return a unique identifier for a key identifying a given version of a
+// file and a chunk size.
+uint64_t VSISharedBlockCache::GetFileId(const std::string &osKey)
+{
+    std::lock_guard oLock(m_oFileIdMutex);
+    const auto oIter = m_oMapFileIds.find(osKey);
+    if (oIter != m_oMapFileIds.end())
+        return oIter->second;
+    // Blocks of forgotten identifiers will just age out of the LRU lists.
+    constexpr size_t MAX_FILE_IDS = 100 * 1000;
+    if (m_oMapFileIds.size() == MAX_FILE_IDS)
+        m_oMapFileIds.clear();
+    ++m_nLastFileId;
+    m_oMapFileIds[osKey] = m_nLastFileId;
+    return m_nLastFileId;
+}
+
+/************************************************************************/
+/*                 VSISharedBlockCache::Contains()                      */
+/************************************************************************/
+
+bool VSISharedBlockCache::Contains(uint64_t nFileId, vsi_l_offset nBlock)
+{
+    const Key k{nFileId, nBlock};
+    Shard &oShard = GetShard(k);
+    std::lock_guard oLock(oShard.oMutex);
+    return oShard.oMap.find(k) != oShard.oMap.end();
+}
+
+/************************************************************************/
+/*                   VSISharedBlockCache::Lookup()                      */
+/************************************************************************/
+
+VSICachedBlock VSISharedBlockCache::Lookup(uint64_t nFileId,
+                                           vsi_l_offset nBlock)
+{
+    const Key k{nFileId, nBlock};
+    Shard &oShard = GetShard(k);
+    std::lock_guard oLock(oShard.oMutex);
+    const auto oIter = oShard.oMap.find(k);
+    if (oIter == oShard.oMap.end())
+        return nullptr;
+    oShard.oLRU.splice(oShard.oLRU.begin(), oShard.oLRU, oIter->second);
+    return oIter->second->second;
+}
+
+/************************************************************************/
+/*                   VSISharedBlockCache::Insert()                      */
+/************************************************************************/
+
+void VSISharedBlockCache::Insert(uint64_t nFileId, vsi_l_offset nBlock,
+                                 VSICachedBlock poBlock)
+{
+    const Key k{nFileId, nBlock};
+    Shard &oShard = GetShard(k);
+    std::lock_guard oLock(oShard.oMutex);
+    const auto oIter = oShard.oMap.find(k);
+    if (oIter != oShard.oMap.end())
+    {
+        oShard.nSize -= oIter->second->second->size();
+        oShard.oLRU.erase(oIter->second);
+        oShard.oMap.erase(oIter);
+    }
+    oShard.nSize += poBlock->size();
+    oShard.oLRU.emplace_front(k, std::move(poBlock));
+    oShard.oMap[k] = oShard.oLRU.begin();
+
+    // Evict least recently used blocks, but always keep the one just
+    // inserted so that the caller can use it.
+    while (oShard.nSize > m_nMaxSizePerShard && oShard.oLRU.size() > 1)
+    {
+        const auto &oLast = oShard.oLRU.back();
+        oShard.nSize -= oLast.second->size();
+        oShard.oMap.erase(oLast.first);
+        oShard.oLRU.pop_back();
+    }
+}
+
 /************************************************************************/
 /*                           VSICachedFile()                            */
 /************************************************************************/
 
 VSICachedFile::VSICachedFile(VSIVirtualHandle *poBaseHandle, size_t nChunkSize,
-                             size_t nCacheSize)
+                             size_t nCacheSize, const char *pszFilename)
     : m_poBase(poBaseHandle),
       m_nChunkSize(nChunkSize ? nChunkSize : VSI_CACHED_DEFAULT_CHUNK_SIZE),
       m_oCache{cpl::div_round_up(GetCacheMax(nCacheSize), m_nChunkSize), 0}
 {
     m_poBase->Seek(0, SEEK_END);
     m_nFileSize = m_poBase->Tell();
+
+    // Blocks are only shared between handles that are on the same version of
+    // a file, and with the same chunk size.
+    VSIStatBufL sStat;
+    if (pszFilename &&
+        CPLTestBool(CPLGetConfigOption("VSI_CACHE_SHARED", "NO")) &&
+        VSIStatL(pszFilename, &sStat) == 0)
+    {
+        m_poSharedCache = &VSISharedBlockCache::Get();
+        m_nSharedFileId = m_poSharedCache->GetFileId(CPLSPrintf(
+            "%s\n" CPL_FRMT_GIB "\n" CPL_FRMT_GUIB "\n" CPL_FRMT_GUIB,
+            pszFilename, static_cast<GIntBig>(sStat.st_mtime),
+            static_cast<GUIntBig>(m_nFileSize),
+            static_cast<GUIntBig>(m_nChunkSize)));
+    }
+}
+
+/************************************************************************/
+/*                             HasBlock()                               */
+/************************************************************************/
+
+bool VSICachedFile::HasBlock(vsi_l_offset iBlock)
+{
+    if (m_poSharedCache)
+        return m_poSharedCache->Contains(m_nSharedFileId, iBlock);
+    return m_oCache.contains(iBlock);
+}
+
+/************************************************************************/
+/*                             GetBlock()                               */
+/************************************************************************/
+
+VSICachedBlock VSICachedFile::GetBlock(vsi_l_offset iBlock)
+{
+    if (m_poSharedCache)
+        return m_poSharedCache->Lookup(m_nSharedFileId, iBlock);
+    const VSICachedBlock *ppoBlock = m_oCache.getPtr(iBlock);
+    return ppoBlock ? *ppoBlock : nullptr;
+}
+
+/************************************************************************/
+/*                            InsertBlock()                             */
+/************************************************************************/
+
+void VSICachedFile::InsertBlock(vsi_l_offset iBlock,
+                                cpl::NonCopyableVector<GByte> &&oData)
+{
+    auto poBlock =
+        std::make_shared<const cpl::NonCopyableVector<GByte>>(std::move(oData));
+    if (m_poSharedCache)
+        m_poSharedCache->Insert(m_nSharedFileId, iBlock, std::move(poBlock));
+    else
+        m_oCache.insert(iBlock, std::move(poBlock));
 }
 
 /************************************************************************/
@@ -237,7 +479,7 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
                 m_bError = true;
             oData.resize(nDataRead);
 
-            m_oCache.insert(nStartBlock, std::move(oData));
+            InsertBlock(nStartBlock, std::move(oData));
         }
         catch (const std::exception &)
         {
@@ -253,16 +495,19 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
     /*      If the buffer is quite large but not quite large enough to      */
     /*      hold all the blocks we will take the pain of splitting the      */
     /*      io request in two in order to avoid allocating a large          */
-    /*      temporary buffer.                                               */
+    /*      temporary buffer. The first request loads as many blocks as     */
+    /*      fit in the buffer, so that the underlying handle can process    */
+    /*      them at once (e.g. decompress them in parallel).                */
     /* -------------------------------------------------------------------- */
     if (nBufferSize > m_nChunkSize * 20 &&
         nBufferSize < nBlockCount * m_nChunkSize)
     {
-        if (!LoadBlocks(nStartBlock, 2, pBuffer, nBufferSize))
+        const size_t nBlocksInBuffer = nBufferSize / m_nChunkSize;
+        if (!LoadBlocks(nStartBlock, nBlocksInBuffer, pBuffer, nBufferSize))
             return false;
 
-        return LoadBlocks(nStartBlock + 2, nBlockCount - 2, pBuffer,
-                          nBufferSize);
+        return LoadBlocks(nStartBlock + nBlocksInBuffer,
+                          nBlockCount - nBlocksInBuffer, pBuffer, nBufferSize);
     }
 
     if (m_poBase->Seek(static_cast<vsi_l_offset>(nStartBlock) * m_nChunkSize,
@@ -316,7 +561,7 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
             memcpy(oData.data(), pabyWorkBuffer + i * m_nChunkSize,
                    nDataFilled);
 
-            m_oCache.insert(iBlock, std::move(oData));
+            InsertBlock(iBlock, std::move(oData));
         }
         catch (const std::exception &)
         {
@@ -366,22 +611,36 @@ size_t VSICachedFile::Read(void *pBuffer, size_t nSize, size_t nCount)
         nEndBlock = nLastBlock;
     }
 
+    vsi_l_offset nMissedBlocks = 0;
     for (vsi_l_offset iBlock = nStartBlock; iBlock <= nEndBlock; iBlock++)
     {
-        if (!m_oCache.contains(iBlock))
+        if (!HasBlock(iBlock))
         {
             size_t nBlocksToLoad = 1;
             while (iBlock + nBlocksToLoad <= nEndBlock &&
-                   !m_oCache.contains(iBlock + nBlocksToLoad))
+                   !HasBlock(iBlock + nBlocksToLoad))
             {
                 nBlocksToLoad++;
             }
+            nMissedBlocks += nBlocksToLoad;
 
             if (!LoadBlocks(iBlock, nBlocksToLoad, pBuffer, nRequestedBytes))
                 break;
         }
     }
 
+    if (cpl::VSIIOMetrics::IsEnabled())
+    {
+        static cpl::VSIIOCacheMetrics *const poCacheMetrics =
+            cpl::VSIIOMetrics::GetCache("vsi_cache");
+        const vsi_l_offset nBlocks = nEndBlock - nStartBlock + 1;
+        poCacheMetrics->nHits.fetch_add(
+            nBlocks - std::min(nBlocks, nMissedBlocks),
+            std::memory_order_relaxed);
+        poCacheMetrics->nMisses.fetch_add(nMissedBlocks,
+                                          std::memory_order_relaxed);
+    }
+
     /* ==================================================================== */
     /*      Copy data into the target buffer to the extent possible.        */
     /* ==================================================================== */
@@ -390,14 +649,14 @@ size_t VSICachedFile::Read(void *pBuffer, size_t nSize, size_t nCount)
     while (nAmountCopied < nRequestedBytes)
     {
         const vsi_l_offset iBlock = (m_nOffset + nAmountCopied) / m_nChunkSize;
-        const cpl::NonCopyableVector<GByte> *poData = m_oCache.getPtr(iBlock);
+        VSICachedBlock poData = GetBlock(iBlock);
         if (poData == nullptr)
         {
             // We can reach that point when the amount to read exceeds
             // the cache size.
             LoadBlocks(iBlock, 1, static_cast<GByte *>(pBuffer) + nAmountCopied,
                        std::min(nRequestedBytes - nAmountCopied, m_nChunkSize));
-            poData = m_oCache.getPtr(iBlock);
+            poData = GetBlock(iBlock);
             if (poData == nullptr)
             {
                 break;
@@ -664,7 +923,8 @@ VSICachedFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     if (!fp)
         return nullptr;
     return VSIVirtualHandleUniquePtr(
-        VSICreateCachedFile(fp.release(), nChunkSize, nCacheSize));
+        VSICreateCachedFile(fp.release(), nChunkSize, nCacheSize,
+                            osUnderlyingFilename.c_str()));
 }
 
 /************************************************************************/
@@ -712,18 +972,28 @@ char **VSICachedFilesystemHandler::ReadDirEx(const char *pszDirname,
  * the content of the cache is discarded when the file handle is closed.
  * The cache is a least-recently used lists of blocks of 32KB each.
  *
+ * If pszFilename is specified and the VSI_CACHE_SHARED configuration option
+ * is set to YES, the blocks are instead stored in a process-wide cache,
+ * shared by all handles opened with the same file name, modification time,
+ * size and chunk size, whose total size is bounded by the VSI_CACHE_SIZE
+ * configuration option. nCacheSize is then ignored.
+ *
  * @param poBaseHandle base handle
  * @param nChunkSize chunk size, in bytes. If 0, defaults to 32 KB
  * @param nCacheSize total size of the cache for the file, in bytes.
  *                   If 0, defaults to the value of the VSI_CACHE_SIZE
  *                   configuration option, which defaults to 25 MB.
+ * @param pszFilename Name of the file of poBaseHandle, or nullptr.
+ *                    (added in GDAL 3.13)
  * @return a new handle
  */
 VSIVirtualHandle *VSICreateCachedFile(VSIVirtualHandle *poBaseHandle,
-                                      size_t nChunkSize, size_t nCacheSize)
+                                      size_t nChunkSize, size_t nCacheSize,
+                                      const char *pszFilename)
 
 {
-    return new VSICachedFile(poBaseHandle, nChunkSize, nCacheSize);
+    return new VSICachedFile(poBaseHandle, nChunkSize, nCacheSize,
+                             pszFilename);
 }
 
 /************************************************************************/
@@ -19,7 +19,14 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <utime.h>
+#endif
 
 #include "cpl_aws.h"
 #include "cpl_json.h"
@@ -32,6 +39,7 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
 #include "cpl_mem_cache.h"
+#include "cpl_sha256.h"
 
 #ifndef S_IRUSR
 #define S_IRUSR 00400
@@ -855,6 +863,61 @@ static GIntBig VSICurlGetExpiresFromS3LikeSignedURL(const char *pszURL)
     return CPLYMDHMSToUnixTime(&brokendowntime) + nDelay;
 }
 
+/************************************************************************/
+/*                      VSICURLLogRequestMetrics()                      */
+/************************************************************************/
+
+/** Account a completed request in the I/O metrics of the file system the
+ * current thread is operating on. */
+static void VSICURLLogRequestMetrics(CURL *hCurlHandle)
+{
+    if (!cpl::VSIIOMetrics::IsEnabled())
+        return;
+
+    std::string osHost;
+    char *pszEffectiveURL = nullptr;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_EFFECTIVE_URL, &pszEffectiveURL);
+    if (pszEffectiveURL)
+    {
+        const char *pszHost = strstr(pszEffectiveURL, "://");
+        pszHost = pszHost ? pszHost + strlen("://") : pszEffectiveURL;
+        osHost.assign(pszHost, strcspn(pszHost, "/?#"));
+        // Do not expose credentials passed in the URL
+        const auto nAtPos = osHost.rfind('@');
+        if (nAtPos != std::string::npos)
+            osHost = osHost.substr(nAtPos + 1);
+    }
+    auto poMetrics = cpl::VSIIOMetrics::GetEndpoint(
+        cpl::VSIIOMetrics::GetCurrentFileSystem(), osHost);
+
+    long response_code = 0;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE, &response_code);
+    double dfTimeToFirstByte = 0;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_STARTTRANSFER_TIME,
+                      &dfTimeToFirstByte);
+    double dfTotalTime = 0;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_TOTAL_TIME, &dfTotalTime);
+    curl_off_t nDownloaded = 0;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_SIZE_DOWNLOAD_T, &nDownloaded);
+    curl_off_t nUploaded = 0;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_SIZE_UPLOAD_T, &nUploaded);
+
+    poMetrics->nRequests.fetch_add(1, std::memory_order_relaxed);
+    if (response_code == 0 || response_code >= 400)
+        poMetrics->nErrors.fetch_add(1, std::memory_order_relaxed);
+    poMetrics->nDownloadedBytes.fetch_add(
+        static_cast<uint64_t>(std::max<curl_off_t>(0, nDownloaded)),
+        std::memory_order_relaxed);
+    poMetrics->nUploadedBytes.fetch_add(
+        static_cast<uint64_t>(std::max<curl_off_t>(0, nUploaded)),
+        std::memory_order_relaxed);
+    // Transfers that failed before receiving anything have a zero time to
+    // first byte, which would bias the histogram.
+    if (dfTimeToFirstByte > 0)
+        poMetrics->oTimeToFirstByte.Add(dfTimeToFirstByte);
+    poMetrics->oTotalTime.Add(dfTotalTime);
+}
+
 /************************************************************************/
 /*                       VSICURLMultiPerform()                          */
 /************************************************************************/
@@ -864,8 +927,13 @@ void VSICURLMultiPerform(CURLM *hCurlMultiHandle, CURL *hEasyHandle,
 {
     int repeats = 0;
 
+    std::unique_ptr<cpl::VSIIOMetrics::InFlightRequest> poInFlightRequest;
     if (hEasyHandle)
+    {
+        poInFlightRequest =
+            std::make_unique<cpl::VSIIOMetrics::InFlightRequest>();
         curl_multi_add_handle(hCurlMultiHandle, hEasyHandle);
+    }
 
     void *old_handler = CPLHTTPIgnoreSigPipe();
     while (true)
@@ -902,7 +970,10 @@ void VSICURLMultiPerform(CURLM *hCurlMultiHandle, CURL *hEasyHandle,
     CPLHTTPRestoreSigPipeHandler(old_handler);
 
     if (hEasyHandle)
+    {
         curl_multi_remove_handle(hCurlMultiHandle, hEasyHandle);
+        VSICURLLogRequestMetrics(hEasyHandle);
+    }
 }
 
 /************************************************************************/
@@ -1531,7 +1602,8 @@ retry:
                             std::min<size_t>(sWriteFuncData.nSize - nOffset,
                                              knDOWNLOAD_CHUNK_SIZE);
                         poFS->AddRegion(m_pszURL, nOffset, nToCache,
-                                        sWriteFuncData.pBuffer + nOffset);
+                                        sWriteFuncData.pBuffer + nOffset,
+                                        m_bCached ? &oFileProp : nullptr);
                         nOffset += nToCache;
                     }
                 }
@@ -1934,6 +2006,185 @@ void VSICurlFilesystemHandlerBase::NotifyStopDownloadRegion(
     m_oMutex.unlock();
 }
 
+/************************************************************************/
+/*                      NotifyStartDownloadRange()                      */
+/************************************************************************/
+
+/** Indicate intent at downloading the [nStart, nEnd] byte range of osURL
+ * in ReadMultiRange().
+ *
+ * If another caller is already downloading a range that contains it, then
+ * bIsOwner is set to false, and the returned object must be waited for
+ * (until its bDone member is set). Otherwise bIsOwner is set to true, and
+ * NotifyStopDownloadRange() must be called once the download is finished.
+ */
+std::shared_ptr<VSICurlFilesystemHandlerBase::RangeInDownload>
+VSICurlFilesystemHandlerBase::NotifyStartDownloadRange(
+    const std::string &osURL, vsi_l_offset nStart, vsi_l_offset nEnd,
+    const void *pOwner, bool &bIsOwner)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    auto &apoRanges = m_oMapRangesInDownload[osURL];
+    for (const auto &poRange : apoRanges)
+    {
+        if (poRange->pOwner != pOwner && poRange->nStart <= nStart &&
+            poRange->nEnd >= nEnd)
+        {
+            poRange->nWaiters++;
+            bIsOwner = false;
+            return poRange;
+        }
+    }
+    auto poRange = std::make_shared<RangeInDownload>();
+    poRange->nStart = nStart;
+    poRange->nEnd = nEnd;
+    poRange->pOwner = pOwner;
+    apoRanges.push_back(poRange);
+    bIsOwner = true;
+    return poRange;
+}
+
+/************************************************************************/
+/*                       NotifyStopDownloadRange()                      */
+/************************************************************************/
+
+/** Signal the end of the download of a range started with
+ * NotifyStartDownloadRange(), and wake up the waiters.
+ *
+ * pData must point to nEnd - nStart + 1 bytes, or be null if the download
+ * failed.
+ */
+void VSICurlFilesystemHandlerBase::NotifyStopDownloadRange(
+    const std::string &osURL, const std::shared_ptr<RangeInDownload> &poRange,
+    const char *pData)
+{
+    int nWaiters = 0;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        auto oIter = m_oMapRangesInDownload.find(osURL);
+        CPLAssert(oIter != m_oMapRangesInDownload.end());
+        auto &apoRanges = oIter->second;
+        apoRanges.erase(
+            std::remove(apoRanges.begin(), apoRanges.end(), poRange),
+            apoRanges.end());
+        if (apoRanges.empty())
+            m_oMapRangesInDownload.erase(oIter);
+        nWaiters = poRange->nWaiters;
+    }
+
+    // No new waiter can show up now that the range is no longer registered
+    if (nWaiters > 0)
+    {
+        if (pData)
+        {
+            poRange->osData.assign(
+                pData, static_cast<size_t>(poRange->nEnd - poRange->nStart + 1));
+        }
+        std::lock_guard<std::mutex> oRangeLock(poRange->oMutex);
+        poRange->bOK = pData != nullptr;
+        poRange->bDone = true;
+        poRange->oCond.notify_all();
+    }
+}
+
+/************************************************************************/
+/*                           GetHostFromURL()                           */
+/************************************************************************/
+
+static std::string GetHostFromURL(const std::string &osURL)
+{
+    auto nPos = osURL.find("://");
+    if (nPos == std::string::npos)
+        return osURL;
+    nPos = osURL.find('/', nPos + strlen("://"));
+    return osURL.substr(0, nPos);
+}
+
+/************************************************************************/
+/*                        UpdateTransferStats()                         */
+/************************************************************************/
+
+/** Update the estimates of the latency and throughput of the host of osURL,
+ * from the timings of a completed ranged GET request.
+ *
+ * @param osURL URL of the request.
+ * @param dfLatency Delay between sending the request and receiving the first
+ *                  byte of the response, in seconds.
+ * @param dfTransferTime Duration of the transfer of the body, in seconds.
+ * @param nBytes Size of the body.
+ */
+void VSICurlFilesystemHandlerBase::UpdateTransferStats(const std::string &osURL,
+                                                       double dfLatency,
+                                                       double dfTransferTime,
+                                                       size_t nBytes)
+{
+    // Weight of the new sample in the exponential moving averages
+    constexpr double ALPHA = 0.25;
+    // Transfers shorter than that mostly measure latency
+    constexpr size_t MIN_BYTES_FOR_BANDWIDTH = 64 * 1024;
+    constexpr double MIN_TIME_FOR_BANDWIDTH = 1e-3;
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    auto &oStats = m_oMapTransferStats[GetHostFromURL(osURL)];
+    if (dfLatency >= 0)
+    {
+        oStats.dfLatency = oStats.nLatencyCount == 0
+                               ? dfLatency
+                               : (1 - ALPHA) * oStats.dfLatency +
+                                     ALPHA * dfLatency;
+        oStats.nLatencyCount++;
+    }
+    if (nBytes >= MIN_BYTES_FOR_BANDWIDTH &&
+        dfTransferTime >= MIN_TIME_FOR_BANDWIDTH)
+    {
+        const double dfBandwidth = static_cast<double>(nBytes) / dfTransferTime;
+        oStats.dfBandwidth = oStats.nBandwidthCount == 0
+                                 ? dfBandwidth
+                                 : (1 - ALPHA) * oStats.dfBandwidth +
+                                       ALPHA * dfBandwidth;
+        oStats.nBandwidthCount++;
+    }
+}
+
+/************************************************************************/
+/*                       GetRangeMergingMaxGap()                        */
+/************************************************************************/
+
+/** Return the maximum number of unneeded bytes between two ranges for
+ * ReadMultiRange() to fetch them with a single request.
+ *
+ * In AUTO mode, this is the number of bytes that can be transferred in the
+ * time of the latency of a request, that is the point where downloading
+ * the gap becomes more expensive than issuing a separate request.
+ */
+vsi_l_offset
+VSICurlFilesystemHandlerBase::GetRangeMergingMaxGap(const std::string &osURL)
+{
+    const char *pszMaxGap =
+        CPLGetConfigOption("GDAL_HTTP_MERGE_RANGES_MAX_GAP", "AUTO");
+    if (!EQUAL(pszMaxGap, "AUTO"))
+    {
+        return static_cast<vsi_l_offset>(
+            std::max<GIntBig>(0, CPLAtoGIntBig(pszMaxGap)));
+    }
+
+    // Do not trust estimates made on too few requests
+    constexpr int MIN_SAMPLES = 3;
+    constexpr double MAX_AUTO_GAP = 1024 * 1024;
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    const auto oIter = m_oMapTransferStats.find(GetHostFromURL(osURL));
+    if (oIter == m_oMapTransferStats.end() ||
+        oIter->second.nLatencyCount < MIN_SAMPLES ||
+        oIter->second.nBandwidthCount < MIN_SAMPLES)
+    {
+        return 0;
+    }
+    const double dfGap = std::min(
+        MAX_AUTO_GAP, oIter->second.dfLatency * oIter->second.dfBandwidth);
+    return static_cast<vsi_l_offset>(dfGap);
+}
+
 /************************************************************************/
 /*                          DownloadRegion()                            */
 /************************************************************************/
@@ -2347,7 +2598,8 @@ void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
 #endif
         const size_t nChunkSize =
             std::min(static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE), nSize);
-        poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer);
+        poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer,
+                        m_bCached ? &oFileProp : nullptr);
         l_startOffset += nChunkSize;
         pBuffer += nChunkSize;
         nSize -= nChunkSize;
@@ -2399,7 +2651,18 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
             (iterOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
         std::string osRegion;
         std::shared_ptr<std::string> psRegion =
-            poFS->GetRegion(m_pszURL, nOffsetToDownload);
+            poFS->GetRegion(m_pszURL, nOffsetToDownload,
+                            m_bCached ? &oFileProp : nullptr);
+        if (VSIIOMetrics::IsEnabled())
+        {
+            static VSIIOCacheMetrics *const poCacheMetrics =
+                VSIIOMetrics::GetCache("vsicurl_region_cache");
+            if (psRegion)
+                poCacheMetrics->nHits.fetch_add(1, std::memory_order_relaxed);
+            else
+                poCacheMetrics->nMisses.fetch_add(1,
+                                                  std::memory_order_relaxed);
+        }
         if (psRegion != nullptr)
         {
             osRegion = *psRegion;
@@ -2439,9 +2702,11 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
             // this should not cause bugs. Just missed optimization.
             for (int i = 1; i < nBlocksToDownload; i++)
             {
-                if (poFS->GetRegion(m_pszURL, nOffsetToDownload +
-                                                  static_cast<vsi_l_offset>(i) *
-                                                      knDOWNLOAD_CHUNK_SIZE) !=
+                if (poFS->GetRegion(m_pszURL,
+                                    nOffsetToDownload +
+                                        static_cast<vsi_l_offset>(i) *
+                                            knDOWNLOAD_CHUNK_SIZE,
+                                    m_bCached ? &oFileProp : nullptr) !=
                     nullptr)
                 {
                     nBlocksToDownload = i;
@@ -2500,6 +2765,78 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
     return ret;
 }
 
+/************************************************************************/
+/*                     VSICURLMultiPerformLimited()                     */
+/************************************************************************/
+
+/** Run the passed easy handles, with at most nMaxParallel of them being
+ * active at the same time on hCurlMultiHandle.
+ */
+static void VSICURLMultiPerformLimited(CURLM *hCurlMultiHandle,
+                                       const std::vector<CURL *> &aHandles,
+                                       int nMaxParallel,
+                                       std::atomic<bool> *pbInterrupt)
+{
+    int repeats = 0;
+    size_t iNextHandle = 0;
+    int nActive = 0;
+    VSIIOFileSystemMetrics *const poFSMetrics =
+        VSIIOMetrics::IsEnabled()
+            ? VSIIOMetrics::GetFileSystem(VSIIOMetrics::GetCurrentFileSystem())
+            : nullptr;
+
+    void *old_handler = CPLHTTPIgnoreSigPipe();
+    while (true)
+    {
+        while (iNextHandle < aHandles.size() && nActive < nMaxParallel)
+        {
+            curl_multi_add_handle(hCurlMultiHandle, aHandles[iNextHandle]);
+            ++iNextHandle;
+            ++nActive;
+            if (poFSMetrics)
+                poFSMetrics->nInFlight.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        int still_running;
+        while (curl_multi_perform(hCurlMultiHandle, &still_running) ==
+               CURLM_CALL_MULTI_PERFORM)
+        {
+            // loop
+        }
+
+        CURLMsg *msg;
+        do
+        {
+            int msgq = 0;
+            msg = curl_multi_info_read(hCurlMultiHandle, &msgq);
+            if (msg && msg->msg == CURLMSG_DONE)
+            {
+                --nActive;
+                if (poFSMetrics)
+                {
+                    poFSMetrics->nInFlight.fetch_sub(1,
+                                                     std::memory_order_relaxed);
+                }
+                VSICURLLogRequestMetrics(msg->easy_handle);
+            }
+        } while (msg);
+
+        if (!still_running && iNextHandle == aHandles.size())
+            break;
+
+        if (pbInterrupt && *pbInterrupt)
+            break;
+
+        if (still_running)
+            CPLMultiPerformWait(hCurlMultiHandle, repeats);
+    }
+    CPLHTTPRestoreSigPipeHandler(old_handler);
+
+    // Requests interrupted before completion
+    if (poFSMetrics && nActive > 0)
+        poFSMetrics->nInFlight.fetch_sub(nActive, std::memory_order_relaxed);
+}
+
 /************************************************************************/
 /*                           ReadMultiRange()                           */
 /************************************************************************/
@@ -2560,42 +2897,90 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
     }
 #endif
 
-    std::vector<CURL *> aHandles;
-    std::vector<WriteFuncStruct> asWriteFuncData(nRanges);
-    std::vector<WriteFuncStruct> asWriteFuncHeaderData(nRanges);
-    std::vector<char *> apszRanges;
-    std::vector<struct curl_slist *> aHeaders;
+    const bool bMergeConsecutiveRanges = CPLTestBool(
+        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    const vsi_l_offset nMaxGap =
+        bMergeConsecutiveRanges ? poFS->GetRangeMergingMaxGap(m_pszURL) : 0;
+    const int nMaxParallelRequests = std::max(
+        1, atoi(CPLGetConfigOption("GDAL_HTTP_MAX_PARALLEL_RANGE_REQUESTS",
+                                   "100")));
 
     struct CurlErrBuffer
     {
         std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf;
     };
 
-    std::vector<CurlErrBuffer> asCurlErrors(nRanges);
-
-    const bool bMergeConsecutiveRanges = CPLTestBool(
-        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    struct Request
+    {
+        vsi_l_offset nStart = 0;
+        vsi_l_offset nEnd = 0;  // included
+        int iFirstRange = 0;
+        int iLastRange = 0;  // included
+        std::shared_ptr<VSICurlFilesystemHandlerBase::RangeInDownload>
+            poRange{};
+        bool bIsOwner = false;
+        CURL *hCurlHandle = nullptr;
+        struct curl_slist *headers = nullptr;
+        WriteFuncStruct sWriteFuncData{};
+        WriteFuncStruct sWriteFuncHeaderData{};
+        CurlErrBuffer sCurlErr{};
+    };
 
-    for (int i = 0, iRequest = 0; i < nRanges;)
+    // Group ranges that are consecutive, overlapping, or separated by a gap
+    // small enough that downloading it is cheaper than issuing another
+    // request.
+    std::vector<Request> aoRequests;
+    for (int i = 0; i < nRanges;)
     {
-        size_t nSize = 0;
-        int iNext = i;
-        // Identify consecutive ranges
-        while (bMergeConsecutiveRanges && iNext + 1 < nRanges &&
-               panOffsets[iNext] + panSizes[iNext] == panOffsets[iNext + 1])
+        if (panSizes[i] == 0)
         {
-            nSize += panSizes[iNext];
-            iNext++;
+            ++i;
+            continue;
         }
-        nSize += panSizes[iNext];
-
-        if (nSize == 0)
+        Request oRequest;
+        oRequest.nStart = panOffsets[i];
+        oRequest.nEnd = panOffsets[i] + panSizes[i] - 1;
+        oRequest.iFirstRange = i;
+        int iNext = i + 1;
+        while (bMergeConsecutiveRanges && iNext < nRanges)
         {
-            i = iNext + 1;
-            continue;
+            if (panSizes[iNext] == 0)
+            {
+                ++iNext;
+                continue;
+            }
+            if (panOffsets[iNext] < oRequest.nStart ||
+                panOffsets[iNext] > oRequest.nEnd + 1 + nMaxGap)
+            {
+                break;
+            }
+            oRequest.nEnd = std::max(oRequest.nEnd,
+                                     panOffsets[iNext] + panSizes[iNext] - 1);
+            ++iNext;
         }
+        oRequest.iLastRange = iNext - 1;
+        aoRequests.push_back(std::move(oRequest));
+        i = iNext;
+    }
+
+    // Do not download ranges that another thread is already downloading.
+    const std::string osKeyURL(m_pszURL);
+    const void *const pOwner = &aoRequests;
+    for (auto &oRequest : aoRequests)
+    {
+        oRequest.poRange = poFS->NotifyStartDownloadRange(
+            osKeyURL, oRequest.nStart, oRequest.nEnd, pOwner,
+            oRequest.bIsOwner);
+    }
+
+    std::vector<CURL *> aHandles;
+    for (auto &oRequest : aoRequests)
+    {
+        if (!oRequest.bIsOwner)
+            continue;
 
         CURL *hCurlHandle = curl_easy_init();
+        oRequest.hCurlHandle = hCurlHandle;
         aHandles.push_back(hCurlHandle);
 
         // As the multi-range request is likely not the first one, we don't
@@ -2605,159 +2990,180 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         struct curl_slist *headers = VSICurlSetOptions(
             hCurlHandle, osURL.c_str(), aosHTTPOptions.List());
 
-        VSICURLInitWriteFuncStruct(&asWriteFuncData[iRequest], this, pfnReadCbk,
+        VSICURLInitWriteFuncStruct(&oRequest.sWriteFuncData, this, pfnReadCbk,
                                    pReadCbkUserData);
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEDATA,
-                                   &asWriteFuncData[iRequest]);
+                                   &oRequest.sWriteFuncData);
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEFUNCTION,
                                    VSICurlHandleWriteFunc);
 
-        VSICURLInitWriteFuncStruct(&asWriteFuncHeaderData[iRequest], nullptr,
+        VSICURLInitWriteFuncStruct(&oRequest.sWriteFuncHeaderData, nullptr,
                                    nullptr, nullptr);
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERDATA,
-                                   &asWriteFuncHeaderData[iRequest]);
+                                   &oRequest.sWriteFuncHeaderData);
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
                                    VSICurlHandleWriteFunc);
-        asWriteFuncHeaderData[iRequest].bIsHTTP = STARTS_WITH(m_pszURL, "http");
-        asWriteFuncHeaderData[iRequest].nStartOffset = panOffsets[i];
-
-        asWriteFuncHeaderData[iRequest].nEndOffset = panOffsets[i] + nSize - 1;
+        oRequest.sWriteFuncHeaderData.bIsHTTP = STARTS_WITH(m_pszURL, "http");
+        oRequest.sWriteFuncHeaderData.nStartOffset = oRequest.nStart;
+        oRequest.sWriteFuncHeaderData.nEndOffset = oRequest.nEnd;
 
         char rangeStr[512] = {};
         snprintf(rangeStr, sizeof(rangeStr), CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
-                 asWriteFuncHeaderData[iRequest].nStartOffset,
-                 asWriteFuncHeaderData[iRequest].nEndOffset);
+                 oRequest.nStart, oRequest.nEnd);
 
         if (ENABLE_DEBUG)
             CPLDebug(poFS->GetDebugKey(), "Downloading %s (%s)...", rangeStr,
                      osURL.c_str());
 
-        if (asWriteFuncHeaderData[iRequest].bIsHTTP)
+        if (oRequest.sWriteFuncHeaderData.bIsHTTP)
         {
             // So it gets included in Azure signature
-            char *pszRange = CPLStrdup(CPLSPrintf("Range: bytes=%s", rangeStr));
-            apszRanges.push_back(pszRange);
-            headers = curl_slist_append(headers, pszRange);
+            headers = curl_slist_append(
+                headers, CPLSPrintf("Range: bytes=%s", rangeStr));
             unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, nullptr);
         }
         else
         {
-            apszRanges.push_back(nullptr);
             unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, rangeStr);
         }
 
-        asCurlErrors[iRequest].szCurlErrBuf[0] = '\0';
+        oRequest.sCurlErr.szCurlErrBuf[0] = '\0';
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_ERRORBUFFER,
-                                   &asCurlErrors[iRequest].szCurlErrBuf[0]);
+                                   &oRequest.sCurlErr.szCurlErrBuf[0]);
 
         headers = GetCurlHeaders("GET", headers);
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER, headers);
-        aHeaders.push_back(headers);
-        curl_multi_add_handle(hMultiHandle, hCurlHandle);
-
-        i = iNext + 1;
-        iRequest++;
+        oRequest.headers = headers;
     }
 
     if (!aHandles.empty())
     {
-        VSICURLMultiPerform(hMultiHandle);
+        VSICURLMultiPerformLimited(hMultiHandle, aHandles, nMaxParallelRequests,
+                                   &m_bInterrupt);
     }
 
+    // Process the requests we have issued first, so that other threads
+    // waiting for them are released before we wait for theirs.
     int nRet = 0;
-    size_t iReq = 0;
-    int iRange = 0;
     size_t nTotalDownloaded = 0;
-    for (; iReq < aHandles.size(); iReq++, iRange++)
+    for (auto &oRequest : aoRequests)
     {
-        while (iRange < nRanges && panSizes[iRange] == 0)
-        {
-            iRange++;
-        }
-        if (iRange == nRanges)
-            break;
+        if (!oRequest.bIsOwner)
+            continue;
+
+        char rangeStr[512] = {};
+        snprintf(rangeStr, sizeof(rangeStr), CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+                 oRequest.nStart, oRequest.nEnd);
 
         long response_code = 0;
-        curl_easy_getinfo(aHandles[iReq], CURLINFO_HTTP_CODE, &response_code);
+        curl_easy_getinfo(oRequest.hCurlHandle, CURLINFO_HTTP_CODE,
+                          &response_code);
 
-        if (ENABLE_DEBUG && asCurlErrors[iRange].szCurlErrBuf[0] != '\0')
+        if (ENABLE_DEBUG && oRequest.sCurlErr.szCurlErrBuf[0] != '\0')
         {
-            char rangeStr[512] = {};
-            snprintf(rangeStr, sizeof(rangeStr),
-                     CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
-                     asWriteFuncHeaderData[iReq].nStartOffset,
-                     asWriteFuncHeaderData[iReq].nEndOffset);
-
-            const char *pszErrorMsg = &asCurlErrors[iRange].szCurlErrBuf[0];
+            const char *pszErrorMsg = &oRequest.sCurlErr.szCurlErrBuf[0];
             CPLDebug(poFS->GetDebugKey(),
                      "ReadMultiRange(%s), %s: response_code=%d, msg=%s",
                      osURL.c_str(), rangeStr, static_cast<int>(response_code),
                      pszErrorMsg);
         }
 
-        if ((response_code != 206 && response_code != 225) ||
-            asWriteFuncHeaderData[iReq].nEndOffset + 1 !=
-                asWriteFuncHeaderData[iReq].nStartOffset +
-                    asWriteFuncData[iReq].nSize)
+        const bool bOK =
+            (response_code == 206 || response_code == 225) &&
+            oRequest.nEnd + 1 ==
+                oRequest.nStart + oRequest.sWriteFuncData.nSize;
+        if (!bOK)
         {
-            char rangeStr[512] = {};
-            snprintf(rangeStr, sizeof(rangeStr),
-                     CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
-                     asWriteFuncHeaderData[iReq].nStartOffset,
-                     asWriteFuncHeaderData[iReq].nEndOffset);
-
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Request for %s failed with response_code=%ld", rangeStr,
                      response_code);
             nRet = -1;
         }
-        else if (nRet == 0)
+        else
         {
-            size_t nOffset = 0;
-            size_t nRemainingSize = asWriteFuncData[iReq].nSize;
-            nTotalDownloaded += nRemainingSize;
-            CPLAssert(iRange < nRanges);
-            while (true)
+            nTotalDownloaded += oRequest.sWriteFuncData.nSize;
+
+            double dfPreTransferTime = 0;
+            double dfStartTransferTime = 0;
+            double dfTotalTime = 0;
+            curl_easy_getinfo(oRequest.hCurlHandle, CURLINFO_PRETRANSFER_TIME,
+                              &dfPreTransferTime);
+            curl_easy_getinfo(oRequest.hCurlHandle,
+                              CURLINFO_STARTTRANSFER_TIME,
+                              &dfStartTransferTime);
+            curl_easy_getinfo(oRequest.hCurlHandle, CURLINFO_TOTAL_TIME,
+                              &dfTotalTime);
+            poFS->UpdateTransferStats(
+                m_pszURL, dfStartTransferTime - dfPreTransferTime,
+                dfTotalTime - dfStartTransferTime,
+                oRequest.sWriteFuncData.nSize);
+
+            for (int iRange = oRequest.iFirstRange;
+                 iRange <= oRequest.iLastRange; ++iRange)
             {
-                if (nRemainingSize < panSizes[iRange])
-                {
-                    nRet = -1;
-                    break;
-                }
-
                 if (panSizes[iRange] > 0)
                 {
                     memcpy(ppData[iRange],
-                           asWriteFuncData[iReq].pBuffer + nOffset,
+                           oRequest.sWriteFuncData.pBuffer +
+                               static_cast<size_t>(panOffsets[iRange] -
+                                                   oRequest.nStart),
                            panSizes[iRange]);
                 }
-
-                if (bMergeConsecutiveRanges && iRange + 1 < nRanges &&
-                    panOffsets[iRange] + panSizes[iRange] ==
-                        panOffsets[iRange + 1])
-                {
-                    nOffset += panSizes[iRange];
-                    nRemainingSize -= panSizes[iRange];
-                    iRange++;
-                }
-                else
-                {
-                    break;
-                }
             }
         }
 
-        curl_multi_remove_handle(hMultiHandle, aHandles[iReq]);
-        VSICURLResetHeaderAndWriterFunctions(aHandles[iReq]);
-        curl_easy_cleanup(aHandles[iReq]);
-        CPLFree(apszRanges[iReq]);
-        CPLFree(asWriteFuncData[iReq].pBuffer);
-        CPLFree(asWriteFuncHeaderData[iReq].pBuffer);
-        curl_slist_free_all(aHeaders[iReq]);
+        poFS->NotifyStopDownloadRange(
+            osKeyURL, oRequest.poRange,
+            bOK ? oRequest.sWriteFuncData.pBuffer : nullptr);
+
+        curl_multi_remove_handle(hMultiHandle, oRequest.hCurlHandle);
+        VSICURLResetHeaderAndWriterFunctions(oRequest.hCurlHandle);
+        curl_easy_cleanup(oRequest.hCurlHandle);
+        CPLFree(oRequest.sWriteFuncData.pBuffer);
+        CPLFree(oRequest.sWriteFuncHeaderData.pBuffer);
+        curl_slist_free_all(oRequest.headers);
     }
 
     NetworkStatisticsLogger::LogGET(nTotalDownloaded);
 
+    for (auto &oRequest : aoRequests)
+    {
+        if (oRequest.bIsOwner)
+            continue;
+
+        auto &oRange = *(oRequest.poRange);
+        {
+            std::unique_lock<std::mutex> oLock(oRange.oMutex);
+            while (!oRange.bDone)
+                oRange.oCond.wait(oLock);
+        }
+        if (oRange.bOK)
+        {
+            for (int iRange = oRequest.iFirstRange;
+                 iRange <= oRequest.iLastRange; ++iRange)
+            {
+                if (panSizes[iRange] > 0)
+                {
+                    memcpy(ppData[iRange],
+                           oRange.osData.data() +
+                               static_cast<size_t>(panOffsets[iRange] -
+                                                   oRange.nStart),
+                           panSizes[iRange]);
+                }
+            }
+        }
+        else if (nRet == 0)
+        {
+            // The download of the other thread failed: try on our own
+            const int nRangesOfRequest =
+                oRequest.iLastRange - oRequest.iFirstRange + 1;
+            nRet = VSIVirtualHandle::ReadMultiRange(
+                nRangesOfRequest, ppData + oRequest.iFirstRange,
+                panOffsets + oRequest.iFirstRange,
+                panSizes + oRequest.iFirstRange);
+        }
+    }
+
     if (ENABLE_DEBUG)
         CPLDebug(poFS->GetDebugKey(), "Download completed");
 
@@ -3594,6 +4000,8 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                 CPLAssert(oIter != oMapHandleToIdx.end());
                 const auto iReq = oIter->second;
 
+                VSICURLLogRequestMetrics(hCurlHandle);
+
                 long response_code = 0;
                 curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE,
                                   &response_code);
@@ -3946,6 +4354,311 @@ CURLM *VSICurlFilesystemHandlerBase::GetCurlMultiHandleFor(
     return conn.hCurlMultiHandle;
 }
 
+/************************************************************************/
+/*                          VSICurlDiskCache                            */
+/************************************************************************/
+
+namespace
+{
+
+// Persistent cache of downloaded regions, enabled by setting the
+// CPL_VSIL_CURL_DISK_CACHE_DIR configuration option, and that can be shared
+// by several processes.
+// Each region is stored in its own file, whose name is the SHA256 of the URL,
+// of the ETag of the remote file, of the download chunk size and of the
+// offset of the region, so that a modification of the remote file changes
+// the name of its cached regions. The last modification time of the remote
+// file, when known, is also stored in the file and checked when reading it.
+// Files are written in a temporary file that is then renamed, so that readers
+// never see partially written files. When the total size of the cache
+// exceeds CPL_VSIL_CURL_DISK_CACHE_SIZE, the least recently used files are
+// removed.
+class VSICurlDiskCache
+{
+  public:
+    static bool IsEnabled();
+    static std::shared_ptr<std::string> Read(const char *pszURL,
+                                             const FileProp &oFileProp,
+                                             vsi_l_offset nFileOffsetStart);
+    static void Write(const char *pszURL, const FileProp &oFileProp,
+                      vsi_l_offset nFileOffsetStart, size_t nSize,
+                      const char *pData);
+
+  private:
+    static constexpr const char MAGIC[] = "GDALVCC1";
+    static constexpr size_t MAGIC_SIZE = sizeof(MAGIC) - 1;
+    static constexpr size_t HEADER_SIZE = MAGIC_SIZE + sizeof(GInt64);
+
+    static std::mutex gMutex;
+    static std::string gosLastCheckedDir;
+    static GIntBig gnBytesWrittenSinceLastCheck;
+
+    static std::string GetFilename(const std::string &osDir,
+                                   const char *pszURL,
+                                   const FileProp &oFileProp,
+                                   vsi_l_offset nFileOffsetStart);
+    static GIntBig GetMaxSize();
+    static void Evict(const std::string &osDir, GIntBig nMaxSize);
+};
+
+std::mutex VSICurlDiskCache::gMutex{};
+std::string VSICurlDiskCache::gosLastCheckedDir{};
+GIntBig VSICurlDiskCache::gnBytesWrittenSinceLastCheck = 0;
+
+/************************************************************************/
+/*                             IsEnabled()                              */
+/************************************************************************/
+
+bool VSICurlDiskCache::IsEnabled()
+{
+    const char *pszDir = CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", "");
+    return pszDir[0] != '\0';
+}
+
+/************************************************************************/
+/*                            GetFilename()                             */
+/************************************************************************/
+
+std::string VSICurlDiskCache::GetFilename(const std::string &osDir,
+                                          const char *pszURL,
+                                          const FileProp &oFileProp,
+                                          vsi_l_offset nFileOffsetStart)
+{
+    // Without an ETag, we have no reliable way of knowing if the remote
+    // file has changed.
+    if (oFileProp.ETag.empty())
+        return std::string();
+
+    std::string osKey(pszURL);
+    osKey += '\n';
+    osKey += oFileProp.ETag;
+    osKey += '\n';
+    osKey += std::to_string(VSICURLGetDownloadChunkSize());
+    osKey += '\n';
+    osKey += std::to_string(nFileOffsetStart);
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osHex(pszHex);
+    CPLFree(pszHex);
+
+    // Use a first level of sub-directories to avoid too many files in
+    // a single directory.
+    return CPLFormFilenameSafe(
+        CPLFormFilenameSafe(osDir.c_str(), osHex.substr(0, 2).c_str(), nullptr)
+            .c_str(),
+        osHex.c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                             GetMaxSize()                             */
+/************************************************************************/
+
+GIntBig VSICurlDiskCache::GetMaxSize()
+{
+    GIntBig nMaxSize = 1024 * 1024 * 1024;
+    const char *pszSize = CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE",
+                                             nullptr);
+    if (pszSize)
+    {
+        bool bUnitSpecified = false;
+        if (CPLParseMemorySize(pszSize, &nMaxSize, &bUnitSpecified) != CE_None)
+            nMaxSize = 1024 * 1024 * 1024;
+    }
+    return nMaxSize;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+std::shared_ptr<std::string>
+VSICurlDiskCache::Read(const char *pszURL, const FileProp &oFileProp,
+                       vsi_l_offset nFileOffsetStart)
+{
+    const std::string osDir =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", "");
+    if (osDir.empty())
+        return nullptr;
+    const std::string osFilename =
+        GetFilename(osDir, pszURL, oFileProp, nFileOffsetStart);
+    if (osFilename.empty())
+        return nullptr;
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "rb"));
+    if (!fp)
+        return nullptr;
+    fp->Seek(0, SEEK_END);
+    const vsi_l_offset nFileSize = fp->Tell();
+    if (nFileSize < HEADER_SIZE ||
+        nFileSize - HEADER_SIZE >
+            static_cast<vsi_l_offset>(VSICURLGetDownloadChunkSize()))
+        return nullptr;
+    fp->Seek(0, SEEK_SET);
+
+    char abyHeader[HEADER_SIZE];
+    auto out = std::make_shared<std::string>();
+    out->resize(static_cast<size_t>(nFileSize - HEADER_SIZE));
+    if (fp->Read(abyHeader, 1, HEADER_SIZE) != HEADER_SIZE ||
+        memcmp(abyHeader, MAGIC, MAGIC_SIZE) != 0 ||
+        fp->Read(out->data(), 1, out->size()) != out->size())
+    {
+        return nullptr;
+    }
+    fp.reset();
+
+    GInt64 nMTime = 0;
+    memcpy(&nMTime, abyHeader + MAGIC_SIZE, sizeof(nMTime));
+    CPL_LSBPTR64(&nMTime);
+    if (nMTime != 0 && oFileProp.mTime != 0 &&
+        nMTime != static_cast<GInt64>(oFileProp.mTime))
+    {
+        VSIUnlink(osFilename.c_str());
+        return nullptr;
+    }
+
+#ifndef _WIN32
+    // Mark the file as recently used, for the eviction policy.
+    utime(osFilename.c_str(), nullptr);
+#endif
+
+    return out;
+}
+
+/************************************************************************/
+/*                                Write()                               */
+/************************************************************************/
+
+void VSICurlDiskCache::Write(const char *pszURL, const FileProp &oFileProp,
+                             vsi_l_offset nFileOffsetStart, size_t nSize,
+                             const char *pData)
+{
+    const std::string osDir =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", "");
+    if (osDir.empty())
+        return;
+    const std::string osFilename =
+        GetFilename(osDir, pszURL, oFileProp, nFileOffsetStart);
+    if (osFilename.empty())
+        return;
+
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) == 0)
+        return;
+
+    // The cache may hold content fetched with credentials, so that it must
+    // only be readable by the current user.
+    const std::string osSubDir = CPLGetPathSafe(osFilename.c_str());
+    if (VSIStatL(osSubDir.c_str(), &sStat) != 0)
+    {
+        VSIMkdirRecursive(osSubDir.c_str(), 0700);
+    }
+
+    // The temporary file name must be unique among processes and threads.
+    const std::string osTmpFilename =
+        osFilename +
+        CPLSPrintf(".%d." CPL_FRMT_GIB ".tmp", CPLGetCurrentProcessID(),
+                   CPLGetPID());
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osTmpFilename.c_str(), "wb"));
+    if (!fp)
+    {
+        CPLDebugOnce("VSICURL", "Cannot create %s in disk cache",
+                     osTmpFilename.c_str());
+        return;
+    }
+#ifndef _WIN32
+    // Restrict permissions while the file is still empty.
+    if (chmod(osTmpFilename.c_str(), S_IRUSR | S_IWUSR) != 0)
+    {
+        fp.reset();
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+#endif
+    GInt64 nMTime = static_cast<GInt64>(oFileProp.mTime);
+    CPL_LSBPTR64(&nMTime);
+    bool bOK = fp->Write(MAGIC, 1, MAGIC_SIZE) == MAGIC_SIZE &&
+               fp->Write(&nMTime, 1, sizeof(nMTime)) == sizeof(nMTime) &&
+               fp->Write(pData, 1, nSize) == nSize;
+    bOK = fp->Close() == 0 && bOK;
+    fp.reset();
+    if (!bOK || VSIRename(osTmpFilename.c_str(), osFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    const GIntBig nMaxSize = GetMaxSize();
+    bool bMustCheck = false;
+    {
+        std::lock_guard<std::mutex> oLock(gMutex);
+        gnBytesWrittenSinceLastCheck += static_cast<GIntBig>(nSize);
+        // Check the cache size the first time we write into it, and then
+        // each time we have written 10% of its maximum size, since other
+        // processes can also write into it.
+        if (gosLastCheckedDir != osDir ||
+            gnBytesWrittenSinceLastCheck > nMaxSize / 10)
+        {
+            gosLastCheckedDir = osDir;
+            gnBytesWrittenSinceLastCheck = 0;
+            bMustCheck = true;
+        }
+    }
+    if (bMustCheck)
+        Evict(osDir, nMaxSize);
+}
+
+/************************************************************************/
+/*                                Evict()                               */
+/************************************************************************/
+
+void VSICurlDiskCache::Evict(const std::string &osDir, GIntBig nMaxSize)
+{
+    struct CacheFile
+    {
+        std::string osFilename;
+        time_t nMTime;
+        GIntBig nSize;
+    };
+
+    std::vector<CacheFile> aoFiles;
+    GIntBig nTotalSize = 0;
+    const CPLStringList aosFiles(VSIReadDirRecursive(osDir.c_str()));
+    for (const char *pszFile : aosFiles)
+    {
+        const std::string osFilename =
+            CPLFormFilenameSafe(osDir.c_str(), pszFile, nullptr);
+        VSIStatBufL sStat;
+        if (VSIStatL(osFilename.c_str(), &sStat) == 0 &&
+            VSI_ISREG(sStat.st_mode))
+        {
+            aoFiles.push_back({osFilename, sStat.st_mtime,
+                               static_cast<GIntBig>(sStat.st_size)});
+            nTotalSize += static_cast<GIntBig>(sStat.st_size);
+        }
+    }
+    if (nTotalSize <= nMaxSize)
+        return;
+
+    // Remove the least recently used files, until we are 10% below the
+    // maximum size, to avoid doing that too often.
+    std::sort(aoFiles.begin(), aoFiles.end(),
+              [](const CacheFile &a, const CacheFile &b)
+              { return a.nMTime < b.nMTime; });
+    const GIntBig nTargetSize = nMaxSize - nMaxSize / 10;
+    for (const auto &oFile : aoFiles)
+    {
+        if (nTotalSize <= nTargetSize)
+            break;
+        // Concurrent removal by another process is OK.
+        VSIUnlink(oFile.osFilename.c_str());
+        nTotalSize -= oFile.nSize;
+    }
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                          GetRegionCache()                            */
 /************************************************************************/
@@ -3968,19 +4681,45 @@ VSICurlFilesystemHandlerBase::GetRegionCache()
 
 std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
-                                        vsi_l_offset nFileOffsetStart)
+                                        vsi_l_offset nFileOffsetStart,
+                                        const FileProp *poFileProp)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
-    std::shared_ptr<std::string> out;
-    if (GetRegionCache()->tryGet(
-            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
     {
-        return out;
+        CPLMutexHolder oHolder(&hMutex);
+
+        std::shared_ptr<std::string> out;
+        if (GetRegionCache()->tryGet(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
+        {
+            return out;
+        }
+    }
+
+    if (poFileProp && VSICurlDiskCache::IsEnabled())
+    {
+        auto out =
+            VSICurlDiskCache::Read(pszURL, *poFileProp, nFileOffsetStart);
+        if (VSIIOMetrics::IsEnabled())
+        {
+            static VSIIOCacheMetrics *const poCacheMetrics =
+                VSIIOMetrics::GetCache("vsicurl_disk_cache");
+            if (out)
+                poCacheMetrics->nHits.fetch_add(1, std::memory_order_relaxed);
+            else
+                poCacheMetrics->nMisses.fetch_add(1,
+                                                  std::memory_order_relaxed);
+        }
+        if (out)
+        {
+            CPLMutexHolder oHolder(&hMutex);
+            GetRegionCache()->insert(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out);
+            return out;
+        }
     }
 
     return nullptr;
@@ -3992,14 +4731,23 @@ VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
 
 void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
                                              vsi_l_offset nFileOffsetStart,
-                                             size_t nSize, const char *pData)
+                                             size_t nSize, const char *pData,
+                                             const FileProp *poFileProp)
 {
-    CPLMutexHolder oHolder(&hMutex);
+    {
+        CPLMutexHolder oHolder(&hMutex);
 
-    std::shared_ptr<std::string> value(new std::string());
-    value->assign(pData, nSize);
-    GetRegionCache()->insert(
-        FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+        std::shared_ptr<std::string> value(new std::string());
+        value->assign(pData, nSize);
+        GetRegionCache()->insert(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+    }
+
+    if (poFileProp && VSICurlDiskCache::IsEnabled())
+    {
+        VSICurlDiskCache::Write(pszURL, *poFileProp, nFileOffsetStart, nSize,
+                                pData);
+    }
 }
 
 /************************************************************************/
@@ -4151,6 +4899,11 @@ void VSICurlFilesystemHandlerBase::ClearCache()
     oCacheDirList.clear();
     nCachedFilesInDirList = 0;
 
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_oMapTransferStats.clear();
+    }
+
     GetConnectionCache()[this].clear();
 }
 
@@ -4487,7 +5240,8 @@ VSICurlFilesystemHandlerBase::Open(const char *pszFilename,
 
     if (CPLTestBool(CPLGetConfigOption("VSI_CACHE", "FALSE")))
         return VSIVirtualHandleUniquePtr(
-            VSICreateCachedFile(poHandle.release()));
+            VSICreateCachedFile(poHandle.release(),
+                                VSI_CACHED_DEFAULT_CHUNK_SIZE, 0, pszFilename));
     else
         return VSIVirtualHandleUniquePtr(poHandle.release());
 }
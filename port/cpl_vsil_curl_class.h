@@ -22,8 +22,11 @@
 #include "cpl_http.h"
 #include "cpl_string.h"
 #include "cpl_vsil_curl_priv.h"
+#include "cpl_vsil_io_metrics.h"
+#include "cpl_error_internal.h"
 #include "cpl_mem_cache.h"
 #include "cpl_multiproc.h"
+#include "cpl_worker_thread_pool.h"
 
 #include "cpl_curl_priv.h"
 
@@ -36,6 +39,7 @@
 #include <mutex>
 #include <thread>
 #include <utility>
+#include <vector>
 
 // To avoid aliasing to CopyFile to CopyFileA on Windows
 #ifdef CopyFile
@@ -212,6 +216,41 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
     std::map<std::string, std::unique_ptr<RegionInDownload>>
         m_oMapRegionInDownload{};
 
+  public:
+    // Byte range being downloaded by ReadMultiRange(), that other threads
+    // needing a subset of it can wait for, instead of issuing their own
+    // request.
+    struct RangeInDownload
+    {
+        vsi_l_offset nStart = 0;
+        vsi_l_offset nEnd = 0;  // included
+        const void *pOwner = nullptr;
+        int nWaiters = 0;  // protected by m_oMutex of the file system
+
+        std::mutex oMutex{};
+        std::condition_variable oCond{};
+        bool bDone = false;
+        bool bOK = false;
+        std::string osData{};
+    };
+
+  private:
+    // Protected by m_oMutex
+    std::map<std::string, std::vector<std::shared_ptr<RangeInDownload>>>
+        m_oMapRangesInDownload{};
+
+    // Latency and throughput observed for ranged GET requests, per host.
+    // Protected by m_oMutex
+    struct TransferStats
+    {
+        double dfLatency = 0;    // in seconds
+        double dfBandwidth = 0;  // in bytes per second
+        int nLatencyCount = 0;
+        int nBandwidthCount = 0;
+    };
+
+    std::map<std::string, TransferStats> m_oMapTransferStats{};
+
   protected:
     CPLMutex *hMutex = nullptr;
 
@@ -290,11 +329,15 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
         return false;
     }
 
-    std::shared_ptr<std::string> GetRegion(const char *pszURL,
-                                           vsi_l_offset nFileOffsetStart);
+    // When poFileProp is not null, the persistent disk cache is also used
+    // if enabled.
+    std::shared_ptr<std::string>
+    GetRegion(const char *pszURL, vsi_l_offset nFileOffsetStart,
+              const FileProp *poFileProp = nullptr);
 
     void AddRegion(const char *pszURL, vsi_l_offset nFileOffsetStart,
-                   size_t nSize, const char *pData);
+                   size_t nSize, const char *pData,
+                   const FileProp *poFileProp = nullptr);
 
     std::pair<bool, std::string>
     NotifyStartDownloadRegion(const std::string &osURL,
@@ -303,6 +346,18 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
                                   vsi_l_offset startOffset, int nBlocks,
                                   const std::string &osData);
 
+    std::shared_ptr<RangeInDownload>
+    NotifyStartDownloadRange(const std::string &osURL, vsi_l_offset nStart,
+                             vsi_l_offset nEnd, const void *pOwner,
+                             bool &bIsOwner);
+    void NotifyStopDownloadRange(const std::string &osURL,
+                                 const std::shared_ptr<RangeInDownload> &poRange,
+                                 const char *pData);
+
+    void UpdateTransferStats(const std::string &osURL, double dfLatency,
+                             double dfTransferTime, size_t nBytes);
+    vsi_l_offset GetRangeMergingMaxGap(const std::string &osURL);
+
     bool GetCachedFileProp(const char *pszURL, FileProp &oFileProp);
     void SetCachedFileProp(const char *pszURL, FileProp &oFileProp);
     void InvalidateCachedData(const char *pszURL);
@@ -605,6 +660,8 @@ class IVSIS3LikeFSHandler /* non final */
 {
     CPL_DISALLOW_COPY_ASSIGN(IVSIS3LikeFSHandler)
 
+    friend class VSIMultipartWriteHandle;
+
     virtual int MkdirInternal(const char *pszDirname, long nMode,
                               bool bDoStatCheck);
 
@@ -680,6 +737,9 @@ class IVSIS3LikeFSHandlerWithMultipartUpload /* non final */
 
     virtual bool SupportsMultipartAbort() const = 0;
 
+    //! Prefix of the configuration options of this file system, e.g. VSIS3
+    virtual const char *GetConfigOptionPrefix() const = 0;
+
     size_t GetUploadChunkSizeInBytes(const char *pszFilename,
                                      const char *pszSpecifiedValInBytes);
 
@@ -845,9 +905,21 @@ class VSIMultipartWriteHandle final : public VSIVirtualHandle
     std::vector<std::string> m_aosEtags{};
     bool m_bError = false;
 
+    // Background upload of parts, when VSI<xx>_MAX_INFLIGHT_PARTS > 1
+    int m_nMaxInFlightParts = 1;
+    std::unique_ptr<CPLWorkerThreadPool> m_poThreadPool{};
+    CPLJobQueuePtr m_poJobQueue{};
+    std::mutex m_oMutex{};
+    std::vector<GByte *> m_apabyFreeBuffers{};  // protected by m_oMutex
+    bool m_bPartUploadFailed = false;           // protected by m_oMutex
+    std::unique_ptr<CPLErrorAccumulator> m_poErrorAccumulator{};
+
     WriteFuncStruct m_sWriteFuncHeaderData{};
 
     bool UploadPart();
+    bool SubmitPartUpload();
+    bool WaitPartUploads();
+    void SetPartETag(int nPartNumber, std::string &&osEtag);
     bool DoSinglePartPUT();
 
     void InvalidateParentDirectory();
@@ -1206,7 +1278,11 @@ class NetworkStatisticsLogger
 
 struct NetworkStatisticsFileSystem
 {
+    // Always active, contrary to NetworkStatisticsLogger
+    VSIIOMetrics::FileSystemContext m_oIOMetricsContext;
+
     inline explicit NetworkStatisticsFileSystem(const char *pszName)
+        : m_oIOMetricsContext(pszName)
     {
         NetworkStatisticsLogger::EnterFileSystem(pszName);
     }
@@ -1628,7 +1628,8 @@ VSICurlStreamingFSHandler::Open(const char *pszFilename, const char *pszAccess,
 
     if (CPLTestBool(CPLGetConfigOption("VSI_CACHE", "FALSE")))
         return VSIVirtualHandleUniquePtr(
-            VSICreateCachedFile(poHandle.release()));
+            VSICreateCachedFile(poHandle.release(),
+                                VSI_CACHED_DEFAULT_CHUNK_SIZE, 0, pszFilename));
 
     return VSIVirtualHandleUniquePtr(poHandle.release());
 }
@@ -68,6 +68,11 @@ class VSIGSFSHandler final : public IVSIS3LikeFSHandlerWithMultipartUpload
         return "GS";
     }
 
+    const char *GetConfigOptionPrefix() const override
+    {
+        return "VSIGS";
+    }
+
     std::string GetFSPrefix() const override
     {
         return m_osPrefix;
@@ -79,6 +79,10 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <list>
@@ -90,6 +94,8 @@
 #include <vector>
 
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
+#include "cpl_mem_cache.h"
 #include "cpl_minizip_ioapi.h"
 #include "cpl_minizip_unzip.h"
 #include "cpl_multiproc.h"
@@ -97,6 +103,7 @@
 #include "cpl_time.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 constexpr int Z_BUFSIZE = 65536;           // Original size is 16384
 constexpr int gz_magic[2] = {0x1f, 0x8b};  // gzip magic header
@@ -143,6 +150,78 @@ typedef struct
     vsi_l_offset out;
 } GZipSnapshot;
 
+/************************************************************************/
+/* ==================================================================== */
+/*                          VSIGZipIndex                                */
+/* ==================================================================== */
+/************************************************************************/
+
+// Contrary to snapshots, which are copies of the whole zlib state, access
+// points only store what is needed to restart decompression at the start of
+// a deflate block (cf examples/zran.c in zlib), and can thus be persisted.
+struct VSIGZipAccessPoint
+{
+    vsi_l_offset nUncompressedOffset = 0;
+    // Offset in the base file of the first full byte of the deflate block
+    vsi_l_offset nCompressedOffset = 0;
+    // Number of bits of the byte before nCompressedOffset that belong to the
+    // block (0 to 7), and value of that byte.
+    int nBits = 0;
+    GByte byPrevByte = 0;
+    // CRC32 of the uncompressed data of the current gzip member, up to the
+    // access point
+    uLong crc = 0;
+    // Last (up to) 32 KB of uncompressed data before the access point
+    std::vector<GByte> abyWindow{};
+};
+
+using VSIGZipAccessPointPtr = std::shared_ptr<const VSIGZipAccessPoint>;
+
+// Set of access points of a .gz file, shared by all handles on that file.
+class VSIGZipIndex
+{
+    mutable std::mutex m_oMutex{};
+    const vsi_l_offset m_nSpan;
+    const bool m_bLoaded;
+    std::vector<VSIGZipAccessPointPtr> m_apoPoints{};  // sorted
+    bool m_bSaveAttempted = false;
+
+    bool WantsPointAtUnlocked(vsi_l_offset nOffset) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSIGZipIndex)
+
+  public:
+    VSIGZipIndex(vsi_l_offset nSpan, bool bLoaded)
+        : m_nSpan(nSpan), m_bLoaded(bLoaded)
+    {
+    }
+
+    vsi_l_offset GetSpan() const
+    {
+        return m_nSpan;
+    }
+
+    // Whether access points must still be collected while decompressing
+    bool IsBuilding() const
+    {
+        return !m_bLoaded;
+    }
+
+    bool WantsPointAt(vsi_l_offset nOffset) const;
+    void AddPoint(VSIGZipAccessPointPtr &&poPoint);
+    VSIGZipAccessPointPtr GetPointBefore(vsi_l_offset nOffset) const;
+    VSIGZipAccessPointPtr GetPointAfter(vsi_l_offset nOffset) const;
+    std::vector<VSIGZipAccessPointPtr> GetPointsIn(vsi_l_offset nStart,
+                                                   vsi_l_offset nEnd) const;
+
+    bool TestAndSetSaveAttempted();
+    bool Save(const std::string &osFilename, vsi_l_offset nCompressedSize,
+              vsi_l_offset nUncompressedSize, GIntBig nMTime) const;
+    static std::shared_ptr<VSIGZipIndex>
+    Load(const std::string &osFilename, vsi_l_offset nCompressedSize,
+         GIntBig nMTime, vsi_l_offset &nUncompressedSize);
+};
+
 class VSIGZipHandle final : public VSIVirtualHandle
 {
     VSIVirtualHandleUniquePtr m_poBaseHandle{};
@@ -177,12 +256,53 @@ class VSIGZipHandle final : public VSIVirtualHandle
     vsi_l_offset snapshot_byte_interval =
         0; /* number of compressed bytes at which we create a "snapshot" */
 
+    std::shared_ptr<VSIGZipIndex> m_poIndex{};
+    GIntBig m_nBaseMTime = 0;
+    // Whether the current decompression run started at the beginning of the
+    // file, in which case the index is complete once the end is reached.
+    bool m_bDecompressedFromStart = true;
+
+    // Segment between two consecutive access points of a complete index,
+    // decompressed ahead of sequential reads by a worker thread.
+    struct PrefetchedSegment
+    {
+        vsi_l_offset nStart = 0;
+        std::vector<GByte> abyData{};
+        std::future<bool> oResult{};
+        bool bWaited = false;
+        bool bOK = false;
+    };
+
+    std::deque<std::shared_ptr<PrefetchedSegment>> m_apoPrefetched{};
+    std::unique_ptr<CPLJobQueue> m_poPrefetchQueue{};
+    int m_nMaxInflightBlocks = 0;
+    bool m_bPrefetchDisabled = false;
+    // Whether reads are served from m_apoPrefetched, in which case the
+    // decompression state is not in sync with out.
+    bool m_bPrefetchActive = false;
+    // Uncompressed offset of the end of the last submitted segment
+    vsi_l_offset m_nPrefetchEnd = 0;
+    // Uncompressed offset at which the current run of sequential reads
+    // started, and offset at which the next sequential read would start.
+    vsi_l_offset m_nSequentialReadStart = 0;
+    vsi_l_offset m_nNextSequentialReadOffset = 0;
+
     void check_header();
     int get_byte();
     bool gzseek(vsi_l_offset nOffset, int nWhence);
     int gzrewind();
     uLong getLong();
 
+    size_t ReadInternal(void *buf, size_t nSize, size_t nMemb);
+    bool ReadParallel(void *buf, unsigned len, size_t &nRead);
+    bool ReadFromPrefetch(void *buf, size_t len, size_t &nRead);
+    bool StartPrefetch();
+    void SubmitPrefetch();
+    bool StopPrefetch(vsi_l_offset nTarget);
+    void AddIndexPoint();
+    bool RestoreFromIndex(const VSIGZipAccessPoint &oPoint);
+    void SaveIndexIfComplete();
+
     CPL_DISALLOW_COPY_ASSIGN(VSIGZipHandle)
 
   public:
@@ -237,6 +357,8 @@ class VSIGZipHandle final : public VSIVirtualHandle
     {
         m_bCanSaveInfo = false;
     }
+
+    void EnableIndex(bool bBuild);
 };
 
 #ifdef ENABLE_DEFLATE64
@@ -374,6 +496,278 @@ class VSIGZipFilesystemHandler final : public VSIFilesystemHandler
     void SaveInfo_unlocked(VSIGZipHandle *poHandle);
 };
 
+/************************************************************************/
+/*                       WantsPointAtUnlocked()                         */
+/************************************************************************/
+
+bool VSIGZipIndex::WantsPointAtUnlocked(vsi_l_offset nOffset) const
+{
+    const auto oIter = std::upper_bound(
+        m_apoPoints.begin(), m_apoPoints.end(), nOffset,
+        [](vsi_l_offset nVal, const VSIGZipAccessPointPtr &poPoint)
+        { return nVal < poPoint->nUncompressedOffset; });
+    const vsi_l_offset nPrevOffset =
+        oIter == m_apoPoints.begin() ? 0 : (*std::prev(oIter))->nUncompressedOffset;
+    return nOffset >= nPrevOffset + m_nSpan &&
+           (oIter == m_apoPoints.end() ||
+            (*oIter)->nUncompressedOffset >= nOffset + m_nSpan);
+}
+
+/************************************************************************/
+/*                           WantsPointAt()                             */
+/************************************************************************/
+
+bool VSIGZipIndex::WantsPointAt(vsi_l_offset nOffset) const
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    return !m_bLoaded && WantsPointAtUnlocked(nOffset);
+}
+
+/************************************************************************/
+/*                             AddPoint()                               */
+/************************************************************************/
+
+void VSIGZipIndex::AddPoint(VSIGZipAccessPointPtr &&poPoint)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    if (!WantsPointAtUnlocked(poPoint->nUncompressedOffset))
+        return;
+    const auto oIter = std::upper_bound(
+        m_apoPoints.begin(), m_apoPoints.end(), poPoint->nUncompressedOffset,
+        [](vsi_l_offset nVal, const VSIGZipAccessPointPtr &poOther)
+        { return nVal < poOther->nUncompressedOffset; });
+    m_apoPoints.insert(oIter, std::move(poPoint));
+}
+
+/************************************************************************/
+/*                          GetPointBefore()                            */
+/************************************************************************/
+
+/** Return the last access point whose uncompressed offset is <= nOffset */
+VSIGZipAccessPointPtr VSIGZipIndex::GetPointBefore(vsi_l_offset nOffset) const
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    const auto oIter = std::upper_bound(
+        m_apoPoints.begin(), m_apoPoints.end(), nOffset,
+        [](vsi_l_offset nVal, const VSIGZipAccessPointPtr &poPoint)
+        { return nVal < poPoint->nUncompressedOffset; });
+    if (oIter == m_apoPoints.begin())
+        return nullptr;
+    return *std::prev(oIter);
+}
+
+/************************************************************************/
+/*                           GetPointAfter()                            */
+/************************************************************************/
+
+/** Return the first access point whose uncompressed offset is > nOffset */
+VSIGZipAccessPointPtr VSIGZipIndex::GetPointAfter(vsi_l_offset nOffset) const
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    const auto oIter = std::upper_bound(
+        m_apoPoints.begin(), m_apoPoints.end(), nOffset,
+        [](vsi_l_offset nVal, const VSIGZipAccessPointPtr &poPoint)
+        { return nVal < poPoint->nUncompressedOffset; });
+    if (oIter == m_apoPoints.end())
+        return nullptr;
+    return *oIter;
+}
+
+/************************************************************************/
+/*                           GetPointsIn()                              */
+/************************************************************************/
+
+/** Return the access points whose uncompressed offset is in
+ * ]nStart, nEnd[ */
+std::vector<VSIGZipAccessPointPtr>
+VSIGZipIndex::GetPointsIn(vsi_l_offset nStart, vsi_l_offset nEnd) const
+{
+    std::vector<VSIGZipAccessPointPtr> apoRet;
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    for (auto oIter = std::upper_bound(
+             m_apoPoints.begin(), m_apoPoints.end(), nStart,
+             [](vsi_l_offset nVal, const VSIGZipAccessPointPtr &poPoint)
+             { return nVal < poPoint->nUncompressedOffset; });
+         oIter != m_apoPoints.end() && (*oIter)->nUncompressedOffset < nEnd;
+         ++oIter)
+    {
+        apoRet.push_back(*oIter);
+    }
+    return apoRet;
+}
+
+/************************************************************************/
+/*                      TestAndSetSaveAttempted()                       */
+/************************************************************************/
+
+/** Return true the first time it is called on an index that has been
+ * built (and not loaded) */
+bool VSIGZipIndex::TestAndSetSaveAttempted()
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    if (m_bLoaded || m_bSaveAttempted)
+        return false;
+    m_bSaveAttempted = true;
+    return true;
+}
+
+constexpr const char VSIGZIP_INDEX_SIGNATURE[] = "GDALGZI1";
+constexpr const char VSIGZIP_INDEX_EXTENSION[] = ".gzidx";
+constexpr int VSIGZIP_WINDOW_SIZE = 32768;
+
+/************************************************************************/
+/*                               Save()                                 */
+/************************************************************************/
+
+/** Save the index in a sidecar file */
+bool VSIGZipIndex::Save(const std::string &osFilename,
+                        vsi_l_offset nCompressedSize,
+                        vsi_l_offset nUncompressedSize, GIntBig nMTime) const
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "wb"));
+    if (!fp)
+        return false;
+
+    bool bOK = fp->Write(VSIGZIP_INDEX_SIGNATURE, 1,
+                         strlen(VSIGZIP_INDEX_SIGNATURE)) ==
+               strlen(VSIGZIP_INDEX_SIGNATURE);
+    const auto WriteUInt64 = [&fp, &bOK](uint64_t nVal)
+    {
+        CPL_LSBPTR64(&nVal);
+        bOK &= fp->Write(&nVal, sizeof(nVal), 1) == 1;
+    };
+    const auto WriteUInt32 = [&fp, &bOK](uint32_t nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        bOK &= fp->Write(&nVal, sizeof(nVal), 1) == 1;
+    };
+    WriteUInt64(nCompressedSize);
+    WriteUInt64(nUncompressedSize);
+    WriteUInt64(static_cast<uint64_t>(nMTime));
+    WriteUInt64(m_nSpan);
+    WriteUInt64(m_apoPoints.size());
+    for (const auto &poPoint : m_apoPoints)
+    {
+        WriteUInt64(poPoint->nUncompressedOffset);
+        WriteUInt64(poPoint->nCompressedOffset);
+        const GByte abyBits[2] = {static_cast<GByte>(poPoint->nBits),
+                                  poPoint->byPrevByte};
+        bOK &= fp->Write(abyBits, 1, 2) == 2;
+        WriteUInt32(static_cast<uint32_t>(poPoint->crc));
+        WriteUInt32(static_cast<uint32_t>(poPoint->abyWindow.size()));
+        bOK &= fp->Write(poPoint->abyWindow.data(), 1,
+                         poPoint->abyWindow.size()) == poPoint->abyWindow.size();
+    }
+    bOK &= fp->Close() == 0;
+    if (!bOK)
+        VSIUnlink(osFilename.c_str());
+    return bOK;
+}
+
+/************************************************************************/
+/*                               Load()                                 */
+/************************************************************************/
+
+/** Load an index from a sidecar file, if it exists and matches the
+ * characteristics of the .gz file.
+ */
+std::shared_ptr<VSIGZipIndex>
+VSIGZipIndex::Load(const std::string &osFilename, vsi_l_offset nCompressedSize,
+                   GIntBig nMTime, vsi_l_offset &nUncompressedSize)
+{
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "rb"));
+    if (!fp)
+        return nullptr;
+
+    char szSignature[sizeof(VSIGZIP_INDEX_SIGNATURE) - 1] = {};
+    bool bOK = fp->Read(szSignature, 1, sizeof(szSignature)) ==
+                   sizeof(szSignature) &&
+               memcmp(szSignature, VSIGZIP_INDEX_SIGNATURE,
+                      sizeof(szSignature)) == 0;
+    const auto ReadUInt64 = [&fp, &bOK]()
+    {
+        uint64_t nVal = 0;
+        bOK &= fp->Read(&nVal, sizeof(nVal), 1) == 1;
+        CPL_LSBPTR64(&nVal);
+        return nVal;
+    };
+    const auto ReadUInt32 = [&fp, &bOK]()
+    {
+        uint32_t nVal = 0;
+        bOK &= fp->Read(&nVal, sizeof(nVal), 1) == 1;
+        CPL_LSBPTR32(&nVal);
+        return nVal;
+    };
+
+    if (!bOK || ReadUInt64() != nCompressedSize)
+        return nullptr;
+    const vsi_l_offset nUncompressedSizeInFile = ReadUInt64();
+    if (ReadUInt64() != static_cast<uint64_t>(nMTime))
+    {
+        CPLDebug("GZIP", "Ignoring %s, which is out of date",
+                 osFilename.c_str());
+        return nullptr;
+    }
+    const vsi_l_offset nSpan = ReadUInt64();
+    const uint64_t nPoints = ReadUInt64();
+    if (!bOK || nSpan == 0 ||
+        nPoints > nUncompressedSizeInFile / nSpan + 1)
+    {
+        return nullptr;
+    }
+
+    auto poIndex = std::make_shared<VSIGZipIndex>(nSpan, true);
+    vsi_l_offset nPrevOffset = 0;
+    for (uint64_t i = 0; bOK && i < nPoints; ++i)
+    {
+        auto poPoint = std::make_shared<VSIGZipAccessPoint>();
+        poPoint->nUncompressedOffset = ReadUInt64();
+        poPoint->nCompressedOffset = ReadUInt64();
+        GByte abyBits[2] = {0, 0};
+        bOK &= fp->Read(abyBits, 1, 2) == 2;
+        poPoint->nBits = abyBits[0];
+        poPoint->byPrevByte = abyBits[1];
+        poPoint->crc = ReadUInt32();
+        const uint32_t nWindowSize = ReadUInt32();
+        if (!bOK || poPoint->nUncompressedOffset <= nPrevOffset ||
+            poPoint->nUncompressedOffset >= nUncompressedSizeInFile ||
+            poPoint->nCompressedOffset == 0 ||
+            poPoint->nCompressedOffset >= nCompressedSize ||
+            poPoint->nBits > 7 || nWindowSize > VSIGZIP_WINDOW_SIZE)
+        {
+            bOK = false;
+            break;
+        }
+        poPoint->abyWindow.resize(nWindowSize);
+        bOK &= fp->Read(poPoint->abyWindow.data(), 1, nWindowSize) ==
+               nWindowSize;
+        nPrevOffset = poPoint->nUncompressedOffset;
+        poIndex->m_apoPoints.push_back(std::move(poPoint));
+    }
+    if (!bOK)
+    {
+        CPLDebug("GZIP", "%s is corrupted", osFilename.c_str());
+        return nullptr;
+    }
+
+    nUncompressedSize = nUncompressedSizeInFile;
+    return poIndex;
+}
+
+/************************************************************************/
+/*                        VSIGZipGetNumThreads()                        */
+/************************************************************************/
+
+// Number of threads for parallel decompression, from GDAL_NUM_THREADS.
+static int VSIGZipGetNumThreads()
+{
+    return GDALGetNumThreads(nullptr, nullptr, "ALL_CPUS", 128);
+}
+
 /************************************************************************/
 /*                            Duplicate()                               */
 /************************************************************************/
@@ -401,6 +795,8 @@ VSIGZipHandle *VSIGZipHandle::Duplicate()
     }
 
     poHandle->m_nLastReadOffset = m_nLastReadOffset;
+    poHandle->m_poIndex = m_poIndex;
+    poHandle->m_nBaseMTime = m_nBaseMTime;
 
     // Most important: duplicate the snapshots!
 
@@ -717,6 +1113,7 @@ int VSIGZipHandle::gzrewind()
         CPL_IGNORE_RET_VAL(inflateReset(&stream));
     in = 0;
     out = 0;
+    m_bDecompressedFromStart = true;
     return m_poBaseHandle->Seek(startOff, SEEK_SET);
 }
 
@@ -798,6 +1195,33 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
         return true;
     }
 
+    // While reads are served from prefetched segments, seeking within them
+    // only changes the current position. Otherwise, the decompression state
+    // must be restored first.
+    if (m_bPrefetchActive)
+    {
+        vsi_l_offset nTarget = m_uncompressed_size;
+        if (whence == SEEK_SET)
+            nTarget = offset;
+        else if (whence == SEEK_CUR)
+            nTarget = out + offset;
+        if (nTarget <= m_nPrefetchEnd &&
+            nTarget >= (m_apoPrefetched.empty()
+                            ? m_nPrefetchEnd
+                            : m_apoPrefetched.front()->nStart))
+        {
+            out = nTarget;
+            return true;
+        }
+        if (!StopPrefetch(nTarget))
+        {
+            CPL_VSIL_GZ_RETURN(FALSE);
+            return false;
+        }
+        offset = nTarget;
+        whence = SEEK_SET;
+    }
+
     // whence == SEEK_END is unsuppored in original gzseek.
     if (whence == SEEK_END)
     {
@@ -850,6 +1274,23 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
         return false;
     }
 
+    // Jump to the closest access point of the index, if it is after the
+    // current position.
+    if (m_poIndex)
+    {
+        const vsi_l_offset nTarget = out + offset;
+        const auto poPoint = m_poIndex->GetPointBefore(nTarget);
+        if (poPoint && poPoint->nUncompressedOffset > out)
+        {
+            if (!RestoreFromIndex(*poPoint) && gzrewind() < 0)
+            {
+                CPL_VSIL_GZ_RETURN(FALSE);
+                return false;
+            }
+            offset = nTarget - out;
+        }
+    }
+
     for (unsigned int i = 0; i < m_compressed_size / snapshot_byte_interval + 1;
          i++)
     {
@@ -883,6 +1324,7 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
             m_transparent = snapshots[i].transparent;
             in = snapshots[i].in;
             out = snapshots[i].out;
+            m_bDecompressedFromStart = false;
             break;
         }
     }
@@ -1009,6 +1451,32 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
         return 0;
     }
 
+    if (out != m_nNextSequentialReadOffset)
+        m_nSequentialReadStart = out;
+
+    size_t nRead = 0;
+    if (ReadFromPrefetch(buf, nSize * nMemb, nRead) ||
+        ReadParallel(buf, static_cast<unsigned>(nSize * nMemb), nRead))
+    {
+        m_nNextSequentialReadOffset = out;
+        const size_t ret = nRead / nSize;
+        if (ret < nMemb)
+            m_bEOF = true;
+        return ret;
+    }
+
+    const size_t ret = ReadInternal(buf, nSize, nMemb);
+    m_nNextSequentialReadOffset = out;
+    return ret;
+}
+
+/************************************************************************/
+/*                            ReadInternal()                            */
+/************************************************************************/
+
+size_t VSIGZipHandle::ReadInternal(void *const buf, size_t const nSize,
+                                   size_t const nMemb)
+{
     const unsigned len =
         static_cast<unsigned int>(nSize) * static_cast<unsigned int>(nMemb);
     Bytef *pStart =
@@ -1140,10 +1608,23 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
         }
         in += stream.avail_in;
         out += stream.avail_out;
-        z_err = inflate(&(stream), Z_NO_FLUSH);
+        // When collecting access points, stop at the end of each deflate block
+        const bool bBuildIndex = m_poIndex && m_poIndex->IsBuilding();
+        z_err = inflate(&(stream), bBuildIndex ? Z_BLOCK : Z_NO_FLUSH);
         in -= stream.avail_in;
         out -= stream.avail_out;
 
+        // Bit 128 of data_type is set at the end of a block, and bit 64 if
+        // this is the last block of the stream.
+        if (bBuildIndex && z_err == Z_OK && (stream.data_type & 128) != 0 &&
+            (stream.data_type & 64) == 0 && m_poIndex->WantsPointAt(out))
+        {
+            crc =
+                crc32(crc, pStart, static_cast<uInt>(stream.next_out - pStart));
+            pStart = stream.next_out;
+            AddIndexPoint();
+        }
+
         if (z_err == Z_STREAM_END && m_compressed_size != 2)
         {
             // Check CRC and original size.
@@ -1197,6 +1678,9 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
     }
     crc = crc32(crc, pStart, static_cast<uInt>(stream.next_out - pStart));
 
+    if (z_err == Z_STREAM_END && m_poIndex)
+        SaveIndexIfComplete();
+
     size_t ret = (len - stream.avail_out) / nSize;
     if (z_err != Z_OK && z_err != Z_STREAM_END)
     {
@@ -1217,6 +1701,557 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nSize,
     return ret;
 }
 
+/************************************************************************/
+/*                            EnableIndex()                             */
+/************************************************************************/
+
+/** Use the sidecar index of the file if it exists and is valid, or start
+ * collecting access points while decompressing otherwise.
+ */
+void VSIGZipHandle::EnableIndex(bool bBuild)
+{
+    if (m_transparent || !m_pszBaseFileName || m_poIndex)
+        return;
+
+    VSIStatBufL sStat;
+    if (VSIStatL(m_pszBaseFileName, &sStat) == 0)
+        m_nBaseMTime = static_cast<GIntBig>(sStat.st_mtime);
+
+    vsi_l_offset nUncompressedSize = 0;
+    m_poIndex = VSIGZipIndex::Load(
+        std::string(m_pszBaseFileName).append(VSIGZIP_INDEX_EXTENSION),
+        m_compressed_size, m_nBaseMTime, nUncompressedSize);
+    if (m_poIndex)
+    {
+        CPLDebug("GZIP", "Using index of %s", m_pszBaseFileName);
+        m_uncompressed_size = nUncompressedSize;
+    }
+    else if (bBuild)
+    {
+        const vsi_l_offset nSpan = std::max<vsi_l_offset>(
+            Z_BUFSIZE,
+            static_cast<vsi_l_offset>(CPLAtoGIntBig(CPLGetConfigOption(
+                "CPL_VSIL_GZIP_INDEX_SPAN", "4194304"))));
+        m_poIndex = std::make_shared<VSIGZipIndex>(nSpan, false);
+    }
+}
+
+/************************************************************************/
+/*                           AddIndexPoint()                            */
+/************************************************************************/
+
+/** Add an access point at the current position, which must be at the end of
+ * a deflate block, and for which crc must be up to date.
+ */
+void VSIGZipHandle::AddIndexPoint()
+{
+#if ZLIB_VERNUM >= 0x1271
+    const int nBits = stream.data_type & 7;
+    if (nBits != 0 && stream.next_in == inbuf)
+    {
+        // The byte holding the first bits of the next block is no longer
+        // available. Wait for the next block.
+        return;
+    }
+
+    auto poPoint = std::make_shared<VSIGZipAccessPoint>();
+    poPoint->nUncompressedOffset = out;
+    poPoint->nCompressedOffset = m_poBaseHandle->Tell() - stream.avail_in;
+    poPoint->nBits = nBits;
+    if (nBits != 0)
+        poPoint->byPrevByte = stream.next_in[-1];
+    poPoint->crc = crc;
+    poPoint->abyWindow.resize(VSIGZIP_WINDOW_SIZE);
+    uInt nWindowSize = VSIGZIP_WINDOW_SIZE;
+    if (inflateGetDictionary(&stream, poPoint->abyWindow.data(),
+                             &nWindowSize) != Z_OK)
+    {
+        return;
+    }
+    poPoint->abyWindow.resize(nWindowSize);
+    m_poIndex->AddPoint(std::move(poPoint));
+#endif
+}
+
+/************************************************************************/
+/*                          RestoreFromIndex()                          */
+/************************************************************************/
+
+/** Set the decompression state to the one at the passed access point */
+bool VSIGZipHandle::RestoreFromIndex(const VSIGZipAccessPoint &oPoint)
+{
+#ifdef ENABLE_DEBUG
+    CPLDebug("GZIP",
+             "using access point: in=" CPL_FRMT_GUIB " out=" CPL_FRMT_GUIB,
+             oPoint.nCompressedOffset, oPoint.nUncompressedOffset);
+#endif
+    if (m_poBaseHandle->Seek(oPoint.nCompressedOffset, SEEK_SET) != 0 ||
+        inflateReset(&stream) != Z_OK)
+    {
+        return false;
+    }
+    stream.avail_in = 0;
+    stream.next_in = inbuf;
+    if (oPoint.nBits != 0 &&
+        inflatePrime(&stream, oPoint.nBits,
+                     oPoint.byPrevByte >> (8 - oPoint.nBits)) != Z_OK)
+    {
+        return false;
+    }
+    if (!oPoint.abyWindow.empty() &&
+        inflateSetDictionary(&stream, oPoint.abyWindow.data(),
+                             static_cast<uInt>(oPoint.abyWindow.size())) !=
+            Z_OK)
+    {
+        return false;
+    }
+    z_err = Z_OK;
+    z_eof = 0;
+    m_bEOF = false;
+    crc = oPoint.crc;
+    in = oPoint.nCompressedOffset - startOff;
+    out = oPoint.nUncompressedOffset;
+    m_bDecompressedFromStart = false;
+    return true;
+}
+
+/************************************************************************/
+/*                        SaveIndexIfComplete()                         */
+/************************************************************************/
+
+void VSIGZipHandle::SaveIndexIfComplete()
+{
+    if (!m_bDecompressedFromStart || !m_poIndex->TestAndSetSaveAttempted())
+        return;
+
+    if (m_pszBaseFileName && !STARTS_WITH(m_pszBaseFileName, "/vsicurl/") &&
+        !STARTS_WITH(m_pszBaseFileName, "/vsitar/") &&
+        !STARTS_WITH(m_pszBaseFileName, "/vsizip/") &&
+        !EQUAL(CPLGetConfigOption("CPL_VSIL_GZIP_INDEX", "NO"), "IN_MEMORY"))
+    {
+        const std::string osIndexFilename =
+            std::string(m_pszBaseFileName).append(VSIGZIP_INDEX_EXTENSION);
+        if (m_poIndex->Save(osIndexFilename, m_compressed_size, out,
+                            m_nBaseMTime))
+        {
+            CPLDebug("GZIP", "%s written", osIndexFilename.c_str());
+        }
+    }
+}
+
+/************************************************************************/
+/*                        VSIGZipInflateSegment()                       */
+/************************************************************************/
+
+/** Decompress nDstSize bytes, starting nSkip bytes after the passed access
+ * point, using a new handle on the base file.
+ */
+static bool VSIGZipInflateSegment(const std::string &osBaseFilename,
+                                  vsi_l_offset nEndCompressedData,
+                                  const VSIGZipAccessPoint &oPoint,
+                                  vsi_l_offset nSkip, GByte *pabyDst,
+                                  size_t nDstSize)
+{
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osBaseFilename.c_str(), "rb"));
+    if (!fp || fp->Seek(oPoint.nCompressedOffset, SEEK_SET) != 0)
+        return false;
+
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+        return false;
+    std::unique_ptr<z_stream, decltype(&inflateEnd)> oStreamHolder(
+        &sStream, inflateEnd);
+    if (oPoint.nBits != 0 &&
+        inflatePrime(&sStream, oPoint.nBits,
+                     oPoint.byPrevByte >> (8 - oPoint.nBits)) != Z_OK)
+    {
+        return false;
+    }
+    if (!oPoint.abyWindow.empty() &&
+        inflateSetDictionary(&sStream, oPoint.abyWindow.data(),
+                             static_cast<uInt>(oPoint.abyWindow.size())) !=
+            Z_OK)
+    {
+        return false;
+    }
+
+    std::vector<GByte> abyIn(Z_BUFSIZE);
+    const auto Refill = [&fp, &abyIn, &sStream, nEndCompressedData]()
+    {
+        const vsi_l_offset nPos = fp->Tell();
+        if (nPos >= nEndCompressedData)
+            return false;
+        const size_t nToRead = static_cast<size_t>(std::min<vsi_l_offset>(
+            abyIn.size(), nEndCompressedData - nPos));
+        sStream.next_in = abyIn.data();
+        sStream.avail_in = static_cast<uInt>(fp->Read(abyIn.data(), 1, nToRead));
+        return sStream.avail_in > 0;
+    };
+    const auto GetByte = [&sStream, &Refill]()
+    {
+        if (sStream.avail_in == 0 && !Refill())
+            return EOF;
+        sStream.avail_in--;
+        return static_cast<int>(*(sStream.next_in++));
+    };
+    // Skip the trailer of a gzip member and the header of the next one
+    const auto SkipToNextMember = [&GetByte]()
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            if (GetByte() == EOF)
+                return false;
+        }
+        if (GetByte() != gz_magic[0] || GetByte() != gz_magic[1] ||
+            GetByte() != Z_DEFLATED)
+            return false;
+        const int flags = GetByte();
+        if (flags == EOF || (flags & RESERVED) != 0)
+            return false;
+        for (int i = 0; i < 6; ++i)
+            GetByte();
+        if ((flags & EXTRA_FIELD) != 0)
+        {
+            int len = GetByte();
+            len += GetByte() << 8;
+            for (; len > 0; --len)
+            {
+                if (GetByte() == EOF)
+                    return false;
+            }
+        }
+        for (const int nFlag : {ORIG_NAME, COMMENT})
+        {
+            if ((flags & nFlag) != 0)
+            {
+                int c;
+                while ((c = GetByte()) != 0)
+                {
+                    if (c == EOF)
+                        return false;
+                }
+            }
+        }
+        if ((flags & HEAD_CRC) != 0)
+        {
+            GetByte();
+            GetByte();
+        }
+        return true;
+    };
+    const auto Inflate = [&sStream, &Refill, &SkipToNextMember](GByte *pabyOut,
+                                                                size_t nSize)
+    {
+        sStream.next_out = pabyOut;
+        sStream.avail_out = static_cast<uInt>(nSize);
+        while (sStream.avail_out > 0)
+        {
+            if (sStream.avail_in == 0 && !Refill())
+                return false;
+            const int ret = inflate(&sStream, Z_NO_FLUSH);
+            if (ret == Z_STREAM_END)
+            {
+                // Nothing to skip if the requested data ends with the member
+                if (sStream.avail_out == 0)
+                    break;
+                if (!SkipToNextMember() || inflateReset(&sStream) != Z_OK)
+                    return false;
+            }
+            else if (ret != Z_OK)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::vector<GByte> abySkip;
+    while (nSkip > 0)
+    {
+        const size_t nChunk =
+            static_cast<size_t>(std::min<vsi_l_offset>(nSkip, Z_BUFSIZE));
+        abySkip.resize(nChunk);
+        if (!Inflate(abySkip.data(), nChunk))
+            return false;
+        nSkip -= nChunk;
+    }
+    return Inflate(pabyDst, nDstSize);
+}
+
+/************************************************************************/
+/*                           ReadParallel()                             */
+/************************************************************************/
+
+/** Read len bytes from the current position, by decompressing the segments
+ * between access points of the index in parallel.
+ *
+ * Returns false if parallel decompression cannot be used, in which case
+ * the caller must use ReadInternal().
+ */
+bool VSIGZipHandle::ReadParallel(void *buf, unsigned len, size_t &nRead)
+{
+    if (!m_poIndex || m_transparent || z_err != Z_OK || m_expected_crc != 0 ||
+        !m_pszBaseFileName || len < 2 * m_poIndex->GetSpan())
+    {
+        return false;
+    }
+
+    const int nThreads = VSIGZipGetNumThreads();
+    if (nThreads <= 1)
+        return false;
+
+    const vsi_l_offset nStart = out;
+    vsi_l_offset nEnd = nStart + len;
+    if (m_uncompressed_size != 0 && nEnd > m_uncompressed_size)
+        nEnd = m_uncompressed_size;
+    const auto apoPoints = m_poIndex->GetPointsIn(nStart, nEnd);
+    if (apoPoints.size() < 2)
+        return false;
+
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return false;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    // The segments between the first and last access points are decompressed
+    // by worker threads, while this thread goes on with the current
+    // decompression state until the first access point, and then from the
+    // last access point until the end.
+    GByte *const pabyBuf = static_cast<GByte *>(buf);
+    const std::string osBaseFilename(m_pszBaseFileName);
+    const vsi_l_offset nEndCompressedData = offsetEndCompressedData;
+    std::vector<int> abSuccess(apoPoints.size() - 1, FALSE);
+    for (size_t i = 0; i + 1 < apoPoints.size(); ++i)
+    {
+        const auto &poPoint = apoPoints[i];
+        GByte *pabyDst = pabyBuf + static_cast<size_t>(
+                                       poPoint->nUncompressedOffset - nStart);
+        const size_t nSize = static_cast<size_t>(
+            apoPoints[i + 1]->nUncompressedOffset -
+            poPoint->nUncompressedOffset);
+        int *pbSuccess = &abSuccess[i];
+        auto job = [osBaseFilename, nEndCompressedData, poPoint, pabyDst, nSize,
+                    pbSuccess]()
+        {
+            *pbSuccess = VSIGZipInflateSegment(osBaseFilename,
+                                               nEndCompressedData, *poPoint, 0,
+                                               pabyDst, nSize);
+        };
+        if (!poJobQueue->SubmitJob(job))
+            job();
+    }
+
+    const size_t nFirstSize =
+        static_cast<size_t>(apoPoints.front()->nUncompressedOffset - nStart);
+    bool bOK = ReadInternal(pabyBuf, 1, nFirstSize) == nFirstSize;
+
+    const auto &poLastPoint = apoPoints.back();
+    const size_t nLastOffset =
+        static_cast<size_t>(poLastPoint->nUncompressedOffset - nStart);
+    size_t nLastRead = 0;
+    if (bOK)
+    {
+        bOK = RestoreFromIndex(*poLastPoint);
+        if (bOK)
+            nLastRead = ReadInternal(pabyBuf + nLastOffset, 1, len - nLastOffset);
+    }
+
+    poJobQueue->WaitCompletion();
+
+    for (const int bSuccess : abSuccess)
+        bOK = bOK && bSuccess;
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "In file %s, parallel decompression failed",
+                 m_pszBaseFileName);
+        z_err = Z_DATA_ERROR;
+        nRead = 0;
+        return true;
+    }
+
+    nRead = nLastOffset + nLastRead;
+    return true;
+}
+
+/************************************************************************/
+/*                           StartPrefetch()                            */
+/************************************************************************/
+
+/** Start decompressing in worker threads the segments that follow the
+ * access point before the current position, provided that the index is
+ * complete and that reads have been sequential over at least one span.
+ */
+bool VSIGZipHandle::StartPrefetch()
+{
+    if (!m_poIndex || m_poIndex->IsBuilding() || m_transparent ||
+        m_expected_crc != 0 || !m_pszBaseFileName || m_uncompressed_size == 0)
+    {
+        m_bPrefetchDisabled = true;
+        return false;
+    }
+    if (z_err != Z_OK ||
+        out < m_nSequentialReadStart + m_poIndex->GetSpan() ||
+        out >= m_uncompressed_size)
+    {
+        return false;
+    }
+    const auto poPoint = m_poIndex->GetPointBefore(out);
+    if (!poPoint)
+        return false;
+
+    if (!m_poPrefetchQueue)
+    {
+        const int nThreads = VSIGZipGetNumThreads();
+        m_nMaxInflightBlocks = atoi(CPLGetConfigOption(
+            "CPL_VSIL_GZIP_MAX_INFLIGHT_BLOCKS", CPLSPrintf("%d", nThreads)));
+        auto poThreadPool = nThreads > 1 && m_nMaxInflightBlocks > 0
+                                ? GDALGetGlobalThreadPool(nThreads)
+                                : nullptr;
+        if (!poThreadPool)
+        {
+            m_bPrefetchDisabled = true;
+            return false;
+        }
+        m_poPrefetchQueue = poThreadPool->CreateJobQueue();
+    }
+
+#ifdef ENABLE_DEBUG
+    CPLDebug("GZIP", "Start prefetching at " CPL_FRMT_GUIB,
+             poPoint->nUncompressedOffset);
+#endif
+    m_bPrefetchActive = true;
+    m_nPrefetchEnd = poPoint->nUncompressedOffset;
+    SubmitPrefetch();
+    return true;
+}
+
+/************************************************************************/
+/*                          SubmitPrefetch()                            */
+/************************************************************************/
+
+/** Submit the decompression of segments after m_nPrefetchEnd, until there
+ * are m_nMaxInflightBlocks of them not consumed yet.
+ */
+void VSIGZipHandle::SubmitPrefetch()
+{
+    const std::string osBaseFilename(m_pszBaseFileName);
+    const vsi_l_offset nEndCompressedData = offsetEndCompressedData;
+    while (m_apoPrefetched.size() < static_cast<size_t>(m_nMaxInflightBlocks) &&
+           m_nPrefetchEnd < m_uncompressed_size)
+    {
+        const auto poPoint = m_poIndex->GetPointBefore(m_nPrefetchEnd);
+        CPLAssert(poPoint && poPoint->nUncompressedOffset == m_nPrefetchEnd);
+        const auto poNextPoint = m_poIndex->GetPointAfter(m_nPrefetchEnd);
+        const vsi_l_offset nSegmentEnd = poNextPoint
+                                             ? poNextPoint->nUncompressedOffset
+                                             : m_uncompressed_size;
+
+        auto poSegment = std::make_shared<PrefetchedSegment>();
+        poSegment->nStart = m_nPrefetchEnd;
+        poSegment->abyData.resize(
+            static_cast<size_t>(nSegmentEnd - m_nPrefetchEnd));
+        auto poPromise = std::make_shared<std::promise<bool>>();
+        poSegment->oResult = poPromise->get_future();
+        auto job = [osBaseFilename, nEndCompressedData, poPoint, poSegment,
+                    poPromise]()
+        {
+            poPromise->set_value(VSIGZipInflateSegment(
+                osBaseFilename, nEndCompressedData, *poPoint, 0,
+                poSegment->abyData.data(), poSegment->abyData.size()));
+        };
+        if (!m_poPrefetchQueue->SubmitJob(job))
+            job();
+        m_apoPrefetched.push_back(std::move(poSegment));
+        m_nPrefetchEnd = nSegmentEnd;
+    }
+}
+
+/************************************************************************/
+/*                         ReadFromPrefetch()                           */
+/************************************************************************/
+
+/** Read len bytes from the current position, from segments decompressed
+ * ahead by worker threads.
+ *
+ * Returns false if prefetching is not active and cannot be started, in which
+ * case the caller must use another reading method.
+ */
+bool VSIGZipHandle::ReadFromPrefetch(void *buf, size_t len, size_t &nRead)
+{
+    if (!m_bPrefetchActive && (m_bPrefetchDisabled || !StartPrefetch()))
+        return false;
+
+    GByte *const pabyBuf = static_cast<GByte *>(buf);
+    nRead = 0;
+    while (nRead < len && !m_apoPrefetched.empty())
+    {
+        auto &poSegment = m_apoPrefetched.front();
+        const vsi_l_offset nSegmentEnd =
+            poSegment->nStart + poSegment->abyData.size();
+        if (out >= nSegmentEnd)
+        {
+            m_apoPrefetched.pop_front();
+            SubmitPrefetch();
+            continue;
+        }
+        if (!poSegment->bWaited)
+        {
+            // Wait through the job queue, so that if this thread is a worker
+            // of the global thread pool, it runs pending jobs itself rather
+            // than blocking a worker that they might need.
+            while (poSegment->oResult.wait_for(std::chrono::seconds(0)) !=
+                       std::future_status::ready &&
+                   m_poPrefetchQueue->WaitEvent())
+            {
+            }
+            poSegment->bOK = poSegment->oResult.get();
+            poSegment->bWaited = true;
+        }
+        if (!poSegment->bOK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "In file %s, decompression of segment at "
+                     "offset " CPL_FRMT_GUIB " failed",
+                     m_pszBaseFileName, poSegment->nStart);
+            m_bPrefetchActive = false;
+            m_apoPrefetched.clear();
+            z_err = Z_DATA_ERROR;
+            break;
+        }
+        const size_t nToCopy = static_cast<size_t>(
+            std::min<vsi_l_offset>(len - nRead, nSegmentEnd - out));
+        memcpy(pabyBuf + nRead,
+               poSegment->abyData.data() +
+                   static_cast<size_t>(out - poSegment->nStart),
+               nToCopy);
+        nRead += nToCopy;
+        out += nToCopy;
+    }
+    if (out > m_nLastReadOffset)
+        m_nLastReadOffset = out;
+    return true;
+}
+
+/************************************************************************/
+/*                           StopPrefetch()                             */
+/************************************************************************/
+
+/** Stop serving reads from prefetched segments, and set the decompression
+ * state at the access point before nTarget, or at the start of the stream.
+ */
+bool VSIGZipHandle::StopPrefetch(vsi_l_offset nTarget)
+{
+    // Segments still being decompressed are owned by their job
+    m_apoPrefetched.clear();
+    m_bPrefetchActive = false;
+    const auto poPoint = m_poIndex->GetPointBefore(nTarget);
+    if (poPoint && RestoreFromIndex(*poPoint))
+        return true;
+    return gzrewind() >= 0;
+}
+
 /************************************************************************/
 /*                              getLong()                               */
 /************************************************************************/
@@ -2026,10 +3061,17 @@ class VSIGZipWriteHandleMT final : public VSIVirtualHandle
     size_t nSOZIPIndexEltSize_ = 0;
     std::vector<uint8_t> *panSOZIPIndex_ = nullptr;
 
+    // When not empty, a .gzidx sidecar file with an access point at the
+    // start of each chunk is written at closing.
+    std::string osIndexBaseFilename_{};
+    std::vector<vsi_l_offset> anChunkCompressedOffsets_{};
+    std::vector<uLong> anChunkStartCRCs_{};
+
     static void DeflateCompress(void *inData);
     static void CRCCompute(void *inData);
     bool ProcessCompletedJobs();
     Job *GetJobObject();
+    void WriteIndex(vsi_l_offset nCompressedSize);
 #ifdef DEBUG_VERBOSE
     void DumpState();
 #endif
@@ -2042,6 +3084,11 @@ class VSIGZipWriteHandleMT final : public VSIVirtualHandle
 
     ~VSIGZipWriteHandleMT() override;
 
+    void SetIndexBaseFilename(const std::string &osFilename)
+    {
+        osIndexBaseFilename_ = osFilename;
+    }
+
     int Seek(vsi_l_offset nOffset, int nWhence) override;
     vsi_l_offset Tell() override;
     size_t Read(void *pBuffer, size_t nSize, size_t nMemb) override;
@@ -2198,6 +3245,7 @@ int VSIGZipWriteHandleMT::Close()
             nRet = -1;
         }
     }
+    const vsi_l_offset nCompressedSize = poBaseHandle_->Tell() - nStartOffset_;
 
     if (bAutoCloseBaseHandle_)
     {
@@ -2209,9 +3257,57 @@ int VSIGZipWriteHandleMT::Close()
     }
     poBaseHandle_ = nullptr;
 
+    if (nRet == 0 && !osIndexBaseFilename_.empty())
+        WriteIndex(nCompressedSize);
+
     return nRet;
 }
 
+/************************************************************************/
+/*                             WriteIndex()                             */
+/************************************************************************/
+
+/** Write a .gzidx sidecar file with an access point at the start of each
+ * chunk. As chunks are terminated by a full flush, access points are byte
+ * aligned and do not need a dictionary.
+ */
+void VSIGZipWriteHandleMT::WriteIndex(vsi_l_offset nCompressedSize)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(osIndexBaseFilename_.c_str(), &sStat) != 0)
+        return;
+
+    VSIGZipIndex oIndex(nChunkSize_, false);
+    const size_t nChunks = std::min(anChunkCompressedOffsets_.size(),
+                                    anChunkStartCRCs_.size());
+    for (size_t i = 1; i < nChunks; ++i)
+    {
+        // All chunks but the last one are full
+        const vsi_l_offset nUncompressedOffset =
+            static_cast<vsi_l_offset>(i) * nChunkSize_;
+        if (nUncompressedOffset >= nCurOffset_)
+            break;
+        auto poPoint = std::make_shared<VSIGZipAccessPoint>();
+        poPoint->nUncompressedOffset = nUncompressedOffset;
+        poPoint->nCompressedOffset = anChunkCompressedOffsets_[i];
+        poPoint->crc = anChunkStartCRCs_[i];
+        oIndex.AddPoint(std::move(poPoint));
+    }
+
+    const std::string osIndexFilename =
+        osIndexBaseFilename_ + VSIGZIP_INDEX_EXTENSION;
+    if (oIndex.Save(osIndexFilename, nCompressedSize, nCurOffset_,
+                    static_cast<GIntBig>(sStat.st_mtime)))
+    {
+        CPLDebug("GZIP", "%s written", osIndexFilename.c_str());
+    }
+    else
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Cannot write %s",
+                 osIndexFilename.c_str());
+    }
+}
+
 /************************************************************************/
 /*                                Read()                                */
 /************************************************************************/
@@ -2435,6 +3531,8 @@ bool VSIGZipWriteHandleMT::ProcessCompletedJobs()
                         }
                     }
                 }
+                if (!osIndexBaseFilename_.empty())
+                    anChunkCompressedOffsets_.push_back(poBaseHandle_->Tell());
                 bool bError =
                     poBaseHandle_->Write(psJob->sCompressedData_.data(), 1,
                                          nToWrite) < nToWrite;
@@ -2469,6 +3567,8 @@ bool VSIGZipWriteHandleMT::ProcessCompletedJobs()
                 {
                     apoCRCFinishedJobs_.erase(iter);
 
+                    if (!osIndexBaseFilename_.empty())
+                        anChunkStartCRCs_.push_back(nCRC_);
                     nCRC_ = crc32_combine(
                         nCRC_, psJob->nCRC_,
                         static_cast<uLong>(psJob->pBuffer_->size()));
@@ -2750,11 +3850,12 @@ VSIVirtualHandle *VSICreateGZipWritable(VSIVirtualHandle *poBaseHandle,
     {
         if (nThreads == 0)
         {
-            if (!pszThreads || EQUAL(pszThreads, "ALL_CPUS"))
-                nThreads = CPLGetNumCPUs();
-            else
-                nThreads = atoi(pszThreads);
-            nThreads = std::max(1, std::min(128, nThreads));
+            nThreads =
+                GDALGetNumThreads(pszThreads ? pszThreads : "ALL_CPUS", 128);
+        }
+        else
+        {
+            nThreads = std::min(nThreads, GDALGetMaxNumThreads());
         }
         if (nThreads > 1 || nChunkSize > 0)
         {
@@ -3046,6 +4147,17 @@ VSIGZipFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
         if (poVirtualHandle == nullptr)
             return nullptr;
 
+        if (strchr(pszAccess, 'z') == nullptr &&
+            CPLTestBool(
+                CPLGetConfigOption("CPL_VSIL_GZIP_WRITE_INDEX", "NO")))
+        {
+            auto poHandle = std::make_unique<VSIGZipWriteHandleMT>(
+                poVirtualHandle.release(), CPL_DEFLATE_TYPE_GZIP, true,
+                std::max(1, VSIGZipGetNumThreads()), 0, 0, nullptr);
+            poHandle->SetIndexBaseFilename(pszFilename + strlen("/vsigzip/"));
+            return VSIVirtualHandleUniquePtr(poHandle.release());
+        }
+
         return VSIVirtualHandleUniquePtr(
             VSICreateGZipWritable(poVirtualHandle.release(),
                                   strchr(pszAccess, 'z') != nullptr, TRUE));
@@ -3137,6 +4249,18 @@ VSIGZipFilesystemHandler::OpenGZipReadOnly(const char *pszFilename,
     {
         return nullptr;
     }
+    // By default, only use an existing index of a local file, to avoid
+    // extra requests on network file systems.
+    const char *pszIndex = CPLGetConfigOption("CPL_VSIL_GZIP_INDEX", "AUTO");
+    if (EQUAL(pszIndex, "AUTO"))
+    {
+        if (VSIIsLocal(pszFilename + strlen("/vsigzip/")))
+            poHandle->EnableIndex(/* bBuild = */ false);
+    }
+    else if (!EQUAL(pszIndex, "NO"))
+    {
+        poHandle->EnableIndex(/* bBuild = */ true);
+    }
     return poHandle.release();
 }
 
@@ -3498,9 +4622,8 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
     VSIVirtualHandleUniquePtr OpenForWrite_unlocked(const char *pszFilename,
                                                     const char *pszAccess);
 
-    struct VSIFileInZipInfo
+    struct VSIFileInZipProperties
     {
-        VSIVirtualHandleUniquePtr poVirtualHandle{};
         std::map<std::string, std::string> oMapProperties{};
         int nCompressionMethod = 0;
         uint64_t nUncompressedSize = 0;
@@ -3516,6 +4639,24 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
         uint64_t nSOZIPStartData = 0;
     };
 
+    struct VSIFileInZipInfo : public VSIFileInZipProperties
+    {
+        VSIVirtualHandleUniquePtr poVirtualHandle{};
+    };
+
+    // Cache of the properties of files in archives, to avoid parsing again
+    // the central directory and local headers each time the same file is
+    // opened. Keyed by "zip_filename\nfile_in_zip".
+    struct CachedFileInZipProperties
+    {
+        time_t mTime = 0;
+        vsi_l_offset nArchiveSize = 0;
+        VSIFileInZipProperties oProps{};
+    };
+
+    lru11::Cache<std::string, CachedFileInZipProperties> m_oCacheFileInZip{
+        1024};
+
     bool GetFileInfo(const char *pszFilename, VSIFileInZipInfo &info,
                      bool bSetError);
 
@@ -3555,6 +4696,10 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
     const char *GetOptions() override;
 
     void RemoveFromMap(VSIZipWriteHandle *poHandle);
+
+    int ExtractAll(const char *pszSource, const char *pszTargetDir,
+                   CSLConstList papszOptions, GDALProgressFunc pfnProgress,
+                   void *pProgressData);
 };
 
 /************************************************************************/
@@ -3678,12 +4823,145 @@ VSIZipFilesystemHandler::CreateReader(const char *pszZipFileName)
 {
     auto poReader = std::make_unique<VSIZipReader>(pszZipFileName);
 
-    if (!poReader->IsValid() || !poReader->GotoFirstFile())
+    if (!poReader->IsValid() || !poReader->GotoFirstFile())
+    {
+        return nullptr;
+    }
+
+    return poReader;
+}
+
+/************************************************************************/
+/*                        VSISOZipDecompressor                          */
+/************************************************************************/
+
+// Decompressor of the raw deflate stream of a SOZip chunk.
+class VSISOZipDecompressor
+{
+#ifdef HAVE_LIBDEFLATE
+    struct libdeflate_decompressor *pDecompressor_ = nullptr;
+#else
+    z_stream sStream_{};
+#endif
+    bool bOK_ = true;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSISOZipDecompressor)
+
+  public:
+    VSISOZipDecompressor();
+    ~VSISOZipDecompressor();
+
+    bool IsOK() const
+    {
+        return bOK_;
+    }
+
+    bool Decompress(GByte *pabyCompressed, size_t nCompressedSize,
+                    GByte *pabyOut, size_t nOutSize, vsi_l_offset nPos);
+};
+
+/************************************************************************/
+/*                       VSISOZipDecompressor()                         */
+/************************************************************************/
+
+VSISOZipDecompressor::VSISOZipDecompressor()
+{
+#ifdef HAVE_LIBDEFLATE
+    pDecompressor_ = libdeflate_alloc_decompressor();
+    if (!pDecompressor_)
+        bOK_ = false;
+#else
+    memset(&sStream_, 0, sizeof(sStream_));
+    int err = inflateInit2(&sStream_, -MAX_WBITS);
+    if (err != Z_OK)
+        bOK_ = false;
+#endif
+}
+
+/************************************************************************/
+/*                      ~VSISOZipDecompressor()                         */
+/************************************************************************/
+
+VSISOZipDecompressor::~VSISOZipDecompressor()
+{
+    if (bOK_)
+    {
+#ifdef HAVE_LIBDEFLATE
+        libdeflate_free_decompressor(pDecompressor_);
+#else
+        inflateEnd(&sStream_);
+#endif
+    }
+}
+
+/************************************************************************/
+/*                            Decompress()                              */
+/************************************************************************/
+
+// Decompress a whole chunk, whose size must be exactly nOutSize.
+// pabyCompressed may be modified.
+bool VSISOZipDecompressor::Decompress(GByte *pabyCompressed,
+                                      size_t nCompressedSize, GByte *pabyOut,
+                                      size_t nOutSize, vsi_l_offset nPos)
+{
+    if (nCompressedSize >= 5 && pabyCompressed[nCompressedSize - 5] == 0x00 &&
+        memcmp(&pabyCompressed[nCompressedSize - 4], "\x00\x00\xFF\xFF", 4) ==
+            0)
+    {
+        // Tag this flush block as the last one.
+        pabyCompressed[nCompressedSize - 5] = 0x01;
+    }
+
+#ifdef HAVE_LIBDEFLATE
+    size_t nOut = 0;
+    if (libdeflate_deflate_decompress(pDecompressor_, pabyCompressed,
+                                      nCompressedSize, pabyOut, nOutSize,
+                                      &nOut) != LIBDEFLATE_SUCCESS)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "libdeflate_deflate_decompress() failed at pos " CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(nPos));
+        return false;
+    }
+    if (nOut != nOutSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
+                 " whereas %u where expected",
+                 static_cast<unsigned>(nOut), static_cast<GUIntBig>(nPos),
+                 static_cast<unsigned>(nOutSize));
+        return false;
+    }
+#else
+    sStream_.avail_in = static_cast<uInt>(nCompressedSize);
+    sStream_.next_in = pabyCompressed;
+    sStream_.avail_out = static_cast<uInt>(nOutSize);
+    sStream_.next_out = pabyOut;
+
+    int err = inflate(&sStream_, Z_FINISH);
+    if ((err != Z_OK && err != Z_STREAM_END))
     {
-        return nullptr;
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "inflate() failed at pos " CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(nPos));
+        inflateReset(&sStream_);
+        return false;
     }
-
-    return poReader;
+    if (sStream_.avail_in != 0)
+        CPLDebug("VSIZIP", "avail_in = %d", sStream_.avail_in);
+    if (sStream_.avail_out != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
+                 " whereas %u where expected",
+                 static_cast<unsigned>(nOutSize - sStream_.avail_out),
+                 static_cast<GUIntBig>(nPos), static_cast<unsigned>(nOutSize));
+        inflateReset(&sStream_);
+        return false;
+    }
+    inflateReset(&sStream_);
+#endif
+    return true;
 }
 
 /************************************************************************/
@@ -3702,16 +4980,17 @@ class VSISOZipHandle final : public VSIVirtualHandle
     bool bEOF_ = false;
     bool bError_ = false;
     vsi_l_offset nCurPos_ = 0;
-    bool bOK_ = true;
-#ifdef HAVE_LIBDEFLATE
-    struct libdeflate_decompressor *pDecompressor_ = nullptr;
-#else
-    z_stream sStream_{};
-#endif
+    VSISOZipDecompressor oDecompressor_{};
 
     VSISOZipHandle(const VSISOZipHandle &) = delete;
     VSISOZipHandle &operator=(const VSISOZipHandle &) = delete;
 
+    bool ReadChunkOffsets(uint64_t nFirstChunk, size_t nChunkCount,
+                          std::vector<uint64_t> &anOffsets);
+    bool DecompressChunks(GByte *pabyCompressed,
+                          const std::vector<uint64_t> &anOffsets,
+                          GByte *pabyOut, size_t nToRead);
+
   public:
     VSISOZipHandle(VSIVirtualHandleUniquePtr poVirtualHandleIn,
                    vsi_l_offset nPosCompressedStream, uint64_t compressed_size,
@@ -3753,7 +5032,7 @@ class VSISOZipHandle final : public VSIVirtualHandle
 
     bool IsOK() const
     {
-        return bOK_;
+        return oDecompressor_.IsOK();
     }
 };
 
@@ -3772,16 +5051,6 @@ VSISOZipHandle::VSISOZipHandle(VSIVirtualHandleUniquePtr poVirtualHandleIn,
       compressed_size_(compressed_size), uncompressed_size_(uncompressed_size),
       indexPos_(indexPos), nToSkip_(nToSkip), nChunkSize_(nChunkSize)
 {
-#ifdef HAVE_LIBDEFLATE
-    pDecompressor_ = libdeflate_alloc_decompressor();
-    if (!pDecompressor_)
-        bOK_ = false;
-#else
-    memset(&sStream_, 0, sizeof(sStream_));
-    int err = inflateInit2(&sStream_, -MAX_WBITS);
-    if (err != Z_OK)
-        bOK_ = false;
-#endif
 }
 
 /************************************************************************/
@@ -3791,14 +5060,6 @@ VSISOZipHandle::VSISOZipHandle(VSIVirtualHandleUniquePtr poVirtualHandleIn,
 VSISOZipHandle::~VSISOZipHandle()
 {
     VSISOZipHandle::Close();
-    if (bOK_)
-    {
-#ifdef HAVE_LIBDEFLATE
-        libdeflate_free_decompressor(pDecompressor_);
-#else
-        inflateEnd(&sStream_);
-#endif
-    }
 }
 
 /************************************************************************/
@@ -3832,6 +5093,121 @@ int VSISOZipHandle::Seek(vsi_l_offset nOffset, int nWhence)
     return 0;
 }
 
+/************************************************************************/
+/*                          ReadChunkOffsets()                          */
+/************************************************************************/
+
+// Fill anOffsets[] with the offsets in the compressed stream of the
+// nChunkCount + 1 chunks starting at nFirstChunk, with a single read in the
+// index.
+bool VSISOZipHandle::ReadChunkOffsets(uint64_t nFirstChunk, size_t nChunkCount,
+                                      std::vector<uint64_t> &anOffsets)
+{
+    const uint64_t nTotalChunks = 1 + (uncompressed_size_ - 1) / nChunkSize_;
+    anOffsets.resize(nChunkCount + 1);
+
+    // Chunk 0 starts at offset 0 and the end of the last chunk is the
+    // end of the compressed stream. Other offsets are in the index.
+    const uint64_t nFirstInIndex = std::max<uint64_t>(1, nFirstChunk);
+    const uint64_t nLastInIndex =
+        std::min<uint64_t>(nTotalChunks - 1, nFirstChunk + nChunkCount);
+    if (nFirstInIndex <= nLastInIndex)
+    {
+        constexpr size_t nOffsetSize = 8;
+        const size_t nCount =
+            static_cast<size_t>(nLastInIndex - nFirstInIndex + 1);
+        if (poBaseHandle_->Seek(indexPos_ + 32 + nToSkip_ +
+                                    (nFirstInIndex - 1) * nOffsetSize,
+                                SEEK_SET) != 0 ||
+            poBaseHandle_->Read(&anOffsets[static_cast<size_t>(
+                                    nFirstInIndex - nFirstChunk)],
+                                nOffsetSize, nCount) != nCount)
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i <= nChunkCount; ++i)
+    {
+        const uint64_t nChunkIdx = nFirstChunk + i;
+        if (nChunkIdx == 0)
+            anOffsets[i] = 0;
+        else if (nChunkIdx == nTotalChunks)
+            anOffsets[i] = compressed_size_;
+        else
+            CPL_LSBPTR64(&anOffsets[i]);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          DecompressChunks()                          */
+/************************************************************************/
+
+// Decompress the chunks whose compressed data, starting at anOffsets[0],
+// is in pabyCompressed. Chunks are dispatched among worker threads when
+// there are several of them.
+bool VSISOZipHandle::DecompressChunks(GByte *pabyCompressed,
+                                      const std::vector<uint64_t> &anOffsets,
+                                      GByte *pabyOut, size_t nToRead)
+{
+    const size_t nChunkCount = anOffsets.size() - 1;
+    const vsi_l_offset nStartPos = nCurPos_;
+    const auto DecompressRange =
+        [this, pabyCompressed, &anOffsets, pabyOut, nToRead,
+         nStartPos](VSISOZipDecompressor &oDecompressor, size_t iStart,
+                    size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const size_t nOutOffset = i * nChunkSize_;
+            if (!oDecompressor.Decompress(
+                    pabyCompressed +
+                        static_cast<size_t>(anOffsets[i] - anOffsets[0]),
+                    static_cast<size_t>(anOffsets[i + 1] - anOffsets[i]),
+                    pabyOut + nOutOffset,
+                    std::min<size_t>(nToRead - nOutOffset, nChunkSize_),
+                    nStartPos + nOutOffset))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    const int nThreads = nChunkCount >= 2 ? VSIGZipGetNumThreads() : 1;
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!poThreadPool)
+        return DecompressRange(oDecompressor_, 0, nChunkCount);
+
+    const size_t nJobs = std::min<size_t>(nThreads, nChunkCount);
+    std::vector<int> abSuccess(nJobs, FALSE);
+    CPLErrorAccumulator oErrorAccumulator;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for (size_t iJob = 0; iJob < nJobs; ++iJob)
+    {
+        const size_t iStart = iJob * nChunkCount / nJobs;
+        const size_t iEnd = (iJob + 1) * nChunkCount / nJobs;
+        int *pbSuccess = &abSuccess[iJob];
+        auto job = [&DecompressRange, &oErrorAccumulator, iStart, iEnd,
+                    pbSuccess]()
+        {
+            auto oContext = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oContext);
+            VSISOZipDecompressor oDecompressor;
+            *pbSuccess = oDecompressor.IsOK() &&
+                         DecompressRange(oDecompressor, iStart, iEnd);
+        };
+        if (!poJobQueue->SubmitJob(job))
+            job();
+    }
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    return std::find(abSuccess.begin(), abSuccess.end(), FALSE) ==
+           abSuccess.end();
+}
+
 /************************************************************************/
 /*                              Read()                                  */
 /************************************************************************/
@@ -3871,162 +5247,92 @@ size_t VSISOZipHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
         return 0;
     }
 
-    const auto ReadOffsetInCompressedStream =
-        [this](uint64_t nChunkIdx) -> uint64_t
-    {
-        if (nChunkIdx == 0)
-            return 0;
-        if (nChunkIdx == 1 + (uncompressed_size_ - 1) / nChunkSize_)
-            return compressed_size_;
-        constexpr size_t nOffsetSize = 8;
-        if (poBaseHandle_->Seek(indexPos_ + 32 + nToSkip_ +
-                                    (nChunkIdx - 1) * nOffsetSize,
-                                SEEK_SET) != 0)
-            return static_cast<uint64_t>(-1);
-
-        uint64_t nOffset;
-        if (poBaseHandle_->Read(&nOffset, sizeof(nOffset), 1) != 1)
-            return static_cast<uint64_t>(-1);
-        CPL_LSBPTR64(&nOffset);
-        return nOffset;
-    };
+    // Process the request by batches of chunks, whose offsets and compressed
+    // data are each fetched with a single read, so as to limit the number of
+    // I/O requests and the memory used by the compressed data.
+    constexpr size_t MAX_BATCH_UNCOMPRESSED_SIZE = 64 * 1024 * 1024;
+    const size_t nMaxChunksPerBatch =
+        std::max<size_t>(1, MAX_BATCH_UNCOMPRESSED_SIZE / nChunkSize_);
 
+    std::vector<uint64_t> anOffsets;
+    std::vector<GByte> abyCompressedData;
     size_t nOffsetInOutputBuffer = 0;
-    while (true)
+    while (nToRead > 0)
     {
-        uint64_t nOffsetInCompressedStream =
-            ReadOffsetInCompressedStream(nCurPos_ / nChunkSize_);
-        if (nOffsetInCompressedStream == static_cast<uint64_t>(-1))
+        const size_t nChunkCount = std::min(
+            nMaxChunksPerBatch, cpl::div_round_up(nToRead, nChunkSize_));
+        if (!ReadChunkOffsets(nCurPos_ / nChunkSize_, nChunkCount, anOffsets))
         {
             bError_ = true;
             CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read nOffsetInCompressedStream");
-            return 0;
-        }
-        uint64_t nNextOffsetInCompressedStream =
-            ReadOffsetInCompressedStream(1 + nCurPos_ / nChunkSize_);
-        if (nNextOffsetInCompressedStream == static_cast<uint64_t>(-1))
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read nNextOffsetInCompressedStream");
+                     "Cannot read offsets of chunks in compressed stream");
             return 0;
         }
 
-        if (nNextOffsetInCompressedStream <= nOffsetInCompressedStream ||
-            nNextOffsetInCompressedStream - nOffsetInCompressedStream >
-                13 + 2 * nChunkSize_ ||
-            nNextOffsetInCompressedStream > compressed_size_)
+        for (size_t i = 0; i < nChunkCount; ++i)
         {
-            bError_ = true;
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Invalid values for nOffsetInCompressedStream (" CPL_FRMT_GUIB
-                ") / "
-                "nNextOffsetInCompressedStream(" CPL_FRMT_GUIB ")",
-                static_cast<GUIntBig>(nOffsetInCompressedStream),
-                static_cast<GUIntBig>(nNextOffsetInCompressedStream));
-            return 0;
+            const uint64_t nOffsetInCompressedStream = anOffsets[i];
+            const uint64_t nNextOffsetInCompressedStream = anOffsets[i + 1];
+            if (nNextOffsetInCompressedStream <= nOffsetInCompressedStream ||
+                nNextOffsetInCompressedStream - nOffsetInCompressedStream >
+                    13 + 2 * nChunkSize_ ||
+                nNextOffsetInCompressedStream > compressed_size_)
+            {
+                bError_ = true;
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid values for nOffsetInCompressedStream "
+                         "(" CPL_FRMT_GUIB ") / "
+                         "nNextOffsetInCompressedStream(" CPL_FRMT_GUIB ")",
+                         static_cast<GUIntBig>(nOffsetInCompressedStream),
+                         static_cast<GUIntBig>(nNextOffsetInCompressedStream));
+                return 0;
+            }
         }
 
         // CPLDebug("VSIZIP", "Seek to compressed data at offset "
         // CPL_FRMT_GUIB, static_cast<GUIntBig>(nPosCompressedStream_ +
-        // nOffsetInCompressedStream));
-        if (poBaseHandle_->Seek(
-                nPosCompressedStream_ + nOffsetInCompressedStream, SEEK_SET) !=
-            0)
-        {
-            bError_ = true;
-            return 0;
-        }
-
-        const int nCompressedToRead = static_cast<int>(
-            nNextOffsetInCompressedStream - nOffsetInCompressedStream);
-        // CPLDebug("VSIZIP", "nCompressedToRead = %d", nCompressedToRead);
-        std::vector<GByte> abyCompressedData(nCompressedToRead);
-        if (poBaseHandle_->Read(&abyCompressedData[0], nCompressedToRead, 1) !=
-            1)
+        // anOffsets[0]));
+        if (poBaseHandle_->Seek(nPosCompressedStream_ + anOffsets[0],
+                                SEEK_SET) != 0)
         {
             bError_ = true;
             return 0;
         }
 
-        size_t nToReadThisIter =
-            std::min(nToRead, static_cast<size_t>(nChunkSize_));
-
-        if (nCompressedToRead >= 5 &&
-            abyCompressedData[nCompressedToRead - 5] == 0x00 &&
-            memcmp(&abyCompressedData[nCompressedToRead - 4],
-                   "\x00\x00\xFF\xFF", 4) == 0)
+        const size_t nCompressedToRead =
+            static_cast<size_t>(anOffsets.back() - anOffsets[0]);
+        try
         {
-            // Tag this flush block as the last one.
-            abyCompressedData[nCompressedToRead - 5] = 0x01;
+            abyCompressedData.resize(nCompressedToRead);
         }
-
-#ifdef HAVE_LIBDEFLATE
-        size_t nOut = 0;
-        if (libdeflate_deflate_decompress(
-                pDecompressor_, &abyCompressedData[0], nCompressedToRead,
-                static_cast<Bytef *>(pBuffer) + nOffsetInOutputBuffer,
-                nToReadThisIter, &nOut) != LIBDEFLATE_SUCCESS)
+        catch (const std::exception &)
         {
             bError_ = true;
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "libdeflate_deflate_decompress() failed at pos " CPL_FRMT_GUIB,
-                static_cast<GUIntBig>(nCurPos_));
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory in VSISOZipHandle::Read()");
             return 0;
         }
-        if (nOut != nToReadThisIter)
+        if (poBaseHandle_->Read(abyCompressedData.data(), nCompressedToRead,
+                                1) != 1)
         {
             bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
-                     " whereas %u where expected",
-                     static_cast<unsigned>(nOut),
-                     static_cast<GUIntBig>(nCurPos_),
-                     static_cast<unsigned>(nToReadThisIter));
             return 0;
         }
-#else
-        sStream_.avail_in = nCompressedToRead;
-        sStream_.next_in = &abyCompressedData[0];
-        sStream_.avail_out = static_cast<int>(nToReadThisIter);
-        sStream_.next_out =
-            static_cast<Bytef *>(pBuffer) + nOffsetInOutputBuffer;
 
-        int err = inflate(&sStream_, Z_FINISH);
-        if ((err != Z_OK && err != Z_STREAM_END))
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "inflate() failed at pos " CPL_FRMT_GUIB,
-                     static_cast<GUIntBig>(nCurPos_));
-            inflateReset(&sStream_);
-            return 0;
-        }
-        if (sStream_.avail_in != 0)
-            CPLDebug("VSIZIP", "avail_in = %d", sStream_.avail_in);
-        if (sStream_.avail_out != 0)
+        const size_t nToReadThisIter =
+            std::min(nToRead, nChunkCount * nChunkSize_);
+        if (!DecompressChunks(abyCompressedData.data(), anOffsets,
+                              static_cast<GByte *>(pBuffer) +
+                                  nOffsetInOutputBuffer,
+                              nToReadThisIter))
         {
             bError_ = true;
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
-                " whereas %u where expected",
-                static_cast<unsigned>(nToReadThisIter - sStream_.avail_out),
-                static_cast<GUIntBig>(nCurPos_),
-                static_cast<unsigned>(nToReadThisIter));
-            inflateReset(&sStream_);
             return 0;
         }
-        inflateReset(&sStream_);
-#endif
+
         nOffsetInOutputBuffer += nToReadThisIter;
         nCurPos_ += nToReadThisIter;
         nToRead -= nToReadThisIter;
-        if (nToRead == 0)
-            break;
     }
 
     return nCount;
@@ -4058,15 +5364,48 @@ bool VSIZipFilesystemHandler::GetFileInfo(const char *pszFilename,
         }
     }
 
+    VSIFilesystemHandler *poFSHandler =
+        VSIFileManager::GetHandler(zipFilename.get());
+
+    // Reuse the result of a previous parsing of the central directory and
+    // local header, if the archive has not changed since then.
+    const std::string osCacheKey =
+        std::string(zipFilename.get()).append("\n").append(osZipInFileName);
+    VSIStatBufL sStatArchive;
+    const bool bStatArchiveOK = VSIStatL(zipFilename.get(), &sStatArchive) == 0;
+    if (bStatArchiveOK)
+    {
+        std::unique_lock oLock(oMutex);
+        bool bFoundInCache = false;
+        if (const auto poCached = m_oCacheFileInZip.getPtr(osCacheKey))
+        {
+            if (poCached->mTime == static_cast<time_t>(sStatArchive.st_mtime) &&
+                poCached->nArchiveSize ==
+                    static_cast<vsi_l_offset>(sStatArchive.st_size))
+            {
+                static_cast<VSIFileInZipProperties &>(info) =
+                    poCached->oProps;
+                bFoundInCache = true;
+            }
+            else
+            {
+                m_oCacheFileInZip.remove(osCacheKey);
+            }
+        }
+        if (bFoundInCache)
+        {
+            oLock.unlock();
+            info.poVirtualHandle = poFSHandler->Open(zipFilename.get(), "rb");
+            return info.poVirtualHandle != nullptr;
+        }
+    }
+
     auto poReader = OpenArchiveFile(zipFilename.get(), osZipInFileName);
     if (poReader == nullptr)
     {
         return false;
     }
 
-    VSIFilesystemHandler *poFSHandler =
-        VSIFileManager::GetHandler(zipFilename.get());
-
     VSIVirtualHandleUniquePtr poVirtualHandle(
         poFSHandler->Open(zipFilename.get(), "rb"));
 
@@ -4317,6 +5656,16 @@ bool VSIZipFilesystemHandler::GetFileInfo(const char *pszFilename,
 
     info.poVirtualHandle = std::move(poVirtualHandle);
 
+    if (bStatArchiveOK)
+    {
+        CachedFileInZipProperties oCached;
+        oCached.mTime = static_cast<time_t>(sStatArchive.st_mtime);
+        oCached.nArchiveSize = static_cast<vsi_l_offset>(sStatArchive.st_size);
+        oCached.oProps = info;
+        std::unique_lock oLock(oMutex);
+        m_oCacheFileInZip.insert(osCacheKey, oCached);
+    }
+
     return true;
 }
 
@@ -4596,6 +5945,7 @@ VSIZipFilesystemHandler::OpenForWrite_unlocked(const char *pszFilename,
     {
         oFileList.erase(iter);
     }
+    m_oCacheFileInZip.clear();
 
     auto oIter = oMapZipWriteHandles.find(osZipFilename);
     if (oIter != oMapZipWriteHandles.end())
@@ -4727,6 +6077,7 @@ int VSIZipFilesystemHandler::CopyFile(const char *pszSource,
     {
         oFileList.erase(oIterFileList);
     }
+    m_oCacheFileInZip.clear();
 
     const auto oIter = oMapZipWriteHandles.find(osZipFilename);
     if (oIter != oMapZipWriteHandles.end())
@@ -4931,6 +6282,275 @@ void VSIZipWriteHandle::StartNewFile(VSIZipWriteHandle *poSubFile)
     poChildInWriting = poSubFile;
 }
 
+/************************************************************************/
+/*                            ExtractAll()                              */
+/************************************************************************/
+
+int VSIZipFilesystemHandler::ExtractAll(const char *pszSource,
+                                        const char *pszTargetDir,
+                                        CSLConstList papszOptions,
+                                        GDALProgressFunc pfnProgress,
+                                        void *pProgressData)
+{
+    CPLString osDirInArchive;
+    std::unique_ptr<char, VSIFreeReleaser> zipFilename(
+        SplitFilename(pszSource, osDirInArchive, true, true));
+    if (zipFilename == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s", pszSource);
+        return -1;
+    }
+
+    struct EntryToExtract
+    {
+        std::string osNameInArchive{};
+        std::string osRelativeName{};
+        uint64_t nSize = 0;
+        bool bIsDir = false;
+    };
+
+    std::vector<EntryToExtract> aoEntries;
+    bool bFoundDir = osDirInArchive.empty();
+    {
+        std::unique_lock oLock(oMutex);
+        const VSIArchiveContent *content =
+            GetContentOfArchive(zipFilename.get());
+        if (!content)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot list content of %s",
+                     zipFilename.get());
+            return -1;
+        }
+        const std::string osPrefix =
+            osDirInArchive.empty() ? std::string()
+                                   : std::string(osDirInArchive).append("/");
+        for (const auto &entry : content->entries)
+        {
+            if (!osDirInArchive.empty() && entry.fileName == osDirInArchive)
+            {
+                bFoundDir = entry.bIsDir;
+                continue;
+            }
+            if (!cpl::starts_with(entry.fileName, osPrefix))
+                continue;
+            bFoundDir = true;
+            EntryToExtract oEntry;
+            oEntry.osNameInArchive = entry.fileName;
+            oEntry.osRelativeName = entry.fileName.substr(osPrefix.size());
+            oEntry.nSize = entry.uncompressed_size;
+            oEntry.bIsDir = entry.bIsDir;
+
+            // Do not allow entries to escape from the target directory
+            const CPLStringList aosParts(
+                CSLTokenizeString2(oEntry.osRelativeName.c_str(), "/", 0));
+            if (std::find(aosParts.begin(), aosParts.end(),
+                          std::string("..")) != aosParts.end())
+            {
+                CPLError(CE_Warning, CPLE_NotSupported,
+                         "Skipping %s which contains a '..' component",
+                         entry.fileName.c_str());
+                continue;
+            }
+            aoEntries.push_back(std::move(oEntry));
+        }
+    }
+    if (!bFoundDir)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "%s is not a directory", pszSource);
+        return -1;
+    }
+
+    const bool bSkipErrors =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_ERRORS", "NO"));
+    const CPLErr eErrClass = bSkipErrors ? CE_Warning : CE_Failure;
+
+    // Create directories first, so that extraction jobs do not have to care
+    // about them.
+    VSIStatBufL sStat;
+    if (VSIStatL(pszTargetDir, &sStat) != 0 &&
+        VSIMkdirRecursive(pszTargetDir, 0755) != 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create directory %s",
+                 pszTargetDir);
+        return -1;
+    }
+    uint64_t nTotalSize = 0;
+    for (const auto &oEntry : aoEntries)
+    {
+        const std::string osTarget = CPLFormFilenameSafe(
+            pszTargetDir,
+            oEntry.bIsDir ? oEntry.osRelativeName.c_str()
+                          : CPLGetPathSafe(oEntry.osRelativeName.c_str())
+                                .c_str(),
+            nullptr);
+        if (VSIStatL(osTarget.c_str(), &sStat) != 0 &&
+            VSIMkdirRecursive(osTarget.c_str(), 0755) != 0)
+        {
+            CPLError(eErrClass, CPLE_FileIO, "Cannot create directory %s",
+                     osTarget.c_str());
+            if (!bSkipErrors)
+                return -1;
+        }
+        if (!oEntry.bIsDir)
+            nTotalSize += oEntry.nSize + 1;
+    }
+    nTotalSize = std::max<uint64_t>(1, nTotalSize);
+
+    // Process biggest entries first, to balance the load between threads
+    std::vector<const EntryToExtract *> apoFiles;
+    for (const auto &oEntry : aoEntries)
+    {
+        if (!oEntry.bIsDir)
+            apoFiles.push_back(&oEntry);
+    }
+    std::stable_sort(apoFiles.begin(), apoFiles.end(),
+                     [](const EntryToExtract *a, const EntryToExtract *b)
+                     { return a->nSize > b->nSize; });
+
+    std::atomic<uint64_t> nDoneSize{0};
+    std::atomic<bool> bStop{false};
+    std::atomic<bool> bError{false};
+    const std::string osArchiveFilename(zipFilename.get());
+
+    const auto ExtractFile = [this, &osArchiveFilename, pszTargetDir, eErrClass,
+                              &nDoneSize, &bStop](const EntryToExtract &oEntry)
+    {
+        const std::string osSrc = std::string(GetPrefix())
+                                      .append("/{")
+                                      .append(osArchiveFilename)
+                                      .append("}/")
+                                      .append(oEntry.osNameInArchive);
+        const std::string osDst = CPLFormFilenameSafe(
+            pszTargetDir, oEntry.osRelativeName.c_str(), nullptr);
+        auto poSrc = Open(osSrc.c_str(), "rb", false, nullptr);
+        if (!poSrc)
+        {
+            CPLError(eErrClass, CPLE_FileIO, "Cannot open %s", osSrc.c_str());
+            return false;
+        }
+        auto poDst =
+            VSIFilesystemHandler::OpenStatic(osDst.c_str(), "wb", false);
+        if (!poDst)
+        {
+            CPLError(eErrClass, CPLE_FileIO, "Cannot create %s",
+                     osDst.c_str());
+            return false;
+        }
+        constexpr size_t BUFFER_SIZE = 1024 * 1024;
+        std::vector<GByte> abyBuffer(BUFFER_SIZE);
+        uint64_t nRemaining = oEntry.nSize;
+        while (nRemaining > 0 && !bStop)
+        {
+            const size_t nToRead = static_cast<size_t>(
+                std::min<uint64_t>(nRemaining, BUFFER_SIZE));
+            if (poSrc->Read(abyBuffer.data(), 1, nToRead) != nToRead)
+            {
+                CPLError(eErrClass, CPLE_FileIO, "Cannot read %s",
+                         osSrc.c_str());
+                return false;
+            }
+            if (poDst->Write(abyBuffer.data(), 1, nToRead) != nToRead)
+            {
+                CPLError(eErrClass, CPLE_FileIO, "Cannot write %s",
+                         osDst.c_str());
+                return false;
+            }
+            nRemaining -= nToRead;
+            nDoneSize += nToRead;
+        }
+        nDoneSize += 1;
+        if (poDst->Close() != 0)
+        {
+            CPLError(eErrClass, CPLE_FileIO, "Cannot write %s",
+                     osDst.c_str());
+            return false;
+        }
+        return true;
+    };
+
+    const int nThreads =
+        GDALGetNumThreads(papszOptions, "NUM_THREADS", "ALL_CPUS", 128);
+    CPLWorkerThreadPool *poThreadPool = nThreads > 1 && apoFiles.size() > 1
+                                            ? GDALGetGlobalThreadPool(nThreads)
+                                            : nullptr;
+
+    const auto ReportProgress = [pfnProgress, pProgressData, &nDoneSize,
+                                 nTotalSize]()
+    {
+        return !pfnProgress ||
+               pfnProgress(std::min(1.0, static_cast<double>(nDoneSize) /
+                                             static_cast<double>(nTotalSize)),
+                           "", pProgressData);
+    };
+
+    if (!poThreadPool)
+    {
+        for (const auto *poEntry : apoFiles)
+        {
+            if (!ExtractFile(*poEntry))
+            {
+                if (!bSkipErrors)
+                    return -1;
+            }
+            if (!ReportProgress())
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "Interrupted by user");
+                return -1;
+            }
+        }
+        return 0;
+    }
+
+    // Errors are emitted by the worker threads, and replayed by this thread
+    // once all jobs are done.
+    CPLErrorAccumulator oErrorAccumulator;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for (const auto *poEntry : apoFiles)
+    {
+        auto job = [poEntry, &ExtractFile, &oErrorAccumulator, &bStop, &bError,
+                    bSkipErrors]()
+        {
+            if (bStop)
+                return;
+            auto oContext = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oContext);
+            if (!ExtractFile(*poEntry))
+            {
+                bError = true;
+                if (!bSkipErrors)
+                    bStop = true;
+            }
+        };
+        if (!poJobQueue->SubmitJob(job))
+            job();
+    }
+
+    bool bInterrupted = false;
+    while (poJobQueue->WaitEvent())
+    {
+        if (!bInterrupted && !ReportProgress())
+        {
+            bInterrupted = true;
+            bStop = true;
+        }
+    }
+    poJobQueue->WaitCompletion();
+
+    oErrorAccumulator.ReplayErrors();
+
+    if (bInterrupted)
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "Interrupted by user");
+        return -1;
+    }
+    if (!ReportProgress())
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "Interrupted by user");
+        return -1;
+    }
+    return bError && !bSkipErrors ? -1 : 0;
+}
+
 //! @endcond
 
 /************************************************************************/
@@ -4957,6 +6577,57 @@ void VSIInstallZipFileHandler()
     VSIFileManager::InstallHandler("/vsizip/", new VSIZipFilesystemHandler());
 }
 
+/************************************************************************/
+/*                          VSIZipExtractAll()                          */
+/************************************************************************/
+
+/**
+ * \brief Extract all files of a directory of a ZIP archive.
+ *
+ * The files are decompressed concurrently by several threads, which is much
+ * faster than extracting them one after the other for archives with many
+ * files or with SOZip-enabled files.
+ *
+ * Options:
+ * <ul>
+ * <li>NUM_THREADS=integer or ALL_CPUS: number of threads used for the
+ * extraction. Defaults to the value of the GDAL_NUM_THREADS configuration
+ * option, or ALL_CPUS, and limited by GDAL_MAX_NUM_THREADS.</li>
+ * <li>SKIP_ERRORS=YES/NO: whether files that cannot be extracted should be
+ * skipped (with a warning). Defaults to NO.</li>
+ * </ul>
+ *
+ * @param pszSource Directory in a ZIP archive, using the /vsizip/ syntax,
+ *                  e.g "/vsizip/path/to/my.zip" or
+ *                  "/vsizip/path/to/my.zip/subdir". Must not be NULL.
+ * @param pszTargetDir Target directory, created if it does not exist.
+ *                     Must not be NULL.
+ * @param papszOptions NULL terminated list of options, or NULL.
+ * @param pfnProgress Progress callback, or NULL.
+ * @param pProgressData User data of progress callback, or NULL.
+ *
+ * @return 0 on success.
+ * @since GDAL 3.13
+ */
+
+int VSIZipExtractAll(const char *pszSource, const char *pszTargetDir,
+                     CSLConstList papszOptions, GDALProgressFunc pfnProgress,
+                     void *pProgressData)
+{
+    if (!STARTS_WITH_CI(pszSource, "/vsizip/"))
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "%s is not a /vsizip/ filename", pszSource);
+        return -1;
+    }
+    auto poFSHandler = dynamic_cast<VSIZipFilesystemHandler *>(
+        VSIFileManager::GetHandler("/vsizip/"));
+    if (!poFSHandler)
+        return -1;
+    return poFSHandler->ExtractAll(pszSource, pszTargetDir, papszOptions,
+                                   pfnProgress, pProgressData);
+}
+
 /************************************************************************/
 /*                         CPLZLibDeflate()                             */
 /************************************************************************/
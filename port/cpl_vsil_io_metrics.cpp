@@ -0,0 +1,469 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Live I/O metrics of virtual file systems
+ * Author:   NextGIS <info at nextgis dot com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, NextGIS <info at nextgis dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_vsil_io_metrics.h"
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+
+//! @cond Doxygen_Suppress
+
+namespace cpl
+{
+
+namespace
+{
+
+struct FileSystemMetrics : public VSIIOFileSystemMetrics
+{
+    std::map<std::string, std::unique_ptr<VSIIOEndpointMetrics>> oMapHosts{};
+};
+
+struct Registry
+{
+    std::mutex oMutex{};
+    std::map<std::string, std::unique_ptr<FileSystemMetrics>> oMapFileSystems{};
+    std::map<std::string, std::unique_ptr<VSIIOCacheMetrics>> oMapCaches{};
+};
+
+Registry &GetRegistry()
+{
+    // Intentionally leaked, as counters may be updated by threads still
+    // running at process termination.
+    static Registry *poRegistry = new Registry();
+    return *poRegistry;
+}
+
+std::atomic<int> gnEnabled{-1};  // unknown state
+
+thread_local std::string gosCurrentFileSystem;
+
+FileSystemMetrics &GetFileSystemMetrics(Registry &oRegistry,
+                                        const std::string &osFileSystem)
+{
+    auto &poFS = oRegistry.oMapFileSystems[osFileSystem.empty()
+                                               ? std::string("unknown")
+                                               : osFileSystem];
+    if (!poFS)
+        poFS = std::make_unique<FileSystemMetrics>();
+    return *poFS;
+}
+
+std::string GetFileSystemDisplayName(const std::string &osName)
+{
+    std::string osRet(osName);
+    if (!osRet.empty() && osRet[0] == '/')
+        osRet = osRet.substr(1);
+    if (!osRet.empty() && osRet.back() == '/')
+        osRet.pop_back();
+    return osRet;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     VSIIOLatencyHistogram::Add()                     */
+/************************************************************************/
+
+void VSIIOLatencyHistogram::Add(double dfSeconds)
+{
+    const double dfMilliSec = std::max(0.0, dfSeconds * 1000.0);
+    size_t i = 0;
+    while (i < BUCKET_UPPER_BOUNDS_MS.size() &&
+           dfMilliSec > BUCKET_UPPER_BOUNDS_MS[i])
+    {
+        ++i;
+    }
+    m_anCounts[i].fetch_add(1, std::memory_order_relaxed);
+    m_nSumMicroSec.fetch_add(static_cast<uint64_t>(dfMilliSec * 1000.0),
+                             std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                    VSIIOLatencyHistogram::Reset()                    */
+/************************************************************************/
+
+void VSIIOLatencyHistogram::Reset()
+{
+    for (auto &nCount : m_anCounts)
+        nCount.store(0, std::memory_order_relaxed);
+    m_nSumMicroSec.store(0, std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                   VSIIOLatencyHistogram::AsJSON()                    */
+/************************************************************************/
+
+void VSIIOLatencyHistogram::AsJSON(CPLJSONObject &oJSON) const
+{
+    std::array<uint64_t, BUCKET_UPPER_BOUNDS_MS.size() + 1> anCounts;
+    uint64_t nTotal = 0;
+    for (size_t i = 0; i < anCounts.size(); ++i)
+    {
+        anCounts[i] = m_anCounts[i].load(std::memory_order_relaxed);
+        nTotal += anCounts[i];
+    }
+    oJSON.Add("count", nTotal);
+    if (nTotal == 0)
+        return;
+    oJSON.Add("mean", static_cast<double>(m_nSumMicroSec.load(
+                          std::memory_order_relaxed)) /
+                          1000.0 / static_cast<double>(nTotal));
+
+    // Percentiles are approximated by the upper bound of the bucket they
+    // fall in (or the lower bound of the last, unbounded, bucket).
+    const auto GetPercentile = [&anCounts, nTotal](double dfRatio)
+    {
+        const uint64_t nTarget = std::max<uint64_t>(
+            1, static_cast<uint64_t>(dfRatio * static_cast<double>(nTotal)));
+        uint64_t nCumulated = 0;
+        for (size_t i = 0; i < BUCKET_UPPER_BOUNDS_MS.size(); ++i)
+        {
+            nCumulated += anCounts[i];
+            if (nCumulated >= nTarget)
+                return BUCKET_UPPER_BOUNDS_MS[i];
+        }
+        return BUCKET_UPPER_BOUNDS_MS.back();
+    };
+    oJSON.Add("p50", GetPercentile(0.50));
+    oJSON.Add("p90", GetPercentile(0.90));
+    oJSON.Add("p99", GetPercentile(0.99));
+
+    CPLJSONObject oBuckets;
+    for (size_t i = 0; i < anCounts.size(); ++i)
+    {
+        if (anCounts[i] == 0)
+            continue;
+        const std::string osKey =
+            i < BUCKET_UPPER_BOUNDS_MS.size()
+                ? CPLSPrintf("<=%d", BUCKET_UPPER_BOUNDS_MS[i])
+                : CPLSPrintf(">%d", BUCKET_UPPER_BOUNDS_MS.back());
+        oBuckets.Add(osKey, anCounts[i]);
+    }
+    oJSON.Add("buckets", oBuckets);
+}
+
+/************************************************************************/
+/*                       VSIIOMetrics::IsEnabled()                      */
+/************************************************************************/
+
+bool VSIIOMetrics::IsEnabled()
+{
+    int nEnabled = gnEnabled.load(std::memory_order_relaxed);
+    if (nEnabled < 0)
+    {
+        nEnabled =
+            CPLTestBool(CPLGetConfigOption("CPL_VSIL_IO_METRICS", "YES")) ? 1
+                                                                          : 0;
+        gnEnabled.store(nEnabled, std::memory_order_relaxed);
+    }
+    return nEnabled == 1;
+}
+
+/************************************************************************/
+/*                     VSIIOMetrics::GetFileSystem()                    */
+/************************************************************************/
+
+VSIIOFileSystemMetrics *
+VSIIOMetrics::GetFileSystem(const std::string &osFileSystem)
+{
+    auto &oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.oMutex);
+    return &GetFileSystemMetrics(oRegistry, osFileSystem);
+}
+
+/************************************************************************/
+/*                      VSIIOMetrics::GetEndpoint()                     */
+/************************************************************************/
+
+VSIIOEndpointMetrics *VSIIOMetrics::GetEndpoint(const std::string &osFileSystem,
+                                                const std::string &osHost)
+{
+    auto &oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.oMutex);
+    auto &poEndpoint =
+        GetFileSystemMetrics(oRegistry, osFileSystem).oMapHosts[osHost];
+    if (!poEndpoint)
+        poEndpoint = std::make_unique<VSIIOEndpointMetrics>();
+    return poEndpoint.get();
+}
+
+/************************************************************************/
+/*                       VSIIOMetrics::GetCache()                       */
+/************************************************************************/
+
+VSIIOCacheMetrics *VSIIOMetrics::GetCache(const char *pszName)
+{
+    auto &oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.oMutex);
+    auto &poCache = oRegistry.oMapCaches[pszName];
+    if (!poCache)
+        poCache = std::make_unique<VSIIOCacheMetrics>();
+    return poCache.get();
+}
+
+/************************************************************************/
+/*                       VSIIOMetrics::LogRetry()                       */
+/************************************************************************/
+
+void VSIIOMetrics::LogRetry()
+{
+    if (!IsEnabled())
+        return;
+    GetFileSystem(gosCurrentFileSystem)
+        ->nRetries.fetch_add(1, std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                            InFlightRequest                           */
+/************************************************************************/
+
+VSIIOMetrics::InFlightRequest::InFlightRequest()
+{
+    if (IsEnabled())
+    {
+        m_poMetrics = GetFileSystem(gosCurrentFileSystem);
+        m_poMetrics->nInFlight.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+VSIIOMetrics::InFlightRequest::~InFlightRequest()
+{
+    if (m_poMetrics)
+        m_poMetrics->nInFlight.fetch_sub(1, std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/*                         VSIIOMetrics::Reset()                        */
+/************************************************************************/
+
+void VSIIOMetrics::Reset()
+{
+    auto &oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.oMutex);
+    for (auto &kvFS : oRegistry.oMapFileSystems)
+    {
+        // nInFlight is a gauge, and is left untouched.
+        kvFS.second->nRetries = 0;
+        for (auto &kvHost : kvFS.second->oMapHosts)
+        {
+            auto &oEndpoint = *(kvHost.second);
+            oEndpoint.nRequests = 0;
+            oEndpoint.nErrors = 0;
+            oEndpoint.nDownloadedBytes = 0;
+            oEndpoint.nUploadedBytes = 0;
+            oEndpoint.oTimeToFirstByte.Reset();
+            oEndpoint.oTotalTime.Reset();
+        }
+    }
+    for (auto &kvCache : oRegistry.oMapCaches)
+    {
+        kvCache.second->nHits = 0;
+        kvCache.second->nMisses = 0;
+    }
+    gnEnabled = -1;
+}
+
+/************************************************************************/
+/*                VSIIOMetrics::GetReportAsSerializedJSON()             */
+/************************************************************************/
+
+std::string VSIIOMetrics::GetReportAsSerializedJSON()
+{
+    auto &oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.oMutex);
+
+    CPLJSONObject oJSON;
+    oJSON.Add("enabled", IsEnabled());
+
+    CPLJSONObject oFileSystems;
+    for (const auto &kvFS : oRegistry.oMapFileSystems)
+    {
+        CPLJSONObject oFS;
+        oFS.Add("retries", kvFS.second->nRetries.load());
+        oFS.Add("in_flight",
+                static_cast<GInt64>(kvFS.second->nInFlight.load()));
+        CPLJSONObject oHosts;
+        for (const auto &kvHost : kvFS.second->oMapHosts)
+        {
+            const auto &oEndpoint = *(kvHost.second);
+            CPLJSONObject oHost;
+            oHost.Add("requests", oEndpoint.nRequests.load());
+            oHost.Add("errors", oEndpoint.nErrors.load());
+            oHost.Add("downloaded_bytes", oEndpoint.nDownloadedBytes.load());
+            oHost.Add("uploaded_bytes", oEndpoint.nUploadedBytes.load());
+            CPLJSONObject oTTFB;
+            oEndpoint.oTimeToFirstByte.AsJSON(oTTFB);
+            oHost.Add("time_to_first_byte_ms", oTTFB);
+            CPLJSONObject oTotal;
+            oEndpoint.oTotalTime.AsJSON(oTotal);
+            oHost.Add("total_time_ms", oTotal);
+            oHosts.AddNoSplitName(kvHost.first, oHost);
+        }
+        oFS.Add("hosts", oHosts);
+        oFileSystems.AddNoSplitName(GetFileSystemDisplayName(kvFS.first),
+                                    oFS);
+    }
+    oJSON.Add("filesystems", oFileSystems);
+
+    CPLJSONObject oCaches;
+    for (const auto &kvCache : oRegistry.oMapCaches)
+    {
+        CPLJSONObject oCache;
+        const uint64_t nHits = kvCache.second->nHits.load();
+        const uint64_t nMisses = kvCache.second->nMisses.load();
+        oCache.Add("hits", nHits);
+        oCache.Add("misses", nMisses);
+        if (nHits + nMisses > 0)
+        {
+            oCache.Add("hit_ratio", static_cast<double>(nHits) /
+                                        static_cast<double>(nHits + nMisses));
+        }
+        oCaches.Add(kvCache.first, oCache);
+    }
+    oJSON.Add("caches", oCaches);
+
+    return oJSON.Format(CPLJSONObject::PrettyFormat::Pretty);
+}
+
+/************************************************************************/
+/*                 VSIIOMetrics::GetCurrentFileSystem()                 */
+/************************************************************************/
+
+const std::string &VSIIOMetrics::GetCurrentFileSystem()
+{
+    return gosCurrentFileSystem;
+}
+
+/************************************************************************/
+/*                          FileSystemContext                           */
+/************************************************************************/
+
+VSIIOMetrics::FileSystemContext::FileSystemContext(const char *pszName)
+    : m_osPrevious(std::move(gosCurrentFileSystem))
+{
+    gosCurrentFileSystem = pszName;
+}
+
+VSIIOMetrics::FileSystemContext::~FileSystemContext()
+{
+    gosCurrentFileSystem = std::move(m_osPrevious);
+}
+
+}  // namespace cpl
+
+//! @endcond
+
+/************************************************************************/
+/*                         VSIIOMetricsReset()                          */
+/************************************************************************/
+
+/**
+ * \brief Reset the I/O metrics collected so far.
+ *
+ * Counters, latency histograms and cache hit/miss counters are set to zero.
+ * The number of requests in flight is not affected. The value of the
+ * CPL_VSIL_IO_METRICS configuration option will be read again on next
+ * access.
+ *
+ * @since GDAL 3.13
+ */
+
+void VSIIOMetricsReset(void)
+{
+    cpl::VSIIOMetrics::Reset();
+}
+
+/************************************************************************/
+/*                   VSIIOMetricsGetAsSerializedJSON()                  */
+/************************************************************************/
+
+/**
+ * \brief Return live I/O metrics, as a JSON serialized object.
+ *
+ * Contrary to VSINetworkStatsGetAsSerializedJSON(), which must be enabled
+ * before network activity starts, those metrics are collected by default,
+ * unless the CPL_VSIL_IO_METRICS configuration option is set to NO, and can
+ * be queried at any time.
+ *
+ * They contain, for each network file system and host:
+ * <ul>
+ * <li>the number of requests, failed requests (transport error or HTTP
+ *     error code), downloaded and uploaded bytes;</li>
+ * <li>histograms of the time to first byte and of the total time of
+ *     requests, in milliseconds, with approximate 50th, 90th and 99th
+ *     percentiles;</li>
+ * </ul>
+ * as well as the number of retried requests and of requests currently in
+ * flight per file system, and the hit and
+ * miss counters of the /vsicurl/ region cache, the /vsicurl/ disk cache and
+ * of the VSI_CACHE block cache.
+ *
+ * Example of output:
+ * \code{.js}
+ * {
+ *   "enabled":true,
+ *   "filesystems":{
+ *     "vsis3":{
+ *       "retries":1,
+ *       "in_flight":0,
+ *       "hosts":{
+ *         "my_bucket.s3.amazonaws.com":{
+ *           "requests":12,
+ *           "errors":1,
+ *           "downloaded_bytes":1327104,
+ *           "uploaded_bytes":0,
+ *           "time_to_first_byte_ms":{
+ *             "count":12,
+ *             "mean":37.2,
+ *             "p50":50,
+ *             "p90":50,
+ *             "p99":100,
+ *             "buckets":{
+ *               "<=20":3,
+ *               "<=50":8,
+ *               "<=100":1
+ *             }
+ *           },
+ *           "total_time_ms":{
+ *              [...]
+ *           }
+ *         }
+ *       }
+ *     }
+ *   },
+ *   "caches":{
+ *     "vsicurl_region_cache":{
+ *       "hits":150,
+ *       "misses":11,
+ *       "hit_ratio":0.93
+ *     }
+ *   }
+ * }
+ * \endcode
+ *
+ * @param papszOptions Unused.
+ * @return a JSON serialized string to free with VSIFree(), or nullptr
+ * @since GDAL 3.13
+ */
+
+char *VSIIOMetricsGetAsSerializedJSON(CPL_UNUSED CSLConstList papszOptions)
+{
+    return CPLStrdup(cpl::VSIIOMetrics::GetReportAsSerializedJSON().c_str());
+}
@@ -0,0 +1,150 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Live I/O metrics of virtual file systems
+ * Author:   NextGIS <info at nextgis dot com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, NextGIS <info at nextgis dot com>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_VSIL_IO_METRICS_H_INCLUDED
+#define CPL_VSIL_IO_METRICS_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "cpl_port.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+class CPLJSONObject;
+
+namespace cpl
+{
+
+/************************************************************************/
+/*                          VSIIOLatencyHistogram                       */
+/************************************************************************/
+
+/** Lock-free histogram of durations, with buckets of increasing width. */
+class VSIIOLatencyHistogram
+{
+  public:
+    //! Upper bound (in milliseconds) of each bucket, but the last one.
+    static constexpr std::array<int, 14> BUCKET_UPPER_BOUNDS_MS = {
+        1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 30000};
+
+    void Add(double dfSeconds);
+    void Reset();
+    void AsJSON(CPLJSONObject &oJSON) const;
+
+  private:
+    std::array<std::atomic<uint64_t>, BUCKET_UPPER_BOUNDS_MS.size() + 1>
+        m_anCounts{};
+    std::atomic<uint64_t> m_nSumMicroSec{0};
+};
+
+/************************************************************************/
+/*                        VSIIOEndpointMetrics                          */
+/************************************************************************/
+
+/** Metrics of requests to a given host by a given file system. */
+struct VSIIOEndpointMetrics
+{
+    std::atomic<uint64_t> nRequests{0};
+    std::atomic<uint64_t> nErrors{0};
+    std::atomic<uint64_t> nDownloadedBytes{0};
+    std::atomic<uint64_t> nUploadedBytes{0};
+    VSIIOLatencyHistogram oTimeToFirstByte{};
+    VSIIOLatencyHistogram oTotalTime{};
+};
+
+/************************************************************************/
+/*                       VSIIOFileSystemMetrics                         */
+/************************************************************************/
+
+/** Metrics of a file system that are not attributed to a given host. */
+struct VSIIOFileSystemMetrics
+{
+    std::atomic<uint64_t> nRetries{0};
+    std::atomic<int64_t> nInFlight{0};
+};
+
+/************************************************************************/
+/*                          VSIIOCacheMetrics                           */
+/************************************************************************/
+
+/** Hit and miss counters of a cache. */
+struct VSIIOCacheMetrics
+{
+    std::atomic<uint64_t> nHits{0};
+    std::atomic<uint64_t> nMisses{0};
+};
+
+/************************************************************************/
+/*                             VSIIOMetrics                             */
+/************************************************************************/
+
+/** Process-wide registry of I/O metrics.
+ *
+ * Counters are updated with relaxed atomic operations, and the registry
+ * mutex is only taken to look up an endpoint or a cache by its name.
+ * Returned pointers remain valid until the end of the process: Reset()
+ * zeroes the counters but does not remove entries.
+ */
+class VSIIOMetrics
+{
+  public:
+    static bool IsEnabled();
+
+    static VSIIOFileSystemMetrics *
+    GetFileSystem(const std::string &osFileSystem);
+    static VSIIOEndpointMetrics *GetEndpoint(const std::string &osFileSystem,
+                                             const std::string &osHost);
+    static VSIIOCacheMetrics *GetCache(const char *pszName);
+
+    static void LogRetry();
+
+    /** RAII helper to count a request as in flight for the file system the
+     * current thread is operating on. */
+    class InFlightRequest
+    {
+        VSIIOFileSystemMetrics *m_poMetrics = nullptr;
+
+        CPL_DISALLOW_COPY_ASSIGN(InFlightRequest)
+
+      public:
+        InFlightRequest();
+        ~InFlightRequest();
+    };
+
+    static void Reset();
+    static std::string GetReportAsSerializedJSON();
+
+    //! Return the name of the file system the current thread is operating on.
+    static const std::string &GetCurrentFileSystem();
+
+    /** RAII helper to set the file system the current thread is operating
+     * on, to which requests and retries are attributed. */
+    class FileSystemContext
+    {
+        std::string m_osPrevious;
+
+        CPL_DISALLOW_COPY_ASSIGN(FileSystemContext)
+
+      public:
+        explicit FileSystemContext(const char *pszName);
+        ~FileSystemContext();
+    };
+};
+
+}  // namespace cpl
+
+#endif  // DOXYGEN_SKIP
+
+#endif  // CPL_VSIL_IO_METRICS_H_INCLUDED
@@ -60,6 +60,11 @@ class VSIOSSFSHandler final : public IVSIS3LikeFSHandlerWithMultipartUpload
         return "OSS";
     }
 
+    const char *GetConfigOptionPrefix() const override
+    {
+        return "VSIOSS";
+    }
+
     IVSIS3LikeHandleHelper *CreateHandleHelper(const char *pszURI,
                                                bool bAllowNoObject) override;
 
@@ -20,6 +20,7 @@
 #include "cpl_time.h"
 #include "cpl_vsil_curl_priv.h"
 #include "cpl_vsil_curl_class.h"
+#include "gdal_thread_pool.h"
 
 #include <errno.h>
 
@@ -765,6 +766,11 @@ class VSIS3FSHandler final : public IVSIS3LikeFSHandlerWithMultipartUpload
         return "S3";
     }
 
+    const char *GetConfigOptionPrefix() const override
+    {
+        return "VSIS3";
+    }
+
     IVSIS3LikeHandleHelper *CreateHandleHelper(const char *pszURI,
                                                bool bAllowNoObject) override;
 
@@ -892,6 +898,27 @@ VSIMultipartWriteHandle::VSIMultipartWriteHandle(
                  "Cannot allocate working buffer for %s",
                  m_poFS->GetFSPrefix().c_str());
     }
+
+    // Number of parts that can be uploaded in the background while the
+    // caller keeps on writing. Memory consumption is at most
+    // (m_nMaxInFlightParts + 1) * m_nBufferSize.
+    if (poFS->SupportsParallelMultipartUpload() &&
+        poFS->SupportsNonSequentialMultipartUpload())
+    {
+        const char *pszMaxInFlightParts =
+            m_aosOptions.FetchNameValue("MAX_INFLIGHT_PARTS");
+        if (!pszMaxInFlightParts)
+        {
+            pszMaxInFlightParts = VSIGetPathSpecificOption(
+                pszFilename,
+                std::string(poFS->GetConfigOptionPrefix())
+                    .append("_MAX_INFLIGHT_PARTS")
+                    .c_str(),
+                "1");
+        }
+        // Each part in flight is uploaded by its own thread
+        m_nMaxInFlightParts = GDALGetNumThreads(pszMaxInFlightParts, 64);
+    }
 }
 
 /************************************************************************/
@@ -964,6 +991,8 @@ VSIMultipartWriteHandle::~VSIMultipartWriteHandle()
     VSIMultipartWriteHandle::Close();
     delete m_poS3HandleHelper;
     CPLFree(m_pabyBuffer);
+    for (GByte *pabyBuffer : m_apabyFreeBuffers)
+        CPLFree(pabyBuffer);
     CPLFree(m_sWriteFuncHeaderData.pBuffer);
 }
 
@@ -1132,17 +1161,148 @@ bool VSIMultipartWriteHandle::UploadPart()
                  m_poFS->GetDebugKey());
         return false;
     }
-    const std::string osEtag = m_poFS->UploadPart(
+    if (m_nMaxInFlightParts > 1)
+    {
+        const bool bRet = SubmitPartUpload();
+        m_nBufferOff = 0;
+        return bRet;
+    }
+    std::string osEtag = m_poFS->UploadPart(
         m_osFilename, m_nPartNumber, m_osUploadID,
         static_cast<vsi_l_offset>(m_nBufferSize) * (m_nPartNumber - 1),
         m_pabyBuffer, m_nBufferOff, m_poS3HandleHelper, m_oRetryParameters,
         nullptr);
     m_nBufferOff = 0;
-    if (!osEtag.empty())
+    if (osEtag.empty())
+        return false;
+    SetPartETag(m_nPartNumber, std::move(osEtag));
+    return true;
+}
+
+/************************************************************************/
+/*                            SetPartETag()                             */
+/************************************************************************/
+
+void VSIMultipartWriteHandle::SetPartETag(int nPartNumber,
+                                          std::string &&osEtag)
+{
+    // Parts uploaded in the background may complete in any order
+    if (m_aosEtags.size() < static_cast<size_t>(nPartNumber))
+        m_aosEtags.resize(nPartNumber);
+    m_aosEtags[nPartNumber - 1] = std::move(osEtag);
+}
+
+/************************************************************************/
+/*                          SubmitPartUpload()                          */
+/************************************************************************/
+
+/** Upload the current buffer as part m_nPartNumber in a background thread,
+ * and switch to another buffer for subsequent writes.
+ *
+ * Waits for a previously submitted part to be uploaded if there are already
+ * m_nMaxInFlightParts of them in flight.
+ */
+bool VSIMultipartWriteHandle::SubmitPartUpload()
+{
+    if (!m_poJobQueue)
+    {
+        auto poThreadPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poThreadPool->Setup(m_nMaxInFlightParts, nullptr, nullptr,
+                                 /* bWaitallStarted = */ false))
+        {
+            return false;
+        }
+        m_poThreadPool = std::move(poThreadPool);
+        m_poJobQueue = m_poThreadPool->CreateJobQueue();
+        m_poErrorAccumulator = std::make_unique<CPLErrorAccumulator>();
+    }
+
+    m_poJobQueue->WaitCompletion(m_nMaxInFlightParts - 1);
+    GByte *pabyNewBuffer = nullptr;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        if (m_bPartUploadFailed)
+        {
+            // Error messages will be emitted by WaitPartUploads()
+            return false;
+        }
+        if (!m_apabyFreeBuffers.empty())
+        {
+            pabyNewBuffer = m_apabyFreeBuffers.back();
+            m_apabyFreeBuffers.pop_back();
+        }
+    }
+    if (!pabyNewBuffer)
+    {
+        pabyNewBuffer = static_cast<GByte *>(VSIMalloc(m_nBufferSize));
+        if (!pabyNewBuffer)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate working buffer for %s",
+                     m_poFS->GetFSPrefix().c_str());
+            return false;
+        }
+    }
+
+    GByte *pabyPartBuffer = m_pabyBuffer;
+    m_pabyBuffer = pabyNewBuffer;
+    const int nPartNumber = m_nPartNumber;
+    const size_t nPartSize = m_nBufferOff;
+
+    const auto UploadPartJob = [this, pabyPartBuffer, nPartNumber, nPartSize]()
+    {
+        auto oContext = m_poErrorAccumulator->InstallForCurrentScope();
+        CPL_IGNORE_RET_VAL(oContext);
+
+        // The handle helper is modified by UploadPart(), so each part needs
+        // its own one.
+        std::unique_ptr<IVSIS3LikeHandleHelper> poS3HandleHelper(
+            m_poFS->CreateHandleHelper(
+                m_osFilename.c_str() + m_poFS->GetFSPrefix().size(), false));
+        std::string osEtag;
+        if (poS3HandleHelper)
+        {
+            osEtag = m_poFS->UploadPart(
+                m_osFilename, nPartNumber, m_osUploadID,
+                static_cast<vsi_l_offset>(m_nBufferSize) * (nPartNumber - 1),
+                pabyPartBuffer, nPartSize, poS3HandleHelper.get(),
+                m_oRetryParameters, nullptr);
+        }
+
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_apabyFreeBuffers.push_back(pabyPartBuffer);
+        if (osEtag.empty())
+            m_bPartUploadFailed = true;
+        else
+            SetPartETag(nPartNumber, std::move(osEtag));
+    };
+    if (!m_poJobQueue->SubmitJob(UploadPartJob))
     {
-        m_aosEtags.push_back(osEtag);
+        // Should not happen, but in that case run the job synchronously
+        UploadPartJob();
     }
-    return !osEtag.empty();
+    return true;
+}
+
+/************************************************************************/
+/*                          WaitPartUploads()                           */
+/************************************************************************/
+
+/** Wait for all parts uploaded in the background, and forward the errors
+ * they emitted.
+ *
+ * @return false if an upload failed.
+ */
+bool VSIMultipartWriteHandle::WaitPartUploads()
+{
+    if (!m_poJobQueue)
+        return true;
+    m_poJobQueue->WaitCompletion();
+    // Make sure errors are only replayed once
+    m_poErrorAccumulator->ReplayErrors();
+    m_poErrorAccumulator = std::make_unique<CPLErrorAccumulator>();
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    return !m_bPartUploadFailed;
 }
 
 std::string IVSIS3LikeFSHandlerWithMultipartUpload::UploadPart(
@@ -1298,6 +1458,7 @@ size_t VSIMultipartWriteHandle::Write(const void *pBuffer, size_t nSize,
             }
             if (!UploadPart())
             {
+                WaitPartUploads();
                 m_bError = true;
                 return 0;
             }
@@ -1843,6 +2004,10 @@ int VSIMultipartWriteHandle::Close()
         }
         else
         {
+            // The last part is uploaded synchronously
+            m_nMaxInFlightParts = 1;
+            if (!WaitPartUploads())
+                m_bError = true;
             if (m_bError)
             {
                 if (!m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
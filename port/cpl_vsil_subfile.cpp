@@ -52,6 +52,8 @@ class VSISubFileHandle final : public VSIVirtualHandle
     int Eof() override;
     int Error() override;
     int Close() override;
+
+    const void *GetMappedRegion(vsi_l_offset nOffset, size_t nSize) override;
 };
 
 /************************************************************************/
@@ -210,6 +212,21 @@ size_t VSISubFileHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
     return nRet;
 }
 
+/************************************************************************/
+/*                          GetMappedRegion()                           */
+/************************************************************************/
+
+const void *VSISubFileHandle::GetMappedRegion(vsi_l_offset nOffset,
+                                              size_t nSize)
+{
+    if (nSubregionSize != 0 &&
+        (nOffset > nSubregionSize || nSize > nSubregionSize - nOffset))
+    {
+        return nullptr;
+    }
+    return fp->GetMappedRegion(nSubregionOffset + nOffset, nSize);
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
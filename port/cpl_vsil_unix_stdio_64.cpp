@@ -63,6 +63,9 @@
 #ifdef HAVE_PREAD_BSD
 #include <sys/uio.h>
 #endif
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
 
 #if defined(__MACH__) && defined(__APPLE__)
 #define HAS_CASE_INSENSITIVE_FILE_SYSTEM
@@ -71,8 +74,13 @@
 #include <limits.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <new>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -80,6 +88,8 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi_error.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #if defined(UNIX_STDIO_64)
 
@@ -154,6 +164,10 @@ class VSIUnixStdioFilesystemHandler final : public VSIFilesystemHandler
     CPLMutex *hMutex = nullptr;
 #endif
 
+    std::mutex m_oReadThreadPoolMutex{};
+    bool m_bReadThreadPoolInitialized = false;
+    std::unique_ptr<CPLWorkerThreadPool> m_poReadThreadPool{};
+
   public:
     VSIUnixStdioFilesystemHandler() = default;
 #ifdef VSI_COUNT_BYTES_READ
@@ -201,6 +215,8 @@ class VSIUnixStdioFilesystemHandler final : public VSIFilesystemHandler
 #ifdef VSI_COUNT_BYTES_READ
     void AddToTotal(vsi_l_offset nBytes);
 #endif
+
+    CPLWorkerThreadPool *GetReadThreadPool();
 };
 
 /************************************************************************/
@@ -226,12 +242,18 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     // file and thus a call to our Seek(0, SEEK_SET) before a read will be a
     // no-op.
     bool bModeAppendReadWrite = false;
+    VSIUnixStdioFilesystemHandler *poFS = nullptr;
 #ifdef VSI_COUNT_BYTES_READ
     vsi_l_offset nTotalBytesRead = 0;
-    VSIUnixStdioFilesystemHandler *poFS = nullptr;
 #endif
 
     std::string m_osFilename{};
+#ifdef HAVE_MMAP
+    // Whole file mapping, lazily established by GetMappedRegion()
+    void *m_pMappedData = nullptr;
+    size_t m_nMappedSize = 0;
+    bool m_bMappingAttempted = false;
+#endif
 #if defined(__linux)
     bool m_bUnlinkedFile = false;
     bool m_bCancelCreation = false;
@@ -266,6 +288,16 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     bool HasPRead() const override;
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+#endif
+#ifdef HAVE_POSIX_FADVISE
+    void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
+                    const size_t *panSizes) override;
+#endif
+#ifdef HAVE_MMAP
+    const void *GetMappedRegion(vsi_l_offset nOffset, size_t nSize) override;
 #endif
 
     void CancelCreation() override;
@@ -275,18 +307,11 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
 /*                       VSIUnixStdioHandle()                           */
 /************************************************************************/
 
-VSIUnixStdioHandle::VSIUnixStdioHandle(
-#ifndef VSI_COUNT_BYTES_READ
-    CPL_UNUSED
-#endif
-        VSIUnixStdioFilesystemHandler *poFSIn,
-    FILE *fpIn, bool bReadOnlyIn, bool bModeAppendReadWriteIn)
+VSIUnixStdioHandle::VSIUnixStdioHandle(VSIUnixStdioFilesystemHandler *poFSIn,
+                                       FILE *fpIn, bool bReadOnlyIn,
+                                       bool bModeAppendReadWriteIn)
     : fp(fpIn), bReadOnly(bReadOnlyIn),
-      bModeAppendReadWrite(bModeAppendReadWriteIn)
-#ifdef VSI_COUNT_BYTES_READ
-      ,
-      poFS(poFSIn)
-#endif
+      bModeAppendReadWrite(bModeAppendReadWriteIn), poFS(poFSIn)
 {
 }
 
@@ -317,6 +342,15 @@ int VSIUnixStdioHandle::Close()
 
     int ret = 0;
 
+#ifdef HAVE_MMAP
+    if (m_pMappedData)
+    {
+        munmap(m_pMappedData, m_nMappedSize);
+        m_pMappedData = nullptr;
+        m_nMappedSize = 0;
+    }
+#endif
+
 #ifdef __linux
     if (!m_bCancelCreation && !m_osFilename.empty() && m_bUnlinkedFile)
     {
@@ -749,6 +783,57 @@ VSIRangeStatus VSIUnixStdioHandle::GetRangeStatus(vsi_l_offset
 #endif
 }
 
+/************************************************************************/
+/*                          GetMappedRegion()                           */
+/************************************************************************/
+
+#ifdef HAVE_MMAP
+const void *VSIUnixStdioHandle::GetMappedRegion(vsi_l_offset nOffset,
+                                                size_t nSize)
+{
+    // Only read-only handles are mapped, so that pending writes in the
+    // stdio buffer do not need to be taken into account.
+    if (!bReadOnly)
+        return nullptr;
+
+    if (!m_bMappingAttempted)
+    {
+        m_bMappingAttempted = true;
+        if (!CPLTestBool(CPLGetConfigOption("CPL_VSIL_USE_MMAP", "YES")))
+            return nullptr;
+
+        // A file too large to be mapped in the address space will make
+        // fstat() fail with EOVERFLOW when not built with 64-bit offsets.
+        struct stat sStatBuf;
+        if (fstat(fileno(fp), &sStatBuf) != 0 ||
+            !S_ISREG(sStatBuf.st_mode) || sStatBuf.st_size <= 0 ||
+            static_cast<uint64_t>(sStatBuf.st_size) >
+                std::numeric_limits<size_t>::max())
+        {
+            return nullptr;
+        }
+        const size_t nFileSize = static_cast<size_t>(sStatBuf.st_size);
+        void *pData =
+            mmap(nullptr, nFileSize, PROT_READ, MAP_SHARED, fileno(fp), 0);
+        if (pData == MAP_FAILED)
+        {
+            CPLDebug("CPL", "mmap() failed with errno=%d", errno);
+            return nullptr;
+        }
+        m_pMappedData = pData;
+        m_nMappedSize = nFileSize;
+    }
+
+    if (!m_pMappedData || nOffset > m_nMappedSize ||
+        nSize > m_nMappedSize - nOffset)
+    {
+        return nullptr;
+    }
+    return static_cast<const GByte *>(m_pMappedData) +
+           static_cast<size_t>(nOffset);
+}
+#endif
+
 /************************************************************************/
 /*                             HasPRead()                               */
 /************************************************************************/
@@ -772,6 +857,130 @@ size_t VSIUnixStdioHandle::PRead(void *pBuffer, size_t nSize,
     return pread(fileno(fp), pBuffer, nSize, static_cast<off_t>(nOffset));
 #endif
 }
+
+/************************************************************************/
+/*                          ReadMultiRange()                            */
+/************************************************************************/
+
+int VSIUnixStdioHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    // Data pending in the stdio write buffer would not be seen by pread()
+    if (!bReadOnly)
+    {
+        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                                panSizes);
+    }
+
+    // Split large ranges, so that huge sequential reads can also benefit
+    // from several concurrent requests.
+    constexpr size_t PIECE_SIZE = 4 * 1024 * 1024;
+    struct Piece
+    {
+        GByte *pabyData;
+        vsi_l_offset nOffset;
+        size_t nSize;
+    };
+
+    std::vector<Piece> aoPieces;
+    size_t nTotalSize = 0;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        for (size_t nDone = 0; nDone < panSizes[i]; nDone += PIECE_SIZE)
+        {
+            aoPieces.push_back({static_cast<GByte *>(ppData[i]) + nDone,
+                                panOffsets[i] + nDone,
+                                std::min(PIECE_SIZE, panSizes[i] - nDone)});
+        }
+        nTotalSize += panSizes[i];
+    }
+
+    const auto ReadPiece = [this](const Piece &oPiece)
+    {
+        size_t nDone = 0;
+        while (nDone < oPiece.nSize)
+        {
+            const size_t nRead = PRead(oPiece.pabyData + nDone,
+                                       oPiece.nSize - nDone,
+                                       oPiece.nOffset + nDone);
+            if (nRead == 0 || nRead == static_cast<size_t>(-1))
+                return false;
+            nDone += nRead;
+        }
+        return true;
+    };
+
+    // Below that threshold, the overhead of dispatching jobs is likely to
+    // be greater than the gain.
+    constexpr size_t MIN_SIZE_FOR_PARALLEL_READ = 256 * 1024;
+    CPLWorkerThreadPool *poPool =
+        aoPieces.size() >= 2 && nTotalSize >= MIN_SIZE_FOR_PARALLEL_READ
+            ? poFS->GetReadThreadPool()
+            : nullptr;
+    if (!poPool)
+    {
+        for (const auto &oPiece : aoPieces)
+        {
+            if (!ReadPiece(oPiece))
+                return -1;
+        }
+        return 0;
+    }
+
+    // Each job picks the next piece to read, so that the number of
+    // requests in flight is the number of threads of the pool.
+    std::atomic<size_t> nNextPiece{0};
+    std::atomic<bool> bSuccess{true};
+    const auto ReadPieces = [&aoPieces, &nNextPiece, &bSuccess, &ReadPiece]()
+    {
+        while (bSuccess)
+        {
+            const size_t nIdx = nNextPiece++;
+            if (nIdx >= aoPieces.size())
+                break;
+            if (!ReadPiece(aoPieces[nIdx]))
+                bSuccess = false;
+        }
+    };
+
+    auto poQueue = poPool->CreateJobQueue();
+    const size_t nJobs = std::min(
+        aoPieces.size(), static_cast<size_t>(poPool->GetThreadCount()));
+    for (size_t i = 0; i < nJobs; ++i)
+    {
+        if (!poQueue->SubmitJob(ReadPieces))
+            break;
+    }
+    // The current thread also contributes, which also guarantees progress
+    // if no job could be submitted.
+    ReadPieces();
+    poQueue->WaitCompletion();
+
+    return bSuccess ? 0 : -1;
+}
+#endif
+
+/************************************************************************/
+/*                            AdviseRead()                              */
+/************************************************************************/
+
+#ifdef HAVE_POSIX_FADVISE
+void VSIUnixStdioHandle::AdviseRead(int nRanges,
+                                    const vsi_l_offset *panOffsets,
+                                    const size_t *panSizes)
+{
+    // Let the kernel start reading the ranges asynchronously into the page
+    // cache, so that the subsequent reads do not wait for the device one
+    // request at a time.
+    const int fd = fileno(fp);
+    for (int i = 0; i < nRanges; ++i)
+    {
+        CPL_IGNORE_RET_VAL(posix_fadvise(fd, static_cast<off_t>(panOffsets[i]),
+                                         static_cast<off_t>(panSizes[i]),
+                                         POSIX_FADV_WILLNEED));
+    }
+}
 #endif
 
 /************************************************************************/
@@ -798,6 +1007,35 @@ VSIUnixStdioFilesystemHandler::~VSIUnixStdioFilesystemHandler()
 }
 #endif
 
+/************************************************************************/
+/*                         GetReadThreadPool()                          */
+/************************************************************************/
+
+/** Return the thread pool used by VSIUnixStdioHandle::ReadMultiRange(), or
+ * nullptr if concurrent reads are disabled.
+ */
+CPLWorkerThreadPool *VSIUnixStdioFilesystemHandler::GetReadThreadPool()
+{
+    std::lock_guard<std::mutex> oLock(m_oReadThreadPoolMutex);
+    if (!m_bReadThreadPoolInitialized)
+    {
+        m_bReadThreadPoolInitialized = true;
+        const int nThreads = GDALGetNumThreads(
+            CPLGetConfigOption("CPL_VSIL_LOCAL_MULTI_RANGE_NUM_THREADS", "8"),
+            1024);
+        if (nThreads > 1)
+        {
+            auto poPool = std::make_unique<CPLWorkerThreadPool>();
+            if (poPool->Setup(nThreads, nullptr, nullptr,
+                              /* bWaitallStarted = */ false))
+            {
+                m_poReadThreadPool = std::move(poPool);
+            }
+        }
+    }
+    return m_poReadThreadPool.get();
+}
+
 /************************************************************************/
 /*                                Open()                                */
 /************************************************************************/
@@ -841,7 +1079,8 @@ VSIUnixStdioFilesystemHandler::Open(const char *pszFilename,
     if (bReadOnly && CPLTestBool(CPLGetConfigOption("VSI_CACHE", "FALSE")))
     {
         return VSIVirtualHandleUniquePtr(
-            VSICreateCachedFile(poHandle.release()));
+            VSICreateCachedFile(poHandle.release(),
+                                VSI_CACHED_DEFAULT_CHUNK_SIZE, 0, pszFilename));
     }
 
     return VSIVirtualHandleUniquePtr(poHandle.release());
@@ -989,7 +989,8 @@ VSIWin32FilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
         CPLTestBool(CPLGetConfigOption("VSI_CACHE", "FALSE")))
     {
         return VSIVirtualHandleUniquePtr(
-            VSICreateCachedFile(poHandle.release()));
+            VSICreateCachedFile(poHandle.release(),
+                                VSI_CACHED_DEFAULT_CHUNK_SIZE, 0, pszFilename));
     }
 
     return VSIVirtualHandleUniquePtr(poHandle.release());
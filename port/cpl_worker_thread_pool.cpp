@@ -132,6 +132,16 @@ bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
  * @return true in case of success.
  */
 bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
+{
+    return SubmitJobInternal(std::move(task), nullptr);
+}
+
+/************************************************************************/
+/*                          SubmitJobInternal()                         */
+/************************************************************************/
+
+bool CPLWorkerThreadPool::SubmitJobInternal(std::function<void()> task,
+                                            CPLJobQueue *poQueue)
 {
 #ifdef DEBUG
     {
@@ -188,7 +198,7 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
             aWT.emplace_back(std::move(wt));
     }
 
-    jobQueue.emplace(task);
+    jobQueue.push_back(QueuedJob{std::move(task), poQueue});
     nPendingJobs++;
 
     if (psWaitingWorkerThreadsList)
@@ -279,7 +289,7 @@ bool CPLWorkerThreadPool::SubmitJobs(CPLThreadFunc pfnFunc,
             }
         }
 
-        jobQueue.emplace([=] { pfnFunc(pData); });
+        jobQueue.push_back(QueuedJob{[=] { pfnFunc(pData); }, nullptr});
         nPendingJobs++;
     }
 
@@ -488,8 +498,8 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
 #if DEBUG_VERBOSE
             CPLDebug("JOB", "%p got a job", psWorkerThread);
 #endif
-            auto task = std::move(jobQueue.front());
-            jobQueue.pop();
+            auto task = std::move(jobQueue.front().task);
+            jobQueue.pop_front();
             return task;
         }
 
@@ -538,6 +548,47 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
     }
 }
 
+/************************************************************************/
+/*                   IsCurrentThreadWorkerOfThisPool()                  */
+/************************************************************************/
+
+bool CPLWorkerThreadPool::IsCurrentThreadWorkerOfThisPool() const
+{
+    return threadLocalCurrentThreadPool == this;
+}
+
+/************************************************************************/
+/*                           RunQueuedJobOf()                           */
+/************************************************************************/
+
+/** Run in the calling thread the oldest job submitted by poQueue that has
+ * not yet been picked up by a worker thread.
+ *
+ * @return true if a job has been run.
+ */
+bool CPLWorkerThreadPool::RunQueuedJobOf(CPLJobQueue *poQueue)
+{
+    std::function<void()> task;
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        for (auto oIter = jobQueue.begin(); oIter != jobQueue.end(); ++oIter)
+        {
+            if (oIter->poQueue == poQueue)
+            {
+                task = std::move(oIter->task);
+                jobQueue.erase(oIter);
+                break;
+            }
+        }
+    }
+    if (!task)
+        return false;
+
+    task();
+    DeclareJobFinished();
+    return true;
+}
+
 /************************************************************************/
 /*                         CreateJobQueue()                             */
 /************************************************************************/
@@ -619,7 +670,7 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
         DeclareJobFinished();
     };
     // cppcheck-suppress knownConditionTrueFalse
-    return m_poPool->SubmitJob(std::move(lambda));
+    return m_poPool->SubmitJobInternal(std::move(lambda), this);
 }
 
 /************************************************************************/
@@ -627,6 +678,11 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
 /************************************************************************/
 
 /** Wait for completion of part or whole jobs.
+ *
+ * When called from a worker thread of the pool (that is from a job that
+ * submitted nested jobs), the calling thread does not sit idle: it runs the
+ * jobs of this queue that no other worker thread has started yet, and only
+ * blocks for the ones that are already running.
  *
  * @param nMaxRemainingJobs Maximum number of pendings jobs that are allowed
  *                          in the queue after this method has completed. Might
@@ -634,6 +690,20 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
  */
 void CPLJobQueue::WaitCompletion(int nMaxRemainingJobs)
 {
+    if (m_poPool->IsCurrentThreadWorkerOfThisPool())
+    {
+        while (true)
+        {
+            {
+                std::lock_guard<std::mutex> oGuard(m_mutex);
+                if (m_nPendingJobs <= nMaxRemainingJobs)
+                    return;
+            }
+            if (!m_poPool->RunQueuedJobOf(this))
+                break;
+        }
+    }
+
     std::unique_lock<std::mutex> oGuard(m_mutex);
     m_cv.wait(oGuard, [this, nMaxRemainingJobs]
               { return m_nPendingJobs <= nMaxRemainingJobs; });
@@ -649,6 +719,13 @@ void CPLJobQueue::WaitCompletion(int nMaxRemainingJobs)
  */
 bool CPLJobQueue::WaitEvent()
 {
+    if (m_poPool->IsCurrentThreadWorkerOfThisPool() &&
+        m_poPool->RunQueuedJobOf(this))
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        return m_nPendingJobs > 0;
+    }
+
     // NOTE - This isn't quite right. After nPendingJobsBefore is set but before
     // a notification occurs, jobs could be submitted which would increase
     // nPendingJobs, so a job completion may looks like a spurious wakeup.
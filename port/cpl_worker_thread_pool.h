@@ -17,10 +17,10 @@
 #include "cpl_list.h"
 
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <vector>
 
 /**
@@ -68,7 +68,14 @@ class CPL_DLL CPLWorkerThreadPool
     mutable std::mutex m_mutex{};
     std::condition_variable m_cv{};
     volatile CPLWorkerThreadState eState = CPLWTS_OK;
-    std::queue<std::function<void()>> jobQueue;
+
+    struct QueuedJob
+    {
+        std::function<void()> task{};
+        CPLJobQueue *poQueue = nullptr;  // job queue that submitted the job
+    };
+
+    std::deque<QueuedJob> jobQueue;
     int nPendingJobs = 0;
     bool m_bNotifyEvent = false;
 
@@ -82,6 +89,11 @@ class CPL_DLL CPLWorkerThreadPool
     void DeclareJobFinished();
     std::function<void()> GetNextJob(CPLWorkerThread *psWorkerThread);
 
+    friend class CPLJobQueue;
+    bool SubmitJobInternal(std::function<void()> task, CPLJobQueue *poQueue);
+    bool RunQueuedJobOf(CPLJobQueue *poQueue);
+    bool IsCurrentThreadWorkerOfThisPool() const;
+
   public:
     CPLWorkerThreadPool();
     explicit CPLWorkerThreadPool(int nThreads);
@@ -200,6 +200,8 @@ void CPL_STDCALL PyCPLErrorHandler(CPLErr eErrClass, CPLErrorNum err_no, const c
 %rename (HasThreadSupport) wrapper_HasThreadSupport;
 %rename (NetworkStatsReset) VSINetworkStatsReset;
 %rename (NetworkStatsGetAsSerializedJSON) VSINetworkStatsGetAsSerializedJSON;
+%rename (IOMetricsReset) VSIIOMetricsReset;
+%rename (IOMetricsGetAsSerializedJSON) VSIIOMetricsGetAsSerializedJSON;
 
 %apply Pointer NONNULL {const char *pszScope};
 retStringAndCPLFree*
@@ -975,6 +977,9 @@ void VSICurlPartialClearCache( const char* utf8_path );
 void VSINetworkStatsReset();
 retStringAndCPLFree* VSINetworkStatsGetAsSerializedJSON( char** options = NULL );
 
+void VSIIOMetricsReset();
+retStringAndCPLFree* VSIIOMetricsGetAsSerializedJSON( char** options = NULL );
+
 #endif /* !defined(SWIGJAVA) */
 
 %apply (char **CSL) {char **};